@@ -0,0 +1,200 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "BenchmarkSupport.hpp"
+#include <malloc.h>
+#include <new>
+
+namespace ad_rss {
+namespace benchmark {
+
+uint64_t gNewCallCounter{0u};
+
+} // namespace benchmark
+} // namespace ad_rss
+
+void *operator new(std::size_t count)
+{
+  ::ad_rss::benchmark::gNewCallCounter++;
+  void *memory = malloc(count);
+  if (memory == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+  free(memory);
+}
+
+namespace ad_rss {
+namespace benchmark {
+
+// make the code more readable
+using physics::Acceleration;
+using physics::Distance;
+using physics::Duration;
+using physics::ParametricValue;
+using physics::Speed;
+
+namespace {
+
+world::Object createObject(world::ObjectId const objectId, Speed const &speedLon, Speed const &speedLat)
+{
+  world::Object object;
+
+  object.objectId = objectId;
+  object.objectType = world::ObjectType::OtherVehicle;
+  object.velocity.speedLon = speedLon;
+  object.velocity.speedLat = speedLat;
+  object.dynamics.alphaLon.accelMax = Acceleration(3.5);
+  object.dynamics.alphaLon.brakeMax = Acceleration(8.);
+  object.dynamics.alphaLon.brakeMin = Acceleration(4.);
+  object.dynamics.alphaLon.brakeMinCorrect = Acceleration(3.);
+  object.dynamics.alphaLat.accelMax = Acceleration(0.2);
+  object.dynamics.alphaLat.brakeMin = Acceleration(0.8);
+  object.responseTime = Duration(2.);
+
+  return object;
+}
+
+world::RoadArea createRoadArea(uint32_t const laneMatrixSize)
+{
+  world::RoadArea roadArea;
+  for (uint32_t roadSegmentIndex = 0u; roadSegmentIndex < laneMatrixSize; ++roadSegmentIndex)
+  {
+    world::RoadSegment roadSegment;
+    for (uint32_t laneIndex = 0u; laneIndex < laneMatrixSize; ++laneIndex)
+    {
+      world::LaneSegment laneSegment;
+      laneSegment.id = roadSegmentIndex * laneMatrixSize + laneIndex;
+      laneSegment.type = world::LaneSegmentType::Normal;
+      laneSegment.drivingDirection = world::LaneDrivingDirection::Positive;
+      laneSegment.length.minimum = Distance(45.);
+      laneSegment.length.maximum = Distance(50.);
+      laneSegment.width.minimum = Distance(3.5);
+      laneSegment.width.maximum = Distance(4.);
+      roadSegment.push_back(laneSegment);
+    }
+    roadArea.push_back(roadSegment);
+  }
+  return roadArea;
+}
+
+} // namespace
+
+bool withinValidInputRange(BenchmarkParameters const &parameters, std::string &errorMessage)
+{
+  if (parameters.numberOfScenes > 100u)
+  {
+    errorMessage = "the number of scenes has to be within [0, 100]";
+    return false;
+  }
+  if ((parameters.laneMatrixSize < 1u) || (parameters.laneMatrixSize > 20u))
+  {
+    errorMessage = "the lane matrix size has to be within [1, 20]";
+    return false;
+  }
+  if ((parameters.numberOfOccupiedRegions < 1u) || (parameters.numberOfOccupiedRegions > 1000u))
+  {
+    errorMessage = "the number of occupied regions has to be within [1, 1000]";
+    return false;
+  }
+  return true;
+}
+
+world::WorldModel createWorldModel(BenchmarkParameters const &parameters)
+{
+  world::WorldModel worldModel;
+  world::RoadArea const roadArea = createRoadArea(parameters.laneMatrixSize);
+
+  worldModel.egoVehicle = createObject(0u, Speed(15.), Speed(0.));
+  worldModel.egoVehicle.objectType = world::ObjectType::EgoVehicle;
+  worldModel.egoVehicle.responseTime = Duration(1.);
+  {
+    world::OccupiedRegion occupiedRegion;
+    occupiedRegion.segmentId = parameters.laneMatrixSize / 2u;
+    occupiedRegion.lonRange.minimum = ParametricValue(0.);
+    occupiedRegion.lonRange.maximum = ParametricValue(0.1);
+    occupiedRegion.latRange.minimum = ParametricValue(0.3);
+    occupiedRegion.latRange.maximum = ParametricValue(0.7);
+    worldModel.egoVehicle.occupiedRegions.push_back(occupiedRegion);
+  }
+
+  for (uint32_t sceneIndex = 0u; sceneIndex < parameters.numberOfScenes; ++sceneIndex)
+  {
+    world::Scene scene;
+    scene.situationType = situation::SituationType::SameDirection;
+    scene.egoVehicleRoad = roadArea;
+
+    // vary the velocities to cover safe and unsafe situations
+    Speed const speedLat((sceneIndex % 3u == 0u) ? 0. : ((sceneIndex % 3u == 1u) ? 0.5 : -0.5));
+    scene.object = createObject(sceneIndex + 1u, Speed(5. + static_cast<double>(sceneIndex % 10u)), speedLat);
+
+    // distribute the objects over the lane segments in front of the ego vehicle
+    uint32_t laneSegmentId = 0u;
+    if (parameters.laneMatrixSize > 1u)
+    {
+      uint32_t const laneIndex = sceneIndex % parameters.laneMatrixSize;
+      uint32_t const roadSegmentIndex
+        = 1u + (sceneIndex / parameters.laneMatrixSize) % (parameters.laneMatrixSize - 1u);
+      laneSegmentId = roadSegmentIndex * parameters.laneMatrixSize + laneIndex;
+    }
+
+    // the occupied regions split the object into longitudinal slices
+    double const sliceLength = 0.1 / static_cast<double>(parameters.numberOfOccupiedRegions);
+    for (uint32_t regionIndex = 0u; regionIndex < parameters.numberOfOccupiedRegions; ++regionIndex)
+    {
+      world::OccupiedRegion occupiedRegion;
+      occupiedRegion.segmentId = laneSegmentId;
+      occupiedRegion.lonRange.minimum = ParametricValue(0.4 + sliceLength * static_cast<double>(regionIndex));
+      occupiedRegion.lonRange.maximum = ParametricValue(0.4 + sliceLength * static_cast<double>(regionIndex + 1u));
+      occupiedRegion.latRange.minimum = ParametricValue(0.3);
+      occupiedRegion.latRange.maximum = ParametricValue(0.7);
+      scene.object.occupiedRegions.push_back(occupiedRegion);
+    }
+
+    worldModel.scenes.push_back(scene);
+  }
+  worldModel.timeIndex = 1u;
+
+  return worldModel;
+}
+
+} // namespace benchmark
+} // namespace ad_rss
@@ -0,0 +1,184 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace benchmark
+ */
+namespace benchmark {
+
+/**
+ * @brief counts the number of calls to new()
+ *
+ * Reset by the benchmark to count the number of heap allocations of the measured operations.
+ */
+extern uint64_t gNewCallCounter;
+
+/**
+ * @brief the parameters of a benchmark run
+ */
+struct BenchmarkParameters
+{
+  /**
+   * @brief the number of scenes within the world model, each with its own object
+   */
+  uint32_t numberOfScenes{1u};
+
+  /**
+   * @brief the size of the lane matrix: number of road segments and number of lane segments per road segment
+   */
+  uint32_t laneMatrixSize{3u};
+
+  /**
+   * @brief the number of occupied regions of each object
+   */
+  uint32_t numberOfOccupiedRegions{1u};
+
+  /**
+   * @brief the minimum time to spend on the measurement of a single benchmark
+   */
+  std::chrono::nanoseconds minimumMeasurementTime{std::chrono::milliseconds(200)};
+};
+
+/**
+ * @brief the result of a benchmark run
+ */
+struct BenchmarkResult
+{
+  /**
+   * @brief the number of measured operations
+   */
+  uint64_t numberOfOperations{0u};
+
+  /**
+   * @brief the average execution time of an operation in nanoseconds
+   */
+  double nanosecondsPerOperation{0.};
+
+  /**
+   * @brief the average number of heap allocations of an operation
+   */
+  double allocationsPerOperation{0.};
+
+  /**
+   * @brief false if one of the operations reported an error
+   */
+  bool success{false};
+};
+
+/**
+ * @brief check if the benchmark parameters describe a world model within valid input range
+ *
+ * @param[in] parameters the benchmark parameters
+ * @param[out] errorMessage the description of the violation, if any
+ *
+ * @returns true if the parameters are valid
+ */
+bool withinValidInputRange(BenchmarkParameters const &parameters, std::string &errorMessage);
+
+/**
+ * @brief create the world model described by the benchmark parameters
+ *
+ * The ego vehicle road is a lane matrix of laneMatrixSize road segments each consisting of laneMatrixSize lane
+ * segments. The ego vehicle occupies the middle lane of the first road segment. The objects of the scenes are
+ * distributed over the remaining lane segments with varying velocities, each occupying numberOfOccupiedRegions lane
+ * segments.
+ *
+ * @param[in] parameters the benchmark parameters
+ *
+ * @returns the world model
+ */
+world::WorldModel createWorldModel(BenchmarkParameters const &parameters);
+
+/**
+ * @brief measure the execution time and the heap allocations of an operation
+ *
+ * The operation is executed a few times ahead of the measurement to let the internal buffers grow to their required
+ * size. Afterwards, the number of operations is doubled until the measurement takes at least
+ * parameters.minimumMeasurementTime.
+ *
+ * @param[in] parameters the benchmark parameters
+ * @param[in] operation the operation to be measured, returning false on error
+ *
+ * @returns the result of the measurement
+ */
+template <typename Operation> BenchmarkResult measure(BenchmarkParameters const &parameters, Operation &&operation)
+{
+  BenchmarkResult benchmarkResult;
+  benchmarkResult.success = true;
+
+  // warm-up
+  for (uint32_t i = 0u; i < 3u; ++i)
+  {
+    benchmarkResult.success = operation() && benchmarkResult.success;
+  }
+
+  uint64_t numberOfOperations = 1u;
+  for (;;)
+  {
+    gNewCallCounter = 0u;
+    auto const startTime = std::chrono::steady_clock::now();
+    for (uint64_t i = 0u; i < numberOfOperations; ++i)
+    {
+      benchmarkResult.success = operation() && benchmarkResult.success;
+    }
+    auto const measuredTime = std::chrono::steady_clock::now() - startTime;
+    uint64_t const numberOfAllocations = gNewCallCounter;
+
+    if ((measuredTime >= parameters.minimumMeasurementTime) || !benchmarkResult.success)
+    {
+      benchmarkResult.numberOfOperations = numberOfOperations;
+      benchmarkResult.nanosecondsPerOperation
+        = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(measuredTime).count())
+        / static_cast<double>(numberOfOperations);
+      benchmarkResult.allocationsPerOperation
+        = static_cast<double>(numberOfAllocations) / static_cast<double>(numberOfOperations);
+      return benchmarkResult;
+    }
+    numberOfOperations *= 2u;
+  }
+}
+
+} // namespace benchmark
+} // namespace ad_rss
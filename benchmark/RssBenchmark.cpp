@@ -0,0 +1,622 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BenchmarkSupport.hpp"
+#include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/core/RssLogReader.hpp"
+#include "ad_rss/core/RssLogWriter.hpp"
+#include "ad_rss/core/RssResponseResolving.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "physics/Math.hpp"
+#include "physics/MathBatch.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace benchmark {
+
+// make the code more readable
+using physics::CoordinateSystemAxis;
+using physics::Distance;
+using physics::Duration;
+using physics::Speed;
+
+/**
+ * @brief the options of the benchmark run provided by the command line
+ */
+struct BenchmarkOptions
+{
+  std::vector<uint32_t> numberOfScenes{1u, 10u, 100u};
+  std::vector<uint32_t> laneMatrixSizes{3u, 10u};
+  std::vector<uint32_t> numberOfOccupiedRegions{1u, 10u};
+  uint32_t numberOfWorkerThreads{0u};
+  uint32_t minimumMeasurementTimeMs{100u};
+  std::string filter;
+  bool showHelp{false};
+};
+
+/**
+ * @brief signature of a benchmark
+ */
+typedef BenchmarkResult (*BenchmarkFunction)(BenchmarkParameters const &, BenchmarkOptions const &);
+
+/**
+ * @brief extract the situations of the world model described by the parameters as input for the single stages
+ */
+bool extractSituations(BenchmarkParameters const &parameters, situation::SituationVector &situationVector)
+{
+  world::WorldModel const worldModel = createWorldModel(parameters);
+  return core::RssSituationExtraction::extractSituations(worldModel, situationVector);
+}
+
+BenchmarkResult benchmarkCalculateStoppingDistance(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Distance stoppingDistance(0.);
+    for (auto const &situation : situationVector)
+    {
+      result = physics::calculateStoppingDistance(situation.egoVehicleState.velocity.speedLon,
+                                                  situation.egoVehicleState.dynamics.alphaLon.brakeMin,
+                                                  stoppingDistance)
+        && result;
+      result = physics::calculateStoppingDistance(situation.otherVehicleState.velocity.speedLon,
+                                                  situation.otherVehicleState.dynamics.alphaLon.brakeMax,
+                                                  stoppingDistance)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCalculateSpeedAfterResponseTime(BenchmarkParameters const &parameters,
+                                                         BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Speed resultingSpeed(0.);
+    for (auto const &situation : situationVector)
+    {
+      result = physics::calculateSpeedAfterResponseTime(CoordinateSystemAxis::Longitudinal,
+                                                        situation.egoVehicleState.velocity.speedLon,
+                                                        situation.egoVehicleState.dynamics.alphaLon.accelMax,
+                                                        situation.egoVehicleState.responseTime,
+                                                        resultingSpeed)
+        && result;
+      result = physics::calculateSpeedAfterResponseTime(CoordinateSystemAxis::Lateral,
+                                                        situation.otherVehicleState.velocity.speedLat,
+                                                        situation.otherVehicleState.dynamics.alphaLat.accelMax,
+                                                        situation.otherVehicleState.responseTime,
+                                                        resultingSpeed)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCalculateDistanceOffsetAfterResponseTime(BenchmarkParameters const &parameters,
+                                                                  BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Distance distanceOffset(0.);
+    for (auto const &situation : situationVector)
+    {
+      result = physics::calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis::Longitudinal,
+                                                                 situation.egoVehicleState.velocity.speedLon,
+                                                                 situation.egoVehicleState.dynamics.alphaLon.accelMax,
+                                                                 situation.egoVehicleState.responseTime,
+                                                                 distanceOffset)
+        && result;
+      result = physics::calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis::Lateral,
+                                                                 situation.otherVehicleState.velocity.speedLat,
+                                                                 situation.otherVehicleState.dynamics.alphaLat.accelMax,
+                                                                 situation.otherVehicleState.responseTime,
+                                                                 distanceOffset)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCalculateTimeToCoverDistance(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Duration requiredTime(0.);
+    for (auto const &situation : situationVector)
+    {
+      result = physics::calculateTimeToCoverDistance(situation.egoVehicleState.velocity.speedLon,
+                                                     situation.egoVehicleState.responseTime,
+                                                     situation.egoVehicleState.dynamics.alphaLon.accelMax,
+                                                     situation.egoVehicleState.dynamics.alphaLon.brakeMin,
+                                                     situation.relativePosition.longitudinalDistance,
+                                                     requiredTime)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCalculateTimeToCoverDistanceBatch(BenchmarkParameters const &parameters,
+                                                           BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  // same input as benchmarkCalculateTimeToCoverDistance(), but as structure of arrays
+  std::vector<double> speeds;
+  std::vector<double> responseTimes;
+  std::vector<double> accelerations;
+  std::vector<double> decelerations;
+  std::vector<double> distances;
+  for (auto const &situation : situationVector)
+  {
+    speeds.push_back(static_cast<double>(situation.egoVehicleState.velocity.speedLon));
+    responseTimes.push_back(static_cast<double>(situation.egoVehicleState.responseTime));
+    accelerations.push_back(static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.accelMax));
+    decelerations.push_back(static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.brakeMin));
+    distances.push_back(static_cast<double>(situation.relativePosition.longitudinalDistance));
+  }
+  std::vector<double> requiredTimes(speeds.size(), 0.);
+  return measure(parameters, [&]() {
+    return physics::calculateTimeToCoverDistanceBatch(speeds.size(),
+                                                      speeds.data(),
+                                                      responseTimes.data(),
+                                                      accelerations.data(),
+                                                      decelerations.data(),
+                                                      distances.data(),
+                                                      requiredTimes.data());
+  });
+}
+
+BenchmarkResult benchmarkCheckSafeLongitudinalDistanceSameDirection(BenchmarkParameters const &parameters,
+                                                                    BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    for (auto const &situation : situationVector)
+    {
+      result = situation::checkSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
+                                                                     situation.egoVehicleState,
+                                                                     situation.relativePosition.longitudinalDistance,
+                                                                     safeDistance,
+                                                                     isDistanceSafe)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCheckSafeLongitudinalDistanceOppositeDirection(BenchmarkParameters const &parameters,
+                                                                        BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    for (auto const &situation : situationVector)
+    {
+      result
+        = situation::checkSafeLongitudinalDistanceOppositeDirection(situation.egoVehicleState,
+                                                                    situation.otherVehicleState,
+                                                                    situation.relativePosition.longitudinalDistance,
+                                                                    safeDistance,
+                                                                    isDistanceSafe)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkCheckSafeLateralDistance(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  return measure(parameters, [&situationVector]() {
+    bool result = true;
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    for (auto const &situation : situationVector)
+    {
+      result = situation::checkSafeLateralDistance(situation.egoVehicleState,
+                                                   situation.otherVehicleState,
+                                                   situation.relativePosition.lateralDistance,
+                                                   safeDistance,
+                                                   isDistanceSafe)
+        && result;
+    }
+    return result;
+  });
+}
+
+BenchmarkResult benchmarkExtractSituations(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  world::WorldModel const worldModel = createWorldModel(parameters);
+  situation::SituationVector situationVector;
+  return measure(parameters, [&worldModel, &situationVector]() {
+    return core::RssSituationExtraction::extractSituations(worldModel, situationVector);
+  });
+}
+
+BenchmarkResult benchmarkCheckSituations(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  if (!extractSituations(parameters, situationVector))
+  {
+    return BenchmarkResult();
+  }
+  core::RssSituationChecking situationChecking;
+  state::ResponseStateVector responseStateVector;
+  return measure(parameters, [&situationVector, &situationChecking, &responseStateVector]() {
+    // the situation checking requires increasing time indices
+    for (auto &situation : situationVector)
+    {
+      situation.timeIndex++;
+    }
+    return situationChecking.checkSituations(situationVector, responseStateVector);
+  });
+}
+
+BenchmarkResult benchmarkProvideProperResponse(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  situation::SituationVector situationVector;
+  core::RssSituationChecking situationChecking;
+  state::ResponseStateVector responseStateVector;
+  if (!extractSituations(parameters, situationVector)
+      || !situationChecking.checkSituations(situationVector, responseStateVector))
+  {
+    return BenchmarkResult();
+  }
+  core::RssResponseResolving responseResolving;
+  state::ResponseState responseState;
+  return measure(parameters, [&responseStateVector, &responseResolving, &responseState]() {
+    return responseResolving.provideProperResponse(responseStateVector, responseState);
+  });
+}
+
+BenchmarkResult calculateAccelerationRestriction(BenchmarkParameters const &parameters,
+                                                 core::RssCheckConfiguration const &configuration)
+{
+  world::WorldModel worldModel = createWorldModel(parameters);
+  core::RssCheck rssCheck(configuration);
+  world::AccelerationRestriction accelerationRestriction;
+  return measure(parameters, [&worldModel, &rssCheck, &accelerationRestriction]() {
+    worldModel.timeIndex++;
+    return rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction);
+  });
+}
+
+BenchmarkResult benchmarkRssCheck(BenchmarkParameters const &parameters, BenchmarkOptions const &options)
+{
+  core::RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = options.numberOfWorkerThreads;
+  return calculateAccelerationRestriction(parameters, configuration);
+}
+
+BenchmarkResult benchmarkRssCheckIncremental(BenchmarkParameters const &parameters, BenchmarkOptions const &options)
+{
+  core::RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = options.numberOfWorkerThreads;
+  configuration.enableIncrementalEvaluation = true;
+  return calculateAccelerationRestriction(parameters, configuration);
+}
+
+BenchmarkResult benchmarkRssCheckBatchEvaluation(BenchmarkParameters const &parameters, BenchmarkOptions const &options)
+{
+  core::RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = options.numberOfWorkerThreads;
+  configuration.enableBatchEvaluation = true;
+  return calculateAccelerationRestriction(parameters, configuration);
+}
+
+BenchmarkResult benchmarkRssCheckBroadPhase(BenchmarkParameters const &parameters, BenchmarkOptions const &options)
+{
+  core::RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = options.numberOfWorkerThreads;
+  configuration.enableBroadPhaseCulling = true;
+  return calculateAccelerationRestriction(parameters, configuration);
+}
+
+BenchmarkResult benchmarkRssCheckLazyReevaluation(BenchmarkParameters const &parameters,
+                                                  BenchmarkOptions const &options)
+{
+  core::RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = options.numberOfWorkerThreads;
+  configuration.enableLazyReevaluation = true;
+  return calculateAccelerationRestriction(parameters, configuration);
+}
+
+BenchmarkResult benchmarkDecodeLog(BenchmarkParameters const &parameters, BenchmarkOptions const &)
+{
+  // the log is mapped into memory, so the file can be removed right after opening it
+  char const *logFileName = "ad-rss-bench.rsslog";
+  uint32_t const numberOfTicks = 16u;
+  world::WorldModel worldModel = createWorldModel(parameters);
+  core::RssLogWriter writer;
+  bool logWritten = writer.open(logFileName);
+  for (uint32_t i = 0u; i < numberOfTicks; i++)
+  {
+    worldModel.timeIndex++;
+    logWritten = writer.write(worldModel) && logWritten;
+  }
+  logWritten = writer.close() && logWritten;
+  core::RssLogReader reader;
+  bool const logOpened = logWritten && reader.open(logFileName);
+  std::remove(logFileName);
+  if (!logOpened)
+  {
+    return BenchmarkResult();
+  }
+
+  std::size_t tickNumber = 0u;
+  return measure(parameters, [&reader, &worldModel, &tickNumber, numberOfTicks]() {
+    core::RssLogTickView tick;
+    bool const result = reader.getTick(tickNumber, tick);
+    tick.decode(worldModel);
+    tickNumber = (tickNumber + 1u) % numberOfTicks;
+    return result;
+  });
+}
+
+struct Benchmark
+{
+  char const *name;
+  BenchmarkFunction function;
+};
+
+Benchmark const cBenchmarks[] = {
+  {"physics::calculateStoppingDistance", benchmarkCalculateStoppingDistance},
+  {"physics::calculateSpeedAfterResponseTime", benchmarkCalculateSpeedAfterResponseTime},
+  {"physics::calculateDistanceOffsetAfterResponseTime", benchmarkCalculateDistanceOffsetAfterResponseTime},
+  {"physics::calculateTimeToCoverDistance", benchmarkCalculateTimeToCoverDistance},
+  {"physics::calculateTimeToCoverDistanceBatch", benchmarkCalculateTimeToCoverDistanceBatch},
+  {"situation::checkSafeLongitudinalDistanceSameDirection", benchmarkCheckSafeLongitudinalDistanceSameDirection},
+  {"situation::checkSafeLongitudinalDistanceOppositeDirection",
+   benchmarkCheckSafeLongitudinalDistanceOppositeDirection},
+  {"situation::checkSafeLateralDistance", benchmarkCheckSafeLateralDistance},
+  {"core::RssSituationExtraction::extractSituations", benchmarkExtractSituations},
+  {"core::RssSituationChecking::checkSituations", benchmarkCheckSituations},
+  {"core::RssResponseResolving::provideProperResponse", benchmarkProvideProperResponse},
+  {"core::RssCheck::calculateAccelerationRestriction", benchmarkRssCheck},
+  {"core::RssCheck::calculateAccelerationRestriction/incremental", benchmarkRssCheckIncremental},
+  {"core::RssCheck::calculateAccelerationRestriction/batch", benchmarkRssCheckBatchEvaluation},
+  {"core::RssCheck::calculateAccelerationRestriction/broadphase", benchmarkRssCheckBroadPhase},
+  {"core::RssCheck::calculateAccelerationRestriction/lazy", benchmarkRssCheckLazyReevaluation},
+  {"core::RssLogReader::decode", benchmarkDecodeLog},
+};
+
+bool parseValues(std::string const &text, std::vector<uint32_t> &values)
+{
+  values.clear();
+  std::istringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    char *end = nullptr;
+    unsigned long const value = std::strtoul(item.c_str(), &end, 10);
+    if (item.empty() || (*end != '\0') || (value > std::numeric_limits<uint32_t>::max()))
+    {
+      return false;
+    }
+    values.push_back(static_cast<uint32_t>(value));
+  }
+  return !values.empty();
+}
+
+void printUsage()
+{
+  std::cout << "Usage: ad-rss-bench [options]\n"
+            << "  --scenes=<n,...>       number of scenes of the world model (default: 1,10,100)\n"
+            << "  --lanes=<n,...>        lane matrix size: road segments and lanes per road segment (default: 3,10)\n"
+            << "  --regions=<n,...>      number of occupied regions per object (default: 1,10)\n"
+            << "  --threads=<n>          number of worker threads used by RssCheck (default: 0)\n"
+            << "  --min-time-ms=<n>      minimum measurement time per benchmark in ms (default: 100)\n"
+            << "  --filter=<text>        run only the benchmarks containing the text in their name\n"
+            << "  --help                 print this message\n";
+}
+
+bool parseOptions(int argc, char *argv[], BenchmarkOptions &options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const argument(argv[i]);
+    std::size_t const separator = argument.find('=');
+    std::string const key = argument.substr(0u, separator);
+    std::string const value = (separator == std::string::npos) ? std::string() : argument.substr(separator + 1u);
+    std::vector<uint32_t> values;
+
+    bool valid = true;
+    if (key == "--scenes")
+    {
+      valid = parseValues(value, options.numberOfScenes);
+    }
+    else if (key == "--lanes")
+    {
+      valid = parseValues(value, options.laneMatrixSizes);
+    }
+    else if (key == "--regions")
+    {
+      valid = parseValues(value, options.numberOfOccupiedRegions);
+    }
+    else if (key == "--threads")
+    {
+      valid = parseValues(value, values) && (values.size() == 1u);
+      options.numberOfWorkerThreads = valid ? values.front() : 0u;
+    }
+    else if (key == "--min-time-ms")
+    {
+      valid = parseValues(value, values) && (values.size() == 1u);
+      options.minimumMeasurementTimeMs = valid ? values.front() : 0u;
+    }
+    else if (key == "--filter")
+    {
+      options.filter = value;
+    }
+    else if (key == "--help")
+    {
+      options.showHelp = true;
+    }
+    else
+    {
+      valid = false;
+    }
+
+    if (!valid)
+    {
+      std::cerr << "Invalid argument: " << argument << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+int runBenchmarks(BenchmarkOptions const &options)
+{
+  int exitCode = EXIT_SUCCESS;
+
+  std::cout << std::left << std::setw(64) << "benchmark" << std::right << std::setw(8) << "scenes" << std::setw(7)
+            << "lanes" << std::setw(9) << "regions" << std::setw(12) << "operations" << std::setw(14) << "ns/op"
+            << std::setw(12) << "allocs/op"
+            << "\n";
+
+  for (auto const &benchmark : cBenchmarks)
+  {
+    if (std::string(benchmark.name).find(options.filter) == std::string::npos)
+    {
+      continue;
+    }
+
+    for (auto const numberOfScenes : options.numberOfScenes)
+    {
+      for (auto const laneMatrixSize : options.laneMatrixSizes)
+      {
+        for (auto const numberOfOccupiedRegions : options.numberOfOccupiedRegions)
+        {
+          BenchmarkParameters parameters;
+          parameters.numberOfScenes = numberOfScenes;
+          parameters.laneMatrixSize = laneMatrixSize;
+          parameters.numberOfOccupiedRegions = numberOfOccupiedRegions;
+          parameters.minimumMeasurementTime = std::chrono::milliseconds(options.minimumMeasurementTimeMs);
+
+          std::cout << std::left << std::setw(64) << benchmark.name << std::right << std::setw(8) << numberOfScenes
+                    << std::setw(7) << laneMatrixSize << std::setw(9) << numberOfOccupiedRegions;
+
+          std::string errorMessage;
+          if (!withinValidInputRange(parameters, errorMessage))
+          {
+            std::cout << "  skipped: " << errorMessage << std::endl;
+            continue;
+          }
+
+          BenchmarkResult const result = benchmark.function(parameters, options);
+          if (!result.success)
+          {
+            std::cout << "  failed" << std::endl;
+            exitCode = EXIT_FAILURE;
+            continue;
+          }
+
+          std::cout << std::setw(12) << result.numberOfOperations << std::fixed << std::setprecision(1)
+                    << std::setw(14) << result.nanosecondsPerOperation << std::setprecision(2) << std::setw(12)
+                    << result.allocationsPerOperation << std::endl;
+        }
+      }
+    }
+  }
+
+  return exitCode;
+}
+
+} // namespace benchmark
+} // namespace ad_rss
+
+int main(int argc, char *argv[])
+{
+  ::ad_rss::benchmark::BenchmarkOptions options;
+  if (!::ad_rss::benchmark::parseOptions(argc, argv, options))
+  {
+    ::ad_rss::benchmark::printUsage();
+    return EXIT_FAILURE;
+  }
+  if (options.showHelp)
+  {
+    ::ad_rss::benchmark::printUsage();
+    return EXIT_SUCCESS;
+  }
+
+  return ::ad_rss::benchmark::runBenchmarks(options);
+}
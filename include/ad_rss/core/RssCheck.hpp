@@ -34,7 +34,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
+#include "ad_rss/core/RssCheckConfiguration.hpp"
+#include "ad_rss/core/RssEgoCandidate.hpp"
+#include "ad_rss/core/RssTrajectoryRollout.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
 #include "ad_rss/world/AccelerationRestriction.hpp"
 #include "ad_rss/world/WorldModel.hpp"
 
@@ -48,8 +55,18 @@ namespace ad_rss {
  */
 namespace core {
 
+class RssBroadPhase;
 class RssResponseResolving;
+class RssSceneCache;
 class RssSituationChecking;
+class RssTemporalCheck;
+class RssWorkerPool;
+struct RssCheckTickBuffer;
+
+namespace RssSituationExtraction {
+struct ExtractionBuffer;
+struct ParallelExtractionBuffer;
+} // namespace RssSituationExtraction
 
 /**
  * @brief RssCheck
@@ -57,6 +74,10 @@ class RssSituationChecking;
  * Class providing the functionality of the RSS check sequence at once with the RSS world model as input and
  * restrictions of the acceleration for the actuator control as output. This class internally makes use of the
  * RssSituationExtraction, RssSituationChecking, RssResponseResolving and RssResponseTransformation functionality.
+ *
+ * The intermediate results of the processing steps are stored in buffers owned by this class. These are reused
+ * on every call, so that once the buffers have grown to the size required by the world model no further heap
+ * allocations are performed.
  */
 class RssCheck
 {
@@ -66,6 +87,13 @@ public:
    */
   RssCheck();
 
+  /**
+   * @brief constructor
+   *
+   * @param [in] configuration - the configuration of the processing (see RssCheckConfiguration)
+   */
+  explicit RssCheck(RssCheckConfiguration const &configuration);
+
   ~RssCheck();
 
   /**
@@ -79,9 +107,133 @@ public:
   bool calculateAccelerationRestriction(world::WorldModel const &worldModel,
                                         world::AccelerationRestriction &accelerationRestriction);
 
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * Additionally provides the intermediate results of the check. If the world model contains no relevant situation, the
+   * response state vector contains the single "all safe" response state used for the response resolving.
+   *
+   * @param [in] worldModel - the current world model information
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] situationVector - the situations extracted from the world model, scenes culled by the broad-phase
+   * culling are not contained
+   * \param [out] responseStateVector - the response states of the situations
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   * On failure, the situation and response state vectors are cleared.
+   */
+  bool calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        situation::SituationVector &situationVector,
+                                        state::ResponseStateVector &responseStateVector);
+
+  /**
+   * @brief evaluateCandidates
+   *
+   * Evaluates alternative states of the ego vehicle against the same world model. The situations are extracted from
+   * the world model once; for each candidate, the ego vehicle state of the situations is replaced by the candidate
+   * (see RssEgoCandidate) before the situations are checked and the proper response is resolved.
+   *
+   * The world model has to be of the time step following the last call of calculateAccelerationRestriction(). The
+   * candidates are evaluated on copies of the intersection and response resolving state, so the response state of a
+   * candidate is the one calculateAccelerationRestriction() would resolve for the candidate, while the state of this
+   * RssCheck is not changed. The incremental evaluation and the broad-phase culling are not used for the candidates.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] candidates - the candidate states of the ego vehicle
+   * @param [out] candidateResponseStates - the proper response state of each candidate
+   *
+   * @return return true if the response states of all candidates could be calculated, false otherwise.
+   * On failure, the candidate response states are cleared.
+   */
+  bool evaluateCandidates(world::WorldModel const &worldModel,
+                          RssEgoCandidateVector const &candidates,
+                          state::ResponseStateVector &candidateResponseStates);
+
+  /**
+   * @brief checkTrajectoryRollout
+   *
+   * Checks a planned trajectory of the ego vehicle at the future time steps of a rollout. The vehicle states of the
+   * situations are propagated step by step with the kinematics of the rollout (see
+   * RssSituationPrediction::predictSituations()); the non-intersection situations of all steps are then evaluated as
+   * a single batch. The intersection situations and the response resolving are processed step by step on copies of
+   * the intersection and response resolving state, so the state of this RssCheck is not changed.
+   *
+   * The situations have to be the situations of the time step processed last by calculateAccelerationRestriction(),
+   * the steps of the rollout get the following time indices.
+   *
+   * @param [in] situationVector - the current situations
+   * @param [in] rollout - the trajectory rollout
+   * @param [out] rolloutResult - the first dangerous step as well as the proper response state and the safety
+   * margins of each step
+   *
+   * @return return true if all steps could be checked, false otherwise.
+   */
+  bool checkTrajectoryRollout(situation::SituationVector const &situationVector,
+                              RssTrajectoryRollout const &rollout,
+                              RssRolloutResult &rolloutResult);
+
 private:
+  friend class RssTemporalCheck;
+
+  /**
+   * @brief resolve the proper response of the response states and transform it into the acceleration restriction
+   *
+   * If the response state vector is empty, the "all safe" response state is added.
+   */
+  bool resolveResponse(world::WorldModel const &worldModel,
+                       state::ResponseStateVector &responseStateVector,
+                       world::AccelerationRestriction &accelerationRestriction);
+
+  /**
+   * @brief perform the processing steps of a time step not depending on previous time steps
+   *
+   * These are the situation extraction and the stateless situation checks (see
+   * RssSituationChecking::checkStatelessSituations()). The function doesn't modify the state of the RssCheck, so the
+   * stateless stages of different time steps can be performed concurrently on different tick buffers.
+   * The scene cache and the worker pool of the RssCheck are not used. If the broad-phase culling is enabled, the
+   * broad phase of the tick buffer is used.
+   *
+   * @param[in,out] tick the tick buffer providing the world model and receiving the intermediate results
+   */
+  void checkStatelessStages(RssCheckTickBuffer &tick) const;
+
+  /**
+   * @brief perform the processing steps of a time step depending on previous time steps
+   *
+   * These are the stateful situation checks, the response resolving and the response transformation. Has to be called
+   * for the tick buffers in the order of the time steps after checkStatelessStages() of the tick buffer. The results
+   * are identical to calculateAccelerationRestriction() for the world model of the tick buffer.
+   *
+   * @param[in,out] tick the tick buffer receiving the results
+   */
+  void checkStatefulStages(RssCheckTickBuffer &tick);
+
+  /**
+   * @brief prepare a tick buffer according to the configuration of the RssCheck
+   */
+  void initializeTickBuffer(RssCheckTickBuffer &tick) const;
+
+  /**
+   * @brief take over the intersection and response resolving state into the side copies, created on first use
+   */
+  bool assignSideState();
+
   std::unique_ptr<RssResponseResolving> mResponseResolving;
   std::unique_ptr<RssSituationChecking> mSituationChecking;
+  std::unique_ptr<RssSituationExtraction::ExtractionBuffer> mExtractionBuffer;
+  std::unique_ptr<RssWorkerPool> mWorkerPool;
+  std::unique_ptr<RssSituationExtraction::ParallelExtractionBuffer> mParallelExtractionBuffer;
+  std::unique_ptr<RssSceneCache> mSceneCache;
+  std::unique_ptr<RssBroadPhase> mBroadPhase;
+  std::vector<uint8_t> mReusedResponseStates;
+  situation::SituationVector mSituationVector;
+  state::ResponseStateVector mResponseStateVector;
+  std::unique_ptr<RssResponseResolving> mSideResponseResolving;
+  std::unique_ptr<RssSituationChecking> mSideSituationChecking;
+  situation::SituationVector mSideSituationVector;
+  state::ResponseStateVector mSideResponseStateVector;
+  state::ResponseStateVector mSideStepResponseStateVector;
 };
 
 } // namespace core
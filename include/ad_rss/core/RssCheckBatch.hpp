@@ -0,0 +1,121 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ad_rss/world/AccelerationRestriction.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+class RssCheck;
+class RssWorkerPool;
+
+/**
+ * @brief RssCheckBatch
+ *
+ * Class providing the RSS check sequence for a batch of independent world models at once, e.g. the world models of
+ * many ego vehicles within a simulation. Each entry of the batch has its own RssCheck instance, so the state of the
+ * entries is kept independently over time. The entries of a batch are distributed over a fixed pool of worker threads.
+ *
+ * The batch only provides the parallel dispatch: the whole batch is handed to the worker pool at once. The input
+ * validation and the scratch buffers are not shared between the entries, every RssCheck validates its world model and
+ * keeps its own scratch buffers, like a single RssCheck does.
+ */
+class RssCheckBatch
+{
+public:
+  /**
+   * @brief constructor
+   *
+   * @param [in] batchSize - the number of world models within each batch
+   * @param [in] numberOfWorkerThreads - the number of additional worker threads; the calling thread is used, too.
+   */
+  RssCheckBatch(std::size_t const batchSize, uint32_t const numberOfWorkerThreads);
+
+  /**
+   * @brief constructor
+   *
+   * The number of worker threads is derived from the number of available cores.
+   *
+   * @param [in] batchSize - the number of world models within each batch
+   */
+  explicit RssCheckBatch(std::size_t const batchSize);
+
+  ~RssCheckBatch();
+
+  /**
+   * @brief the number of world models within each batch
+   */
+  std::size_t getBatchSize() const;
+
+  /**
+   * @brief calculateAccelerationRestrictions
+   *
+   * The world model at index i is always processed by the same RssCheck instance.
+   *
+   * @param [in] worldModels - the current world models, array of batchSize entries
+   * @param [in] numberOfWorldModels - the number of world models, has to be equal to the batch size
+   * @param [out] accelerationRestrictions - the restrictions on the vehicle acceleration to become RSS safe, array of
+   * batchSize entries
+   * @param [out] checkResults - optional array of batchSize entries receiving the result of every single check. Can be
+   * nullptr.
+   *
+   * @return return true if the acceleration restrictions of all world models could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestrictions(world::WorldModel const *worldModels,
+                                         std::size_t const numberOfWorldModels,
+                                         world::AccelerationRestriction *accelerationRestrictions,
+                                         bool *checkResults);
+
+private:
+  std::vector<std::unique_ptr<RssCheck>> mRssChecks;
+  std::unique_ptr<RssWorkerPool> mWorkerPool;
+  std::vector<uint8_t> mCheckResults;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,124 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "ad_rss/physics/Duration.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssCheckConfiguration
+ *
+ * Configuration of the processing performed by RssCheck.
+ * The default configuration results in the plain sequential processing of all scenes.
+ */
+struct RssCheckConfiguration
+{
+  /**
+   * @brief the number of additional worker threads used to process the scenes of a world model in parallel
+   *
+   * The situation extraction and the checks of the non-intersection situations are distributed over the worker
+   * threads and the calling thread. The results are merged in the order of the scenes, so the output is identical to
+   * the sequential processing. A value of 0 disables the parallel processing.
+   */
+  uint32_t numberOfWorkerThreads{0u};
+
+  /**
+   * @brief enable the incremental evaluation of unchanged scenes
+   *
+   * If enabled, the scenes of the world model are compared against the scenes of the previous call. If the ego vehicle
+   * and a scene (matched by the object id) are exactly identical, the situation and, for non-intersection situations,
+   * the response state of the previous call are reused with the current time index. Intersection situations are
+   * always checked to keep the intersection state consistent. The results are identical to the full evaluation.
+   */
+  bool enableIncrementalEvaluation{false};
+
+  /**
+   * @brief enable the batch evaluation of the non-intersection situations
+   *
+   * If enabled, the same direction and opposite direction situations are grouped by their situation type and the
+   * safe distance calculations of all of them are performed as vectorized batch calculations. The batch evaluation
+   * is performed by the calling thread; worker threads are still used for the situation extraction. The results are
+   * identical to the situation-wise evaluation.
+   */
+  bool enableBatchEvaluation{false};
+
+  /**
+   * @brief enable the broad-phase culling of far away scenes
+   *
+   * If enabled, a cheap lower bound of the longitudinal distance is calculated for same direction and opposite
+   * direction scenes of objects, which are separated from the ego vehicle by whole road segments. If the situation is
+   * longitudinally safe at this bound, the scene is culled: no situation is extracted and checked for it, so the
+   * situations and response states provided by the RssCheck don't contain it. All other scenes are evaluated as usual.
+   * The response resolving treats a culled object like an object seen for the first time once it comes near, so the
+   * acceleration restriction is never less restrictive than the full evaluation.
+   */
+  bool enableBroadPhaseCulling{false};
+
+  /**
+   * @brief enable the lazy re-evaluation of situations far from becoming unsafe
+   *
+   * If enabled, a conservative time-to-unsafe horizon is calculated for each longitudinally safe same direction and
+   * opposite direction situation, based on the worst case accelerations of the vehicles (accelMax towards the other
+   * vehicle, brakeMax otherwise). Until the horizon expires, the situation is not evaluated again as long as its
+   * distance and speeds stay within the bounds reachable by the worst case motion and its other inputs (e.g. the
+   * lateral distance and speeds or the dynamics) are unchanged. The response states of these situations are
+   * longitudinally safe and carry over the lateral states of their last evaluation. The safety decisions and the
+   * acceleration restriction are identical to the full evaluation, but the response states of these situations
+   * report an upper bound of the longitudinal safe distance. Situations are matched by their situation id. The lazy
+   * re-evaluation is not applied by the temporal parallel replay of RssLogReplay.
+   */
+  bool enableLazyReevaluation{false};
+
+  /**
+   * @brief the upper bound of the duration between two consecutive time indices
+   *
+   * Used to convert the time-to-unsafe horizons of the lazy re-evaluation into time steps. The lazy re-evaluation
+   * is disabled if the duration is not positive.
+   */
+  physics::Duration maximumTimeStepDuration{0.1};
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,87 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <vector>
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/world/Dynamics.hpp"
+#include "ad_rss/world/Velocity.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssEgoCandidate
+ *
+ * A candidate state of the ego vehicle evaluated by RssCheck::evaluateCandidates() instead of the ego vehicle state
+ * of the world model, e.g. the state resulting from an alternative maneuver of a behavior planner.
+ */
+struct RssEgoCandidate
+{
+  /**
+   * @brief the velocity of the ego vehicle
+   */
+  world::Velocity velocity;
+
+  /**
+   * @brief the RSS dynamics of the ego vehicle
+   */
+  world::Dynamics dynamics;
+
+  /**
+   * @brief the lateral offset of the ego vehicle position
+   *
+   * The offset is oriented as the lateral speed: a positive offset moves a vehicle at the left of another vehicle
+   * towards the other vehicle. It changes the lateral distance of the situations with the ego vehicle at the left or
+   * at the right of the other vehicle; if the distance becomes negative, the vehicles overlap laterally. Lateral
+   * overlaps are kept, since their extent is not known to the situations.
+   */
+  physics::Distance lateralOffset{0.};
+};
+
+/**
+ * @brief RssEgoCandidateVector
+ */
+typedef std::vector<RssEgoCandidate> RssEgoCandidateVector;
+
+} // namespace core
+} // namespace ad_rss
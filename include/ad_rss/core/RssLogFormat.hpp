@@ -0,0 +1,267 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief Binary log format of world models, situations and response states
+ *
+ * A log file consists of
+ * - the RssLogFileHeader
+ * - the tick records, one per time step, each starting at an 8 byte aligned file offset
+ * - the tick index: an array of RssLogTickIndexEntry, one per tick record in order of increasing time index
+ * - the RssLogFileFooter at the very end of the file, referencing the tick index
+ *
+ * A tick record starts with the RssLogTickRecord followed by the arrays referenced by its RssLogArrayRef members.
+ * All offsets of a RssLogArrayRef are relative to the begin of the tick record, so a tick record can be read in place
+ * without any further information. All values are stored in the byte order of the writing machine, which is
+ * identified by the byteOrderMark of the file header. The record layouts don't contain implicit padding, the
+ * reserved members are written as zero.
+ *
+ * Any change of the layout requires to increase cRssLogVersion.
+ */
+constexpr uint32_t cRssLogVersion = 1u;
+
+/**
+ * @brief the value of RssLogFileHeader::byteOrderMark as written by the machine creating the log
+ */
+constexpr uint32_t cRssLogByteOrderMark = 0x01020304u;
+
+/**
+ * @brief the magic of the file header
+ */
+constexpr char cRssLogFileMagic[8] = {'A', 'D', 'R', 'S', 'S', 'L', 'O', 'G'};
+
+/**
+ * @brief the magic of the file footer
+ */
+constexpr char cRssLogIndexMagic[8] = {'A', 'D', 'R', 'S', 'S', 'I', 'D', 'X'};
+
+/**
+ * @brief the alignment of the tick records and of the arrays within a tick record
+ */
+constexpr std::size_t cRssLogAlignment = 8u;
+
+struct RssLogFileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t reserved[2];
+};
+
+struct RssLogFileFooter
+{
+  uint64_t tickIndexOffset;
+  uint64_t tickCount;
+  uint64_t reserved;
+  char magic[8];
+};
+
+struct RssLogTickIndexEntry
+{
+  uint64_t timeIndex;
+  uint64_t offset;
+  uint64_t size;
+};
+
+/**
+ * @brief reference to an array within a tick record
+ */
+struct RssLogArrayRef
+{
+  uint32_t offset;
+  uint32_t count;
+};
+
+struct RssLogDynamicsRecord
+{
+  double lonAccelMax;
+  double lonBrakeMax;
+  double lonBrakeMin;
+  double lonBrakeMinCorrect;
+  double latAccelMax;
+  double latBrakeMin;
+  double lateralFluctuationMargin;
+};
+
+struct RssLogOccupiedRegionRecord
+{
+  uint64_t segmentId;
+  double lonRangeMinimum;
+  double lonRangeMaximum;
+  double latRangeMinimum;
+  double latRangeMaximum;
+};
+
+struct RssLogObjectRecord
+{
+  uint64_t objectId;
+  int32_t objectType;
+  uint32_t reserved;
+  //! array of RssLogOccupiedRegionRecord
+  RssLogArrayRef occupiedRegions;
+  RssLogDynamicsRecord dynamics;
+  double speedLon;
+  double speedLat;
+  double responseTime;
+};
+
+struct RssLogLaneSegmentRecord
+{
+  uint64_t id;
+  int32_t type;
+  int32_t drivingDirection;
+  double lengthMinimum;
+  double lengthMaximum;
+  double widthMinimum;
+  double widthMaximum;
+};
+
+struct RssLogSceneRecord
+{
+  int32_t situationType;
+  uint32_t reserved;
+  //! array of RssLogArrayRef, one per road segment referencing its array of RssLogLaneSegmentRecord
+  RssLogArrayRef egoVehicleRoad;
+  //! array of RssLogArrayRef, one per road segment referencing its array of RssLogLaneSegmentRecord
+  RssLogArrayRef intersectingRoad;
+  RssLogObjectRecord object;
+};
+
+struct RssLogVehicleStateRecord
+{
+  double speedLon;
+  double speedLat;
+  RssLogDynamicsRecord dynamics;
+  double responseTime;
+  uint8_t hasPriority;
+  uint8_t isInCorrectLane;
+  uint8_t reserved[6];
+  double distanceToEnterIntersection;
+  double distanceToLeaveIntersection;
+};
+
+struct RssLogSituationRecord
+{
+  uint64_t timeIndex;
+  uint64_t situationId;
+  int32_t situationType;
+  int32_t longitudinalPosition;
+  int32_t lateralPosition;
+  uint32_t reserved;
+  double longitudinalDistance;
+  double lateralDistance;
+  RssLogVehicleStateRecord egoVehicleState;
+  RssLogVehicleStateRecord otherVehicleState;
+};
+
+struct RssLogRssStateRecord
+{
+  uint8_t isSafe;
+  uint8_t reserved[3];
+  int32_t response;
+  int32_t responseEvaluator;
+  uint32_t reserved2;
+  double safeDistance;
+  double currentDistance;
+};
+
+struct RssLogResponseStateRecord
+{
+  uint64_t timeIndex;
+  uint64_t situationId;
+  RssLogRssStateRecord longitudinalState;
+  RssLogRssStateRecord lateralStateRight;
+  RssLogRssStateRecord lateralStateLeft;
+};
+
+struct RssLogTickRecord
+{
+  uint64_t timeIndex;
+  //! the size of the whole tick record in bytes
+  uint32_t size;
+  uint32_t reserved;
+  RssLogObjectRecord egoVehicle;
+  //! array of RssLogSceneRecord
+  RssLogArrayRef scenes;
+  //! array of RssLogSituationRecord
+  RssLogArrayRef situations;
+  //! array of RssLogResponseStateRecord
+  RssLogArrayRef responseStates;
+};
+
+static_assert(sizeof(RssLogFileHeader) == 32u, "unexpected padding");
+static_assert(sizeof(RssLogFileFooter) == 32u, "unexpected padding");
+static_assert(sizeof(RssLogTickIndexEntry) == 24u, "unexpected padding");
+static_assert(sizeof(RssLogArrayRef) == 8u, "unexpected padding");
+static_assert(sizeof(RssLogDynamicsRecord) == 56u, "unexpected padding");
+static_assert(sizeof(RssLogOccupiedRegionRecord) == 40u, "unexpected padding");
+static_assert(sizeof(RssLogObjectRecord) == 104u, "unexpected padding");
+static_assert(sizeof(RssLogLaneSegmentRecord) == 48u, "unexpected padding");
+static_assert(sizeof(RssLogSceneRecord) == 128u, "unexpected padding");
+static_assert(sizeof(RssLogVehicleStateRecord) == 104u, "unexpected padding");
+static_assert(sizeof(RssLogSituationRecord) == 256u, "unexpected padding");
+static_assert(sizeof(RssLogRssStateRecord) == 32u, "unexpected padding");
+static_assert(sizeof(RssLogResponseStateRecord) == 112u, "unexpected padding");
+static_assert(sizeof(RssLogTickRecord) == 144u, "unexpected padding");
+
+/**
+ * @brief load a record from the log data
+ *
+ * The data doesn't need to be aligned.
+ */
+template <typename Record> Record loadRssLogRecord(uint8_t const *data)
+{
+  Record record;
+  std::memcpy(&record, data, sizeof(Record));
+  return record;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,367 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ad_rss/core/RssLogFormat.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief reading of a single array element of type Element from its record
+ *
+ * Specialized for all element types of RssLogArrayView.
+ */
+template <typename Element> struct RssLogElement;
+
+/**
+ * @brief view on an array within a tick record
+ *
+ * The elements are read in place on access.
+ */
+template <typename Element> class RssLogArrayView
+{
+public:
+  RssLogArrayView() = default;
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] tickRecord - the begin of the tick record
+   * @param [in] arrayRef - the reference to the array within the tick record
+   */
+  RssLogArrayView(uint8_t const *tickRecord, RssLogArrayRef const &arrayRef)
+    : mTickRecord(tickRecord)
+    , mElements(tickRecord + arrayRef.offset)
+    , mSize(arrayRef.count)
+  {
+  }
+
+  /**
+   * @brief the number of elements of the array
+   */
+  std::size_t size() const
+  {
+    return mSize;
+  }
+
+  /**
+   * @brief check if the array is empty
+   */
+  bool empty() const
+  {
+    return mSize == 0u;
+  }
+
+  /**
+   * @brief read the element at the given index
+   */
+  Element operator[](std::size_t const index) const
+  {
+    return RssLogElement<Element>::read(mTickRecord, mElements + index * RssLogElement<Element>::cRecordSize);
+  }
+
+private:
+  uint8_t const *mTickRecord{nullptr};
+  uint8_t const *mElements{nullptr};
+  std::size_t mSize{0u};
+};
+
+/**
+ * @brief view on the road segments of a road area, each road segment is an array of lane segments
+ */
+using RssLogRoadSegmentView = RssLogArrayView<world::LaneSegment>;
+using RssLogRoadAreaView = RssLogArrayView<RssLogRoadSegmentView>;
+
+/**
+ * @brief view on an object within a tick record
+ */
+class RssLogObjectView
+{
+public:
+  RssLogObjectView() = default;
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] tickRecord - the begin of the tick record
+   * @param [in] objectRecord - the RssLogObjectRecord within the tick record
+   */
+  RssLogObjectView(uint8_t const *tickRecord, uint8_t const *objectRecord)
+    : mTickRecord(tickRecord)
+    , mObjectRecord(objectRecord)
+  {
+  }
+
+  world::ObjectId getObjectId() const;
+  world::ObjectType getObjectType() const;
+  RssLogArrayView<world::OccupiedRegion> getOccupiedRegions() const;
+  world::Dynamics getDynamics() const;
+  world::Velocity getVelocity() const;
+  physics::Duration getResponseTime() const;
+
+  /**
+   * @brief decode the object
+   *
+   * The capacity of the vectors of the object is reused.
+   */
+  void decode(world::Object &object) const;
+
+private:
+  uint8_t const *mTickRecord{nullptr};
+  uint8_t const *mObjectRecord{nullptr};
+};
+
+/**
+ * @brief view on a scene within a tick record
+ */
+class RssLogSceneView
+{
+public:
+  RssLogSceneView() = default;
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] tickRecord - the begin of the tick record
+   * @param [in] sceneRecord - the RssLogSceneRecord within the tick record
+   */
+  RssLogSceneView(uint8_t const *tickRecord, uint8_t const *sceneRecord)
+    : mTickRecord(tickRecord)
+    , mSceneRecord(sceneRecord)
+  {
+  }
+
+  situation::SituationType getSituationType() const;
+  RssLogRoadAreaView getEgoVehicleRoad() const;
+  RssLogRoadAreaView getIntersectingRoad() const;
+  RssLogObjectView getObject() const;
+
+  /**
+   * @brief decode the scene
+   *
+   * The capacity of the vectors of the scene is reused.
+   */
+  void decode(world::Scene &scene) const;
+
+private:
+  uint8_t const *mTickRecord{nullptr};
+  uint8_t const *mSceneRecord{nullptr};
+};
+
+/**
+ * @brief view on a tick record: the world model of one time step plus the situations and response states
+ */
+class RssLogTickView
+{
+public:
+  RssLogTickView() = default;
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] tickRecord - the begin of the tick record, the tick record has to be validated before
+   */
+  explicit RssLogTickView(uint8_t const *tickRecord)
+    : mTickRecord(tickRecord)
+  {
+  }
+
+  physics::TimeIndex getTimeIndex() const;
+  RssLogObjectView getEgoVehicle() const;
+  RssLogArrayView<RssLogSceneView> getScenes() const;
+  RssLogArrayView<situation::Situation> getSituations() const;
+  RssLogArrayView<state::ResponseState> getResponseStates() const;
+
+  /**
+   * @brief decode the world model
+   *
+   * The capacity of the vectors of the world model is reused, so decoding the ticks of a log one after the other into
+   * the same world model doesn't allocate memory in steady state.
+   */
+  void decode(world::WorldModel &worldModel) const;
+
+  /**
+   * @brief decode the situations
+   */
+  void decode(situation::SituationVector &situationVector) const;
+
+  /**
+   * @brief decode the response states
+   */
+  void decode(state::ResponseStateVector &responseStateVector) const;
+
+private:
+  RssLogTickRecord getTickRecord() const;
+
+  uint8_t const *mTickRecord{nullptr};
+};
+
+template <> struct RssLogElement<world::OccupiedRegion>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogOccupiedRegionRecord);
+  static world::OccupiedRegion read(uint8_t const *tickRecord, uint8_t const *record);
+};
+
+template <> struct RssLogElement<world::LaneSegment>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogLaneSegmentRecord);
+  static world::LaneSegment read(uint8_t const *tickRecord, uint8_t const *record);
+};
+
+template <> struct RssLogElement<RssLogRoadSegmentView>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogArrayRef);
+  static RssLogRoadSegmentView read(uint8_t const *tickRecord, uint8_t const *record)
+  {
+    return RssLogRoadSegmentView(tickRecord, loadRssLogRecord<RssLogArrayRef>(record));
+  }
+};
+
+template <> struct RssLogElement<RssLogSceneView>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogSceneRecord);
+  static RssLogSceneView read(uint8_t const *tickRecord, uint8_t const *record)
+  {
+    return RssLogSceneView(tickRecord, record);
+  }
+};
+
+template <> struct RssLogElement<situation::Situation>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogSituationRecord);
+  static situation::Situation read(uint8_t const *tickRecord, uint8_t const *record);
+};
+
+template <> struct RssLogElement<state::ResponseState>
+{
+  static constexpr std::size_t cRecordSize = sizeof(RssLogResponseStateRecord);
+  static state::ResponseState read(uint8_t const *tickRecord, uint8_t const *record);
+};
+
+/**
+ * @brief RssLogReader
+ *
+ * Class providing read access to a log written by RssLogWriter (see RssLogFormat.hpp). The log file is memory mapped
+ * and read in place: the views returned by the reader point into the mapped data and read the values on access,
+ * there are no per element allocations. The tick index of the log allows to seek any time step directly.
+ *
+ * The views stay valid as long as the reader keeps the log open.
+ */
+class RssLogReader
+{
+public:
+  RssLogReader() = default;
+  ~RssLogReader();
+
+  RssLogReader(RssLogReader const &) = delete;
+  RssLogReader &operator=(RssLogReader const &) = delete;
+
+  /**
+   * @brief open the log file by mapping it into memory
+   *
+   * @param [in] fileName - the name of the log file
+   *
+   * @return true if the file could be mapped and contains a valid log header, footer and tick index, false otherwise
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @brief open a log already available in memory
+   *
+   * @param [in] data - the log data, has to stay valid while the log is open
+   * @param [in] size - the size of the log data in bytes
+   *
+   * @return true if the data contains a valid log header, footer and tick index, false otherwise
+   */
+  bool open(uint8_t const *data, std::size_t const size);
+
+  /**
+   * @brief close the log, unmap the log file if mapped
+   */
+  void close();
+
+  /**
+   * @brief the number of ticks within the log
+   */
+  std::size_t getNumberOfTicks() const;
+
+  /**
+   * @brief get the tick with the given number
+   *
+   * The tick record is validated, i.e. all arrays of the record are checked to be located within the record.
+   *
+   * @param [in] tickNumber - the number of the tick within the log, has to be smaller than getNumberOfTicks()
+   * @param [out] tick - the view on the tick
+   *
+   * @return true if the tick is available and valid, false otherwise
+   */
+  bool getTick(std::size_t const tickNumber, RssLogTickView &tick) const;
+
+  /**
+   * @brief find the first tick with a time index not less than the given time index
+   *
+   * @param [in] timeIndex - the time index to search for
+   * @param [out] tickNumber - the number of the tick found
+   *
+   * @return true if such a tick exists, false otherwise
+   */
+  bool findTick(physics::TimeIndex const timeIndex, std::size_t &tickNumber) const;
+
+private:
+  RssLogTickIndexEntry getTickIndexEntry(std::size_t const tickNumber) const;
+
+  uint8_t const *mData{nullptr};
+  std::size_t mSize{0u};
+  void *mMapping{nullptr};
+  uint8_t const *mTickIndex{nullptr};
+  std::size_t mNumberOfTicks{0u};
+};
+
+} // namespace core
+} // namespace ad_rss
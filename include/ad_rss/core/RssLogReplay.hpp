@@ -0,0 +1,207 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "ad_rss/core/RssCheckConfiguration.hpp"
+#include "ad_rss/core/RssLogReader.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "ad_rss/world/AccelerationRestriction.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssLogReplayConfiguration
+ *
+ * Configuration of the replay performed by RssLogReplay.
+ */
+struct RssLogReplayConfiguration
+{
+  /**
+   * @brief the configuration of the RssCheck the ticks are fed through
+   */
+  RssCheckConfiguration checkConfiguration;
+
+  /**
+   * @brief the number of ticks decoded ahead of the check
+   *
+   * If larger than 0, the ticks are decoded by a separate reader thread into a ring of the given number of world
+   * models, so that reading and decoding the log overlaps with the RSS check of the previous ticks. A value of 0
+   * decodes the ticks in the calling thread right before checking them.
+   */
+  uint32_t numberOfReadAheadTicks{8u};
+
+  /**
+   * @brief the number of additional worker threads processing the ticks in parallel across time steps
+   *
+   * If larger than 0, the ticks are replayed in windows of temporalWindowSize ticks: the ticks of a window are decoded,
+   * their situations extracted and the non-intersection situations checked in parallel by the worker threads and the
+   * calling thread, since these steps don't depend on previous time steps. Afterwards, the checks of the intersection
+   * situations and the response resolving, which keep state across time steps, are performed for the ticks of the
+   * window in order. The results are identical to the tick by tick replay.
+   *
+   * In this mode, the read-ahead, the worker threads and the incremental evaluation of the checkConfiguration are not
+   * used. A value of 0 replays tick by tick.
+   */
+  uint32_t numberOfTemporalWorkerThreads{0u};
+
+  /**
+   * @brief the number of ticks processed per window by the temporal parallel replay
+   */
+  uint32_t temporalWindowSize{64u};
+};
+
+/**
+ * @brief RssLogReplayStatistics
+ *
+ * Throughput and latency of a replay.
+ */
+struct RssLogReplayStatistics
+{
+  /**
+   * @brief the number of replayed ticks
+   */
+  std::size_t numberOfTicks{0u};
+
+  /**
+   * @brief the number of ticks which could not be decoded or for which the RSS check failed
+   */
+  std::size_t numberOfFailedTicks{0u};
+
+  /**
+   * @brief the wall clock time of the whole replay in seconds
+   */
+  double durationSeconds{0.};
+
+  /**
+   * @brief the number of replayed ticks per second of wall clock time
+   */
+  double ticksPerSecond{0.};
+
+  /**
+   * @brief the latency percentiles of the RSS check of a single tick in microseconds
+   *
+   * The percentiles are calculated by the nearest-rank method over all replayed ticks. For the temporal parallel
+   * replay, the latency of a tick is its processing time summed over all stages including the decoding.
+   */
+  double latencyMeanMicroseconds{0.};
+  double latencyP50Microseconds{0.};
+  double latencyP90Microseconds{0.};
+  double latencyP99Microseconds{0.};
+  double latencyMaxMicroseconds{0.};
+};
+
+/**
+ * @brief RssLogReplay
+ *
+ * Class replaying the ticks of a log written by RssLogWriter: the world model of each tick is fed in order through one
+ * persistent RssCheck, so the state kept between the time steps (e.g. of intersection situations) evolves as during
+ * the recording. The acceleration restriction, the situations and the per-situation response states of every tick are
+ * passed to a ResultHandler.
+ *
+ * The world models are decoded into buffers owned by the replay which are reused for all ticks, so that the replay
+ * doesn't allocate memory per tick in steady state.
+ */
+class RssLogReplay
+{
+public:
+  /**
+   * @brief interface receiving the results of the replayed ticks
+   */
+  class ResultHandler
+  {
+  public:
+    virtual ~ResultHandler() = default;
+
+    /**
+     * @brief handle the result of a single tick
+     *
+     * Called in the order of the ticks by the thread calling replay(). This function is not allowed to throw.
+     * The references are only valid during the call.
+     *
+     * @param[in] tickNumber the number of the tick within the log
+     * @param[in] worldModel the decoded world model of the tick
+     * @param[in] result true if the tick could be decoded and checked, the other results are only valid in that case
+     * @param[in] accelerationRestriction the acceleration restriction calculated by the RssCheck
+     * @param[in] situationVector the situations extracted from the world model
+     * @param[in] responseStateVector the per-situation response states
+     */
+    virtual void handleResult(std::size_t const tickNumber,
+                              world::WorldModel const &worldModel,
+                              bool const result,
+                              world::AccelerationRestriction const &accelerationRestriction,
+                              situation::SituationVector const &situationVector,
+                              state::ResponseStateVector const &responseStateVector)
+      = 0;
+  };
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] configuration - the configuration of the replay (see RssLogReplayConfiguration)
+   */
+  explicit RssLogReplay(RssLogReplayConfiguration const &configuration = RssLogReplayConfiguration());
+
+  /**
+   * @brief replay all ticks of the log
+   *
+   * A new RssCheck is created for every replay, so the results don't depend on previous replays.
+   *
+   * @param [in] reader - the reader providing the opened log
+   * @param [in] resultHandler - the handler receiving the results of the ticks, may be nullptr
+   * @param [out] statistics - the throughput and latency of the replay
+   *
+   * @return true if the log could be replayed, false if the replay could not be set up. Failing ticks don't stop the
+   * replay, they are reported to the result handler and counted in the statistics.
+   */
+  bool replay(RssLogReader const &reader, ResultHandler *resultHandler, RssLogReplayStatistics &statistics);
+
+private:
+  RssLogReplayConfiguration mConfiguration;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,132 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "ad_rss/core/RssLogFormat.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssLogWriter
+ *
+ * Class writing world models, optionally together with the situations and response states calculated from them, into
+ * a binary log (see RssLogFormat.hpp) to be read by RssLogReader. Each written world model forms one tick of the log.
+ * The tick index and the footer are written when closing the log.
+ *
+ * The tick records are serialized into an internal buffer, which keeps its capacity, so writing doesn't allocate
+ * memory in steady state apart from the growing tick index.
+ */
+class RssLogWriter
+{
+public:
+  RssLogWriter() = default;
+
+  /**
+   * @brief destructor, closes the log if still open
+   */
+  ~RssLogWriter();
+
+  RssLogWriter(RssLogWriter const &) = delete;
+  RssLogWriter &operator=(RssLogWriter const &) = delete;
+
+  /**
+   * @brief create the log file and write the file header
+   *
+   * @param [in] fileName - the name of the log file
+   *
+   * @return true if the file could be created, false otherwise
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @brief write the world model of a time step as new tick
+   *
+   * The time index of the world model has to be larger than the one of the previous tick.
+   *
+   * @param [in] worldModel - the world model to write
+   *
+   * @return true if the tick could be written, false otherwise
+   */
+  bool write(world::WorldModel const &worldModel);
+
+  /**
+   * @brief write the world model of a time step together with its situations and response states as new tick
+   *
+   * The time index of the world model has to be larger than the one of the previous tick.
+   *
+   * @param [in] worldModel - the world model to write
+   * @param [in] situationVector - the situations extracted from the world model
+   * @param [in] responseStateVector - the response states of the situations
+   *
+   * @return true if the tick could be written, false otherwise
+   */
+  bool write(world::WorldModel const &worldModel,
+             situation::SituationVector const &situationVector,
+             state::ResponseStateVector const &responseStateVector);
+
+  /**
+   * @brief write the tick index and the footer and close the log file
+   *
+   * @return true if the log has been completed successfully, false otherwise
+   */
+  bool close();
+
+private:
+  bool writeData(void const *data, std::size_t const size);
+
+  std::FILE *mFile{nullptr};
+  uint64_t mFileOffset{0u};
+  bool mFailed{false};
+  std::vector<uint8_t> mTickBuffer;
+  std::vector<RssLogTickIndexEntry> mTickIndex;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -34,7 +34,7 @@
 
 #pragma once
 
-#include <map>
+#include <memory>
 #include "ad_rss/state/ResponseStateVector.hpp"
 
 /*!
@@ -42,6 +42,10 @@
  */
 namespace ad_rss {
 
+namespace situation {
+template <typename StateType> class RssSituationStateTable;
+} // namespace situation
+
 /*!
  * @brief namespace core
  */
@@ -64,6 +68,11 @@ public:
    */
   RssResponseResolving();
 
+  /**
+   * @brief destructor
+   */
+  ~RssResponseResolving();
+
   /**
    * @brief Calculate the proper response out of the current responses
    *
@@ -76,6 +85,33 @@ public:
   bool provideProperResponse(state::ResponseStateVector const &currentStates, state::ResponseState &responseState);
 
 private:
+  friend class RssCheck;
+
+  /**
+   * @brief Calculate the proper response out of the current responses without checking the input range
+   *
+   * Same as provideProperResponse(), but the currentStates have to be already checked to be within valid input range.
+   *
+   * @param[in]  currentStates all the response states gathered for the current situations
+   * @param[out] responseState the proper overall response state
+   *
+   * @return true if response could be calculated, false otherwise
+   * If false is returned the internal state has not been updated
+   */
+  bool provideProperResponseInputRangeChecked(state::ResponseStateVector const &currentStates,
+                                              state::ResponseState &responseState);
+
+  /**
+   * @brief Take over the tracked response states of another response resolving
+   *
+   * Allows to resolve responses on a copy of the state, without changing the state of the other response resolving.
+   *
+   * @param[in] other the response resolving to be copied
+   *
+   * @return true if the state could be taken over, false otherwise.
+   */
+  bool assignState(RssResponseResolving const &other);
+
   struct RssState
   {
     bool longitudinalSafe{false};
@@ -83,16 +119,13 @@ private:
   };
 
   /**
-   * @brief typedef for the mapping of object id to the corresponding RssState before the danger threshold time
-   */
-  typedef std::map<situation::SituationId, RssState> RssStateBeforeDangerThresholdTimeMap;
-
-  /**
-   * @brief the state of all responses before the danger threshold time of each response
+   * @brief the RssState of each situation before its danger threshold time
    *
-   * Needs to be stored to check which is the response that changed and required to solve an unclear situation
+   * Needs to be stored to check which is the response that changed and required to solve an unclear situation.
+   * The states of the previous call are kept as previous generation of the table, the states of the current call
+   * become the previous generation if the proper response could be calculated.
    */
-  RssStateBeforeDangerThresholdTimeMap mStatesBeforeDangerThresholdTime;
+  std::unique_ptr<situation::RssSituationStateTable<RssState>> mStatesBeforeDangerThresholdTime;
 };
 
 } // namespace core
@@ -0,0 +1,140 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <limits>
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssSafetyLimits
+ *
+ * The limits of the ego vehicle keeping the situations RSS safe. Each limit is valid while the other values of the
+ * ego vehicle state stay unchanged. A situation is safe if it is safe in longitudinal or in lateral direction.
+ * Therefore, the limits of one direction are only restricted if the situation is not safe in the other direction.
+ * The default values do not restrict the ego vehicle at all.
+ */
+struct RssSafetyLimits
+{
+  /**
+   * @brief the maximum longitudinal acceleration of the ego vehicle (dynamics.alphaLon.accelMax)
+   *
+   * A negative value indicates that the ego vehicle has to decelerate already during the response time.
+   */
+  physics::Acceleration maxAccelerationLon{std::numeric_limits<physics::Acceleration>::max()};
+
+  /**
+   * @brief the maximum longitudinal speed of the ego vehicle
+   *
+   * A negative value indicates that no longitudinal speed is safe.
+   */
+  physics::Speed maxSpeedLon{std::numeric_limits<physics::Speed>::max()};
+
+  /**
+   * @brief the maximum lateral acceleration of the ego vehicle (dynamics.alphaLat.accelMax)
+   */
+  physics::Acceleration maxAccelerationLat{std::numeric_limits<physics::Acceleration>::max()};
+
+  /**
+   * @brief the minimum lateral speed of the ego vehicle
+   */
+  physics::Speed minSpeedLat{std::numeric_limits<physics::Speed>::lowest()};
+
+  /**
+   * @brief the maximum lateral speed of the ego vehicle
+   */
+  physics::Speed maxSpeedLat{std::numeric_limits<physics::Speed>::max()};
+};
+
+/*!
+ * @brief namespace RssSafetyLimitsCalculation
+ *
+ * Namespace providing the closed form calculation of the limits of the ego vehicle keeping the situations RSS safe.
+ * Instead of searching the limits by repeated RSS checks with varied ego vehicle states, the safe distance formulas
+ * are solved for the acceleration and the speed of the ego vehicle.
+ */
+namespace RssSafetyLimitsCalculation {
+
+/**
+ * @brief Calculate the limits of the ego vehicle keeping the situation RSS safe
+ *
+ * Non-intersection situations are limited by the longitudinal and the lateral safe distances; if the ego vehicle is
+ * leading in a same direction situation, it is not required to respond and is therefore not limited longitudinally.
+ * Intersection situations are limited longitudinally by the ability of the ego vehicle to stop in front of the
+ * intersection if the ego vehicle has no priority and the other vehicle isn't able to stop in front of the
+ * intersection. The time based intersection criteria are not considered, so the limits are conservative.
+ *
+ * @param [in] situation - the situation to be checked
+ * @param [out] safetyLimits - the limits of the ego vehicle
+ *
+ * @return true if the limits could be calculated, false otherwise.
+ */
+bool calculateSafetyLimits(situation::Situation const &situation, RssSafetyLimits &safetyLimits);
+
+/**
+ * @brief Calculate the limits of the ego vehicle keeping all situations RSS safe
+ *
+ * @param [in] situationVector - the situations to be checked
+ * @param [out] safetyLimits - the tightest limits of all situations
+ *
+ * @return true if the limits could be calculated, false otherwise.
+ */
+bool calculateSafetyLimits(situation::SituationVector const &situationVector, RssSafetyLimits &safetyLimits);
+
+/**
+ * @brief Calculate the limits of the ego vehicle keeping all situations of the world model RSS safe
+ *
+ * @param [in] worldModel - the current world model information
+ * @param [out] safetyLimits - the tightest limits of all situations extracted from the world model
+ *
+ * @return true if the limits could be calculated, false otherwise.
+ */
+bool calculateSafetyLimits(world::WorldModel const &worldModel, RssSafetyLimits &safetyLimits);
+
+} // namespace RssSafetyLimitsCalculation
+} // namespace core
+} // namespace ad_rss
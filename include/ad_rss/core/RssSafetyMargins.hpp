@@ -0,0 +1,258 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/CoordinateSystemAxis.hpp"
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/DurationSquared.hpp"
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssSafetyMargin
+ *
+ * The margin of a distance checked by RSS and its partial derivatives with respect to the state of the ego vehicle.
+ * The distance is safe if the margin is at least physics::Distance::cPrecisionValue.
+ */
+struct RssSafetyMargin
+{
+  /**
+   * @brief the current distance minus the safe distance
+   */
+  physics::Distance margin{0.};
+
+  /**
+   * @brief the partial derivative of the margin with respect to the speed of the ego vehicle
+   */
+  physics::Duration speedDerivative{0.};
+
+  /**
+   * @brief the partial derivative of the margin with respect to the maximum acceleration of the ego vehicle
+   */
+  physics::DurationSquared accelerationDerivative{0.};
+
+  /**
+   * @brief the partial derivative of the margin with respect to the response time of the ego vehicle
+   */
+  physics::Speed responseTimeDerivative{0.};
+};
+
+/**
+ * @brief RssSituationSafetyMargins
+ *
+ * The safety margins of a situation. The longitudinal margin refers to the longitudinal speed and acceleration, the
+ * lateral margin to the lateral speed and acceleration of the ego vehicle. A situation is safe if one of its margins
+ * is safe.
+ */
+struct RssSituationSafetyMargins
+{
+  /**
+   * @brief the id of the situation
+   */
+  situation::SituationId situationId{0u};
+
+  /**
+   * @brief true if the situation provides a longitudinal margin
+   */
+  bool hasLongitudinalMargin{false};
+
+  /**
+   * @brief the longitudinal margin
+   */
+  RssSafetyMargin longitudinalMargin;
+
+  /**
+   * @brief true if the situation provides a lateral margin, false if the vehicles overlap laterally
+   */
+  bool hasLateralMargin{false};
+
+  /**
+   * @brief the lateral margin
+   */
+  RssSafetyMargin lateralMargin;
+};
+
+/**
+ * @brief vector of the safety margins of the situations
+ */
+typedef std::vector<RssSituationSafetyMargins> RssSituationSafetyMarginsVector;
+
+/**
+ * @brief RssPlanningHorizon
+ *
+ * The nominal accelerations of the ego vehicle planned for the equidistant steps of a planning horizon. Both vectors
+ * must have the same size.
+ */
+struct RssPlanningHorizon
+{
+  /**
+   * @brief the duration of a step of the planning horizon
+   */
+  physics::Duration stepDuration{0.1};
+
+  /**
+   * @brief the planned longitudinal accelerations of the ego vehicle, one per step
+   */
+  std::vector<physics::Acceleration> accelerationsLon;
+
+  /**
+   * @brief the planned lateral accelerations of the ego vehicle, one per step
+   */
+  std::vector<physics::Acceleration> accelerationsLat;
+};
+
+/**
+ * @brief RssLinearConstraint
+ *
+ * A linear half-space constraint on the accelerations of the ego vehicle along the planning horizon:
+ * sum(coefficients[i] * accelerations[i]) <= upperBound, with the accelerations of the axis of the constraint.
+ */
+struct RssLinearConstraint
+{
+  /**
+   * @brief the id of the situation the constraint belongs to
+   */
+  situation::SituationId situationId{0u};
+
+  /**
+   * @brief the axis of the accelerations constrained
+   */
+  physics::CoordinateSystemAxis axis{physics::CoordinateSystemAxis::Longitudinal};
+
+  /**
+   * @brief the step of the planning horizon the constraint refers to, in the range [1, number of steps]
+   */
+  uint32_t step{0u};
+
+  /**
+   * @brief the coefficients of the accelerations, one per step of the planning horizon
+   */
+  std::vector<double> coefficients;
+
+  /**
+   * @brief the upper bound of the weighted sum of the accelerations
+   */
+  double upperBound{0.};
+};
+
+/**
+ * @brief vector of linear constraints
+ */
+typedef std::vector<RssLinearConstraint> RssLinearConstraintVector;
+
+/*!
+ * @brief namespace RssSafetyMarginCalculation
+ *
+ * Namespace providing the safety margins of the situations together with their analytic gradients with respect to
+ * the ego vehicle state, and their linearization along a planning horizon for optimization based planners.
+ */
+namespace RssSafetyMarginCalculation {
+
+/**
+ * @brief Calculate the safety margins of the situation
+ *
+ * Non-intersection situations provide the longitudinal margin and, if the vehicles don't overlap laterally, the
+ * lateral margin. Intersection situations provide the margin of the ego vehicle to stop in front of the intersection
+ * as longitudinal margin if the ego vehicle has no priority.
+ *
+ * @param [in] situation - the situation
+ * @param [out] safetyMargins - the safety margins of the situation
+ *
+ * @return true if the margins could be calculated, false otherwise.
+ */
+bool calculateSafetyMargins(situation::Situation const &situation, RssSituationSafetyMargins &safetyMargins);
+
+/**
+ * @brief Calculate the safety margins of all situations extracted from the world model
+ *
+ * @param [in] worldModel - the current world model information
+ * @param [out] safetyMarginsVector - the safety margins of the situations
+ *
+ * @return true if the margins could be calculated, false otherwise.
+ */
+bool calculateSafetyMargins(world::WorldModel const &worldModel, RssSituationSafetyMarginsVector &safetyMarginsVector);
+
+/**
+ * @brief Calculate the linearized safety margins of the situation along the planning horizon
+ *
+ * The ego vehicle follows the planned accelerations, the other vehicle keeps its speeds. For every step of the horizon
+ * the margins are evaluated at the predicted state and linearized with respect to the accelerations of the previous
+ * steps, which change the speed of the ego vehicle and the distance to the other vehicle. The maximum accelerations
+ * of the ego vehicle during the response time stay the ones of its dynamics. As a situation is safe if either its
+ * longitudinal or its lateral margin is safe, the planner may drop the constraints of one axis as long as the
+ * constraints of the other axis are fulfilled.
+ *
+ * @param [in] situation - the situation
+ * @param [in] planningHorizon - the planned accelerations of the ego vehicle
+ * @param [out] constraints - the constraints of the situation are appended
+ *
+ * @return true if the constraints could be calculated, false otherwise.
+ */
+bool calculateLinearConstraints(situation::Situation const &situation,
+                                RssPlanningHorizon const &planningHorizon,
+                                RssLinearConstraintVector &constraints);
+
+/**
+ * @brief Calculate the linearized safety margins of all situations extracted from the world model along the planning
+ * horizon
+ *
+ * @param [in] worldModel - the current world model information
+ * @param [in] planningHorizon - the planned accelerations of the ego vehicle
+ * @param [out] constraints - the constraints of all situations
+ *
+ * @return true if the constraints could be calculated, false otherwise.
+ */
+bool calculateLinearConstraints(world::WorldModel const &worldModel,
+                                RssPlanningHorizon const &planningHorizon,
+                                RssLinearConstraintVector &constraints);
+
+} // namespace RssSafetyMarginCalculation
+} // namespace core
+} // namespace ad_rss
@@ -34,7 +34,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
+#include "ad_rss/physics/Duration.hpp"
 #include "ad_rss/situation/SituationVector.hpp"
 #include "ad_rss/state/ResponseStateVector.hpp"
 
@@ -55,6 +58,11 @@ class RssIntersectionChecker;
  */
 namespace core {
 
+class RssCheck;
+class RssReevaluationScheduler;
+class RssWorkerPool;
+struct SituationCheckBuffer;
+
 /*!
  * @brief class RssSituationChecking
  *
@@ -85,6 +93,132 @@ public:
                        state::ResponseStateVector &responseStateVector);
 
 private:
+  friend class RssCheck;
+
+  /*!
+   * @brief Checks if the current situations are safe, optionally reusing response states and using a worker pool.
+   *
+   * The non-intersection situations are checked as batch if enabled by enableBatchEvaluation(), otherwise in parallel
+   * if a worker pool is given, while the intersection situations are always checked in the order of the
+   * situationVector. The results are identical to the sequential checkSituations().
+   *
+   * As within the sequential checkSituations(), the terms depending on the ego vehicle state only are calculated
+   * once and reused by the checks of all situations (see situation::RssEgoVehicleTerms).
+   *
+   * Only the situations of not reused response states are checked to be within valid input range; the reused ones
+   * have already been checked within the previous time step. In addition, the calculated response states are checked
+   * to be within valid input range, so that the responseStateVector can be passed on to the response resolving
+   * without checking it again.
+   *
+   * If enabled by enableLazyReevaluation(), the situations which cannot have become unsafe since their last
+   * evaluation are not evaluated again (see RssReevaluationScheduler); their response states are provided like the
+   * reused ones.
+   *
+   * This is the combination of checkStatelessSituations() and checkStatefulSituations().
+   *
+   * @param [in] situationVector the vector of situations that should be analyzed
+   * @param[in,out] responseStateVector the vector of response states for the current situations. On input, the
+   * entries flagged within reusedResponseStates already contain the valid response state of the situation.
+   * @param[in] reusedResponseStates flags per situation indicating if the response state is already available. This
+   * is only supported for non-intersection situations. Empty if no response states are available.
+   * @param[in] workerPool the worker pool to be used, nullptr for sequential processing
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituations(situation::SituationVector const &situationVector,
+                       state::ResponseStateVector &responseStateVector,
+                       std::vector<uint8_t> const &reusedResponseStates,
+                       RssWorkerPool *workerPool);
+
+  /*!
+   * @brief Performs the checks of the situations not depending on previous time steps
+   *
+   * These are the input range checks, the ego vehicle terms and the checks of the non-intersection situations. The
+   * function doesn't modify the state of the situation checking, so the stateless checks of different time steps can
+   * be performed concurrently on different buffers, before the stateful checks of the time steps are performed in
+   * order.
+   *
+   * @param [in] situationVector the vector of situations that should be analyzed
+   * @param[in,out] responseStateVector the vector of response states for the current situations (see
+   * checkSituations())
+   * @param[in] reusedResponseStates flags per situation indicating if the response state is already available
+   * @param[in] workerPool the worker pool to be used, nullptr for sequential processing
+   * @param[out] buffer the buffer receiving the results of the stateless checks, prepared by initializeCheckBuffer()
+   */
+  void checkStatelessSituations(situation::SituationVector const &situationVector,
+                                state::ResponseStateVector &responseStateVector,
+                                std::vector<uint8_t> const &reusedResponseStates,
+                                RssWorkerPool *workerPool,
+                                SituationCheckBuffer &buffer) const;
+
+  /*!
+   * @brief Performs the checks of the situations depending on previous time steps
+   *
+   * These are the check of the increasing time index and the checks of the intersection situations.
+   *
+   * @param [in] situationVector the vector of situations that should be analyzed
+   * @param[in,out] responseStateVector the vector of response states provided by checkStatelessSituations()
+   * @param[in] buffer the results of checkStatelessSituations() of the situations
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkStatefulSituations(situation::SituationVector const &situationVector,
+                               state::ResponseStateVector &responseStateVector,
+                               SituationCheckBuffer const &buffer);
+
+  /*!
+   * @brief Checks the situations of a sequence of time steps
+   *
+   * The situations are ordered by the time steps, each time step consists of the same number of situations sharing
+   * the time index. The non-intersection situations of all time steps are evaluated as a single batch, the
+   * intersection situations are checked time step by time step afterwards. Each time step has to increase the time
+   * index.
+   *
+   * @param [in] situationVector the situations of all time steps
+   * @param [in] numberOfSituationsPerTimeStep the number of situations of each time step
+   * @param[out] responseStateVector the response states of the situations
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituationSequence(situation::SituationVector const &situationVector,
+                              std::size_t const numberOfSituationsPerTimeStep,
+                              state::ResponseStateVector &responseStateVector);
+
+  /*!
+   * @brief Prepare a buffer for checkStatelessSituations() according to the configuration of the situation checking
+   */
+  void initializeCheckBuffer(SituationCheckBuffer &buffer) const;
+
+  /*!
+   * @brief Enable the batch evaluation of the non-intersection situations within checkSituations() reusing response
+   * states
+   *
+   * See RssCheckConfiguration::enableBatchEvaluation.
+   */
+  void enableBatchEvaluation();
+
+  /*!
+   * @brief Enable the lazy re-evaluation of the situations within checkSituations() reusing response states
+   *
+   * See RssCheckConfiguration::enableLazyReevaluation. The lazy re-evaluation stays disabled if the duration is not
+   * positive.
+   *
+   * @param[in] maximumTimeStepDuration the upper bound of the duration between two consecutive time indices
+   */
+  void enableLazyReevaluation(physics::Duration const &maximumTimeStepDuration);
+
+  /*!
+   * @brief Take over the state across time steps and the configuration of another situation checking
+   *
+   * Allows to check situations on a copy of the state, without changing the state of the other situation checking.
+   * The lazy re-evaluation is not taken over, the situations checked on the copy are always evaluated completely.
+   *
+   * @param[in] other the situation checking to be copied
+   *
+   * @return true if the state could be taken over, false otherwise.
+   */
+  bool assignState(RssSituationChecking const &other);
+
   /*!
    * @brief Check if the current situation is safe.
    *
@@ -109,8 +243,11 @@ private:
   bool checkTimeIncreasingConsistently(situation::Situation const &situation, bool const nextTimeStep);
 
   std::unique_ptr<ad_rss::situation::RssIntersectionChecker> mIntersectionChecker;
+  std::unique_ptr<SituationCheckBuffer> mCheckBuffer;
+  std::unique_ptr<RssReevaluationScheduler> mReevaluationScheduler;
   physics::TimeIndex mLastTimeIndex{0u};
   physics::TimeIndex mCurrentTimeIndex{0u};
+  bool mBatchEvaluation{false};
 };
 } // namespace core
 } // namespace ad_rss
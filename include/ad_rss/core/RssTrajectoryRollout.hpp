@@ -0,0 +1,158 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ad_rss/core/RssSafetyMargins.hpp"
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/state/ResponseState.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssRolloutKinematics
+ *
+ * The accelerations of a vehicle during a step of a trajectory rollout.
+ */
+struct RssRolloutKinematics
+{
+  /**
+   * @brief the longitudinal acceleration, the vehicle doesn't start to drive in reverse direction after standing still
+   */
+  physics::Acceleration accelerationLon{0.};
+
+  /**
+   * @brief the lateral acceleration
+   */
+  physics::Acceleration accelerationLat{0.};
+};
+
+/**
+ * @brief RssRolloutStep
+ *
+ * The kinematics of the vehicles during a step of a trajectory rollout.
+ */
+struct RssRolloutStep
+{
+  /**
+   * @brief the kinematics of the ego vehicle
+   */
+  RssRolloutKinematics egoKinematics;
+
+  /**
+   * @brief the kinematics of the other vehicle of each situation, in the order of the situations
+   *
+   * If empty, the other vehicles keep their speed.
+   */
+  std::vector<RssRolloutKinematics> objectKinematics;
+};
+
+/**
+ * @brief RssTrajectoryRollout
+ *
+ * A planned trajectory of the ego vehicle together with the predicted kinematics of the other vehicles.
+ */
+struct RssTrajectoryRollout
+{
+  /**
+   * @brief the (positive) duration of each step
+   */
+  physics::Duration stepDuration{0.1};
+
+  /**
+   * @brief the steps of the rollout
+   */
+  std::vector<RssRolloutStep> steps;
+};
+
+/**
+ * @brief RssRolloutStepResult
+ *
+ * The result of a step of a trajectory rollout.
+ */
+struct RssRolloutStepResult
+{
+  /**
+   * @brief the time index of the step
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /**
+   * @brief the proper response state of the step
+   */
+  state::ResponseState properResponse;
+
+  /**
+   * @brief the safety margins of the predicted situations of the step, in the order of the situations
+   */
+  RssSituationSafetyMarginsVector safetyMargins;
+};
+
+/**
+ * @brief RssRolloutResult
+ *
+ * The result of a trajectory rollout.
+ */
+struct RssRolloutResult
+{
+  /**
+   * @brief true if none of the steps is dangerous
+   */
+  bool isSafe{true};
+
+  /**
+   * @brief the index of the first dangerous step, only valid if not isSafe
+   */
+  std::size_t firstUnsafeStep{0u};
+
+  /**
+   * @brief the results of the steps
+   */
+  std::vector<RssRolloutStepResult> stepResults;
+};
+
+} // namespace core
+} // namespace ad_rss
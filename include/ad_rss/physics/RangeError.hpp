@@ -0,0 +1,175 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <stdexcept>
+
+/*!
+ * @brief The library reports invalid physics values (see e.g. Distance::ensureValid()) by raising a range error.
+ *
+ * By default a range error is a std::out_of_range exception. If the library is compiled without exception support
+ * (BUILD_WITHOUT_EXCEPTIONS, defining AD_RSS_NO_EXCEPTIONS) a range error sets a thread local error flag instead and
+ * the calculation continues. The library functions catching the exceptions use AD_RSS_TRY and AD_RSS_CATCH_ALL or
+ * AD_RSS_CATCH_RANGE_ERROR instead of try and catch, so that the error is handled in both modes in the same place:
+ * the handler is executed after the try block if a range error has been raised within the block.
+ *
+ * Code of the try block which must not be executed with the result of a failing calculation, i.e. which would have
+ * been skipped by the exception, has to check rangeErrorRaised() in addition. Since the flag stays set until the end
+ * of the block, the calculation continues with the invalid values until such a check:
+ * - the physics calculations returning a bool (physics::MathT, the RSS formulas) return false once a range error has
+ *   been raised, so their callers only have to check the returned value.
+ * - the operators of the physics types and the calculations returning the calculated value (e.g.
+ *   calculateDistanceOffsetInAccerlatedMovement()) return the invalid value. Their callers have to check
+ *   rangeErrorRaised() before the value decides a branch or a loop, indexes memory or is returned.
+ * - results which outlive the try block (e.g. caches and the state kept between time steps) must only be stored if
+ *   rangeErrorRaised() is false.
+ */
+
+namespace ad_rss {
+namespace physics {
+
+#if defined(AD_RSS_NO_EXCEPTIONS)
+
+/*!
+ * @brief the thread local range error flag of the innermost AD_RSS_TRY block
+ */
+inline bool &rangeErrorFlag()
+{
+  static thread_local bool flag = false;
+  return flag;
+}
+
+/*!
+ * @brief raise a range error: set the range error flag
+ */
+inline void raiseRangeError(char const *)
+{
+  rangeErrorFlag() = true;
+}
+
+/*!
+ * @brief check if a range error has been raised within the current AD_RSS_TRY block
+ */
+inline bool rangeErrorRaised()
+{
+  return rangeErrorFlag();
+}
+
+/*!
+ * @brief the scope of an AD_RSS_TRY block
+ *
+ * The range errors raised within the block are handled by the block, the flag of the enclosing block is restored when
+ * leaving the scope.
+ */
+class RangeErrorScope
+{
+public:
+  RangeErrorScope()
+    : mEnclosingFlag(rangeErrorFlag())
+  {
+    rangeErrorFlag() = false;
+  }
+
+  ~RangeErrorScope()
+  {
+    rangeErrorFlag() = mEnclosingFlag;
+  }
+
+  RangeErrorScope(RangeErrorScope const &) = delete;
+  RangeErrorScope &operator=(RangeErrorScope const &) = delete;
+
+  /*!
+   * @brief advance to the next pass of the AD_RSS_TRY loop
+   *
+   * @returns \c true for the try block pass and for the handler pass if a range error has been raised
+   */
+  bool nextPass()
+  {
+    mPass++;
+    return (mPass == 1u) || ((mPass == 2u) && rangeErrorRaised());
+  }
+
+  /*!
+   * @returns \c true if the try block has to be executed
+   */
+  bool isTryPass() const
+  {
+    return mPass == 1u;
+  }
+
+private:
+  bool const mEnclosingFlag;
+  unsigned mPass{0u};
+};
+
+#define AD_RSS_RANGE_ERROR_SCOPE_NAME_(line) adRssRangeErrorScope##line
+#define AD_RSS_RANGE_ERROR_SCOPE_NAME(line) AD_RSS_RANGE_ERROR_SCOPE_NAME_(line)
+#define AD_RSS_TRY                                                                                                     \
+  for (::ad_rss::physics::RangeErrorScope AD_RSS_RANGE_ERROR_SCOPE_NAME(__LINE__);                                     \
+       AD_RSS_RANGE_ERROR_SCOPE_NAME(__LINE__).nextPass();)                                                            \
+    if (AD_RSS_RANGE_ERROR_SCOPE_NAME(__LINE__).isTryPass())
+#define AD_RSS_CATCH_ALL else
+#define AD_RSS_CATCH_RANGE_ERROR else
+
+#else
+
+/*!
+ * @brief raise a range error: throw a std::out_of_range exception
+ */
+[[noreturn]] inline void raiseRangeError(char const *message)
+{
+  throw std::out_of_range(message);
+}
+
+/*!
+ * @brief check if a range error has been raised within the current AD_RSS_TRY block
+ *
+ * With exception support a range error leaves the try block immediately, so there is nothing to check.
+ */
+inline constexpr bool rangeErrorRaised()
+{
+  return false;
+}
+
+#define AD_RSS_TRY try
+#define AD_RSS_CATCH_ALL catch (...)
+#define AD_RSS_CATCH_RANGE_ERROR catch (std::out_of_range &)
+
+#endif
+
+} // namespace physics
+} // namespace ad_rss
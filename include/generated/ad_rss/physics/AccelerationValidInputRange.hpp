@@ -42,6 +42,7 @@
 #include <cmath>
 #include <limits>
 #include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/RangeError.hpp"
 
 /*!
  * \brief check if the given Acceleration is within valid input range
@@ -57,7 +58,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::physics::Acceleration const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     // check for generic numeric limits of the type
@@ -72,7 +73,7 @@ inline bool withinValidInputRange(::ad_rss::physics::Acceleration const &input)
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
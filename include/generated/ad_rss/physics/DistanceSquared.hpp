@@ -42,6 +42,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 /*!
  * @brief namespace ad_rss
  */
@@ -403,7 +404,7 @@ public:
   {
     if (!isValid())
     {
-      throw std::out_of_range("DistanceSquared value out of range"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("DistanceSquared value out of range"); // LCOV_EXCL_BR_LINE
     }
   }
 
@@ -418,7 +419,7 @@ public:
     ensureValid();
     if (operator==(DistanceSquared(0.))) // LCOV_EXCL_BR_LINE
     {
-      throw std::out_of_range("DistanceSquared value is zero"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("DistanceSquared value is zero"); // LCOV_EXCL_BR_LINE
     }
   }
 
@@ -43,6 +43,7 @@
 #include <limits>
 #include "ad_rss/physics/DistanceValidInputRange.hpp"
 #include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/physics/RangeError.hpp"
 
 /*!
  * \brief check if the given MetricRange is within valid input range
@@ -57,7 +58,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::physics::MetricRange const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     // check for generic member input ranges
@@ -74,7 +75,7 @@ inline bool withinValidInputRange(::ad_rss::physics::MetricRange const &input)
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
@@ -42,6 +42,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 /*!
  * @brief namespace ad_rss
  */
@@ -395,7 +396,7 @@ public:
   {
     if (!isValid())
     {
-      throw std::out_of_range("ParametricValue value out of range"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("ParametricValue value out of range"); // LCOV_EXCL_BR_LINE
     }
   }
 
@@ -410,7 +411,7 @@ public:
     ensureValid();
     if (operator==(ParametricValue(0.))) // LCOV_EXCL_BR_LINE
     {
-      throw std::out_of_range("ParametricValue value is zero"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("ParametricValue value is zero"); // LCOV_EXCL_BR_LINE
     }
   }
 
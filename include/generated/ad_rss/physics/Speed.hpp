@@ -42,6 +42,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 /*!
  * @brief namespace ad_rss
  */
@@ -416,7 +417,7 @@ public:
   {
     if (!isValid())
     {
-      throw std::out_of_range("Speed value out of range"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("Speed value out of range"); // LCOV_EXCL_BR_LINE
     }
   }
 
@@ -431,7 +432,7 @@ public:
     ensureValid();
     if (operator==(Speed(0.))) // LCOV_EXCL_BR_LINE
     {
-      throw std::out_of_range("Speed value is zero"); // LCOV_EXCL_BR_LINE
+      ::ad_rss::physics::raiseRangeError("Speed value is zero"); // LCOV_EXCL_BR_LINE
     }
   }
 
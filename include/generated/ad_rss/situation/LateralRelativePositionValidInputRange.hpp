@@ -41,6 +41,7 @@
 
 #include <cmath>
 #include <limits>
+#include "ad_rss/physics/RangeError.hpp"
 #include "ad_rss/situation/LateralRelativePosition.hpp"
 
 /*!
@@ -54,7 +55,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::situation::LateralRelativePosition const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     return (input == ::ad_rss::situation::LateralRelativePosition::AtLeft)
@@ -65,7 +66,7 @@ inline bool withinValidInputRange(::ad_rss::situation::LateralRelativePosition c
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
@@ -43,6 +43,7 @@
 #include <limits>
 #include "ad_rss/physics/DistanceValidInputRange.hpp"
 #include "ad_rss/physics/DurationValidInputRange.hpp"
+#include "ad_rss/physics/RangeError.hpp"
 #include "ad_rss/situation/VehicleState.hpp"
 #include "ad_rss/world/DynamicsValidInputRange.hpp"
 #include "ad_rss/world/VelocityValidInputRange.hpp"
@@ -61,7 +62,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::situation::VehicleState const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     // check for generic member input ranges
@@ -86,7 +87,7 @@ inline bool withinValidInputRange(::ad_rss::situation::VehicleState const &input
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
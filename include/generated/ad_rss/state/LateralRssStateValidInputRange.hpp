@@ -41,6 +41,7 @@
 
 #include <cmath>
 #include <limits>
+#include "ad_rss/physics/RangeError.hpp"
 #include "ad_rss/state/LateralResponseValidInputRange.hpp"
 #include "ad_rss/state/LateralRssState.hpp"
 #include "ad_rss/state/ResponseInformationValidInputRange.hpp"
@@ -56,7 +57,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::state::LateralRssState const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     // check for generic member input ranges
@@ -67,7 +68,7 @@ inline bool withinValidInputRange(::ad_rss::state::LateralRssState const &input)
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
@@ -41,6 +41,7 @@
 
 #include <cmath>
 #include <limits>
+#include "ad_rss/physics/RangeError.hpp"
 #include "ad_rss/state/LateralRssStateValidInputRange.hpp"
 #include "ad_rss/state/LongitudinalRssStateValidInputRange.hpp"
 #include "ad_rss/state/ResponseState.hpp"
@@ -57,7 +58,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::state::ResponseState const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     // check for generic member input ranges
@@ -71,7 +72,7 @@ inline bool withinValidInputRange(::ad_rss::state::ResponseState const &input)
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
@@ -41,6 +41,7 @@
 
 #include <cmath>
 #include <limits>
+#include "ad_rss/physics/RangeError.hpp"
 #include "ad_rss/state/ResponseStateValidInputRange.hpp"
 #include "ad_rss/state/ResponseStateVector.hpp"
 
@@ -57,7 +58,7 @@
  */
 inline bool withinValidInputRange(::ad_rss::state::ResponseStateVector const &input)
 {
-  try
+  AD_RSS_TRY
   {
     // LCOV_EXCL_BR_START: not always possible to cover especially all exception branches
     bool inValidInputRange = (input.size() <= std::size_t(1000));
@@ -73,7 +74,7 @@ inline bool withinValidInputRange(::ad_rss::state::ResponseStateVector const &in
     // LCOV_EXCL_BR_STOP: not always possible to cover especially all exception branches
   }
   // LCOV_EXCL_START: not possible to cover these lines for all generated datatypes
-  catch (std::out_of_range &)
+  AD_RSS_CATCH_RANGE_ERROR
   {
   }
   return false;
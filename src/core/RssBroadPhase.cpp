@@ -0,0 +1,296 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#include "core/RssBroadPhase.hpp"
+#include <algorithm>
+#include <limits>
+#include "ad_rss/situation/SituationValidInputRange.hpp"
+#include "situation/RssSituation.hpp"
+#include "world/RssSituationCoordinateSystemConversion.hpp"
+
+namespace ad_rss {
+namespace core {
+
+using physics::Distance;
+
+void RssBroadPhase::cullScenes(world::WorldModel const &worldModel, RssSceneResults const *sceneResults)
+{
+  mSceneResults = sceneResults;
+  mNumberOfCulledScenes = 0u;
+  mCulledScenes.assign(worldModel.scenes.size(), 0u);
+
+  for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); sceneIndex++)
+  {
+    if ((mSceneResults != nullptr) && (mSceneResults->getSituation(sceneIndex) != nullptr))
+    {
+      continue;
+    }
+
+    bool culled = false;
+    AD_RSS_TRY
+    {
+      culled = cullScene(worldModel, worldModel.scenes[sceneIndex]);
+    }
+    AD_RSS_CATCH_ALL
+    {
+      culled = false;
+    }
+
+    if (culled)
+    {
+      mCulledScenes[sceneIndex] = 1u;
+      mNumberOfCulledScenes++;
+    }
+  }
+}
+
+situation::Situation const *RssBroadPhase::getSituation(std::size_t const sceneIndex) const
+{
+  if ((mSceneResults == nullptr) || isSceneCulled(sceneIndex))
+  {
+    return nullptr;
+  }
+  return mSceneResults->getSituation(sceneIndex);
+}
+
+state::ResponseState const *RssBroadPhase::getResponseState(std::size_t const sceneIndex) const
+{
+  if ((mSceneResults == nullptr) || isSceneCulled(sceneIndex))
+  {
+    return nullptr;
+  }
+  return mSceneResults->getResponseState(sceneIndex);
+}
+
+bool RssBroadPhase::isSceneCulled(std::size_t const sceneIndex) const
+{
+  return (sceneIndex < mCulledScenes.size()) && (mCulledScenes[sceneIndex] != 0u);
+}
+
+std::size_t RssBroadPhase::getNumberOfCulledScenes() const
+{
+  return mNumberOfCulledScenes;
+}
+
+bool RssBroadPhase::findOccupiedRoadSegments(world::RoadArea const &roadArea,
+                                             world::OccupiedRegionVector const &occupiedRegions,
+                                             OccupiedRoadSegments &segments)
+{
+  if (occupiedRegions.empty())
+  {
+    return false;
+  }
+
+  segments = OccupiedRoadSegments();
+  segments.first = std::numeric_limits<std::size_t>::max();
+  // like the extraction, the first lane segment with the id of a region takes the region
+  mRegionProcessed.assign(occupiedRegions.size(), 0u);
+  std::size_t remainingRegions = occupiedRegions.size();
+  for (std::size_t roadSegmentIndex = 0u; (roadSegmentIndex < roadArea.size()) && (remainingRegions > 0u);
+       roadSegmentIndex++)
+  {
+    for (auto const &laneSegment : roadArea[roadSegmentIndex])
+    {
+      for (std::size_t regionIndex = 0u; regionIndex < occupiedRegions.size(); regionIndex++)
+      {
+        if ((mRegionProcessed[regionIndex] != 0u) || (occupiedRegions[regionIndex].segmentId != laneSegment.id))
+        {
+          continue;
+        }
+        mRegionProcessed[regionIndex] = 1u;
+        remainingRegions--;
+
+        segments.first = std::min(segments.first, roadSegmentIndex);
+        segments.last = std::max(segments.last, roadSegmentIndex);
+        if (laneSegment.drivingDirection == world::LaneDrivingDirection::Positive)
+        {
+          segments.onPositiveLane = true;
+        }
+        if (laneSegment.drivingDirection == world::LaneDrivingDirection::Negative)
+        {
+          segments.onNegativeLane = true;
+        }
+      }
+    }
+  }
+
+  // otherwise the exact extraction fails, too
+  return remainingRegions == 0u;
+}
+
+bool RssBroadPhase::calculateLongitudinalDistanceBound(world::RoadArea const &roadArea,
+                                                       std::size_t const backRoadSegmentEnd,
+                                                       std::size_t const frontRoadSegment,
+                                                       Distance &distanceBound) const
+{
+  // the minimal start of the front road segment and the maximal end of the back road segment are accumulated exactly
+  // as within world::calculateObjectDimensions()
+  Distance frontStartMin = Distance(0.);
+  Distance backEndMax = Distance(0.);
+  for (std::size_t i = 0u; (i < frontRoadSegment) && (i < roadArea.size()); i++)
+  {
+    if (roadArea[i].empty())
+    {
+      return false;
+    }
+    Distance lengthMax = Distance(0.);
+    Distance lengthMin = std::numeric_limits<Distance>::max();
+    for (auto const &laneSegment : roadArea[i])
+    {
+      lengthMax = std::max(lengthMax, laneSegment.length.maximum);
+      lengthMin = std::min(lengthMin, laneSegment.length.minimum);
+    }
+    if (i < backRoadSegmentEnd)
+    {
+      backEndMax += lengthMax;
+    }
+    frontStartMin += lengthMin;
+  }
+
+  // the rounding of the exact position calculation is covered by the precision of the distance
+  distanceBound = frontStartMin - backEndMax - Distance::getPrecision();
+  return true;
+}
+
+bool RssBroadPhase::cullScene(world::WorldModel const &worldModel, world::Scene const &scene)
+{
+  if ((scene.situationType != situation::SituationType::SameDirection)
+      && (scene.situationType != situation::SituationType::OppositeDirection))
+  {
+    return false;
+  }
+
+  // scenes failing the exact extraction are never culled (see RssSituationExtraction)
+  if (!scene.intersectingRoad.empty()
+      || ((scene.object.objectType != world::ObjectType::OtherVehicle)
+          && (scene.object.objectType != world::ObjectType::ArtificialObject))
+      || (worldModel.egoVehicle.objectType != world::ObjectType::EgoVehicle)
+      || (scene.object.objectId == worldModel.egoVehicle.objectId))
+  {
+    return false;
+  }
+
+  OccupiedRoadSegments egoVehicleSegments;
+  OccupiedRoadSegments objectSegments;
+  if (!findOccupiedRoadSegments(scene.egoVehicleRoad, worldModel.egoVehicle.occupiedRegions, egoVehicleSegments)
+      || !findOccupiedRoadSegments(scene.egoVehicleRoad, scene.object.occupiedRegions, objectSegments))
+  {
+    return false;
+  }
+
+  // the longitudinal range of a vehicle starts not before the minimal start of its first road segment and ends not
+  // behind the maximal end of its last road segment; only vehicles separated by whole road segments provide a
+  // positive lower bound of the distance
+  situation::Situation situation;
+  std::size_t frontRoadSegment = 0u;
+  std::size_t backRoadSegmentEnd = 0u;
+  if (objectSegments.first > egoVehicleSegments.last + 1u)
+  {
+    situation.relativePosition.longitudinalPosition = situation::LongitudinalRelativePosition::AtBack;
+    frontRoadSegment = objectSegments.first;
+    backRoadSegmentEnd = egoVehicleSegments.last + 1u;
+  }
+  else if (egoVehicleSegments.first > objectSegments.last + 1u)
+  {
+    situation.relativePosition.longitudinalPosition = situation::LongitudinalRelativePosition::InFront;
+    frontRoadSegment = egoVehicleSegments.first;
+    backRoadSegmentEnd = objectSegments.last + 1u;
+  }
+  else
+  {
+    return false;
+  }
+
+  Distance longitudinalDistance = Distance(0.);
+  if (!calculateLongitudinalDistanceBound(
+        scene.egoVehicleRoad, backRoadSegmentEnd, frontRoadSegment, longitudinalDistance)
+      || (longitudinalDistance <= Distance(0.)))
+  {
+    return false;
+  }
+
+  situation.timeIndex = worldModel.timeIndex;
+  situation.situationId = situation::SituationId(scene.object.objectId);
+  situation.situationType = scene.situationType;
+
+  situation.egoVehicleState.hasPriority = false;
+  situation.otherVehicleState.hasPriority = false;
+
+  situation.egoVehicleState.isInCorrectLane = !egoVehicleSegments.onNegativeLane;
+  if (scene.situationType == situation::SituationType::OppositeDirection)
+  {
+    situation.otherVehicleState.isInCorrectLane = !objectSegments.onPositiveLane;
+  }
+  else
+  {
+    situation.otherVehicleState.isInCorrectLane = !objectSegments.onNegativeLane;
+  }
+
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(0.);
+  situation.egoVehicleState.distanceToLeaveIntersection = Distance(1000.);
+
+  situation.otherVehicleState.distanceToEnterIntersection = Distance(0.);
+  situation.otherVehicleState.distanceToLeaveIntersection = Distance(1000.);
+
+  world::convertVehicleStateDynamics(worldModel.egoVehicle, situation.egoVehicleState);
+  world::convertVehicleStateDynamics(scene.object, situation.otherVehicleState);
+
+  situation.relativePosition.longitudinalDistance = longitudinalDistance;
+  situation.relativePosition.lateralPosition = situation::LateralRelativePosition::Overlap;
+  situation.relativePosition.lateralDistance = Distance(0.);
+
+  // scenes with dynamics out of the valid input range are left to the situation checking, which fails then
+  if (!withinValidInputRange(situation))
+  {
+    return false;
+  }
+
+  // the safe distance doesn't depend on the distance of the vehicles, so the situation is safe for the exact
+  // distance, too
+  state::LongitudinalRssState longitudinalState;
+  bool result = false;
+  if (scene.situationType == situation::SituationType::SameDirection)
+  {
+    result = situation::calculateLongitudinalRssStateNonIntersectionSameDirection(situation, longitudinalState);
+  }
+  else
+  {
+    result = situation::calculateLongitudinalRssStateNonIntersectionOppositeDirection(situation, longitudinalState);
+  }
+
+  return result && longitudinalState.isSafe;
+}
+
+} // namespace core
+} // namespace ad_rss
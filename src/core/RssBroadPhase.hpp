@@ -0,0 +1,145 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+#include "core/RssSceneResults.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief class RssBroadPhase
+ *
+ * Broad-phase pass over the scenes of a world model, culling the same direction and opposite direction scenes of
+ * objects which are far away from the ego vehicle and longitudinally safe.
+ *
+ * An object is far away, if the road segments occupied by the object and by the ego vehicle are separated by whole
+ * road segments and the minimal lengths of these provide a positive lower bound of the longitudinal distance. The
+ * lower bound only requires the road segments of the occupied regions and rejects near scenes cheaply. The
+ * longitudinal state is evaluated at the lower bound by the same RSS formulas as the situation checking. The safe
+ * distance doesn't depend on the distance of the vehicles, so if the lower bound is safe, the exact distance is safe,
+ * too, and the scene is culled. Otherwise the bound is inconclusive and the scene takes the full extraction and
+ * checks.
+ *
+ * No situation is extracted from a culled scene. It is neither checked nor passed to the response resolving, which
+ * treats the object like an object seen for the first time once it comes near. That results in the response of
+ * both the longitudinal and the lateral conflict, so it is never less restrictive than the full evaluation.
+ *
+ * Scenes, which are failing the exact extraction (e.g. occupied regions not found within the road area), are never
+ * culled. The world model doesn't need to be within valid input range: the situation extraction checks the world
+ * model anyway.
+ */
+class RssBroadPhase : public RssSceneResults
+{
+public:
+  /**
+   * @brief Cull the scenes of the world model
+   *
+   * @param[in] worldModel the current world model
+   * @param[in] sceneResults optional results of scenes already known otherwise (e.g. unchanged scenes of the
+   * RssSceneCache). These scenes are not culled, but their results are provided by the broad phase. Can be nullptr.
+   */
+  void cullScenes(world::WorldModel const &worldModel, RssSceneResults const *sceneResults);
+
+  /**
+   * @brief Get the situation of a scene of the scene results passed to cullScenes()
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to cullScenes()
+   *
+   * @returns the situation of the scene, nullptr if the scene has to be extracted
+   */
+  situation::Situation const *getSituation(std::size_t const sceneIndex) const override;
+
+  /**
+   * @brief Get the response state of a scene of the scene results passed to cullScenes()
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to cullScenes()
+   *
+   * @returns the response state of the scene, nullptr if the situation of the scene has to be checked
+   */
+  state::ResponseState const *getResponseState(std::size_t const sceneIndex) const override;
+
+  /**
+   * @brief Check if a scene is culled
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to cullScenes()
+   *
+   * @returns true if the scene is culled by the last call of cullScenes()
+   */
+  bool isSceneCulled(std::size_t const sceneIndex) const override;
+
+  /**
+   * @returns the number of scenes culled by the last call of cullScenes()
+   */
+  std::size_t getNumberOfCulledScenes() const;
+
+private:
+  struct OccupiedRoadSegments
+  {
+    std::size_t first{0u};
+    std::size_t last{0u};
+    bool onPositiveLane{false};
+    bool onNegativeLane{false};
+  };
+
+  bool findOccupiedRoadSegments(world::RoadArea const &roadArea,
+                                world::OccupiedRegionVector const &occupiedRegions,
+                                OccupiedRoadSegments &segments);
+  bool calculateLongitudinalDistanceBound(world::RoadArea const &roadArea,
+                                          std::size_t const backRoadSegmentEnd,
+                                          std::size_t const frontRoadSegment,
+                                          physics::Distance &distanceBound) const;
+  bool cullScene(world::WorldModel const &worldModel, world::Scene const &scene);
+
+  RssSceneResults const *mSceneResults{nullptr};
+  std::vector<uint8_t> mCulledScenes;
+  std::size_t mNumberOfCulledScenes{0u};
+  std::vector<uint8_t> mRegionProcessed;
+};
+
+} // namespace core
+} // namespace ad_rss
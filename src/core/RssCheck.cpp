@@ -32,25 +32,143 @@
 #include "ad_rss/core/RssCheck.hpp"
 #include "ad_rss/core/RssResponseResolving.hpp"
 #include "ad_rss/core/RssResponseTransformation.hpp"
+#include "ad_rss/core/RssSafetyMargins.hpp"
 #include "ad_rss/core/RssSituationChecking.hpp"
 #include "ad_rss/core/RssSituationExtraction.hpp"
+#include "core/RssBroadPhase.hpp"
+#include "core/RssSceneCache.hpp"
+#include "core/RssSituationExtractionBuffer.hpp"
+#include "core/RssSituationPrediction.hpp"
+#include "core/RssResponseTransformationInputRangeChecked.hpp"
 #include "core/RssState.hpp"
+#include "core/RssTemporalCheck.hpp"
+#include "core/RssWorkerPool.hpp"
 
 namespace ad_rss {
 
 namespace core {
 
+namespace {
+
+/*!
+ * @brief take over the response states of the scenes provided by the scene results
+ *
+ * The situations are extracted from the relevant and not culled scenes in the order of the scenes.
+ */
+void provideReusedResponseStates(world::WorldModel const &worldModel,
+                                 RssSceneResults const &sceneResults,
+                                 situation::SituationVector const &situationVector,
+                                 state::ResponseStateVector &responseStateVector,
+                                 std::vector<uint8_t> &reusedResponseStates)
+{
+  responseStateVector.resize(situationVector.size());
+  reusedResponseStates.assign(situationVector.size(), 0u);
+
+  std::size_t situationIndex = 0u;
+  for (std::size_t sceneIndex = 0u;
+       (sceneIndex < worldModel.scenes.size()) && (situationIndex < situationVector.size());
+       sceneIndex++)
+  {
+    if (!isSituationExtracted(worldModel.scenes[sceneIndex], &sceneResults, sceneIndex))
+    {
+      continue;
+    }
+    state::ResponseState const *responseState = sceneResults.getResponseState(sceneIndex);
+    if (responseState != nullptr)
+    {
+      responseStateVector[situationIndex] = *responseState;
+      responseStateVector[situationIndex].timeIndex = worldModel.timeIndex;
+      reusedResponseStates[situationIndex] = 1u;
+    }
+    situationIndex++;
+  }
+}
+
+/*!
+ * @brief add the "all safe" response state if the world model contains no relevant object (or no objects at all)
+ */
+void provideSafeResponseStateIfEmpty(physics::TimeIndex const timeIndex,
+                                     state::ResponseStateVector &responseStateVector)
+{
+  if (responseStateVector.empty())
+  {
+    state::ResponseState const safeResponse
+      = state::createResponseState(timeIndex, situation::SituationId(0), state::IsSafe::Yes);
+    responseStateVector.push_back(safeResponse);
+  }
+}
+
+/*!
+ * @brief replace the ego vehicle state of the situation by the candidate
+ */
+void applyEgoCandidate(RssEgoCandidate const &candidate, situation::Situation &situation)
+{
+  situation.egoVehicleState.velocity = candidate.velocity;
+  situation.egoVehicleState.dynamics = candidate.dynamics;
+
+  situation::RelativePosition &relativePosition = situation.relativePosition;
+  if (relativePosition.lateralPosition == situation::LateralRelativePosition::AtLeft)
+  {
+    relativePosition.lateralDistance -= candidate.lateralOffset;
+  }
+  else if (relativePosition.lateralPosition == situation::LateralRelativePosition::AtRight)
+  {
+    relativePosition.lateralDistance += candidate.lateralOffset;
+  }
+  if (relativePosition.lateralDistance < physics::Distance(0.))
+  {
+    relativePosition.lateralPosition = situation::LateralRelativePosition::Overlap;
+    relativePosition.lateralDistance = physics::Distance(0.);
+  }
+}
+
+} // namespace
+
 RssCheck::RssCheck()
+  : RssCheck(RssCheckConfiguration())
 {
-  try
+}
+
+RssCheck::RssCheck(RssCheckConfiguration const &configuration)
+{
+  AD_RSS_TRY
   {
     mResponseResolving = std::unique_ptr<RssResponseResolving>(new RssResponseResolving());
     mSituationChecking = std::unique_ptr<RssSituationChecking>(new RssSituationChecking());
+    mExtractionBuffer
+      = std::unique_ptr<RssSituationExtraction::ExtractionBuffer>(new RssSituationExtraction::ExtractionBuffer());
+    if (configuration.numberOfWorkerThreads > 0u)
+    {
+      mWorkerPool = std::unique_ptr<RssWorkerPool>(new RssWorkerPool(configuration.numberOfWorkerThreads));
+      mParallelExtractionBuffer = std::unique_ptr<RssSituationExtraction::ParallelExtractionBuffer>(
+        new RssSituationExtraction::ParallelExtractionBuffer());
+    }
+    if (configuration.enableIncrementalEvaluation)
+    {
+      mSceneCache = std::unique_ptr<RssSceneCache>(new RssSceneCache());
+    }
+    if (configuration.enableBroadPhaseCulling)
+    {
+      mBroadPhase = std::unique_ptr<RssBroadPhase>(new RssBroadPhase());
+    }
+    if (configuration.enableBatchEvaluation)
+    {
+      mSituationChecking->enableBatchEvaluation();
+    }
+    if (configuration.enableLazyReevaluation)
+    {
+      mSituationChecking->enableLazyReevaluation(configuration.maximumTimeStepDuration);
+    }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     mResponseResolving = nullptr;
     mSituationChecking = nullptr;
+    mExtractionBuffer = nullptr;
+    mWorkerPool = nullptr;
+    mParallelExtractionBuffer = nullptr;
+    mSceneCache = nullptr;
+    mBroadPhase = nullptr;
   }
 }
 
@@ -63,51 +181,348 @@ bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldMo
 {
   bool result = false;
   // global try catch block to ensure this library call doesn't throw an exception
-  try
+  AD_RSS_TRY
   {
-    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking))
+    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking)
+        || !static_cast<bool>(mExtractionBuffer))
     {
       return false;
     }
 
-    situation::SituationVector situationVector;
-    result = RssSituationExtraction::extractSituations(worldModel, situationVector);
+    // the buffers keep their capacity, so clearing them doesn't release any memory
+    mSituationVector.clear();
+    mResponseStateVector.clear();
 
-    state::ResponseStateVector responseStateVector;
-    if (result)
+    RssSceneResults const *sceneResults = nullptr;
+    if (static_cast<bool>(mSceneCache))
     {
-      result = mSituationChecking->checkSituations(situationVector, responseStateVector);
+      mSceneCache->findUnchangedScenes(worldModel);
+      sceneResults = mSceneCache.get();
+    }
+    if (static_cast<bool>(mBroadPhase))
+    {
+      // the broad phase forwards the results of the unchanged scenes
+      mBroadPhase->cullScenes(worldModel, sceneResults);
+      sceneResults = mBroadPhase.get();
     }
 
-    if (result && responseStateVector.empty())
+    if (static_cast<bool>(mWorkerPool))
+    {
+      result = RssSituationExtraction::extractSituations(
+        worldModel, mSituationVector, *mParallelExtractionBuffer, *mWorkerPool, sceneResults);
+    }
+    else
     {
-      // if the worldModel contains no relevant object (or no objects at all)
-      // the responseStateVector will be empty. Thus, we need to add a "all safe" response
-      state::ResponseState const safeResponse
-        = state::createResponseState(worldModel.timeIndex, situation::SituationId(0), state::IsSafe::Yes);
-      responseStateVector.push_back(safeResponse);
+      result
+        = RssSituationExtraction::extractSituations(worldModel, mSituationVector, *mExtractionBuffer, sceneResults);
     }
 
-    state::ResponseState properResponse;
+    // the world model has been checked to be within valid input range by the situation extraction, the following
+    // steps only check the data they derive from it: the situations and the resulting response states
+    if (result)
+    {
+      mReusedResponseStates.clear();
+      if (sceneResults != nullptr)
+      {
+        provideReusedResponseStates(
+          worldModel, *sceneResults, mSituationVector, mResponseStateVector, mReusedResponseStates);
+      }
+      result = mSituationChecking->checkSituations(
+        mSituationVector, mResponseStateVector, mReusedResponseStates, mWorkerPool.get());
+    }
+
+    if (static_cast<bool>(mSceneCache))
+    {
+      if (result)
+      {
+        mSceneCache->update(worldModel, sceneResults, mSituationVector, mResponseStateVector);
+      }
+      else
+      {
+        mSceneCache->clear();
+      }
+    }
 
     if (result)
     {
-      result = mResponseResolving->provideProperResponse(responseStateVector, properResponse);
+      result = resolveResponse(worldModel, mResponseStateVector, accelerationRestriction);
     }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
 
+bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                situation::SituationVector &situationVector,
+                                                state::ResponseStateVector &responseStateVector)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    situationVector.clear();
+    responseStateVector.clear();
+    result = calculateAccelerationRestriction(worldModel, accelerationRestriction);
     if (result)
     {
-      result = RssResponseTransformation::transformProperResponse(worldModel, properResponse, accelerationRestriction);
+      // assignment reuses the capacity of the output vectors
+      situationVector = mSituationVector;
+      responseStateVector = mResponseStateVector;
     }
   }
   // LCOV_EXCL_START: unreachable code, keep to be on the safe side
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
+    situationVector.clear();
+    responseStateVector.clear();
     result = false;
   }
   // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
   return result;
 }
 
+bool RssCheck::evaluateCandidates(world::WorldModel const &worldModel,
+                                  RssEgoCandidateVector const &candidates,
+                                  state::ResponseStateVector &candidateResponseStates)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    candidateResponseStates.clear();
+    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking)
+        || !static_cast<bool>(mExtractionBuffer))
+    {
+      return false;
+    }
+    // the situations are extracted once into the buffer of the regular processing, without the scene results
+    mSituationVector.clear();
+    if (static_cast<bool>(mWorkerPool))
+    {
+      result = RssSituationExtraction::extractSituations(
+        worldModel, mSituationVector, *mParallelExtractionBuffer, *mWorkerPool, nullptr);
+    }
+    else
+    {
+      result = RssSituationExtraction::extractSituations(worldModel, mSituationVector, *mExtractionBuffer, nullptr);
+    }
+
+    std::vector<uint8_t> const noReusedResponseStates;
+    for (auto it = candidates.begin(); result && (it != candidates.end()); it++)
+    {
+      // assignment reuses the capacity of the side buffers
+      mSideSituationVector = mSituationVector;
+      for (auto &situation : mSideSituationVector)
+      {
+        applyEgoCandidate(*it, situation);
+      }
+
+      // the input range of the modified situations is checked by the situation checking
+      result = assignSideState()
+        && mSideSituationChecking->checkSituations(
+             mSideSituationVector, mSideResponseStateVector, noReusedResponseStates, mWorkerPool.get());
+      if (result)
+      {
+        provideSafeResponseStateIfEmpty(worldModel.timeIndex, mSideResponseStateVector);
+        state::ResponseState properResponse;
+        result = mSideResponseResolving->provideProperResponseInputRangeChecked(mSideResponseStateVector,
+                                                                               properResponse);
+        if (result)
+        {
+          candidateResponseStates.push_back(properResponse);
+        }
+      }
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  if (!result)
+  {
+    candidateResponseStates.clear();
+  }
+  return result;
+}
+
+bool RssCheck::checkTrajectoryRollout(situation::SituationVector const &situationVector,
+                                      RssTrajectoryRollout const &rollout,
+                                      RssRolloutResult &rolloutResult)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    rolloutResult = RssRolloutResult();
+    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking)
+        || (rollout.stepDuration <= physics::Duration(0.)))
+    {
+      return false;
+    }
+    for (auto const &step : rollout.steps)
+    {
+      if (!step.objectKinematics.empty() && (step.objectKinematics.size() != situationVector.size()))
+      {
+        return false;
+      }
+    }
+
+    // the steps follow the time step processed last
+    physics::TimeIndex const timeIndex = mSituationChecking->mCurrentTimeIndex;
+    result = assignSideState()
+      && RssSituationPrediction::predictSituations(situationVector, rollout, timeIndex, mSideSituationVector)
+      && mSideSituationChecking->checkSituationSequence(
+           mSideSituationVector, situationVector.size(), mSideResponseStateVector);
+
+    rolloutResult.stepResults.resize(rollout.steps.size());
+    for (std::size_t step = 0u; result && (step < rollout.steps.size()); step++)
+    {
+      RssRolloutStepResult &stepResult = rolloutResult.stepResults[step];
+      stepResult.timeIndex = timeIndex + static_cast<physics::TimeIndex>(step + 1u);
+
+      std::size_t const begin = step * situationVector.size();
+      auto const beginIt = mSideResponseStateVector.begin() + static_cast<std::ptrdiff_t>(begin);
+      mSideStepResponseStateVector.assign(beginIt, beginIt + static_cast<std::ptrdiff_t>(situationVector.size()));
+      provideSafeResponseStateIfEmpty(stepResult.timeIndex, mSideStepResponseStateVector);
+      result = mSideResponseResolving->provideProperResponseInputRangeChecked(mSideStepResponseStateVector,
+                                                                             stepResult.properResponse);
+
+      stepResult.safetyMargins.resize(situationVector.size());
+      for (std::size_t i = 0u; result && (i < situationVector.size()); i++)
+      {
+        result = RssSafetyMarginCalculation::calculateSafetyMargins(mSideSituationVector[begin + i],
+                                                                    stepResult.safetyMargins[i]);
+      }
+
+      if (result && rolloutResult.isSafe && isDangerous(stepResult.properResponse))
+      {
+        rolloutResult.isSafe = false;
+        rolloutResult.firstUnsafeStep = step;
+      }
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  if (!result)
+  {
+    rolloutResult = RssRolloutResult();
+  }
+  return result;
+}
+
+bool RssCheck::assignSideState()
+{
+  // the copies of the state are only required by the evaluations on the side, so these are created on first use
+  if (!static_cast<bool>(mSideResponseResolving))
+  {
+    mSideResponseResolving = std::unique_ptr<RssResponseResolving>(new RssResponseResolving());
+  }
+  if (!static_cast<bool>(mSideSituationChecking))
+  {
+    mSideSituationChecking = std::unique_ptr<RssSituationChecking>(new RssSituationChecking());
+  }
+  return mSideSituationChecking->assignState(*mSituationChecking)
+    && mSideResponseResolving->assignState(*mResponseResolving);
+}
+
+bool RssCheck::resolveResponse(world::WorldModel const &worldModel,
+                               state::ResponseStateVector &responseStateVector,
+                               world::AccelerationRestriction &accelerationRestriction)
+{
+  provideSafeResponseStateIfEmpty(worldModel.timeIndex, responseStateVector);
+
+  state::ResponseState properResponse;
+  bool result = mResponseResolving->provideProperResponseInputRangeChecked(responseStateVector, properResponse);
+  if (result)
+  {
+    result = RssResponseTransformation::transformProperResponseInputRangeChecked(
+      worldModel, properResponse, accelerationRestriction);
+  }
+  return result;
+}
+
+void RssCheck::initializeTickBuffer(RssCheckTickBuffer &tick) const
+{
+  if (static_cast<bool>(mSituationChecking))
+  {
+    mSituationChecking->initializeCheckBuffer(tick.situationCheckBuffer);
+  }
+  if (static_cast<bool>(mBroadPhase))
+  {
+    tick.broadPhase = std::unique_ptr<RssBroadPhase>(new RssBroadPhase());
+  }
+}
+
+void RssCheck::checkStatelessStages(RssCheckTickBuffer &tick) const
+{
+  tick.extractionResult = false;
+  tick.situationVector.clear();
+  tick.responseStateVector.clear();
+  if (!tick.worldModelValid || !static_cast<bool>(mSituationChecking))
+  {
+    return;
+  }
+  AD_RSS_TRY
+  {
+    if (static_cast<bool>(tick.broadPhase))
+    {
+      tick.broadPhase->cullScenes(tick.worldModel, nullptr);
+    }
+    tick.extractionResult = RssSituationExtraction::extractSituations(
+      tick.worldModel, tick.situationVector, tick.extractionBuffer, tick.broadPhase.get());
+    if (tick.extractionResult)
+    {
+      mSituationChecking->checkStatelessSituations(
+        tick.situationVector, tick.responseStateVector, std::vector<uint8_t>(), nullptr, tick.situationCheckBuffer);
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    tick.extractionResult = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+}
+
+void RssCheck::checkStatefulStages(RssCheckTickBuffer &tick)
+{
+  tick.result = false;
+  AD_RSS_TRY
+  {
+    // as within calculateAccelerationRestriction(), the situations are only checked if the extraction succeeded
+    if (tick.extractionResult && static_cast<bool>(mResponseResolving) && static_cast<bool>(mSituationChecking))
+    {
+      tick.result = mSituationChecking->checkStatefulSituations(
+        tick.situationVector, tick.responseStateVector, tick.situationCheckBuffer);
+      if (tick.result)
+      {
+        tick.result = resolveResponse(tick.worldModel, tick.responseStateVector, tick.accelerationRestriction);
+      }
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    tick.result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  if (!tick.result)
+  {
+    tick.situationVector.clear();
+    tick.responseStateVector.clear();
+  }
+}
+
 } // namespace core
 } // namespace ad_rss
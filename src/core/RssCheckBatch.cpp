@@ -0,0 +1,158 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssCheckBatch.hpp"
+#include <thread>
+#include "ad_rss/core/RssCheck.hpp"
+#include "core/RssWorkerPool.hpp"
+
+namespace ad_rss {
+
+namespace core {
+
+namespace {
+
+/*!
+ * @brief task performing the checks of the batch entries within the worker pool
+ */
+class BatchCheckTask : public RssWorkerPool::Task
+{
+public:
+  BatchCheckTask(std::vector<std::unique_ptr<RssCheck>> &rssChecks,
+                 world::WorldModel const *worldModels,
+                 world::AccelerationRestriction *accelerationRestrictions,
+                 std::vector<uint8_t> &checkResults)
+    : mRssChecks(rssChecks)
+    , mWorldModels(worldModels)
+    , mAccelerationRestrictions(accelerationRestrictions)
+    , mCheckResults(checkResults)
+  {
+  }
+
+  void execute(std::size_t const, std::size_t const itemIndex) override
+  {
+    bool const result = mRssChecks[itemIndex]->calculateAccelerationRestriction(
+      mWorldModels[itemIndex], mAccelerationRestrictions[itemIndex]);
+    mCheckResults[itemIndex] = result ? 1u : 0u;
+  }
+
+private:
+  std::vector<std::unique_ptr<RssCheck>> &mRssChecks;
+  world::WorldModel const *mWorldModels;
+  world::AccelerationRestriction *mAccelerationRestrictions;
+  std::vector<uint8_t> &mCheckResults;
+};
+
+uint32_t getDefaultNumberOfWorkerThreads()
+{
+  uint32_t const numberOfCores = std::thread::hardware_concurrency();
+  if (numberOfCores > 1u)
+  {
+    return numberOfCores - 1u;
+  }
+  return 0u;
+}
+
+} // namespace
+
+RssCheckBatch::RssCheckBatch(std::size_t const batchSize, uint32_t const numberOfWorkerThreads)
+{
+  AD_RSS_TRY
+  {
+    mRssChecks.reserve(batchSize);
+    for (std::size_t i = 0u; i < batchSize; i++)
+    {
+      mRssChecks.push_back(std::unique_ptr<RssCheck>(new RssCheck()));
+    }
+    mCheckResults.resize(batchSize, 0u);
+    mWorkerPool = std::unique_ptr<RssWorkerPool>(new RssWorkerPool(numberOfWorkerThreads));
+  }
+  AD_RSS_CATCH_ALL
+  {
+    mRssChecks.clear();
+    mCheckResults.clear();
+    mWorkerPool = nullptr;
+  }
+}
+
+RssCheckBatch::RssCheckBatch(std::size_t const batchSize)
+  : RssCheckBatch(batchSize, getDefaultNumberOfWorkerThreads())
+{
+}
+
+RssCheckBatch::~RssCheckBatch()
+{
+}
+
+std::size_t RssCheckBatch::getBatchSize() const
+{
+  return mRssChecks.size();
+}
+
+bool RssCheckBatch::calculateAccelerationRestrictions(world::WorldModel const *worldModels,
+                                                      std::size_t const numberOfWorldModels,
+                                                      world::AccelerationRestriction *accelerationRestrictions,
+                                                      bool *checkResults)
+{
+  if (!static_cast<bool>(mWorkerPool) || (numberOfWorldModels != mRssChecks.size()) || (worldModels == nullptr)
+      || (accelerationRestrictions == nullptr))
+  {
+    return false;
+  }
+
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    BatchCheckTask task(mRssChecks, worldModels, accelerationRestrictions, mCheckResults);
+    mWorkerPool->execute(task, numberOfWorldModels);
+
+    for (std::size_t i = 0u; i < numberOfWorldModels; i++)
+    {
+      bool const checkResult = (mCheckResults[i] != 0u);
+      if (checkResults != nullptr)
+      {
+        checkResults[i] = checkResult;
+      }
+      result = result && checkResult;
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,515 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssLogReader.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ad_rss {
+
+namespace core {
+
+namespace {
+
+world::Dynamics readDynamics(RssLogDynamicsRecord const &record)
+{
+  world::Dynamics dynamics;
+  dynamics.alphaLon.accelMax = physics::Acceleration(record.lonAccelMax);
+  dynamics.alphaLon.brakeMax = physics::Acceleration(record.lonBrakeMax);
+  dynamics.alphaLon.brakeMin = physics::Acceleration(record.lonBrakeMin);
+  dynamics.alphaLon.brakeMinCorrect = physics::Acceleration(record.lonBrakeMinCorrect);
+  dynamics.alphaLat.accelMax = physics::Acceleration(record.latAccelMax);
+  dynamics.alphaLat.brakeMin = physics::Acceleration(record.latBrakeMin);
+  dynamics.lateralFluctuationMargin = physics::Distance(record.lateralFluctuationMargin);
+  return dynamics;
+}
+
+situation::VehicleState readVehicleState(RssLogVehicleStateRecord const &record)
+{
+  situation::VehicleState vehicleState;
+  vehicleState.velocity.speedLon = physics::Speed(record.speedLon);
+  vehicleState.velocity.speedLat = physics::Speed(record.speedLat);
+  vehicleState.dynamics = readDynamics(record.dynamics);
+  vehicleState.responseTime = physics::Duration(record.responseTime);
+  vehicleState.hasPriority = (record.hasPriority != 0u);
+  vehicleState.isInCorrectLane = (record.isInCorrectLane != 0u);
+  vehicleState.distanceToEnterIntersection = physics::Distance(record.distanceToEnterIntersection);
+  vehicleState.distanceToLeaveIntersection = physics::Distance(record.distanceToLeaveIntersection);
+  return vehicleState;
+}
+
+template <typename RssState> void readRssState(RssLogRssStateRecord const &record, RssState &rssState)
+{
+  rssState.isSafe = (record.isSafe != 0u);
+  rssState.response = static_cast<decltype(rssState.response)>(record.response);
+  rssState.responseInformation.safeDistance = physics::Distance(record.safeDistance);
+  rssState.responseInformation.currentDistance = physics::Distance(record.currentDistance);
+  rssState.responseInformation.responseEvaluator = static_cast<state::ResponseEvaluator>(record.responseEvaluator);
+}
+
+void decodeRoadArea(RssLogRoadAreaView const &roadAreaView, world::RoadArea &roadArea)
+{
+  roadArea.resize(roadAreaView.size());
+  for (std::size_t i = 0u; i < roadAreaView.size(); i++)
+  {
+    RssLogRoadSegmentView const roadSegmentView = roadAreaView[i];
+    world::RoadSegment &roadSegment = roadArea[i];
+    roadSegment.resize(roadSegmentView.size());
+    for (std::size_t j = 0u; j < roadSegmentView.size(); j++)
+    {
+      roadSegment[j] = roadSegmentView[j];
+    }
+  }
+}
+
+/*!
+ * @brief the validation of the arrays of a tick record
+ */
+class TickRecordValidation
+{
+public:
+  TickRecordValidation(uint8_t const *tickRecord, std::size_t const size)
+    : mTickRecord(tickRecord)
+    , mSize(size)
+  {
+  }
+
+  bool isArrayValid(RssLogArrayRef const &arrayRef, std::size_t const recordSize) const
+  {
+    return (arrayRef.offset >= sizeof(RssLogTickRecord)) && (arrayRef.offset % cRssLogAlignment == 0u)
+      && (static_cast<uint64_t>(arrayRef.offset) + static_cast<uint64_t>(arrayRef.count) * recordSize <= mSize);
+  }
+
+  bool isObjectValid(RssLogObjectRecord const &object) const
+  {
+    return isArrayValid(object.occupiedRegions, sizeof(RssLogOccupiedRegionRecord));
+  }
+
+  bool isRoadAreaValid(RssLogArrayRef const &roadArea) const
+  {
+    if (!isArrayValid(roadArea, sizeof(RssLogArrayRef)))
+    {
+      return false;
+    }
+    for (std::size_t i = 0u; i < roadArea.count; i++)
+    {
+      RssLogArrayRef const roadSegment
+        = loadRssLogRecord<RssLogArrayRef>(mTickRecord + roadArea.offset + i * sizeof(RssLogArrayRef));
+      if (!isArrayValid(roadSegment, sizeof(RssLogLaneSegmentRecord)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isSceneValid(RssLogSceneRecord const &scene) const
+  {
+    return isRoadAreaValid(scene.egoVehicleRoad) && isRoadAreaValid(scene.intersectingRoad)
+      && isObjectValid(scene.object);
+  }
+
+  bool isTickValid(RssLogTickRecord const &tick) const
+  {
+    if (!isObjectValid(tick.egoVehicle) || !isArrayValid(tick.scenes, sizeof(RssLogSceneRecord))
+        || !isArrayValid(tick.situations, sizeof(RssLogSituationRecord))
+        || !isArrayValid(tick.responseStates, sizeof(RssLogResponseStateRecord)))
+    {
+      return false;
+    }
+    for (std::size_t i = 0u; i < tick.scenes.count; i++)
+    {
+      if (!isSceneValid(
+            loadRssLogRecord<RssLogSceneRecord>(mTickRecord + tick.scenes.offset + i * sizeof(RssLogSceneRecord))))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  uint8_t const *mTickRecord;
+  std::size_t mSize;
+};
+
+} // namespace
+
+world::OccupiedRegion RssLogElement<world::OccupiedRegion>::read(uint8_t const *, uint8_t const *record)
+{
+  RssLogOccupiedRegionRecord const occupiedRegionRecord = loadRssLogRecord<RssLogOccupiedRegionRecord>(record);
+  world::OccupiedRegion occupiedRegion;
+  occupiedRegion.segmentId = occupiedRegionRecord.segmentId;
+  occupiedRegion.lonRange.minimum = physics::ParametricValue(occupiedRegionRecord.lonRangeMinimum);
+  occupiedRegion.lonRange.maximum = physics::ParametricValue(occupiedRegionRecord.lonRangeMaximum);
+  occupiedRegion.latRange.minimum = physics::ParametricValue(occupiedRegionRecord.latRangeMinimum);
+  occupiedRegion.latRange.maximum = physics::ParametricValue(occupiedRegionRecord.latRangeMaximum);
+  return occupiedRegion;
+}
+
+world::LaneSegment RssLogElement<world::LaneSegment>::read(uint8_t const *, uint8_t const *record)
+{
+  RssLogLaneSegmentRecord const laneSegmentRecord = loadRssLogRecord<RssLogLaneSegmentRecord>(record);
+  world::LaneSegment laneSegment;
+  laneSegment.id = laneSegmentRecord.id;
+  laneSegment.type = static_cast<world::LaneSegmentType>(laneSegmentRecord.type);
+  laneSegment.drivingDirection = static_cast<world::LaneDrivingDirection>(laneSegmentRecord.drivingDirection);
+  laneSegment.length.minimum = physics::Distance(laneSegmentRecord.lengthMinimum);
+  laneSegment.length.maximum = physics::Distance(laneSegmentRecord.lengthMaximum);
+  laneSegment.width.minimum = physics::Distance(laneSegmentRecord.widthMinimum);
+  laneSegment.width.maximum = physics::Distance(laneSegmentRecord.widthMaximum);
+  return laneSegment;
+}
+
+situation::Situation RssLogElement<situation::Situation>::read(uint8_t const *, uint8_t const *record)
+{
+  RssLogSituationRecord const situationRecord = loadRssLogRecord<RssLogSituationRecord>(record);
+  situation::Situation situation;
+  situation.timeIndex = situationRecord.timeIndex;
+  situation.situationId = situationRecord.situationId;
+  situation.situationType = static_cast<situation::SituationType>(situationRecord.situationType);
+  situation.egoVehicleState = readVehicleState(situationRecord.egoVehicleState);
+  situation.otherVehicleState = readVehicleState(situationRecord.otherVehicleState);
+  situation.relativePosition.longitudinalPosition
+    = static_cast<situation::LongitudinalRelativePosition>(situationRecord.longitudinalPosition);
+  situation.relativePosition.longitudinalDistance = physics::Distance(situationRecord.longitudinalDistance);
+  situation.relativePosition.lateralPosition
+    = static_cast<situation::LateralRelativePosition>(situationRecord.lateralPosition);
+  situation.relativePosition.lateralDistance = physics::Distance(situationRecord.lateralDistance);
+  return situation;
+}
+
+state::ResponseState RssLogElement<state::ResponseState>::read(uint8_t const *, uint8_t const *record)
+{
+  RssLogResponseStateRecord const responseStateRecord = loadRssLogRecord<RssLogResponseStateRecord>(record);
+  state::ResponseState responseState;
+  responseState.timeIndex = responseStateRecord.timeIndex;
+  responseState.situationId = responseStateRecord.situationId;
+  readRssState(responseStateRecord.longitudinalState, responseState.longitudinalState);
+  readRssState(responseStateRecord.lateralStateRight, responseState.lateralStateRight);
+  readRssState(responseStateRecord.lateralStateLeft, responseState.lateralStateLeft);
+  return responseState;
+}
+
+world::ObjectId RssLogObjectView::getObjectId() const
+{
+  return loadRssLogRecord<RssLogObjectRecord>(mObjectRecord).objectId;
+}
+
+world::ObjectType RssLogObjectView::getObjectType() const
+{
+  return static_cast<world::ObjectType>(loadRssLogRecord<RssLogObjectRecord>(mObjectRecord).objectType);
+}
+
+RssLogArrayView<world::OccupiedRegion> RssLogObjectView::getOccupiedRegions() const
+{
+  return RssLogArrayView<world::OccupiedRegion>(mTickRecord,
+                                                loadRssLogRecord<RssLogObjectRecord>(mObjectRecord).occupiedRegions);
+}
+
+world::Dynamics RssLogObjectView::getDynamics() const
+{
+  return readDynamics(loadRssLogRecord<RssLogObjectRecord>(mObjectRecord).dynamics);
+}
+
+world::Velocity RssLogObjectView::getVelocity() const
+{
+  RssLogObjectRecord const objectRecord = loadRssLogRecord<RssLogObjectRecord>(mObjectRecord);
+  world::Velocity velocity;
+  velocity.speedLon = physics::Speed(objectRecord.speedLon);
+  velocity.speedLat = physics::Speed(objectRecord.speedLat);
+  return velocity;
+}
+
+physics::Duration RssLogObjectView::getResponseTime() const
+{
+  return physics::Duration(loadRssLogRecord<RssLogObjectRecord>(mObjectRecord).responseTime);
+}
+
+void RssLogObjectView::decode(world::Object &object) const
+{
+  object.objectId = getObjectId();
+  object.objectType = getObjectType();
+  RssLogArrayView<world::OccupiedRegion> const occupiedRegions = getOccupiedRegions();
+  object.occupiedRegions.resize(occupiedRegions.size());
+  for (std::size_t i = 0u; i < occupiedRegions.size(); i++)
+  {
+    object.occupiedRegions[i] = occupiedRegions[i];
+  }
+  object.dynamics = getDynamics();
+  object.velocity = getVelocity();
+  object.responseTime = getResponseTime();
+}
+
+situation::SituationType RssLogSceneView::getSituationType() const
+{
+  return static_cast<situation::SituationType>(loadRssLogRecord<RssLogSceneRecord>(mSceneRecord).situationType);
+}
+
+RssLogRoadAreaView RssLogSceneView::getEgoVehicleRoad() const
+{
+  return RssLogRoadAreaView(mTickRecord, loadRssLogRecord<RssLogSceneRecord>(mSceneRecord).egoVehicleRoad);
+}
+
+RssLogRoadAreaView RssLogSceneView::getIntersectingRoad() const
+{
+  return RssLogRoadAreaView(mTickRecord, loadRssLogRecord<RssLogSceneRecord>(mSceneRecord).intersectingRoad);
+}
+
+RssLogObjectView RssLogSceneView::getObject() const
+{
+  return RssLogObjectView(mTickRecord, mSceneRecord + offsetof(RssLogSceneRecord, object));
+}
+
+void RssLogSceneView::decode(world::Scene &scene) const
+{
+  scene.situationType = getSituationType();
+  decodeRoadArea(getEgoVehicleRoad(), scene.egoVehicleRoad);
+  decodeRoadArea(getIntersectingRoad(), scene.intersectingRoad);
+  getObject().decode(scene.object);
+}
+
+RssLogTickRecord RssLogTickView::getTickRecord() const
+{
+  return loadRssLogRecord<RssLogTickRecord>(mTickRecord);
+}
+
+physics::TimeIndex RssLogTickView::getTimeIndex() const
+{
+  return getTickRecord().timeIndex;
+}
+
+RssLogObjectView RssLogTickView::getEgoVehicle() const
+{
+  return RssLogObjectView(mTickRecord, mTickRecord + offsetof(RssLogTickRecord, egoVehicle));
+}
+
+RssLogArrayView<RssLogSceneView> RssLogTickView::getScenes() const
+{
+  return RssLogArrayView<RssLogSceneView>(mTickRecord, getTickRecord().scenes);
+}
+
+RssLogArrayView<situation::Situation> RssLogTickView::getSituations() const
+{
+  return RssLogArrayView<situation::Situation>(mTickRecord, getTickRecord().situations);
+}
+
+RssLogArrayView<state::ResponseState> RssLogTickView::getResponseStates() const
+{
+  return RssLogArrayView<state::ResponseState>(mTickRecord, getTickRecord().responseStates);
+}
+
+void RssLogTickView::decode(world::WorldModel &worldModel) const
+{
+  worldModel.timeIndex = getTimeIndex();
+  getEgoVehicle().decode(worldModel.egoVehicle);
+  RssLogArrayView<RssLogSceneView> const scenes = getScenes();
+  worldModel.scenes.resize(scenes.size());
+  for (std::size_t i = 0u; i < scenes.size(); i++)
+  {
+    scenes[i].decode(worldModel.scenes[i]);
+  }
+}
+
+void RssLogTickView::decode(situation::SituationVector &situationVector) const
+{
+  RssLogArrayView<situation::Situation> const situations = getSituations();
+  situationVector.resize(situations.size());
+  for (std::size_t i = 0u; i < situations.size(); i++)
+  {
+    situationVector[i] = situations[i];
+  }
+}
+
+void RssLogTickView::decode(state::ResponseStateVector &responseStateVector) const
+{
+  RssLogArrayView<state::ResponseState> const responseStates = getResponseStates();
+  responseStateVector.resize(responseStates.size());
+  for (std::size_t i = 0u; i < responseStates.size(); i++)
+  {
+    responseStateVector[i] = responseStates[i];
+  }
+}
+
+RssLogReader::~RssLogReader()
+{
+  close();
+}
+
+bool RssLogReader::open(std::string const &fileName)
+{
+  close();
+  int const fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+  {
+    return false;
+  }
+  struct stat fileStatus;
+  bool result = (::fstat(fileDescriptor, &fileStatus) == 0) && (fileStatus.st_size > 0);
+  void *mapping = nullptr;
+  std::size_t size = 0u;
+  if (result)
+  {
+    size = static_cast<std::size_t>(fileStatus.st_size);
+    mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    result = (mapping != MAP_FAILED);
+  }
+  // the mapping stays valid after closing the file
+  ::close(fileDescriptor);
+  if (!result)
+  {
+    return false;
+  }
+
+  result = open(static_cast<uint8_t const *>(mapping), size);
+  if (result)
+  {
+    mMapping = mapping;
+  }
+  else
+  {
+    ::munmap(mapping, size);
+  }
+  return result;
+}
+
+bool RssLogReader::open(uint8_t const *data, std::size_t const size)
+{
+  close();
+  if ((data == nullptr) || (size < sizeof(RssLogFileHeader) + sizeof(RssLogFileFooter)))
+  {
+    return false;
+  }
+
+  RssLogFileHeader const header = loadRssLogRecord<RssLogFileHeader>(data);
+  if ((std::memcmp(header.magic, cRssLogFileMagic, sizeof(cRssLogFileMagic)) != 0)
+      || (header.version != cRssLogVersion) || (header.byteOrderMark != cRssLogByteOrderMark))
+  {
+    return false;
+  }
+
+  RssLogFileFooter const footer = loadRssLogRecord<RssLogFileFooter>(data + size - sizeof(RssLogFileFooter));
+  uint64_t const tickIndexEnd = size - sizeof(RssLogFileFooter);
+  if ((std::memcmp(footer.magic, cRssLogIndexMagic, sizeof(cRssLogIndexMagic)) != 0)
+      || (footer.tickIndexOffset < sizeof(RssLogFileHeader)) || (footer.tickIndexOffset > tickIndexEnd)
+      || (footer.tickCount > (tickIndexEnd - footer.tickIndexOffset) / sizeof(RssLogTickIndexEntry)))
+  {
+    return false;
+  }
+
+  mData = data;
+  mSize = size;
+  mTickIndex = data + footer.tickIndexOffset;
+  mNumberOfTicks = static_cast<std::size_t>(footer.tickCount);
+
+  // the tick records have to be located in front of the tick index and in order of increasing time index
+  for (std::size_t i = 0u; i < mNumberOfTicks; i++)
+  {
+    RssLogTickIndexEntry const entry = getTickIndexEntry(i);
+    bool const entryValid = (entry.offset >= sizeof(RssLogFileHeader)) && (entry.size >= sizeof(RssLogTickRecord))
+      && (entry.offset <= footer.tickIndexOffset) && (entry.size <= footer.tickIndexOffset - entry.offset)
+      && ((i == 0u) || (getTickIndexEntry(i - 1u).timeIndex < entry.timeIndex));
+    if (!entryValid)
+    {
+      close();
+      return false;
+    }
+  }
+  return true;
+}
+
+void RssLogReader::close()
+{
+  if (mMapping != nullptr)
+  {
+    ::munmap(mMapping, mSize);
+  }
+  mData = nullptr;
+  mSize = 0u;
+  mMapping = nullptr;
+  mTickIndex = nullptr;
+  mNumberOfTicks = 0u;
+}
+
+std::size_t RssLogReader::getNumberOfTicks() const
+{
+  return mNumberOfTicks;
+}
+
+RssLogTickIndexEntry RssLogReader::getTickIndexEntry(std::size_t const tickNumber) const
+{
+  return loadRssLogRecord<RssLogTickIndexEntry>(mTickIndex + tickNumber * sizeof(RssLogTickIndexEntry));
+}
+
+bool RssLogReader::getTick(std::size_t const tickNumber, RssLogTickView &tick) const
+{
+  if (tickNumber >= mNumberOfTicks)
+  {
+    return false;
+  }
+  RssLogTickIndexEntry const entry = getTickIndexEntry(tickNumber);
+  uint8_t const *tickRecordData = mData + entry.offset;
+  RssLogTickRecord const tickRecord = loadRssLogRecord<RssLogTickRecord>(tickRecordData);
+  if ((tickRecord.size != entry.size) || (tickRecord.timeIndex != entry.timeIndex)
+      || !TickRecordValidation(tickRecordData, static_cast<std::size_t>(entry.size)).isTickValid(tickRecord))
+  {
+    return false;
+  }
+  tick = RssLogTickView(tickRecordData);
+  return true;
+}
+
+bool RssLogReader::findTick(physics::TimeIndex const timeIndex, std::size_t &tickNumber) const
+{
+  // binary search within the tick index, the time indices are increasing
+  std::size_t first = 0u;
+  std::size_t count = mNumberOfTicks;
+  while (count > 0u)
+  {
+    std::size_t const step = count / 2u;
+    if (getTickIndexEntry(first + step).timeIndex < timeIndex)
+    {
+      first += step + 1u;
+      count -= step + 1u;
+    }
+    else
+    {
+      count = step;
+    }
+  }
+  tickNumber = first;
+  return first < mNumberOfTicks;
+}
+
+} // namespace core
+} // namespace ad_rss
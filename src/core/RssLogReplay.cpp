@@ -0,0 +1,420 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssLogReplay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/physics/RangeError.hpp"
+#include "core/RssTemporalCheck.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+/**
+ * @brief a decoded tick of the log
+ */
+struct DecodedTick
+{
+  world::WorldModel worldModel;
+  bool valid{false};
+};
+
+bool decodeTick(RssLogReader const &reader, std::size_t const tickNumber, world::WorldModel &worldModel)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    RssLogTickView tick;
+    result = reader.getTick(tickNumber, tick);
+    if (result)
+    {
+      tick.decode(worldModel);
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+/**
+ * @brief decoding of the ticks of a log by a separate reader thread ahead of their use
+ *
+ * The ticks are decoded into a ring of slots. A slot is reused by the reader thread once the tick decoded into it has
+ * been released by the consumer.
+ */
+class TickReadAhead
+{
+public:
+  TickReadAhead(RssLogReader const &reader, std::size_t const numberOfSlots)
+    : mReader(reader)
+    , mSlots(numberOfSlots)
+  {
+  }
+
+  ~TickReadAhead()
+  {
+    {
+      std::lock_guard<std::mutex> const lock(mMutex);
+      mStop = true;
+    }
+    mReleasedCondition.notify_one();
+    if (mThread.joinable())
+    {
+      mThread.join();
+    }
+  }
+
+  TickReadAhead(TickReadAhead const &) = delete;
+  TickReadAhead &operator=(TickReadAhead const &) = delete;
+
+  /**
+   * @brief start the reader thread
+   *
+   * @throws std::system_error if the thread could not be created
+   */
+  void start()
+  {
+    mThread = std::thread(&TickReadAhead::run, this);
+  }
+
+  /**
+   * @brief wait until the tick is decoded
+   *
+   * The ticks have to be requested in order and each has to be released before requesting the next one.
+   */
+  DecodedTick const &waitForTick(std::size_t const tickNumber)
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDecodedCondition.wait(lock, [this, tickNumber] { return mNumberOfDecodedTicks > tickNumber; });
+    return mSlots[tickNumber % mSlots.size()];
+  }
+
+  /**
+   * @brief release the tick, its slot can be reused afterwards
+   */
+  void releaseTick(std::size_t const tickNumber)
+  {
+    {
+      std::lock_guard<std::mutex> const lock(mMutex);
+      mNumberOfReleasedTicks = tickNumber + 1u;
+    }
+    mReleasedCondition.notify_one();
+  }
+
+private:
+  void run()
+  {
+    std::size_t const numberOfTicks = mReader.getNumberOfTicks();
+    for (std::size_t tickNumber = 0u; tickNumber < numberOfTicks; ++tickNumber)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mReleasedCondition.wait(lock, [this, tickNumber] {
+          return mStop || (tickNumber - mNumberOfReleasedTicks < mSlots.size());
+        });
+        if (mStop)
+        {
+          return;
+        }
+      }
+
+      // the slot is not accessed by the consumer until the tick is announced as decoded
+      DecodedTick &slot = mSlots[tickNumber % mSlots.size()];
+      slot.valid = decodeTick(mReader, tickNumber, slot.worldModel);
+
+      {
+        std::lock_guard<std::mutex> const lock(mMutex);
+        mNumberOfDecodedTicks = tickNumber + 1u;
+      }
+      mDecodedCondition.notify_one();
+    }
+  }
+
+  RssLogReader const &mReader;
+  std::vector<DecodedTick> mSlots;
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mDecodedCondition;
+  std::condition_variable mReleasedCondition;
+  std::size_t mNumberOfDecodedTicks{0u};
+  std::size_t mNumberOfReleasedTicks{0u};
+  bool mStop{false};
+};
+
+/**
+ * @brief recording of the results of the replayed ticks: forwarding to the result handler and collecting the latencies
+ */
+class TickRecorder
+{
+public:
+  TickRecorder(RssLogReplay::ResultHandler *resultHandler, std::size_t const numberOfTicks)
+    : mResultHandler(resultHandler)
+  {
+    mLatencies.reserve(numberOfTicks);
+  }
+
+  void recordTick(std::size_t const tickNumber,
+                  world::WorldModel const &worldModel,
+                  bool const result,
+                  world::AccelerationRestriction const &accelerationRestriction,
+                  situation::SituationVector const &situationVector,
+                  state::ResponseStateVector const &responseStateVector,
+                  std::chrono::steady_clock::duration const latency)
+  {
+    mLatencies.push_back(std::chrono::duration<double, std::micro>(latency).count());
+    if (!result)
+    {
+      mNumberOfFailedTicks++;
+    }
+    if (mResultHandler != nullptr)
+    {
+      mResultHandler->handleResult(
+        tickNumber, worldModel, result, accelerationRestriction, situationVector, responseStateVector);
+    }
+  }
+
+  /**
+   * @brief calculate the statistics of the checked ticks
+   *
+   * @param[in] durationSeconds the wall clock time of the replay
+   * @param[out] statistics the resulting statistics
+   */
+  void calculateStatistics(double const durationSeconds, RssLogReplayStatistics &statistics)
+  {
+    statistics.numberOfTicks = mLatencies.size();
+    statistics.numberOfFailedTicks = mNumberOfFailedTicks;
+    statistics.durationSeconds = durationSeconds;
+    if (mLatencies.empty())
+    {
+      return;
+    }
+    double const numberOfTicks = static_cast<double>(mLatencies.size());
+    if (durationSeconds > 0.)
+    {
+      statistics.ticksPerSecond = numberOfTicks / durationSeconds;
+    }
+    statistics.latencyMeanMicroseconds = std::accumulate(mLatencies.begin(), mLatencies.end(), 0.) / numberOfTicks;
+    std::sort(mLatencies.begin(), mLatencies.end());
+    statistics.latencyP50Microseconds = getPercentile(0.5);
+    statistics.latencyP90Microseconds = getPercentile(0.9);
+    statistics.latencyP99Microseconds = getPercentile(0.99);
+    statistics.latencyMaxMicroseconds = mLatencies.back();
+  }
+
+private:
+  /**
+   * @brief the percentile of the sorted latencies by the nearest-rank method
+   */
+  double getPercentile(double const percentile) const
+  {
+    auto const rank = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(mLatencies.size())));
+    return mLatencies[std::min(std::max(rank, std::size_t(1u)), mLatencies.size()) - 1u];
+  }
+
+  RssLogReplay::ResultHandler *mResultHandler;
+  std::vector<double> mLatencies;
+  std::size_t mNumberOfFailedTicks{0u};
+};
+
+/**
+ * @brief checking of the decoded ticks one after the other by the persistent RssCheck
+ *
+ * The result buffers are reused for all ticks.
+ */
+class TickChecker
+{
+public:
+  TickChecker(RssCheckConfiguration const &configuration, TickRecorder &tickRecorder)
+    : mRssCheck(configuration)
+    , mTickRecorder(tickRecorder)
+  {
+  }
+
+  void checkTick(std::size_t const tickNumber, DecodedTick const &decodedTick)
+  {
+    bool result = false;
+    auto const startTime = std::chrono::steady_clock::now();
+    if (decodedTick.valid)
+    {
+      result = mRssCheck.calculateAccelerationRestriction(
+        decodedTick.worldModel, mAccelerationRestriction, mSituationVector, mResponseStateVector);
+    }
+    auto const latency = std::chrono::steady_clock::now() - startTime;
+
+    if (!result)
+    {
+      mSituationVector.clear();
+      mResponseStateVector.clear();
+    }
+    mTickRecorder.recordTick(tickNumber,
+                             decodedTick.worldModel,
+                             result,
+                             mAccelerationRestriction,
+                             mSituationVector,
+                             mResponseStateVector,
+                             latency);
+  }
+
+private:
+  RssCheck mRssCheck;
+  TickRecorder &mTickRecorder;
+  world::AccelerationRestriction mAccelerationRestriction;
+  situation::SituationVector mSituationVector;
+  state::ResponseStateVector mResponseStateVector;
+};
+
+/**
+ * @brief world model provider decoding the ticks of the log, used by the temporal parallel replay
+ */
+class LogWorldModelProvider : public RssTemporalCheck::WorldModelProvider
+{
+public:
+  explicit LogWorldModelProvider(RssLogReader const &reader)
+    : mReader(reader)
+  {
+  }
+
+  bool provideWorldModel(std::size_t const tickNumber, world::WorldModel &worldModel) override
+  {
+    return decodeTick(mReader, tickNumber, worldModel);
+  }
+
+private:
+  RssLogReader const &mReader;
+};
+
+void replayTickByTick(RssLogReplayConfiguration const &configuration,
+                      RssLogReader const &reader,
+                      TickRecorder &tickRecorder)
+{
+  std::size_t const numberOfTicks = reader.getNumberOfTicks();
+  TickChecker tickChecker(configuration.checkConfiguration, tickRecorder);
+  if (configuration.numberOfReadAheadTicks > 0u)
+  {
+    TickReadAhead readAhead(reader, configuration.numberOfReadAheadTicks);
+    readAhead.start();
+    for (std::size_t tickNumber = 0u; tickNumber < numberOfTicks; ++tickNumber)
+    {
+      tickChecker.checkTick(tickNumber, readAhead.waitForTick(tickNumber));
+      readAhead.releaseTick(tickNumber);
+    }
+  }
+  else
+  {
+    DecodedTick decodedTick;
+    for (std::size_t tickNumber = 0u; tickNumber < numberOfTicks; ++tickNumber)
+    {
+      decodedTick.valid = decodeTick(reader, tickNumber, decodedTick.worldModel);
+      tickChecker.checkTick(tickNumber, decodedTick);
+    }
+  }
+}
+
+void replayTemporalParallel(RssLogReplayConfiguration const &configuration,
+                            RssLogReader const &reader,
+                            TickRecorder &tickRecorder)
+{
+  std::size_t const numberOfTicks = reader.getNumberOfTicks();
+  RssTemporalCheck temporalCheck(
+    configuration.checkConfiguration, configuration.numberOfTemporalWorkerThreads, configuration.temporalWindowSize);
+  LogWorldModelProvider worldModelProvider(reader);
+  for (std::size_t firstTickNumber = 0u; firstTickNumber < numberOfTicks;
+       firstTickNumber += temporalCheck.getWindowSize())
+  {
+    std::size_t const numberOfWindowTicks = std::min(temporalCheck.getWindowSize(), numberOfTicks - firstTickNumber);
+    temporalCheck.checkWindow(worldModelProvider, firstTickNumber, numberOfWindowTicks);
+    for (std::size_t i = 0u; i < numberOfWindowTicks; i++)
+    {
+      RssCheckTickBuffer const &tick = temporalCheck.getTick(i);
+      tickRecorder.recordTick(firstTickNumber + i,
+                              tick.worldModel,
+                              tick.result,
+                              tick.accelerationRestriction,
+                              tick.situationVector,
+                              tick.responseStateVector,
+                              tick.processingTime);
+    }
+  }
+}
+
+} // namespace
+
+RssLogReplay::RssLogReplay(RssLogReplayConfiguration const &configuration)
+  : mConfiguration(configuration)
+{
+}
+
+bool RssLogReplay::replay(RssLogReader const &reader, ResultHandler *resultHandler, RssLogReplayStatistics &statistics)
+{
+  statistics = RssLogReplayStatistics();
+  bool result = false;
+  AD_RSS_TRY
+  {
+    std::size_t const numberOfTicks = reader.getNumberOfTicks();
+    TickRecorder tickRecorder(resultHandler, numberOfTicks);
+
+    auto const startTime = std::chrono::steady_clock::now();
+    if (mConfiguration.numberOfTemporalWorkerThreads > 0u)
+    {
+      replayTemporalParallel(mConfiguration, reader, tickRecorder);
+    }
+    else
+    {
+      replayTickByTick(mConfiguration, reader, tickRecorder);
+    }
+    auto const duration = std::chrono::steady_clock::now() - startTime;
+
+    tickRecorder.calculateStatistics(std::chrono::duration<double>(duration).count(), statistics);
+    result = true;
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  AD_RSS_CATCH_ALL
+  {
+    statistics = RssLogReplayStatistics();
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,345 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssLogWriter.hpp"
+#include <limits>
+
+namespace ad_rss {
+
+namespace core {
+
+namespace {
+
+/*!
+ * @brief serialization of a tick record into a buffer
+ *
+ * The records are addressed by their offsets, as the buffer might be reallocated while growing.
+ */
+class TickSerializer
+{
+public:
+  explicit TickSerializer(std::vector<uint8_t> &buffer)
+    : mBuffer(buffer)
+  {
+    mBuffer.clear();
+  }
+
+  std::size_t reserve(std::size_t const size)
+  {
+    std::size_t const offset = mBuffer.size();
+    std::size_t const alignedSize = (size + cRssLogAlignment - 1u) / cRssLogAlignment * cRssLogAlignment;
+    // the reserved members and the padding of the records are zero
+    mBuffer.resize(offset + alignedSize, 0u);
+    return offset;
+  }
+
+  RssLogArrayRef reserveArray(std::size_t const count, std::size_t const recordSize)
+  {
+    RssLogArrayRef arrayRef;
+    arrayRef.offset = static_cast<uint32_t>(reserve(count * recordSize));
+    arrayRef.count = static_cast<uint32_t>(count);
+    return arrayRef;
+  }
+
+  template <typename Record> void store(std::size_t const offset, Record const &record)
+  {
+    std::memcpy(&mBuffer[offset], &record, sizeof(Record));
+  }
+
+  bool isSizeValid() const
+  {
+    return mBuffer.size() <= std::numeric_limits<uint32_t>::max();
+  }
+
+  RssLogArrayRef writeOccupiedRegions(world::OccupiedRegionVector const &occupiedRegions)
+  {
+    RssLogArrayRef const arrayRef = reserveArray(occupiedRegions.size(), sizeof(RssLogOccupiedRegionRecord));
+    for (std::size_t i = 0u; i < occupiedRegions.size(); i++)
+    {
+      world::OccupiedRegion const &occupiedRegion = occupiedRegions[i];
+      RssLogOccupiedRegionRecord record{};
+      record.segmentId = occupiedRegion.segmentId;
+      record.lonRangeMinimum = static_cast<double>(occupiedRegion.lonRange.minimum);
+      record.lonRangeMaximum = static_cast<double>(occupiedRegion.lonRange.maximum);
+      record.latRangeMinimum = static_cast<double>(occupiedRegion.latRange.minimum);
+      record.latRangeMaximum = static_cast<double>(occupiedRegion.latRange.maximum);
+      store(arrayRef.offset + i * sizeof(RssLogOccupiedRegionRecord), record);
+    }
+    return arrayRef;
+  }
+
+  RssLogArrayRef writeRoadArea(world::RoadArea const &roadArea)
+  {
+    RssLogArrayRef const arrayRef = reserveArray(roadArea.size(), sizeof(RssLogArrayRef));
+    for (std::size_t i = 0u; i < roadArea.size(); i++)
+    {
+      world::RoadSegment const &roadSegment = roadArea[i];
+      RssLogArrayRef const roadSegmentRef = reserveArray(roadSegment.size(), sizeof(RssLogLaneSegmentRecord));
+      for (std::size_t j = 0u; j < roadSegment.size(); j++)
+      {
+        world::LaneSegment const &laneSegment = roadSegment[j];
+        RssLogLaneSegmentRecord record{};
+        record.id = laneSegment.id;
+        record.type = static_cast<int32_t>(laneSegment.type);
+        record.drivingDirection = static_cast<int32_t>(laneSegment.drivingDirection);
+        record.lengthMinimum = static_cast<double>(laneSegment.length.minimum);
+        record.lengthMaximum = static_cast<double>(laneSegment.length.maximum);
+        record.widthMinimum = static_cast<double>(laneSegment.width.minimum);
+        record.widthMaximum = static_cast<double>(laneSegment.width.maximum);
+        store(roadSegmentRef.offset + j * sizeof(RssLogLaneSegmentRecord), record);
+      }
+      store(arrayRef.offset + i * sizeof(RssLogArrayRef), roadSegmentRef);
+    }
+    return arrayRef;
+  }
+
+  RssLogObjectRecord createObjectRecord(world::Object const &object)
+  {
+    RssLogObjectRecord record{};
+    record.objectId = object.objectId;
+    record.objectType = static_cast<int32_t>(object.objectType);
+    record.occupiedRegions = writeOccupiedRegions(object.occupiedRegions);
+    record.dynamics = createDynamicsRecord(object.dynamics);
+    record.speedLon = static_cast<double>(object.velocity.speedLon);
+    record.speedLat = static_cast<double>(object.velocity.speedLat);
+    record.responseTime = static_cast<double>(object.responseTime);
+    return record;
+  }
+
+  RssLogArrayRef writeScenes(world::SceneVector const &scenes)
+  {
+    RssLogArrayRef const arrayRef = reserveArray(scenes.size(), sizeof(RssLogSceneRecord));
+    for (std::size_t i = 0u; i < scenes.size(); i++)
+    {
+      world::Scene const &scene = scenes[i];
+      RssLogSceneRecord record{};
+      record.situationType = static_cast<int32_t>(scene.situationType);
+      record.egoVehicleRoad = writeRoadArea(scene.egoVehicleRoad);
+      record.intersectingRoad = writeRoadArea(scene.intersectingRoad);
+      record.object = createObjectRecord(scene.object);
+      store(arrayRef.offset + i * sizeof(RssLogSceneRecord), record);
+    }
+    return arrayRef;
+  }
+
+  RssLogArrayRef writeSituations(situation::SituationVector const &situationVector)
+  {
+    RssLogArrayRef const arrayRef = reserveArray(situationVector.size(), sizeof(RssLogSituationRecord));
+    for (std::size_t i = 0u; i < situationVector.size(); i++)
+    {
+      situation::Situation const &situation = situationVector[i];
+      RssLogSituationRecord record{};
+      record.timeIndex = situation.timeIndex;
+      record.situationId = situation.situationId;
+      record.situationType = static_cast<int32_t>(situation.situationType);
+      record.longitudinalPosition = static_cast<int32_t>(situation.relativePosition.longitudinalPosition);
+      record.lateralPosition = static_cast<int32_t>(situation.relativePosition.lateralPosition);
+      record.longitudinalDistance = static_cast<double>(situation.relativePosition.longitudinalDistance);
+      record.lateralDistance = static_cast<double>(situation.relativePosition.lateralDistance);
+      record.egoVehicleState = createVehicleStateRecord(situation.egoVehicleState);
+      record.otherVehicleState = createVehicleStateRecord(situation.otherVehicleState);
+      store(arrayRef.offset + i * sizeof(RssLogSituationRecord), record);
+    }
+    return arrayRef;
+  }
+
+  RssLogArrayRef writeResponseStates(state::ResponseStateVector const &responseStateVector)
+  {
+    RssLogArrayRef const arrayRef = reserveArray(responseStateVector.size(), sizeof(RssLogResponseStateRecord));
+    for (std::size_t i = 0u; i < responseStateVector.size(); i++)
+    {
+      state::ResponseState const &responseState = responseStateVector[i];
+      RssLogResponseStateRecord record{};
+      record.timeIndex = responseState.timeIndex;
+      record.situationId = responseState.situationId;
+      record.longitudinalState = createRssStateRecord(responseState.longitudinalState);
+      record.lateralStateRight = createRssStateRecord(responseState.lateralStateRight);
+      record.lateralStateLeft = createRssStateRecord(responseState.lateralStateLeft);
+      store(arrayRef.offset + i * sizeof(RssLogResponseStateRecord), record);
+    }
+    return arrayRef;
+  }
+
+private:
+  static RssLogDynamicsRecord createDynamicsRecord(world::Dynamics const &dynamics)
+  {
+    RssLogDynamicsRecord record{};
+    record.lonAccelMax = static_cast<double>(dynamics.alphaLon.accelMax);
+    record.lonBrakeMax = static_cast<double>(dynamics.alphaLon.brakeMax);
+    record.lonBrakeMin = static_cast<double>(dynamics.alphaLon.brakeMin);
+    record.lonBrakeMinCorrect = static_cast<double>(dynamics.alphaLon.brakeMinCorrect);
+    record.latAccelMax = static_cast<double>(dynamics.alphaLat.accelMax);
+    record.latBrakeMin = static_cast<double>(dynamics.alphaLat.brakeMin);
+    record.lateralFluctuationMargin = static_cast<double>(dynamics.lateralFluctuationMargin);
+    return record;
+  }
+
+  static RssLogVehicleStateRecord createVehicleStateRecord(situation::VehicleState const &vehicleState)
+  {
+    RssLogVehicleStateRecord record{};
+    record.speedLon = static_cast<double>(vehicleState.velocity.speedLon);
+    record.speedLat = static_cast<double>(vehicleState.velocity.speedLat);
+    record.dynamics = createDynamicsRecord(vehicleState.dynamics);
+    record.responseTime = static_cast<double>(vehicleState.responseTime);
+    record.hasPriority = vehicleState.hasPriority ? 1u : 0u;
+    record.isInCorrectLane = vehicleState.isInCorrectLane ? 1u : 0u;
+    record.distanceToEnterIntersection = static_cast<double>(vehicleState.distanceToEnterIntersection);
+    record.distanceToLeaveIntersection = static_cast<double>(vehicleState.distanceToLeaveIntersection);
+    return record;
+  }
+
+  template <typename RssState> static RssLogRssStateRecord createRssStateRecord(RssState const &rssState)
+  {
+    RssLogRssStateRecord record{};
+    record.isSafe = rssState.isSafe ? 1u : 0u;
+    record.response = static_cast<int32_t>(rssState.response);
+    record.responseEvaluator = static_cast<int32_t>(rssState.responseInformation.responseEvaluator);
+    record.safeDistance = static_cast<double>(rssState.responseInformation.safeDistance);
+    record.currentDistance = static_cast<double>(rssState.responseInformation.currentDistance);
+    return record;
+  }
+
+  std::vector<uint8_t> &mBuffer;
+};
+
+} // namespace
+
+RssLogWriter::~RssLogWriter()
+{
+  if (mFile != nullptr)
+  {
+    static_cast<void>(close());
+  }
+}
+
+bool RssLogWriter::open(std::string const &fileName)
+{
+  if (mFile != nullptr)
+  {
+    return false;
+  }
+  mFile = std::fopen(fileName.c_str(), "wb");
+  if (mFile == nullptr)
+  {
+    return false;
+  }
+  mFileOffset = 0u;
+  mFailed = false;
+  mTickIndex.clear();
+
+  RssLogFileHeader header{};
+  std::memcpy(header.magic, cRssLogFileMagic, sizeof(cRssLogFileMagic));
+  header.version = cRssLogVersion;
+  header.byteOrderMark = cRssLogByteOrderMark;
+  return writeData(&header, sizeof(header));
+}
+
+bool RssLogWriter::write(world::WorldModel const &worldModel)
+{
+  return write(worldModel, situation::SituationVector(), state::ResponseStateVector());
+}
+
+bool RssLogWriter::write(world::WorldModel const &worldModel,
+                         situation::SituationVector const &situationVector,
+                         state::ResponseStateVector const &responseStateVector)
+{
+  if ((mFile == nullptr) || mFailed)
+  {
+    return false;
+  }
+  if (!mTickIndex.empty() && (worldModel.timeIndex <= mTickIndex.back().timeIndex))
+  {
+    return false;
+  }
+
+  TickSerializer serializer(mTickBuffer);
+  std::size_t const tickRecordOffset = serializer.reserve(sizeof(RssLogTickRecord));
+  RssLogTickRecord tickRecord{};
+  tickRecord.timeIndex = worldModel.timeIndex;
+  tickRecord.egoVehicle = serializer.createObjectRecord(worldModel.egoVehicle);
+  tickRecord.scenes = serializer.writeScenes(worldModel.scenes);
+  tickRecord.situations = serializer.writeSituations(situationVector);
+  tickRecord.responseStates = serializer.writeResponseStates(responseStateVector);
+  if (!serializer.isSizeValid())
+  {
+    return false;
+  }
+  tickRecord.size = static_cast<uint32_t>(mTickBuffer.size());
+  serializer.store(tickRecordOffset, tickRecord);
+
+  RssLogTickIndexEntry entry;
+  entry.timeIndex = worldModel.timeIndex;
+  entry.offset = mFileOffset;
+  entry.size = mTickBuffer.size();
+  if (!writeData(mTickBuffer.data(), mTickBuffer.size()))
+  {
+    return false;
+  }
+  mTickIndex.push_back(entry);
+  return true;
+}
+
+bool RssLogWriter::close()
+{
+  if (mFile == nullptr)
+  {
+    return false;
+  }
+  RssLogFileFooter footer{};
+  footer.tickIndexOffset = mFileOffset;
+  footer.tickCount = mTickIndex.size();
+  std::memcpy(footer.magic, cRssLogIndexMagic, sizeof(cRssLogIndexMagic));
+
+  bool result = writeData(mTickIndex.data(), mTickIndex.size() * sizeof(RssLogTickIndexEntry));
+  result = writeData(&footer, sizeof(footer)) && result;
+  result = (std::fclose(mFile) == 0) && result;
+  mFile = nullptr;
+  mTickIndex.clear();
+  return result;
+}
+
+bool RssLogWriter::writeData(void const *data, std::size_t const size)
+{
+  if (mFailed)
+  {
+    return false;
+  }
+  if ((size > 0u) && (std::fwrite(data, 1u, size, mFile) != size))
+  {
+    mFailed = true;
+    return false;
+  }
+  mFileOffset += size;
+  return true;
+}
+
+} // namespace core
+} // namespace ad_rss
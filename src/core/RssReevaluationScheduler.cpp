@@ -0,0 +1,386 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssReevaluationScheduler.hpp"
+#include <algorithm>
+#include <functional>
+#include "ad_rss/physics/DistanceValidInputRange.hpp"
+#include "ad_rss/state/LongitudinalRssStateValidInputRange.hpp"
+#include "ad_rss/world/VelocityValidInputRange.hpp"
+#include "core/RssSituationPrediction.hpp"
+#include "situation/RssSituation.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+bool isScheduledSituationType(situation::SituationType const &situationType)
+{
+  return (situationType == situation::SituationType::SameDirection)
+    || (situationType == situation::SituationType::OppositeDirection);
+}
+
+bool isLongitudinalDistance(situation::LongitudinalRelativePosition const &position)
+{
+  return (position == situation::LongitudinalRelativePosition::InFront)
+    || (position == situation::LongitudinalRelativePosition::AtBack);
+}
+
+/*!
+ * @brief the worst case acceleration of a vehicle: approaching the other vehicle with accelMax, moving away from it
+ * with brakeMax
+ */
+RssRolloutKinematics getWorstCaseKinematics(situation::VehicleState const &vehicle, double const distanceChangeFactor)
+{
+  RssRolloutKinematics kinematics;
+  kinematics.accelerationLon
+    = (distanceChangeFactor < 0.) ? vehicle.dynamics.alphaLon.accelMax : -vehicle.dynamics.alphaLon.brakeMax;
+  return kinematics;
+}
+
+/*!
+ * @brief the values are compared exactly, since the bounds have to hold without the precision of the physics types
+ */
+template <typename PhysicsType> bool isIdenticalValue(PhysicsType const &left, PhysicsType const &right)
+{
+  std::equal_to<double> const isEqual;
+  return isEqual(static_cast<double>(left), static_cast<double>(right));
+}
+
+/*!
+ * @brief check the speed of a vehicle against the bound of the bounding situation
+ *
+ * The bound is an upper bound for a vehicle approaching the other vehicle, a lower bound otherwise.
+ */
+bool isSpeedWithinBound(physics::Speed const &speed, physics::Speed const &bound, double const distanceChangeFactor)
+{
+  return (distanceChangeFactor < 0.) ? (static_cast<double>(speed) <= static_cast<double>(bound))
+                                     : (static_cast<double>(speed) >= static_cast<double>(bound));
+}
+
+/*!
+ * @brief check all inputs of a vehicle besides the longitudinal speed to be unchanged since the evaluation
+ */
+bool isVehicleUnchanged(situation::VehicleState const &vehicle, situation::VehicleState const &evaluatedVehicle)
+{
+  world::Dynamics const &dynamics = vehicle.dynamics;
+  world::Dynamics const &evaluatedDynamics = evaluatedVehicle.dynamics;
+  return isIdenticalValue(vehicle.velocity.speedLat, evaluatedVehicle.velocity.speedLat)
+    && isIdenticalValue(dynamics.alphaLon.accelMax, evaluatedDynamics.alphaLon.accelMax)
+    && isIdenticalValue(dynamics.alphaLon.brakeMax, evaluatedDynamics.alphaLon.brakeMax)
+    && isIdenticalValue(dynamics.alphaLon.brakeMin, evaluatedDynamics.alphaLon.brakeMin)
+    && isIdenticalValue(dynamics.alphaLon.brakeMinCorrect, evaluatedDynamics.alphaLon.brakeMinCorrect)
+    && isIdenticalValue(dynamics.alphaLat.accelMax, evaluatedDynamics.alphaLat.accelMax)
+    && isIdenticalValue(dynamics.alphaLat.brakeMin, evaluatedDynamics.alphaLat.brakeMin)
+    && isIdenticalValue(dynamics.lateralFluctuationMargin, evaluatedDynamics.lateralFluctuationMargin)
+    && isIdenticalValue(vehicle.responseTime, evaluatedVehicle.responseTime)
+    && (vehicle.hasPriority == evaluatedVehicle.hasPriority)
+    && (vehicle.isInCorrectLane == evaluatedVehicle.isInCorrectLane)
+    && isIdenticalValue(vehicle.distanceToEnterIntersection, evaluatedVehicle.distanceToEnterIntersection)
+    && isIdenticalValue(vehicle.distanceToLeaveIntersection, evaluatedVehicle.distanceToLeaveIntersection);
+}
+
+/*!
+ * @brief calculate the bounding situation of the worst case motion of the vehicles within the horizon
+ */
+bool calculateBoundingSituation(situation::Situation const &situation,
+                                physics::Duration const &horizon,
+                                situation::Situation &boundingSituation)
+{
+  double const egoFactor
+    = RssSituationPrediction::getEgoDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal);
+  double const otherFactor
+    = RssSituationPrediction::getOtherDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal);
+
+  RssSituationPrediction::VehicleMotion egoMotion;
+  egoMotion.speedLon = situation.egoVehicleState.velocity.speedLon;
+  egoMotion.speedLat = situation.egoVehicleState.velocity.speedLat;
+  RssSituationPrediction::VehicleMotion otherMotion;
+  otherMotion.speedLon = situation.otherVehicleState.velocity.speedLon;
+  otherMotion.speedLat = situation.otherVehicleState.velocity.speedLat;
+  if (!RssSituationPrediction::propagateMotion(
+        getWorstCaseKinematics(situation.egoVehicleState, egoFactor), horizon, egoMotion)
+      || !RssSituationPrediction::propagateMotion(
+           getWorstCaseKinematics(situation.otherVehicleState, otherFactor), horizon, otherMotion))
+  {
+    return false;
+  }
+
+  // the longitudinal speeds within valid input range don't exceed 100 m/s
+  egoMotion.speedLon = std::min(egoMotion.speedLon, physics::Speed(100.));
+  otherMotion.speedLon = std::min(otherMotion.speedLon, physics::Speed(100.));
+
+  RssSituationPrediction::predictSituation(situation, egoMotion, otherMotion, situation.timeIndex, boundingSituation);
+  if (boundingSituation.relativePosition.longitudinalPosition != situation.relativePosition.longitudinalPosition)
+  {
+    // the vehicles might reach each other
+    return false;
+  }
+
+  // the change of the distance is concave in time (the approaching speeds increase, the others decrease), so the
+  // distance within the horizon is bounded by the current distance and the distance at the end of the horizon
+  boundingSituation.relativePosition.longitudinalDistance = std::min(
+    boundingSituation.relativePosition.longitudinalDistance, situation.relativePosition.longitudinalDistance);
+  return true;
+}
+
+bool calculateLongitudinalRssState(situation::Situation const &situation, state::LongitudinalRssState &rssState)
+{
+  if (situation.situationType == situation::SituationType::SameDirection)
+  {
+    return situation::calculateLongitudinalRssStateNonIntersectionSameDirection(situation, rssState);
+  }
+  return situation::calculateLongitudinalRssStateNonIntersectionOppositeDirection(situation, rssState);
+}
+
+} // namespace
+
+constexpr uint32_t RssReevaluationScheduler::cMaximumExponent;
+constexpr uint32_t RssReevaluationScheduler::cMaximumNumberOfTimeSteps;
+constexpr uint32_t RssReevaluationScheduler::cRetryNumberOfTimeSteps;
+
+RssReevaluationScheduler::RssReevaluationScheduler(physics::Duration const &maximumTimeStepDuration)
+  : mMaximumTimeStepDuration(maximumTimeStepDuration)
+{
+}
+
+void RssReevaluationScheduler::provideScheduledResponseStates(situation::SituationVector const &situationVector,
+                                                              std::vector<uint8_t> const &providedResponseStates,
+                                                              state::ResponseStateVector &responseStateVector)
+{
+  mProvidedResponseStates.assign(situationVector.size(), 0u);
+  std::copy(providedResponseStates.begin(),
+            providedResponseStates.begin()
+              + static_cast<std::ptrdiff_t>(std::min(providedResponseStates.size(), situationVector.size())),
+            mProvidedResponseStates.begin());
+  responseStateVector.resize(situationVector.size());
+  mNumberOfSkippedSituations = 0u;
+
+  for (std::size_t i = 0u; i < situationVector.size(); i++)
+  {
+    situation::Situation const &situation = situationVector[i];
+    if (mProvidedResponseStates[i] != 0u)
+    {
+      continue;
+    }
+    ScheduledSituation const *scheduledSituation = mSchedule.findPrevious(situation.situationId);
+    if ((scheduledSituation == nullptr) || !isWithinSchedule(*scheduledSituation, situation))
+    {
+      continue;
+    }
+
+    // the response state is within valid input range: the time index is increased, the current distance is checked
+    // by isWithinSchedule() and the states are checked when scheduled
+    state::ResponseState &responseState = responseStateVector[i];
+    responseState.timeIndex = situation.timeIndex;
+    responseState.situationId = situation.situationId;
+    responseState.longitudinalState = scheduledSituation->longitudinalState;
+    responseState.longitudinalState.responseInformation.currentDistance
+      = situation.relativePosition.longitudinalDistance;
+    responseState.lateralStateLeft = scheduledSituation->lateralStateLeft;
+    responseState.lateralStateRight = scheduledSituation->lateralStateRight;
+    mProvidedResponseStates[i] = 1u;
+    mNumberOfSkippedSituations++;
+  }
+}
+
+std::vector<uint8_t> const &RssReevaluationScheduler::getProvidedResponseStates() const
+{
+  return mProvidedResponseStates;
+}
+
+std::size_t RssReevaluationScheduler::getNumberOfSkippedSituations() const
+{
+  return mNumberOfSkippedSituations;
+}
+
+void RssReevaluationScheduler::update(situation::SituationVector const &situationVector,
+                                      state::ResponseStateVector const &responseStateVector,
+                                      bool const checkResult)
+{
+  if (!checkResult || (responseStateVector.size() != situationVector.size()))
+  {
+    // the schedule of the previous time step is kept
+    mSchedule.discardCurrentGeneration();
+    return;
+  }
+
+  for (std::size_t i = 0u; i < situationVector.size(); i++)
+  {
+    situation::Situation const &situation = situationVector[i];
+    if ((i < mProvidedResponseStates.size()) && (mProvidedResponseStates[i] != 0u))
+    {
+      ScheduledSituation const *scheduledSituation = mSchedule.findPrevious(situation.situationId);
+      if (scheduledSituation != nullptr)
+      {
+        mSchedule.insertCurrent(situation.situationId, *scheduledSituation);
+      }
+      continue;
+    }
+
+    ScheduledSituation const *previousSituation = mSchedule.findPrevious(situation.situationId);
+    if ((previousSituation != nullptr) && (previousSituation->numberOfTimeSteps == 0u)
+        && ((situation.timeIndex - previousSituation->evaluationTimeIndex) < cRetryNumberOfTimeSteps))
+    {
+      // the situation had no horizon recently, the search is not repeated within each time step
+      mSchedule.insertCurrent(situation.situationId, *previousSituation);
+      continue;
+    }
+
+    ScheduledSituation scheduledSituation;
+    calculateSchedule(situation, responseStateVector[i], scheduledSituation);
+    mSchedule.insertCurrent(situation.situationId, scheduledSituation);
+  }
+  mSchedule.nextGeneration();
+}
+
+bool RssReevaluationScheduler::calculateTimeToUnsafe(situation::Situation const &situation,
+                                                     state::ResponseState const &responseState,
+                                                     physics::Duration &timeToUnsafe) const
+{
+  ScheduledSituation scheduledSituation;
+  if (!calculateSchedule(situation, responseState, scheduledSituation))
+  {
+    return false;
+  }
+  timeToUnsafe = mMaximumTimeStepDuration * static_cast<double>(scheduledSituation.numberOfTimeSteps);
+  return true;
+}
+
+bool RssReevaluationScheduler::calculateSchedule(situation::Situation const &situation,
+                                                 state::ResponseState const &responseState,
+                                                 ScheduledSituation &scheduledSituation) const
+{
+  scheduledSituation.evaluationTimeIndex = situation.timeIndex;
+  scheduledSituation.numberOfTimeSteps = 0u;
+  scheduledSituation.evaluatedSituation = situation;
+  scheduledSituation.lateralStateLeft = responseState.lateralStateLeft;
+  scheduledSituation.lateralStateRight = responseState.lateralStateRight;
+  if (!isScheduledSituationType(situation.situationType)
+      || !isLongitudinalDistance(situation.relativePosition.longitudinalPosition)
+      || !responseState.longitudinalState.isSafe || (mMaximumTimeStepDuration <= physics::Duration(0.)))
+  {
+    return false;
+  }
+
+  // the horizon is searched over the powers of two: a single time step isn't worth the effort and the close
+  // situations fail already for two time steps, while the far ones usually succeed for the maximal horizon
+  uint32_t safeExponent = 0u;
+  uint32_t unsafeExponent = cMaximumExponent + 1u;
+  for (uint32_t exponent : {1u, cMaximumExponent})
+  {
+    if (!calculateScheduleForHorizon(situation, exponent, scheduledSituation))
+    {
+      unsafeExponent = exponent;
+      break;
+    }
+    safeExponent = exponent;
+  }
+  while ((safeExponent > 0u) && ((safeExponent + 1u) < unsafeExponent))
+  {
+    uint32_t const exponent = (safeExponent + unsafeExponent) / 2u;
+    if (calculateScheduleForHorizon(situation, exponent, scheduledSituation))
+    {
+      safeExponent = exponent;
+    }
+    else
+    {
+      unsafeExponent = exponent;
+    }
+  }
+  return scheduledSituation.numberOfTimeSteps > 0u;
+}
+
+bool RssReevaluationScheduler::calculateScheduleForHorizon(situation::Situation const &situation,
+                                                           uint32_t const exponent,
+                                                           ScheduledSituation &scheduledSituation) const
+{
+  uint32_t const numberOfTimeSteps = 1u << exponent;
+  physics::Duration const horizon = mMaximumTimeStepDuration * static_cast<double>(numberOfTimeSteps);
+  situation::Situation boundingSituation;
+  state::LongitudinalRssState longitudinalState;
+  if (!calculateBoundingSituation(situation, horizon, boundingSituation)
+      || !calculateLongitudinalRssState(boundingSituation, longitudinalState) || !longitudinalState.isSafe
+      || !withinValidInputRange(longitudinalState))
+  {
+    return false;
+  }
+  scheduledSituation.boundingSituation = boundingSituation;
+  scheduledSituation.longitudinalState = longitudinalState;
+  scheduledSituation.numberOfTimeSteps = numberOfTimeSteps;
+  return true;
+}
+
+bool RssReevaluationScheduler::isWithinSchedule(ScheduledSituation const &scheduledSituation,
+                                                situation::Situation const &situation) const
+{
+  situation::Situation const &boundingSituation = scheduledSituation.boundingSituation;
+  situation::Situation const &evaluatedSituation = scheduledSituation.evaluatedSituation;
+  physics::TimeIndex const elapsedTimeSteps = situation.timeIndex - scheduledSituation.evaluationTimeIndex;
+  if ((elapsedTimeSteps == 0u) || (elapsedTimeSteps > scheduledSituation.numberOfTimeSteps)
+      || (situation.situationType != evaluatedSituation.situationType)
+      || (situation.relativePosition.longitudinalPosition != evaluatedSituation.relativePosition.longitudinalPosition)
+      || (situation.relativePosition.lateralPosition != evaluatedSituation.relativePosition.lateralPosition)
+      || !isIdenticalValue(situation.relativePosition.lateralDistance,
+                           evaluatedSituation.relativePosition.lateralDistance)
+      || !isVehicleUnchanged(situation.egoVehicleState, evaluatedSituation.egoVehicleState)
+      || !isVehicleUnchanged(situation.otherVehicleState, evaluatedSituation.otherVehicleState))
+  {
+    // the lateral states of the evaluation only hold for an unchanged lateral relation
+    return false;
+  }
+
+  // the unchanged inputs have been checked to be within valid input range when evaluated, only the changed ones are
+  // checked again
+  if (!withinValidInputRange(situation.relativePosition.longitudinalDistance)
+      || !withinValidInputRange(situation.egoVehicleState.velocity)
+      || !withinValidInputRange(situation.otherVehicleState.velocity))
+  {
+    return false;
+  }
+
+  double const egoFactor
+    = RssSituationPrediction::getEgoDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal);
+  double const otherFactor
+    = RssSituationPrediction::getOtherDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal);
+  return (static_cast<double>(situation.relativePosition.longitudinalDistance)
+          >= static_cast<double>(boundingSituation.relativePosition.longitudinalDistance))
+    && isSpeedWithinBound(situation.egoVehicleState.velocity.speedLon,
+                          boundingSituation.egoVehicleState.velocity.speedLon,
+                          egoFactor)
+    && isSpeedWithinBound(situation.otherVehicleState.velocity.speedLon,
+                          boundingSituation.otherVehicleState.velocity.speedLon,
+                          otherFactor);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,196 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "situation/RssSituationStateTable.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief class RssReevaluationScheduler
+ *
+ * Lazy re-evaluation of the same direction and opposite direction situations, which are longitudinally safe by a
+ * margin that cannot be closed within the next time steps.
+ *
+ * For such a situation, a conservative time-to-unsafe horizon is calculated when it is evaluated: the longest horizon
+ * (a power of two number of time steps up to cMaximumNumberOfTimeSteps), for which the worst case motion of the
+ * vehicles keeps the situation longitudinally safe. In the worst case motion, each vehicle approaching the other one
+ * accelerates with accelMax, while each vehicle moving away brakes with brakeMax. The worst case motion results in a
+ * bounding situation with the maximal speeds of the approaching vehicles, the minimal speeds of the vehicles moving
+ * away and the minimal longitudinal distance reachable within the horizon. The safe distance is increasing in the
+ * speeds of the approaching vehicles and decreasing in the speeds of the vehicles moving away, so every situation
+ * within these bounds is longitudinally safe.
+ *
+ * Situations without such a horizon are only considered again after cRetryNumberOfTimeSteps.
+ *
+ * Within the following time steps up to the horizon, the situation is not evaluated again as long as it stays within
+ * the bounds of the bounding situation and all its inputs not covered by the bounds are unchanged since the
+ * evaluation. Otherwise, it is evaluated completely.
+ *
+ * For a situation not evaluated again, the response state is provided:
+ * - the longitudinal state is safe, reporting the current distance and the safe distance of the bounding situation,
+ *   which is an upper bound of the exact safe distance
+ * - the lateral states are the ones of the last evaluation, which only depend on the unchanged lateral inputs
+ *
+ * The safety decisions of a skipped situation are those of its full evaluation. Only the longitudinal safe distance
+ * differs, which is informational: the response resolving and the acceleration restriction are unaffected.
+ */
+class RssReevaluationScheduler
+{
+public:
+  /**
+   * @brief the exponent of the maximal number of time steps a situation is not evaluated again
+   */
+  static constexpr uint32_t cMaximumExponent = 6u;
+
+  /**
+   * @brief the maximal number of time steps a situation is not evaluated again
+   */
+  static constexpr uint32_t cMaximumNumberOfTimeSteps = 1u << cMaximumExponent;
+
+  /**
+   * @brief the number of time steps until the horizon of a situation without horizon is calculated again
+   */
+  static constexpr uint32_t cRetryNumberOfTimeSteps = 4u;
+
+  /**
+   * @brief constructor
+   *
+   * @param[in] maximumTimeStepDuration the upper bound of the duration between two consecutive time indices
+   */
+  explicit RssReevaluationScheduler(physics::Duration const &maximumTimeStepDuration);
+
+  /**
+   * @brief Provide the response states of the situations, which don't need to be evaluated again
+   *
+   * Situations already provided by the caller are not considered. The situations not evaluated again are within
+   * valid input range, so that these can be treated as provided situations by the situation checking: besides the
+   * longitudinal speeds and the longitudinal distance, which are checked again, their inputs are unchanged since the
+   * evaluation.
+   *
+   * @param[in] situationVector the situations of the current time step
+   * @param[in] providedResponseStates flags per situation indicating if the response state is already provided by
+   * the caller. Empty if no response states are provided.
+   * @param[in,out] responseStateVector the response states of the situations, resized to the number of situations
+   */
+  void provideScheduledResponseStates(situation::SituationVector const &situationVector,
+                                      std::vector<uint8_t> const &providedResponseStates,
+                                      state::ResponseStateVector &responseStateVector);
+
+  /**
+   * @returns the flags per situation of the last call of provideScheduledResponseStates(), indicating if the
+   * response state is provided by the caller or by the scheduler
+   */
+  std::vector<uint8_t> const &getProvidedResponseStates() const;
+
+  /**
+   * @returns the number of situations not evaluated again by the last call of provideScheduledResponseStates()
+   */
+  std::size_t getNumberOfSkippedSituations() const;
+
+  /**
+   * @brief Schedule the re-evaluation of the evaluated situations of the current time step
+   *
+   * The schedule of the provided situations is kept.
+   *
+   * @param[in] situationVector the situations of the current time step
+   * @param[in] responseStateVector the response states of the situations
+   * @param[in] checkResult the result of the situation checking, on failure the current time step is discarded
+   */
+  void update(situation::SituationVector const &situationVector,
+              state::ResponseStateVector const &responseStateVector,
+              bool const checkResult);
+
+  /**
+   * @brief Calculate the time-to-unsafe horizon of a situation
+   *
+   * @param[in] situation the situation
+   * @param[in] responseState the response state of the situation
+   * @param[out] timeToUnsafe the conservative time, before which the situation cannot become unsafe
+   *
+   * @returns true if the situation has a horizon of at least two time steps, false otherwise
+   */
+  bool calculateTimeToUnsafe(situation::Situation const &situation,
+                             state::ResponseState const &responseState,
+                             physics::Duration &timeToUnsafe) const;
+
+private:
+  /**
+   * @brief the schedule of a situation, a number of time steps of zero indicates a situation without horizon
+   *
+   * The lateral states are the ones of the evaluation together with the evaluated situation, which has been checked
+   * to be within valid input range.
+   */
+  struct ScheduledSituation
+  {
+    situation::Situation evaluatedSituation;
+    situation::Situation boundingSituation;
+    state::LongitudinalRssState longitudinalState;
+    state::LateralRssState lateralStateLeft;
+    state::LateralRssState lateralStateRight;
+    physics::TimeIndex evaluationTimeIndex{0u};
+    uint32_t numberOfTimeSteps{0u};
+  };
+
+  bool calculateSchedule(situation::Situation const &situation,
+                         state::ResponseState const &responseState,
+                         ScheduledSituation &scheduledSituation) const;
+  bool calculateScheduleForHorizon(situation::Situation const &situation,
+                                   uint32_t const exponent,
+                                   ScheduledSituation &scheduledSituation) const;
+  bool isWithinSchedule(ScheduledSituation const &scheduledSituation, situation::Situation const &situation) const;
+
+  physics::Duration mMaximumTimeStepDuration;
+  situation::RssSituationStateTable<ScheduledSituation> mSchedule;
+  std::vector<uint8_t> mProvidedResponseStates;
+  std::size_t mNumberOfSkippedSituations{0u};
+};
+
+} // namespace core
+} // namespace ad_rss
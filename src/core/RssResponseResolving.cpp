@@ -30,17 +30,42 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "ad_rss/core/RssResponseResolving.hpp"
-#include <algorithm>
 #include "ad_rss/state/ResponseStateVectorValidInputRange.hpp"
 #include "core/RssState.hpp"
+#include "situation/RssSituationStateTable.hpp"
 
 namespace ad_rss {
 namespace core {
 
 RssResponseResolving::RssResponseResolving()
+{
+  AD_RSS_TRY
+  {
+    mStatesBeforeDangerThresholdTime = std::unique_ptr<situation::RssSituationStateTable<RssState>>(
+      new situation::RssSituationStateTable<RssState>());
+  }
+  AD_RSS_CATCH_ALL
+  {
+    mStatesBeforeDangerThresholdTime = nullptr;
+  }
+}
+
+RssResponseResolving::~RssResponseResolving()
 {
 }
 
+bool RssResponseResolving::assignState(RssResponseResolving const &other)
+{
+  if (!static_cast<bool>(mStatesBeforeDangerThresholdTime)
+      || !static_cast<bool>(other.mStatesBeforeDangerThresholdTime))
+  {
+    return false;
+  }
+  // assignment reuses the capacity of the state table
+  *mStatesBeforeDangerThresholdTime = *other.mStatesBeforeDangerThresholdTime;
+  return true;
+}
+
 bool RssResponseResolving::provideProperResponse(state::ResponseStateVector const &currentStates,
                                                  state::ResponseState &responseState)
 {
@@ -49,14 +74,23 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
     return false;
   }
 
+  return provideProperResponseInputRangeChecked(currentStates, responseState);
+}
+
+bool RssResponseResolving::provideProperResponseInputRangeChecked(state::ResponseStateVector const &currentStates,
+                                                                  state::ResponseState &responseState)
+{
+  if (!static_cast<bool>(mStatesBeforeDangerThresholdTime))
+  {
+    return false;
+  }
+
   bool result = true;
   // global try catch block to ensure this library call doesn't throw an exception
-  try
+  AD_RSS_TRY
   {
     responseState = state::createResponseState(physics::TimeIndex(0u), situation::SituationId(0), state::IsSafe::Yes);
 
-    RssStateBeforeDangerThresholdTimeMap newStatesBeforeDangerThresholdTime;
-
     for (auto const &currentState : currentStates)
     {
       if (responseState.timeIndex == physics::TimeIndex(0u))
@@ -73,10 +107,11 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
       RssState nonDangerousStateToRemember;
       if (isDangerous(currentState))
       {
-        auto const previousNonDangerousState = mStatesBeforeDangerThresholdTime.find(currentState.situationId);
-        if (previousNonDangerousState != mStatesBeforeDangerThresholdTime.end())
+        auto const previousNonDangerousState
+          = mStatesBeforeDangerThresholdTime->findPrevious(currentState.situationId);
+        if (previousNonDangerousState != nullptr)
         {
-          if (previousNonDangerousState->second.lateralSafe)
+          if (previousNonDangerousState->lateralSafe)
           {
             // we might need to check here if left or right is the dangerous side
             // but for the combineLateralResponse will only respect the more severe response
@@ -95,7 +130,7 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
             responseState.longitudinalState.isSafe
               = responseState.longitudinalState.isSafe && currentState.longitudinalState.isSafe;
           }
-          if (previousNonDangerousState->second.longitudinalSafe)
+          if (previousNonDangerousState->longitudinalSafe)
           {
             // propagate is safe in lateral direction
             responseState.lateralStateLeft.isSafe
@@ -107,7 +142,7 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
               = combineRssState(currentState.longitudinalState, responseState.longitudinalState);
           }
 
-          nonDangerousStateToRemember = previousNonDangerousState->second;
+          nonDangerousStateToRemember = *previousNonDangerousState;
         }
         else
         {
@@ -135,12 +170,12 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
       // store state for the next iteration
       if (nonDangerousStateToRemember.longitudinalSafe || nonDangerousStateToRemember.lateralSafe)
       {
-        auto const insertResult = newStatesBeforeDangerThresholdTime.insert(
-          RssStateBeforeDangerThresholdTimeMap::value_type(currentState.situationId, nonDangerousStateToRemember));
+        bool const insertResult
+          = mStatesBeforeDangerThresholdTime->insertCurrent(currentState.situationId, nonDangerousStateToRemember);
 
         if (result)
         {
-          result = insertResult.second;
+          result = insertResult;
         }
       }
     }
@@ -148,12 +183,16 @@ bool RssResponseResolving::provideProperResponse(state::ResponseStateVector cons
     if (result)
     {
       // Determine resulting response
-      mStatesBeforeDangerThresholdTime.clear();
-      mStatesBeforeDangerThresholdTime.swap(newStatesBeforeDangerThresholdTime);
+      mStatesBeforeDangerThresholdTime->nextGeneration();
+    }
+    else
+    {
+      mStatesBeforeDangerThresholdTime->discardCurrentGeneration();
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
+    mStatesBeforeDangerThresholdTime->discardCurrentGeneration();
     result = false;
   }
 
@@ -32,6 +32,7 @@
 #include "ad_rss/core/RssResponseTransformation.hpp"
 #include "ad_rss/state/ResponseStateValidInputRange.hpp"
 #include "ad_rss/world/WorldModelValidInputRange.hpp"
+#include "core/RssResponseTransformationInputRangeChecked.hpp"
 
 namespace ad_rss {
 
@@ -47,6 +48,13 @@ bool transformProperResponse(world::WorldModel const &worldModel,
     return false;
   }
 
+  return transformProperResponseInputRangeChecked(worldModel, response, accelerationRestriction);
+}
+
+bool transformProperResponseInputRangeChecked(world::WorldModel const &worldModel,
+                                              state::ResponseState const &response,
+                                              world::AccelerationRestriction &accelerationRestriction)
+{
   if (worldModel.timeIndex != response.timeIndex)
   {
     return false;
@@ -0,0 +1,73 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/core/RssResponseTransformation.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief namespace RssResponseTransformation
+ */
+namespace RssResponseTransformation {
+
+/*!
+ * @brief transformProperResponse without checking the input range
+ *
+ * Same as transformProperResponse(), but the world model and the response have to be already checked to be within
+ * valid input range. Used by RssCheck, where the world model has been checked by the situation extraction and the
+ * response is resolved from response states checked by the situation checking.
+ *
+ * @param [in] worldModel - The current world model information.
+ * @param [in] response - The proper overall response to be transformed.
+ * @param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+ *
+ * @return return true if the acceleration restrictions could be calculated, false otherwise.
+ */
+bool transformProperResponseInputRangeChecked(world::WorldModel const &worldModel,
+                                              state::ResponseState const &response,
+                                              world::AccelerationRestriction &accelerationRestriction);
+
+} // namespace RssResponseTransformation
+} // namespace core
+} // namespace ad_rss
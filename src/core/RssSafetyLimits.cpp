@@ -0,0 +1,238 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssSafetyLimits.hpp"
+#include <algorithm>
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/physics/RangeError.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+
+namespace core {
+
+namespace RssSafetyLimitsCalculation {
+
+namespace {
+
+/*!
+ * @brief restrict the limits to the tighter ones of both
+ */
+void restrictSafetyLimits(RssSafetyLimits &safetyLimits, RssSafetyLimits const &otherLimits)
+{
+  safetyLimits.maxAccelerationLon = std::min(safetyLimits.maxAccelerationLon, otherLimits.maxAccelerationLon);
+  safetyLimits.maxSpeedLon = std::min(safetyLimits.maxSpeedLon, otherLimits.maxSpeedLon);
+  safetyLimits.maxAccelerationLat = std::min(safetyLimits.maxAccelerationLat, otherLimits.maxAccelerationLat);
+  safetyLimits.minSpeedLat = std::max(safetyLimits.minSpeedLat, otherLimits.minSpeedLat);
+  safetyLimits.maxSpeedLat = std::min(safetyLimits.maxSpeedLat, otherLimits.maxSpeedLat);
+}
+
+/*!
+ * @brief calculate the longitudinal limits of a non-intersection situation
+ */
+bool calculateLongitudinalLimits(situation::Situation const &situation, RssSafetyLimits &safetyLimits)
+{
+  bool result = true;
+  if (situation.situationType == situation::SituationType::OppositeDirection)
+  {
+    result = situation::calculateSafeLongitudinalLimitsOppositeDirection(
+      situation.egoVehicleState,
+      situation.otherVehicleState,
+      situation.relativePosition.longitudinalDistance,
+      safetyLimits.maxAccelerationLon,
+      safetyLimits.maxSpeedLon);
+  }
+  else if ((situation.relativePosition.longitudinalPosition != situation::LongitudinalRelativePosition::InFront)
+           && (situation.relativePosition.longitudinalPosition
+               != situation::LongitudinalRelativePosition::OverlapFront))
+  {
+    // the ego vehicle is following, if leading it is not required to respond
+    result = situation::calculateSafeLongitudinalLimitsSameDirection(situation.otherVehicleState,
+                                                                      situation.egoVehicleState,
+                                                                      situation.relativePosition.longitudinalDistance,
+                                                                      safetyLimits.maxAccelerationLon,
+                                                                      safetyLimits.maxSpeedLon);
+  }
+  return result;
+}
+
+/*!
+ * @brief calculate the lateral limits of a non-intersection situation
+ */
+bool calculateLateralLimits(situation::Situation const &situation, RssSafetyLimits &safetyLimits)
+{
+  if ((situation.relativePosition.lateralPosition != situation::LateralRelativePosition::AtLeft)
+      && (situation.relativePosition.lateralPosition != situation::LateralRelativePosition::AtRight))
+  {
+    // lateral distance is zero, never safe
+    safetyLimits.maxAccelerationLat = std::numeric_limits<physics::Acceleration>::lowest();
+    safetyLimits.minSpeedLat = std::numeric_limits<physics::Speed>::max();
+    safetyLimits.maxSpeedLat = std::numeric_limits<physics::Speed>::lowest();
+    return true;
+  }
+
+  physics::SpeedRange speedRange;
+  bool const result = situation::calculateSafeLateralLimits(situation.egoVehicleState,
+                                                            situation.otherVehicleState,
+                                                            situation.relativePosition.lateralPosition,
+                                                            situation.relativePosition.lateralDistance,
+                                                            safetyLimits.maxAccelerationLat,
+                                                            speedRange);
+  if (result)
+  {
+    safetyLimits.minSpeedLat = speedRange.minimum;
+    safetyLimits.maxSpeedLat = speedRange.maximum;
+  }
+  return result;
+}
+
+/*!
+ * @brief calculate the limits of an intersection situation
+ */
+bool calculateIntersectionLimits(situation::Situation const &situation, RssSafetyLimits &safetyLimits)
+{
+  if (situation.egoVehicleState.hasPriority)
+  {
+    return true;
+  }
+
+  bool result = true;
+  bool isOtherAbleToStop = false;
+  if (!situation.otherVehicleState.hasPriority)
+  {
+    physics::Distance safeDistance;
+    result = situation::checkStopInFrontIntersection(situation.otherVehicleState, safeDistance, isOtherAbleToStop);
+  }
+
+  if (result && !isOtherAbleToStop)
+  {
+    result = situation::calculateStopInFrontIntersectionLimits(
+      situation.egoVehicleState, safetyLimits.maxAccelerationLon, safetyLimits.maxSpeedLon);
+  }
+  return result;
+}
+
+} // namespace
+
+bool calculateSafetyLimits(situation::Situation const &situation, RssSafetyLimits &safetyLimits)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    RssSafetyLimits limits;
+    switch (situation.situationType)
+    {
+      case situation::SituationType::NotRelevant:
+        result = true;
+        break;
+      case situation::SituationType::SameDirection:
+      case situation::SituationType::OppositeDirection:
+      {
+        RssSafetyLimits lateralLimits;
+        result = calculateLongitudinalLimits(situation, limits) && calculateLateralLimits(situation, lateralLimits);
+        if (result)
+        {
+          // each direction only has to be restricted if the other direction is unsafe
+          bool const isLongitudinalSafe
+            = (situation.egoVehicleState.dynamics.alphaLon.accelMax <= limits.maxAccelerationLon);
+          bool const isLateralSafe
+            = (situation.egoVehicleState.dynamics.alphaLat.accelMax <= lateralLimits.maxAccelerationLat);
+          if (isLateralSafe)
+          {
+            limits = RssSafetyLimits();
+          }
+          if (!isLongitudinalSafe)
+          {
+            limits.maxAccelerationLat = lateralLimits.maxAccelerationLat;
+            limits.minSpeedLat = lateralLimits.minSpeedLat;
+            limits.maxSpeedLat = lateralLimits.maxSpeedLat;
+          }
+        }
+        break;
+      }
+      case situation::SituationType::IntersectionEgoHasPriority:
+      case situation::SituationType::IntersectionObjectHasPriority:
+      case situation::SituationType::IntersectionSamePriority:
+        result = calculateIntersectionLimits(situation, limits);
+        break;
+      default:
+        result = false;
+        break;
+    }
+
+    if (result)
+    {
+      safetyLimits = limits;
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool calculateSafetyLimits(situation::SituationVector const &situationVector, RssSafetyLimits &safetyLimits)
+{
+  RssSafetyLimits limits;
+  for (auto const &situation : situationVector)
+  {
+    RssSafetyLimits situationLimits;
+    if (!calculateSafetyLimits(situation, situationLimits))
+    {
+      return false;
+    }
+    restrictSafetyLimits(limits, situationLimits);
+  }
+
+  safetyLimits = limits;
+  return true;
+}
+
+bool calculateSafetyLimits(world::WorldModel const &worldModel, RssSafetyLimits &safetyLimits)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    situation::SituationVector situationVector;
+    result = RssSituationExtraction::extractSituations(worldModel, situationVector)
+      && calculateSafetyLimits(situationVector, safetyLimits);
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace RssSafetyLimitsCalculation
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,400 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssSafetyMargins.hpp"
+#include <algorithm>
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/physics/RangeError.hpp"
+#include "core/RssSituationPrediction.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+
+namespace core {
+
+namespace RssSafetyMarginCalculation {
+
+namespace {
+
+/*!
+ * @brief the valid range of the predicted ego vehicle speeds, see VehicleStateValidInputRange.hpp
+ */
+double const cMaxSpeedLon = 100.;
+double const cMaxSpeedLat = 10.;
+
+RssSafetyMargin createSafetyMargin(physics::Distance const &margin, situation::DistanceGradient const &marginGradient)
+{
+  RssSafetyMargin safetyMargin;
+  safetyMargin.margin = margin;
+  safetyMargin.speedDerivative = marginGradient.speed;
+  safetyMargin.accelerationDerivative = marginGradient.acceleration;
+  safetyMargin.responseTimeDerivative = marginGradient.responseTime;
+  return safetyMargin;
+}
+
+bool isIntersectionSituation(situation::Situation const &situation)
+{
+  return (situation.situationType == situation::SituationType::IntersectionEgoHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionObjectHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionSamePriority);
+}
+
+bool hasLateralDistance(situation::Situation const &situation)
+{
+  return (situation.relativePosition.lateralPosition == situation::LateralRelativePosition::AtLeft)
+    || (situation.relativePosition.lateralPosition == situation::LateralRelativePosition::AtRight);
+}
+
+bool calculateLongitudinalMargin(situation::Situation const &situation, RssSituationSafetyMargins &safetyMargins)
+{
+  physics::Distance margin(0.);
+  situation::DistanceGradient marginGradient;
+  bool result = true;
+  switch (situation.situationType)
+  {
+    case situation::SituationType::SameDirection:
+      safetyMargins.hasLongitudinalMargin = true;
+      result = situation::calculateSafeLongitudinalMarginSameDirection(situation.egoVehicleState,
+                                                                       situation.otherVehicleState,
+                                                                       situation.relativePosition.longitudinalPosition,
+                                                                       situation.relativePosition.longitudinalDistance,
+                                                                       margin,
+                                                                       marginGradient);
+      break;
+    case situation::SituationType::OppositeDirection:
+      safetyMargins.hasLongitudinalMargin = true;
+      result = situation::calculateSafeLongitudinalMarginOppositeDirection(
+        situation.egoVehicleState,
+        situation.otherVehicleState,
+        situation.relativePosition.longitudinalDistance,
+        margin,
+        marginGradient);
+      break;
+    case situation::SituationType::IntersectionEgoHasPriority:
+    case situation::SituationType::IntersectionObjectHasPriority:
+    case situation::SituationType::IntersectionSamePriority:
+      if (!situation.egoVehicleState.hasPriority)
+      {
+        safetyMargins.hasLongitudinalMargin = true;
+        result = situation::calculateStopInFrontIntersectionMargin(situation.egoVehicleState, margin, marginGradient);
+      }
+      break;
+    default:
+      break;
+  }
+
+  if (result && safetyMargins.hasLongitudinalMargin)
+  {
+    safetyMargins.longitudinalMargin = createSafetyMargin(margin, marginGradient);
+  }
+  return result;
+}
+
+bool calculateLateralMargin(situation::Situation const &situation, RssSituationSafetyMargins &safetyMargins)
+{
+  if (isIntersectionSituation(situation) || !hasLateralDistance(situation))
+  {
+    return true;
+  }
+
+  physics::Distance margin(0.);
+  situation::DistanceGradient marginGradient;
+  bool const result = situation::calculateSafeLateralMargin(situation.egoVehicleState,
+                                                            situation.otherVehicleState,
+                                                            situation.relativePosition.lateralPosition,
+                                                            situation.relativePosition.lateralDistance,
+                                                            margin,
+                                                            marginGradient);
+  if (result)
+  {
+    safetyMargins.hasLateralMargin = true;
+    safetyMargins.lateralMargin = createSafetyMargin(margin, marginGradient);
+  }
+  return result;
+}
+
+/*!
+ * @brief the motion of the ego vehicle along one axis of the planning horizon
+ */
+struct PlannedMotion
+{
+  /*!
+   * @brief the ego vehicle speed at the beginning of each step
+   */
+  std::vector<double> speeds;
+
+  /*!
+   * @brief the ego vehicle displacement at the beginning of each step
+   */
+  std::vector<double> displacements;
+};
+
+PlannedMotion calculatePlannedMotion(physics::Speed const &currentSpeed,
+                                     std::vector<physics::Acceleration> const &accelerations,
+                                     double const stepDuration)
+{
+  PlannedMotion motion;
+  motion.speeds.reserve(accelerations.size() + 1u);
+  motion.displacements.reserve(accelerations.size() + 1u);
+  motion.speeds.push_back(static_cast<double>(currentSpeed));
+  motion.displacements.push_back(0.);
+  for (auto const &acceleration : accelerations)
+  {
+    double const speed = motion.speeds.back();
+    double const accelerationValue = static_cast<double>(acceleration);
+    motion.displacements.push_back(motion.displacements.back() + speed * stepDuration
+                                   + 0.5 * accelerationValue * stepDuration * stepDuration);
+    motion.speeds.push_back(speed + accelerationValue * stepDuration);
+  }
+  return motion;
+}
+
+/*!
+ * @brief predict the situation at the given step of the planning horizon
+ */
+situation::Situation predictSituation(situation::Situation const &situation,
+                                      PlannedMotion const &motionLon,
+                                      PlannedMotion const &motionLat,
+                                      std::size_t const step,
+                                      double const stepDuration)
+{
+  situation::Situation predictedSituation = situation;
+  double const time = static_cast<double>(step) * stepDuration;
+
+  predictedSituation.egoVehicleState.velocity.speedLon
+    = physics::Speed(std::max(0., std::min(motionLon.speeds[step], cMaxSpeedLon)));
+  predictedSituation.egoVehicleState.velocity.speedLat
+    = physics::Speed(std::max(-cMaxSpeedLat, std::min(motionLat.speeds[step], cMaxSpeedLat)));
+
+  if (isIntersectionSituation(situation))
+  {
+    double const displacement = motionLon.displacements[step];
+    predictedSituation.egoVehicleState.distanceToEnterIntersection = physics::Distance(
+      std::max(0., static_cast<double>(situation.egoVehicleState.distanceToEnterIntersection) - displacement));
+    predictedSituation.egoVehicleState.distanceToLeaveIntersection = physics::Distance(
+      std::max(0., static_cast<double>(situation.egoVehicleState.distanceToLeaveIntersection) - displacement));
+    return predictedSituation;
+  }
+
+  double const longitudinalDistance = static_cast<double>(situation.relativePosition.longitudinalDistance)
+    + RssSituationPrediction::getEgoDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal)
+      * motionLon.displacements[step]
+    + RssSituationPrediction::getOtherDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Longitudinal)
+      * static_cast<double>(situation.otherVehicleState.velocity.speedLon) * time;
+  predictedSituation.relativePosition.longitudinalDistance = physics::Distance(std::max(0., longitudinalDistance));
+
+  if (hasLateralDistance(situation))
+  {
+    double const lateralDistance = static_cast<double>(situation.relativePosition.lateralDistance)
+      + RssSituationPrediction::getEgoDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Lateral)
+        * motionLat.displacements[step]
+      + RssSituationPrediction::getOtherDistanceChangeFactor(situation, physics::CoordinateSystemAxis::Lateral)
+        * static_cast<double>(situation.otherVehicleState.velocity.speedLat) * time;
+    predictedSituation.relativePosition.lateralDistance = physics::Distance(std::max(0., lateralDistance));
+  }
+  return predictedSituation;
+}
+
+/*!
+ * @brief linearize the margin at the given step with respect to the accelerations of the planning horizon
+ *
+ * The accelerations of the previous steps j change the speed by stepDuration and the displacement by
+ * stepDuration^2 * (step - j - 0.5).
+ */
+RssLinearConstraint createLinearConstraint(situation::Situation const &situation,
+                                           physics::CoordinateSystemAxis const &axis,
+                                           RssSafetyMargin const &safetyMargin,
+                                           std::vector<physics::Acceleration> const &plannedAccelerations,
+                                           std::size_t const step,
+                                           double const stepDuration)
+{
+  RssLinearConstraint constraint;
+  constraint.situationId = situation.situationId;
+  constraint.axis = axis;
+  constraint.step = static_cast<uint32_t>(step);
+  constraint.coefficients.assign(plannedAccelerations.size(), 0.);
+
+  double const speedDerivative = static_cast<double>(safetyMargin.speedDerivative);
+  double const distanceChange = RssSituationPrediction::getEgoDistanceChangeFactor(situation, axis);
+
+  // margin + sum(gradient[j] * (acceleration[j] - plannedAcceleration[j])) >= precision
+  constraint.upperBound = static_cast<double>(safetyMargin.margin) - physics::Distance::cPrecisionValue;
+  for (std::size_t j = 0u; j < step; j++)
+  {
+    double const gradient = speedDerivative * stepDuration
+      + distanceChange * stepDuration * stepDuration * (static_cast<double>(step - j) - 0.5);
+    constraint.coefficients[j] = -gradient;
+    constraint.upperBound -= gradient * static_cast<double>(plannedAccelerations[j]);
+  }
+  return constraint;
+}
+
+} // namespace
+
+bool calculateSafetyMargins(situation::Situation const &situation, RssSituationSafetyMargins &safetyMargins)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    RssSituationSafetyMargins margins;
+    margins.situationId = situation.situationId;
+    result = calculateLongitudinalMargin(situation, margins) && calculateLateralMargin(situation, margins);
+    if (result)
+    {
+      safetyMargins = margins;
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool calculateSafetyMargins(world::WorldModel const &worldModel, RssSituationSafetyMarginsVector &safetyMarginsVector)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    situation::SituationVector situationVector;
+    result = RssSituationExtraction::extractSituations(worldModel, situationVector);
+
+    RssSituationSafetyMarginsVector marginsVector;
+    marginsVector.reserve(situationVector.size());
+    for (auto it = situationVector.begin(); result && (it != situationVector.end()); it++)
+    {
+      RssSituationSafetyMargins safetyMargins;
+      result = calculateSafetyMargins(*it, safetyMargins);
+      marginsVector.push_back(safetyMargins);
+    }
+
+    if (result)
+    {
+      safetyMarginsVector.swap(marginsVector);
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool calculateLinearConstraints(situation::Situation const &situation,
+                                RssPlanningHorizon const &planningHorizon,
+                                RssLinearConstraintVector &constraints)
+{
+  if ((planningHorizon.stepDuration <= physics::Duration(0.))
+      || (planningHorizon.accelerationsLon.size() != planningHorizon.accelerationsLat.size()))
+  {
+    return false;
+  }
+
+  bool result = true;
+  AD_RSS_TRY
+  {
+    double const stepDuration = static_cast<double>(planningHorizon.stepDuration);
+    PlannedMotion const motionLon = calculatePlannedMotion(
+      situation.egoVehicleState.velocity.speedLon, planningHorizon.accelerationsLon, stepDuration);
+    PlannedMotion const motionLat = calculatePlannedMotion(
+      situation.egoVehicleState.velocity.speedLat, planningHorizon.accelerationsLat, stepDuration);
+
+    RssLinearConstraintVector situationConstraints;
+    for (std::size_t step = 1u; result && (step <= planningHorizon.accelerationsLon.size()); step++)
+    {
+      situation::Situation const predictedSituation
+        = predictSituation(situation, motionLon, motionLat, step, stepDuration);
+
+      RssSituationSafetyMargins safetyMargins;
+      result = calculateSafetyMargins(predictedSituation, safetyMargins);
+      if (result && safetyMargins.hasLongitudinalMargin)
+      {
+        situationConstraints.push_back(createLinearConstraint(situation,
+                                                              physics::CoordinateSystemAxis::Longitudinal,
+                                                              safetyMargins.longitudinalMargin,
+                                                              planningHorizon.accelerationsLon,
+                                                              step,
+                                                              stepDuration));
+      }
+      if (result && safetyMargins.hasLateralMargin)
+      {
+        situationConstraints.push_back(createLinearConstraint(situation,
+                                                              physics::CoordinateSystemAxis::Lateral,
+                                                              safetyMargins.lateralMargin,
+                                                              planningHorizon.accelerationsLat,
+                                                              step,
+                                                              stepDuration));
+      }
+    }
+
+    if (result)
+    {
+      constraints.insert(constraints.end(), situationConstraints.begin(), situationConstraints.end());
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool calculateLinearConstraints(world::WorldModel const &worldModel,
+                                RssPlanningHorizon const &planningHorizon,
+                                RssLinearConstraintVector &constraints)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    situation::SituationVector situationVector;
+    result = RssSituationExtraction::extractSituations(worldModel, situationVector);
+
+    RssLinearConstraintVector allConstraints;
+    for (auto it = situationVector.begin(); result && (it != situationVector.end()); it++)
+    {
+      result = calculateLinearConstraints(*it, planningHorizon, allConstraints);
+    }
+
+    if (result)
+    {
+      constraints.swap(allConstraints);
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace RssSafetyMarginCalculation
+} // namespace core
+} // namespace ad_rss
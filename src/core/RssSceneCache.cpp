@@ -0,0 +1,159 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssSceneCache.hpp"
+#include <algorithm>
+#include "world/RssWorldModelComparison.hpp"
+
+namespace ad_rss {
+namespace core {
+
+constexpr std::size_t RssSceneCache::cNoEntry;
+
+void RssSceneCache::findUnchangedScenes(world::WorldModel const &worldModel)
+{
+  mSceneEntries.assign(worldModel.scenes.size(), cNoEntry);
+
+  // the situations depend on the ego vehicle, too
+  if (!mEgoVehicleValid || !world::isIdentical(mEgoVehicle, worldModel.egoVehicle))
+  {
+    return;
+  }
+
+  for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); sceneIndex++)
+  {
+    world::Scene const &scene = worldModel.scenes[sceneIndex];
+    auto const entryIndex = std::lower_bound(
+      mSortedEntryIndices.cbegin(),
+      mSortedEntryIndices.cend(),
+      scene.object.objectId,
+      [](EntryIndex const &left, world::ObjectId const &objectId) { return left.objectId < objectId; });
+    if ((entryIndex != mSortedEntryIndices.cend()) && (entryIndex->objectId == scene.object.objectId)
+        && world::isIdentical(mEntries[entryIndex->entryIndex].scene, scene))
+    {
+      mSceneEntries[sceneIndex] = entryIndex->entryIndex;
+    }
+  }
+}
+
+situation::Situation const *RssSceneCache::getSituation(std::size_t const sceneIndex) const
+{
+  if ((sceneIndex >= mSceneEntries.size()) || (mSceneEntries[sceneIndex] == cNoEntry))
+  {
+    return nullptr;
+  }
+  return &mEntries[mSceneEntries[sceneIndex]].situation;
+}
+
+state::ResponseState const *RssSceneCache::getResponseState(std::size_t const sceneIndex) const
+{
+  if ((sceneIndex >= mSceneEntries.size()) || (mSceneEntries[sceneIndex] == cNoEntry))
+  {
+    return nullptr;
+  }
+  return &mEntries[mSceneEntries[sceneIndex]].responseState;
+}
+
+bool RssSceneCache::isSceneCulled(std::size_t const sceneIndex) const
+{
+  (void)sceneIndex;
+  return false;
+}
+
+void RssSceneCache::update(world::WorldModel const &worldModel,
+                           RssSceneResults const *sceneResults,
+                           situation::SituationVector const &situationVector,
+                           state::ResponseStateVector const &responseStateVector)
+{
+  clear();
+
+  // a situation and response state exists for every relevant and not culled scene in the order of the scenes
+  std::size_t situationIndex = 0u;
+  for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); sceneIndex++)
+  {
+    world::Scene const &scene = worldModel.scenes[sceneIndex];
+    if (!isSituationExtracted(scene, sceneResults, sceneIndex))
+    {
+      continue;
+    }
+    if ((situationIndex >= situationVector.size()) || (situationIndex >= responseStateVector.size()))
+    {
+      clear();
+      return;
+    }
+
+    if (mNumberOfEntries == mEntries.size())
+    {
+      mEntries.emplace_back();
+    }
+    Entry &entry = mEntries[mNumberOfEntries];
+    entry.scene = scene;
+    entry.situation = situationVector[situationIndex];
+    entry.responseState = responseStateVector[situationIndex];
+
+    EntryIndex entryIndex;
+    entryIndex.objectId = scene.object.objectId;
+    entryIndex.entryIndex = mNumberOfEntries;
+    mSortedEntryIndices.push_back(entryIndex);
+
+    mNumberOfEntries++;
+    situationIndex++;
+  }
+
+  std::sort(mSortedEntryIndices.begin(), mSortedEntryIndices.end(), [](EntryIndex const &left, EntryIndex const &right) {
+    return left.objectId < right.objectId;
+  });
+
+  // the object id has to identify the scene uniquely
+  auto const duplicate = std::adjacent_find(
+    mSortedEntryIndices.cbegin(), mSortedEntryIndices.cend(), [](EntryIndex const &left, EntryIndex const &right) {
+      return left.objectId == right.objectId;
+    });
+  if (duplicate != mSortedEntryIndices.cend())
+  {
+    clear();
+    return;
+  }
+
+  mEgoVehicle = worldModel.egoVehicle;
+  mEgoVehicleValid = true;
+}
+
+void RssSceneCache::clear()
+{
+  mEgoVehicleValid = false;
+  mNumberOfEntries = 0u;
+  mSortedEntryIndices.clear();
+  mSceneEntries.clear();
+}
+
+} // namespace core
+} // namespace ad_rss
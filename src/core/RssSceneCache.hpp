@@ -0,0 +1,144 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+#include "core/RssSceneResults.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief class RssSceneCache
+ *
+ * Keeps the scenes of the previous time step together with the extracted situations and the calculated response
+ * states. Scenes of the current world model which are identical to a scene of the previous time step (and the ego
+ * vehicle is identical, too) can reuse the previous results instead of extracting and checking again.
+ *
+ * Scenes are matched by their object id and have to be exactly identical (see world::isIdentical()).
+ */
+class RssSceneCache : public RssSceneResults
+{
+public:
+  /**
+   * @brief Search the unchanged scenes of the world model within the results of the previous time step
+   *
+   * @param[in] worldModel the current world model
+   */
+  void findUnchangedScenes(world::WorldModel const &worldModel);
+
+  /**
+   * @brief Get the situation of an unchanged scene
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to findUnchangedScenes()
+   *
+   * @returns the situation of the previous time step, nullptr if the scene changed
+   */
+  situation::Situation const *getSituation(std::size_t const sceneIndex) const override;
+
+  /**
+   * @brief Get the response state of an unchanged scene
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to findUnchangedScenes()
+   *
+   * @returns the response state of the previous time step, nullptr if the scene changed
+   */
+  state::ResponseState const *getResponseState(std::size_t const sceneIndex) const override;
+
+  /**
+   * @brief The scene cache doesn't cull any scene
+   *
+   * @param[in] sceneIndex the index of the scene within the world model passed to findUnchangedScenes()
+   *
+   * @returns false
+   */
+  bool isSceneCulled(std::size_t const sceneIndex) const override;
+
+  /**
+   * @brief Store the results of the current time step
+   *
+   * @param[in] worldModel the current world model
+   * @param[in] sceneResults the optional scene results passed to the situation extraction, culled scenes are not
+   * stored. Can be nullptr.
+   * @param[in] situationVector the situations extracted from the relevant scenes of the world model
+   * @param[in] responseStateVector the response states of the situations
+   */
+  void update(world::WorldModel const &worldModel,
+              RssSceneResults const *sceneResults,
+              situation::SituationVector const &situationVector,
+              state::ResponseStateVector const &responseStateVector);
+
+  /**
+   * @brief Drop all stored results
+   */
+  void clear();
+
+private:
+  struct Entry
+  {
+    world::Scene scene;
+    situation::Situation situation;
+    state::ResponseState responseState;
+  };
+
+  struct EntryIndex
+  {
+    world::ObjectId objectId{0u};
+    std::size_t entryIndex{0u};
+  };
+
+  static constexpr std::size_t cNoEntry = static_cast<std::size_t>(-1);
+
+  world::Object mEgoVehicle;
+  bool mEgoVehicleValid{false};
+  std::vector<Entry> mEntries;
+  std::size_t mNumberOfEntries{0u};
+  std::vector<EntryIndex> mSortedEntryIndices;
+  std::vector<std::size_t> mSceneEntries;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,113 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "ad_rss/situation/Situation.hpp"
+#include "ad_rss/state/ResponseState.hpp"
+#include "ad_rss/world/Scene.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief class RssSceneResults
+ *
+ * Interface providing the situations and the response states of scenes of the world model which are already known
+ * without extracting and checking the scene (e.g. the unchanged scenes of RssSceneCache). The situation extraction
+ * takes over the situations of these scenes and the situation checking their response states.
+ *
+ * Scenes can be culled, too (e.g. by RssBroadPhase): no situation is extracted from a culled scene at all.
+ */
+class RssSceneResults
+{
+public:
+  virtual ~RssSceneResults() = default;
+
+  /**
+   * @brief Get the situation of a scene
+   *
+   * @param[in] sceneIndex the index of the scene within the world model
+   *
+   * @returns the situation of the scene, nullptr if the scene has to be extracted
+   */
+  virtual situation::Situation const *getSituation(std::size_t const sceneIndex) const = 0;
+
+  /**
+   * @brief Get the response state of a scene
+   *
+   * @param[in] sceneIndex the index of the scene within the world model
+   *
+   * @returns the response state of the scene, nullptr if the situation of the scene has to be checked
+   */
+  virtual state::ResponseState const *getResponseState(std::size_t const sceneIndex) const = 0;
+
+  /**
+   * @brief Check if a scene is culled
+   *
+   * @param[in] sceneIndex the index of the scene within the world model
+   *
+   * @returns true if no situation is extracted from the scene
+   */
+  virtual bool isSceneCulled(std::size_t const sceneIndex) const = 0;
+};
+
+/**
+ * @brief Check if a situation is extracted from a scene
+ *
+ * @param[in] scene the scene of the world model
+ * @param[in] sceneResults the optional scene results, can be nullptr
+ * @param[in] sceneIndex the index of the scene within the world model
+ *
+ * @returns true if the scene is relevant and not culled, the situations are extracted from these scenes in the order
+ * of the scenes
+ */
+inline bool isSituationExtracted(world::Scene const &scene,
+                                 RssSceneResults const *sceneResults,
+                                 std::size_t const sceneIndex)
+{
+  return (scene.situationType != situation::SituationType::NotRelevant)
+    && ((sceneResults == nullptr) || !sceneResults->isSceneCulled(sceneIndex));
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,102 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "situation/RssEgoVehicleTerms.hpp"
+#include "situation/RssSituationBatchEvaluator.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief buffers and intermediate results of the situation checks of a single time step
+ *
+ * The checks of a time step are split into the stateless checks, which only depend on the situations of the time step,
+ * and the stateful checks, which depend on the previous time steps (see RssSituationChecking). The stateless checks
+ * store their results within this buffer to be taken over by the stateful checks.
+ *
+ * RssSituationChecking keeps one instance to check the time steps one after the other, the temporal parallel
+ * processing (see RssTemporalCheck) keeps one per time step in flight.
+ */
+struct SituationCheckBuffer
+{
+  /**
+   * @brief the terms of the ego vehicle of the time step
+   */
+  situation::RssEgoVehicleTerms egoVehicleTerms;
+
+  /**
+   * @brief the results of the stateless checks, one per situation
+   */
+  std::vector<uint8_t> situationCheckResults;
+
+  /**
+   * @brief the batch evaluator, nullptr if the batch evaluation is disabled
+   */
+  std::unique_ptr<situation::RssSituationBatchEvaluator> batchEvaluator;
+
+  /**
+   * @brief the indices of the situations evaluated as batch
+   */
+  std::vector<std::size_t> batchSituationIndices;
+
+  /**
+   * @brief true if the situations are within valid input range
+   */
+  bool inputRangeValid{false};
+
+  /**
+   * @brief the number of situations checked, i.e. the situations sharing the time index of the first situation
+   */
+  std::size_t numberOfSituations{0u};
+
+  /**
+   * @brief false if the stateless checks of the time step failed as a whole
+   */
+  bool statelessResult{false};
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -33,22 +33,180 @@
 #include <algorithm>
 #include <memory>
 #include "ad_rss/situation/SituationVectorValidInputRange.hpp"
+#include "ad_rss/state/ResponseStateValidInputRange.hpp"
+#include "core/RssReevaluationScheduler.hpp"
+#include "core/RssSituationCheckBuffer.hpp"
 #include "core/RssState.hpp"
+#include "core/RssWorkerPool.hpp"
+#include "situation/RssEgoVehicleTerms.hpp"
 #include "situation/RssIntersectionChecker.hpp"
+#include "situation/RssSituationBatchEvaluator.hpp"
 #include "situation/RssSituation.hpp"
 
 namespace ad_rss {
 namespace core {
 
+namespace {
+
+bool isIntersectionSituation(situation::Situation const &situation)
+{
+  return (situation.situationType == situation::SituationType::IntersectionEgoHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionObjectHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionSamePriority);
+}
+
+/*!
+ * @brief check a situation not requiring any state from previous time steps, i.e. not an intersection situation
+ */
+bool checkStatelessSituation(situation::Situation const &situation,
+                             situation::RssEgoVehicleTerms const &egoVehicleTerms,
+                             state::ResponseState &response)
+{
+  bool result = false;
+  response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+
+  switch (situation.situationType)
+  {
+    case situation::SituationType::NotRelevant:
+      response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::Yes);
+      result = true;
+      break;
+    case situation::SituationType::SameDirection:
+      result = calculateRssStateNonIntersectionSameDirection(situation, egoVehicleTerms, response);
+      break;
+    case situation::SituationType::OppositeDirection:
+      result = calculateRssStateNonIntersectionOppositeDirection(situation, egoVehicleTerms, response);
+      break;
+    default:
+      result = false;
+      break;
+  }
+  return result;
+}
+
+bool isBatchSituation(situation::Situation const &situation)
+{
+  return (situation.situationType == situation::SituationType::SameDirection)
+    || (situation.situationType == situation::SituationType::OppositeDirection);
+}
+
+bool isResponseStateReused(std::vector<uint8_t> const &reusedResponseStates, std::size_t const index)
+{
+  return (index < reusedResponseStates.size()) && (reusedResponseStates[index] != 0u);
+}
+
+/*!
+ * @brief check the input range of the situations not already checked within a previous time step
+ *
+ * The situations of reused response states are taken over unchanged from the previous time step, where they have
+ * been checked already (besides the time index, which is checked as part of the world model).
+ */
+bool withinValidInputRangeUnlessReused(situation::SituationVector const &situationVector,
+                                       std::vector<uint8_t> const &reusedResponseStates)
+{
+  // maximum size of a SituationVector within valid input range
+  if (situationVector.size() > std::size_t(100))
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < situationVector.size(); i++)
+  {
+    if (!isResponseStateReused(reusedResponseStates, i) && !withinValidInputRange(situationVector[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * @brief calculate the terms of the ego vehicle of the time step from the first situation to be checked
+ */
+void calculateEgoVehicleTerms(situation::SituationVector const &situationVector,
+                              std::size_t const numberOfSituations,
+                              std::vector<uint8_t> const &reusedResponseStates,
+                              situation::RssEgoVehicleTerms &egoVehicleTerms)
+{
+  egoVehicleTerms.reset();
+  for (std::size_t i = 0u; i < numberOfSituations; i++)
+  {
+    if (!isResponseStateReused(reusedResponseStates, i))
+    {
+      // all situations of a time step usually share the same ego vehicle state, situations with a different one
+      // calculate the ego vehicle terms on their own
+      egoVehicleTerms.calculate(situationVector[i].egoVehicleState);
+      break;
+    }
+  }
+}
+
+/*!
+ * @brief task checking the stateless situations within the worker pool
+ */
+class StatelessSituationCheckTask : public RssWorkerPool::Task
+{
+public:
+  StatelessSituationCheckTask(situation::SituationVector const &situationVector,
+                              situation::RssEgoVehicleTerms const &egoVehicleTerms,
+                              state::ResponseStateVector &responseStateVector,
+                              std::vector<uint8_t> const &reusedResponseStates,
+                              std::vector<uint8_t> &checkResults)
+    : mSituationVector(situationVector)
+    , mEgoVehicleTerms(egoVehicleTerms)
+    , mResponseStateVector(responseStateVector)
+    , mReusedResponseStates(reusedResponseStates)
+    , mCheckResults(checkResults)
+  {
+  }
+
+  void execute(std::size_t const, std::size_t const itemIndex) override
+  {
+    situation::Situation const &situation = mSituationVector[itemIndex];
+    if (isIntersectionSituation(situation))
+    {
+      return;
+    }
+    if (isResponseStateReused(mReusedResponseStates, itemIndex))
+    {
+      mCheckResults[itemIndex] = 1u;
+      return;
+    }
+
+    bool result = false;
+    AD_RSS_TRY
+    {
+      // the response state is checked here already, so that the response resolving doesn't need to check it again
+      result = checkStatelessSituation(situation, mEgoVehicleTerms, mResponseStateVector[itemIndex])
+        && withinValidInputRange(mResponseStateVector[itemIndex]);
+    }
+    AD_RSS_CATCH_ALL
+    {
+      result = false;
+    }
+    mCheckResults[itemIndex] = result ? 1u : 0u;
+  }
+
+private:
+  situation::SituationVector const &mSituationVector;
+  situation::RssEgoVehicleTerms const &mEgoVehicleTerms;
+  state::ResponseStateVector &mResponseStateVector;
+  std::vector<uint8_t> const &mReusedResponseStates;
+  std::vector<uint8_t> &mCheckResults;
+};
+
+} // namespace
+
 RssSituationChecking::RssSituationChecking()
 {
-  try
+  AD_RSS_TRY
   {
     mIntersectionChecker = std::unique_ptr<situation::RssIntersectionChecker>(new situation::RssIntersectionChecker());
+    mCheckBuffer = std::unique_ptr<SituationCheckBuffer>(new SituationCheckBuffer());
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     mIntersectionChecker = nullptr;
+    mCheckBuffer = nullptr;
   }
 }
 
@@ -56,15 +214,59 @@ RssSituationChecking::~RssSituationChecking()
 {
 }
 
+void RssSituationChecking::enableBatchEvaluation()
+{
+  mBatchEvaluation = true;
+  if (static_cast<bool>(mCheckBuffer))
+  {
+    initializeCheckBuffer(*mCheckBuffer);
+  }
+}
+
+void RssSituationChecking::enableLazyReevaluation(physics::Duration const &maximumTimeStepDuration)
+{
+  if (maximumTimeStepDuration > physics::Duration(0.))
+  {
+    mReevaluationScheduler
+      = std::unique_ptr<RssReevaluationScheduler>(new RssReevaluationScheduler(maximumTimeStepDuration));
+  }
+}
+
+void RssSituationChecking::initializeCheckBuffer(SituationCheckBuffer &buffer) const
+{
+  if (mBatchEvaluation && !static_cast<bool>(buffer.batchEvaluator))
+  {
+    buffer.batchEvaluator
+      = std::unique_ptr<situation::RssSituationBatchEvaluator>(new situation::RssSituationBatchEvaluator());
+  }
+}
+
+bool RssSituationChecking::assignState(RssSituationChecking const &other)
+{
+  if (!static_cast<bool>(mIntersectionChecker) || !static_cast<bool>(other.mIntersectionChecker))
+  {
+    return false;
+  }
+  // assignment reuses the capacity of the state table
+  *mIntersectionChecker = *other.mIntersectionChecker;
+  mLastTimeIndex = other.mLastTimeIndex;
+  mCurrentTimeIndex = other.mCurrentTimeIndex;
+  if (other.mBatchEvaluation)
+  {
+    enableBatchEvaluation();
+  }
+  return true;
+}
+
 bool RssSituationChecking::checkSituationInputRangeChecked(situation::Situation const &situation,
                                                            bool const nextTimeStep,
                                                            state::ResponseState &response)
 {
   bool result = false;
   // global try catch block to ensure this library call doesn't throw an exception
-  try
+  AD_RSS_TRY
   {
-    if (!static_cast<bool>(mIntersectionChecker))
+    if (!static_cast<bool>(mIntersectionChecker) || !static_cast<bool>(mCheckBuffer))
     {
       return false;
     }
@@ -73,32 +275,17 @@ bool RssSituationChecking::checkSituationInputRangeChecked(situation::Situation
       return false;
     }
 
-    response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
-
-    switch (situation.situationType)
+    if (isIntersectionSituation(situation))
     {
-      case situation::SituationType::NotRelevant:
-        response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::Yes);
-        result = true;
-        break;
-      case situation::SituationType::SameDirection:
-        result = calculateRssStateNonIntersectionSameDirection(situation, response);
-        break;
-      case situation::SituationType::OppositeDirection:
-        result = calculateRssStateNonIntersectionOppositeDirection(situation, response);
-        break;
-
-      case situation::SituationType::IntersectionEgoHasPriority:
-      case situation::SituationType::IntersectionObjectHasPriority:
-      case situation::SituationType::IntersectionSamePriority:
-        result = mIntersectionChecker->calculateRssStateIntersection(situation, response);
-        break;
-      default:
-        result = false;
-        break;
+      response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+      result = mIntersectionChecker->calculateRssStateIntersection(situation, mCheckBuffer->egoVehicleTerms, response);
+    }
+    else
+    {
+      result = checkStatelessSituation(situation, mCheckBuffer->egoVehicleTerms, response);
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     result = false;
   }
@@ -116,9 +303,14 @@ bool RssSituationChecking::checkSituations(situation::SituationVector const &sit
   bool result = true;
   bool nextTimeStep = true;
   // global try catch block to ensure this library call doesn't throw an exception
-  try
+  AD_RSS_TRY
   {
     responseStateVector.clear();
+    if (static_cast<bool>(mCheckBuffer))
+    {
+      calculateEgoVehicleTerms(
+        situationVector, situationVector.size(), std::vector<uint8_t>(), mCheckBuffer->egoVehicleTerms);
+    }
     for (auto const &situation : situationVector)
     {
       state::ResponseState responseState;
@@ -135,7 +327,264 @@ bool RssSituationChecking::checkSituations(situation::SituationVector const &sit
       }
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    responseStateVector.clear();
+  }
+  return result;
+}
+
+bool RssSituationChecking::checkSituations(situation::SituationVector const &situationVector,
+                                           state::ResponseStateVector &responseStateVector,
+                                           std::vector<uint8_t> const &reusedResponseStates,
+                                           RssWorkerPool *workerPool)
+{
+  if (!static_cast<bool>(mCheckBuffer))
+  {
+    // without situations there is nothing to be checked
+    responseStateVector.clear();
+    return situationVector.empty();
+  }
+  if (!static_cast<bool>(mReevaluationScheduler))
+  {
+    checkStatelessSituations(situationVector, responseStateVector, reusedResponseStates, workerPool, *mCheckBuffer);
+    return checkStatefulSituations(situationVector, responseStateVector, *mCheckBuffer);
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    // the situations not evaluated again are treated like the reused ones
+    mReevaluationScheduler->provideScheduledResponseStates(situationVector, reusedResponseStates, responseStateVector);
+    checkStatelessSituations(situationVector,
+                             responseStateVector,
+                             mReevaluationScheduler->getProvidedResponseStates(),
+                             workerPool,
+                             *mCheckBuffer);
+    result = checkStatefulSituations(situationVector, responseStateVector, *mCheckBuffer);
+    mReevaluationScheduler->update(situationVector, responseStateVector, result);
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    responseStateVector.clear();
+  }
+  return result;
+}
+
+void RssSituationChecking::checkStatelessSituations(situation::SituationVector const &situationVector,
+                                                    state::ResponseStateVector &responseStateVector,
+                                                    std::vector<uint8_t> const &reusedResponseStates,
+                                                    RssWorkerPool *workerPool,
+                                                    SituationCheckBuffer &buffer) const
+{
+  buffer.inputRangeValid = withinValidInputRangeUnlessReused(situationVector, reusedResponseStates);
+  buffer.numberOfSituations = 0u;
+  buffer.statelessResult = false;
+  if (!buffer.inputRangeValid)
+  {
+    return;
+  }
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    // all situations of a time step have to share the time index, only the first one is allowed to start a new time
+    // step (the increase of the time index is checked by the stateful checks)
+    std::size_t numberOfSituations = situationVector.size();
+    for (std::size_t i = 1u; i < situationVector.size(); i++)
+    {
+      if (situationVector[i].timeIndex != situationVector[0].timeIndex)
+      {
+        numberOfSituations = i;
+        result = false;
+        break;
+      }
+    }
+
+    buffer.numberOfSituations = numberOfSituations;
+    responseStateVector.resize(numberOfSituations);
+    buffer.situationCheckResults.assign(numberOfSituations, 0u);
+    calculateEgoVehicleTerms(situationVector, numberOfSituations, reusedResponseStates, buffer.egoVehicleTerms);
+    StatelessSituationCheckTask task(
+      situationVector, buffer.egoVehicleTerms, responseStateVector, reusedResponseStates, buffer.situationCheckResults);
+    if (static_cast<bool>(buffer.batchEvaluator))
+    {
+      // the same and opposite direction situations are evaluated as batch, all others one by one
+      buffer.batchSituationIndices.clear();
+      for (std::size_t i = 0u; i < numberOfSituations; i++)
+      {
+        situation::Situation const &situation = situationVector[i];
+        if (isBatchSituation(situation) && !isResponseStateReused(reusedResponseStates, i))
+        {
+          buffer.batchSituationIndices.push_back(i);
+          responseStateVector[i]
+            = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+        }
+        else
+        {
+          task.execute(0u, i);
+        }
+      }
+      bool const batchResult = buffer.batchEvaluator->calculateRssStates(
+        situationVector, buffer.batchSituationIndices, responseStateVector);
+      for (auto const index : buffer.batchSituationIndices)
+      {
+        if (batchResult)
+        {
+          buffer.situationCheckResults[index] = withinValidInputRange(responseStateVector[index]) ? 1u : 0u;
+        }
+        else
+        {
+          // the failing situations are determined by the situation-wise evaluation
+          task.execute(0u, index);
+        }
+      }
+    }
+    else if (workerPool != nullptr)
+    {
+      workerPool->execute(task, numberOfSituations);
+    }
+    else
+    {
+      for (std::size_t i = 0u; i < numberOfSituations; i++)
+      {
+        task.execute(0u, i);
+      }
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  buffer.statelessResult = result;
+}
+
+bool RssSituationChecking::checkStatefulSituations(situation::SituationVector const &situationVector,
+                                                   state::ResponseStateVector &responseStateVector,
+                                                   SituationCheckBuffer const &buffer)
+{
+  if (!buffer.inputRangeValid)
+  {
+    responseStateVector.clear();
+    return false;
+  }
+  bool result = buffer.statelessResult;
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    if (!situationVector.empty())
+    {
+      // the time step is started by the first situation, even if the stateless checks failed
+      result = static_cast<bool>(mIntersectionChecker) && checkTimeIncreasingConsistently(situationVector[0], true)
+        && result;
+    }
+
+    // the intersection checker keeps state across time steps, therefore the intersection situations are evaluated
+    // in order and only up to the first failing situation (as done by the sequential processing)
+    for (std::size_t i = 0u; (i < buffer.numberOfSituations) && result; i++)
+    {
+      situation::Situation const &situation = situationVector[i];
+      if (isIntersectionSituation(situation))
+      {
+        state::ResponseState &response = responseStateVector[i];
+        response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+        result = mIntersectionChecker->calculateRssStateIntersection(situation, buffer.egoVehicleTerms, response)
+          && withinValidInputRange(response);
+      }
+      else
+      {
+        result = (buffer.situationCheckResults[i] != 0u);
+      }
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    responseStateVector.clear();
+  }
+  return result;
+}
+
+bool RssSituationChecking::checkSituationSequence(situation::SituationVector const &situationVector,
+                                                  std::size_t const numberOfSituationsPerTimeStep,
+                                                  state::ResponseStateVector &responseStateVector)
+{
+  // maximum size of a SituationVector within valid input range
+  bool result = static_cast<bool>(mIntersectionChecker) && static_cast<bool>(mCheckBuffer)
+    && (numberOfSituationsPerTimeStep <= std::size_t(100));
+  if (!situationVector.empty())
+  {
+    result = result && (numberOfSituationsPerTimeStep > 0u)
+      && ((situationVector.size() % numberOfSituationsPerTimeStep) == 0u);
+  }
+  // global try catch block to ensure this library call doesn't throw an exception
+  AD_RSS_TRY
+  {
+    if (result)
+    {
+      SituationCheckBuffer &buffer = *mCheckBuffer;
+      if (!static_cast<bool>(buffer.batchEvaluator))
+      {
+        // the sequence is always evaluated as batch
+        buffer.batchEvaluator
+          = std::unique_ptr<situation::RssSituationBatchEvaluator>(new situation::RssSituationBatchEvaluator());
+        initializeCheckBuffer(buffer);
+      }
+
+      responseStateVector.resize(situationVector.size());
+      buffer.batchSituationIndices.clear();
+      for (std::size_t i = 0u; result && (i < situationVector.size()); i++)
+      {
+        situation::Situation const &situation = situationVector[i];
+        result = withinValidInputRange(situation);
+        if (result && isBatchSituation(situation))
+        {
+          buffer.batchSituationIndices.push_back(i);
+          responseStateVector[i]
+            = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+        }
+      }
+      result = result && buffer.batchEvaluator->calculateRssStates(
+                           situationVector, buffer.batchSituationIndices, responseStateVector);
+
+      // the intersection checker keeps state across time steps, therefore the time steps are processed in order
+      for (std::size_t begin = 0u; result && (begin < situationVector.size()); begin += numberOfSituationsPerTimeStep)
+      {
+        std::size_t const end = begin + numberOfSituationsPerTimeStep;
+        result = checkTimeIncreasingConsistently(situationVector[begin], true);
+        buffer.egoVehicleTerms.calculate(situationVector[begin].egoVehicleState);
+        for (std::size_t i = begin; result && (i < end); i++)
+        {
+          situation::Situation const &situation = situationVector[i];
+          state::ResponseState &response = responseStateVector[i];
+          result = (i == begin) || checkTimeIncreasingConsistently(situation, false);
+          if (result && isIntersectionSituation(situation))
+          {
+            response = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+            result = mIntersectionChecker->calculateRssStateIntersection(situation, buffer.egoVehicleTerms, response);
+          }
+          else if (result && !isBatchSituation(situation))
+          {
+            result = checkStatelessSituation(situation, buffer.egoVehicleTerms, response);
+          }
+          result = result && withinValidInputRange(response);
+        }
+      }
+    }
+  }
+  AD_RSS_CATCH_ALL
   {
     result = false;
   }
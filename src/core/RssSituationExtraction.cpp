@@ -32,6 +32,8 @@
 #include "ad_rss/core/RssSituationExtraction.hpp"
 #include "ad_rss/world/WorldModelValidInputRange.hpp"
 
+#include "core/RssSituationExtraction.hpp"
+#include "core/RssSituationExtractionBuffer.hpp"
 #include "world/RssSituationCoordinateSystemConversion.hpp"
 
 namespace ad_rss {
@@ -143,7 +145,8 @@ void calcluateRelativeLateralPosition(MetricRange const &egoMetricRange,
 
 bool convertObjectsNonIntersection(world::Object const &egoVehicle,
                                    world::Scene const &currentScene,
-                                   situation::Situation &situation)
+                                   situation::Situation &situation,
+                                   ExtractionBuffer &buffer)
 {
   if (!currentScene.intersectingRoad.empty())
   {
@@ -154,7 +157,8 @@ bool convertObjectsNonIntersection(world::Object const &egoVehicle,
 
   world::ObjectDimensions egoVehicleDimension;
   world::ObjectDimensions objectToBeCheckedDimension;
-  result = calculateObjectDimensions(egoVehicle, currentScene, egoVehicleDimension, objectToBeCheckedDimension);
+  result = calculateObjectDimensions(
+    egoVehicle, currentScene, egoVehicleDimension, objectToBeCheckedDimension, buffer.objectDimensions);
 
   situation::LongitudinalRelativePosition longitudinalPosition;
   Distance longitudinalDistance;
@@ -205,14 +209,24 @@ void convertToIntersectionCentric(MetricRange const &objectDimension,
 
 bool convertObjectsIntersection(world::Object const &egoVehicle,
                                 world::Scene const &currentScene,
-                                situation::Situation &situation)
+                                situation::Situation &situation,
+                                ExtractionBuffer &buffer)
 {
   world::ObjectDimensions egoVehicleDimension;
   world::ObjectDimensions objectDimension;
 
-  bool result = calculateObjectDimensions(egoVehicle, currentScene.egoVehicleRoad, egoVehicleDimension);
+  world::EgoVehicleRoadDimensions const *egoVehicleRoadDimensions = nullptr;
+  bool result = calculateEgoVehicleDimensions(
+    egoVehicle, currentScene.egoVehicleRoad, buffer.objectDimensions, egoVehicleRoadDimensions);
+  if (result)
+  {
+    egoVehicleDimension = egoVehicleRoadDimensions->egoVehiclePosition;
+  }
 
-  result = result && calculateObjectDimensions(currentScene.object, currentScene.intersectingRoad, objectDimension);
+  result = result && calculateObjectDimensions(currentScene.object,
+                                               currentScene.intersectingRoad,
+                                               objectDimension,
+                                               buffer.objectDimensions);
 
   if (result)
   {
@@ -278,7 +292,8 @@ bool convertObjectsIntersection(world::Object const &egoVehicle,
 bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
                                        world::Object const &egoVehicle,
                                        world::Scene const &currentScene,
-                                       situation::Situation &situation)
+                                       situation::Situation &situation,
+                                       ExtractionBuffer &buffer)
 {
   // ensure the object types are semantically correct
   // toDo: add this restriction to the data type model
@@ -296,7 +311,7 @@ bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
 
   bool result = false;
 
-  try
+  AD_RSS_TRY
   {
     situation.timeIndex = timeIndex;
     situation.situationId = situation::SituationId(currentScene.object.objectId);
@@ -322,7 +337,7 @@ bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
       case ad_rss::situation::SituationType::SameDirection:
       case ad_rss::situation::SituationType::OppositeDirection:
       {
-        result = convertObjectsNonIntersection(egoVehicle, currentScene, situation);
+        result = convertObjectsNonIntersection(egoVehicle, currentScene, situation, buffer);
 
         break;
       }
@@ -330,7 +345,7 @@ bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
       case ad_rss::situation::SituationType::IntersectionObjectHasPriority:
       case ad_rss::situation::SituationType::IntersectionSamePriority:
       {
-        result = convertObjectsIntersection(egoVehicle, currentScene, situation);
+        result = convertObjectsIntersection(egoVehicle, currentScene, situation, buffer);
         break;
       }
       case ad_rss::situation::SituationType::NotRelevant:
@@ -345,7 +360,7 @@ bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
       }
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     result = false;
   }
@@ -353,6 +368,24 @@ bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
   return result;
 }
 
+bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
+                                       world::Object const &egoVehicle,
+                                       world::Scene const &currentScene,
+                                       situation::Situation &situation)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    ExtractionBuffer buffer;
+    result = extractSituationInputRangeChecked(timeIndex, egoVehicle, currentScene, situation, buffer);
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
 bool extractSituation(physics::TimeIndex const &timeIndex,
                       world::Object const &egoVehicle,
                       world::Scene const &currentScene,
@@ -366,7 +399,32 @@ bool extractSituation(physics::TimeIndex const &timeIndex,
   return extractSituationInputRangeChecked(timeIndex, egoVehicle, currentScene, situation);
 }
 
-bool extractSituations(world::WorldModel const &worldModel, situation::SituationVector &situationVector)
+/*!
+ * @brief take over the situation of a scene already provided by the scene results
+ */
+bool reuseSituation(RssSceneResults const *sceneResults,
+                    physics::TimeIndex const &timeIndex,
+                    std::size_t const sceneIndex,
+                    situation::Situation &situation)
+{
+  if (sceneResults == nullptr)
+  {
+    return false;
+  }
+  situation::Situation const *providedSituation = sceneResults->getSituation(sceneIndex);
+  if (providedSituation == nullptr)
+  {
+    return false;
+  }
+  situation = *providedSituation;
+  situation.timeIndex = timeIndex;
+  return true;
+}
+
+bool extractSituations(world::WorldModel const &worldModel,
+                       situation::SituationVector &situationVector,
+                       ExtractionBuffer &buffer,
+                       RssSceneResults const *sceneResults)
 {
   if (!withinValidInputRange(worldModel))
   {
@@ -374,13 +432,22 @@ bool extractSituations(world::WorldModel const &worldModel, situation::Situation
   }
 
   bool result = true;
-  try
+  AD_RSS_TRY
   {
-    for (auto const &scene : worldModel.scenes)
+    // the ego vehicle position ranges are shared by all scenes of the world model
+    buffer.objectDimensions.clearEgoVehicleCache();
+
+    for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); sceneIndex++)
     {
+      world::Scene const &scene = worldModel.scenes[sceneIndex];
+      if ((sceneResults != nullptr) && sceneResults->isSceneCulled(sceneIndex))
+      {
+        continue;
+      }
       situation::Situation situation;
       bool const extractResult
-        = extractSituationInputRangeChecked(worldModel.timeIndex, worldModel.egoVehicle, scene, situation);
+        = reuseSituation(sceneResults, worldModel.timeIndex, sceneIndex, situation)
+        || extractSituationInputRangeChecked(worldModel.timeIndex, worldModel.egoVehicle, scene, situation, buffer);
 
       // if the situation is relevant, add it to situationVector
       if (scene.situationType != ad_rss::situation::SituationType::NotRelevant)
@@ -396,7 +463,122 @@ bool extractSituations(world::WorldModel const &worldModel, situation::Situation
       }
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+namespace {
+
+/*!
+ * @brief task extracting the situations of the scenes within the worker pool
+ */
+class SceneExtractionTask : public RssWorkerPool::Task
+{
+public:
+  SceneExtractionTask(world::WorldModel const &worldModel,
+                      ParallelExtractionBuffer &buffer,
+                      RssSceneResults const *sceneResults)
+    : mWorldModel(worldModel)
+    , mBuffer(buffer)
+    , mSceneResults(sceneResults)
+  {
+  }
+
+  void execute(std::size_t const workerIndex, std::size_t const itemIndex) override
+  {
+    if ((mSceneResults != nullptr) && mSceneResults->isSceneCulled(itemIndex))
+    {
+      mBuffer.sceneResults[itemIndex] = 0u;
+      return;
+    }
+    bool result = false;
+    AD_RSS_TRY
+    {
+      situation::Situation &situation = mBuffer.sceneSituations[itemIndex];
+      situation = situation::Situation();
+      result = reuseSituation(mSceneResults, mWorldModel.timeIndex, itemIndex, situation)
+        || extractSituationInputRangeChecked(mWorldModel.timeIndex,
+                                             mWorldModel.egoVehicle,
+                                             mWorldModel.scenes[itemIndex],
+                                             situation,
+                                             mBuffer.workerBuffers[workerIndex]);
+    }
+    AD_RSS_CATCH_ALL
+    {
+      result = false;
+    }
+    mBuffer.sceneResults[itemIndex] = result ? 1u : 0u;
+  }
+
+private:
+  world::WorldModel const &mWorldModel;
+  ParallelExtractionBuffer &mBuffer;
+  RssSceneResults const *mSceneResults;
+};
+
+} // namespace
+
+bool extractSituations(world::WorldModel const &worldModel,
+                       situation::SituationVector &situationVector,
+                       ParallelExtractionBuffer &buffer,
+                       RssWorkerPool &workerPool,
+                       RssSceneResults const *sceneResults)
+{
+  if (!withinValidInputRange(worldModel))
+  {
+    return false;
+  }
+
+  bool result = true;
+  AD_RSS_TRY
+  {
+    buffer.workerBuffers.resize(workerPool.getNumberOfWorkers());
+    for (auto &workerBuffer : buffer.workerBuffers)
+    {
+      // the ego vehicle position ranges are shared by all scenes of the world model
+      workerBuffer.objectDimensions.clearEgoVehicleCache();
+    }
+    buffer.sceneSituations.resize(worldModel.scenes.size());
+    buffer.sceneResults.assign(worldModel.scenes.size(), 0u);
+
+    SceneExtractionTask task(worldModel, buffer, sceneResults);
+    workerPool.execute(task, worldModel.scenes.size());
+
+    for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+    {
+      // if the situation is relevant, add it to situationVector
+      if (isSituationExtracted(worldModel.scenes[i], sceneResults, i))
+      {
+        if (buffer.sceneResults[i] != 0u)
+        {
+          situationVector.push_back(buffer.sceneSituations[i]);
+        }
+        else
+        {
+          result = false;
+        }
+      }
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool extractSituations(world::WorldModel const &worldModel, situation::SituationVector &situationVector)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    ExtractionBuffer buffer;
+    result = extractSituations(worldModel, situationVector, buffer, nullptr);
+  }
+  AD_RSS_CATCH_ALL
   {
     result = false;
   }
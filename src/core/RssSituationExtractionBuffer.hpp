@@ -0,0 +1,153 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "core/RssSceneResults.hpp"
+#include "core/RssWorkerPool.hpp"
+#include "world/RssSituationCoordinateSystemConversion.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief namespace RssSituationExtraction
+ */
+namespace RssSituationExtraction {
+
+/**
+ * @brief buffers reused by consecutive situation extractions
+ *
+ * An instance is kept by the caller (e.g. RssCheck) over time, so that the extraction
+ * does not require any heap allocations once the buffers have grown to the required size.
+ */
+struct ExtractionBuffer
+{
+  /**
+   * @brief buffers used for the calculation of the object dimensions
+   */
+  world::ObjectDimensionsBuffer objectDimensions;
+};
+
+/**
+ * @brief buffers reused by consecutive parallel situation extractions
+ */
+struct ParallelExtractionBuffer
+{
+  /**
+   * @brief the extraction buffers, one per worker of the worker pool
+   */
+  std::vector<ExtractionBuffer> workerBuffers;
+
+  /**
+   * @brief the extracted situations, one per scene
+   */
+  std::vector<situation::Situation> sceneSituations;
+
+  /**
+   * @brief the extraction results, one per scene
+   */
+  std::vector<uint8_t> sceneResults;
+};
+
+/**
+ * @brief Extract the RSS situation of the ego vehicle and the object to be checked.
+ *
+ * In contrast to extractSituation() the inputs are expected to be checked for their valid input range already.
+ *
+ * @param [in] timeIndex - the time index of the current situation
+ * @param [in] egoVehicle - the information on the ego vehicle object
+ * @param [in] currentScene - the information on the object to be checked and the according lane information
+ * @param [out] situation - the situation to be analyzed with RSS
+ * @param [in,out] buffer - the buffers to be used for the extraction. The cached ego vehicle position ranges of the
+ * buffer have to be cleared by the caller whenever the ego vehicle changes.
+ *
+ * @return true if the situation could be created, false if there was an error during the operation.
+ */
+bool extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
+                                       world::Object const &egoVehicle,
+                                       world::Scene const &currentScene,
+                                       situation::Situation &situation,
+                                       ExtractionBuffer &buffer);
+
+/**
+ * @brief Extract all RSS situations to be checked from the world model.
+ *
+ * @param [in] worldModel - the current world model information
+ * @param [out] situationVector - the vector of situations to be analyzed with RSS
+ * @param [in,out] buffer - the buffers to be used for the extraction
+ * @param [in] sceneResults - optional results providing the situations of scenes not to be extracted (e.g. the
+ * unchanged scenes of the RssSceneCache). No situation is added for the culled scenes. Can be nullptr.
+ *
+ * @return true if the situations could be created, false if there was an error during the operation.
+ */
+bool extractSituations(world::WorldModel const &worldModel,
+                       situation::SituationVector &situationVector,
+                       ExtractionBuffer &buffer,
+                       RssSceneResults const *sceneResults);
+
+/**
+ * @brief Extract all RSS situations to be checked from the world model using the given worker pool.
+ *
+ * The scenes are extracted in parallel. The situations are added to the situationVector in the order of the scenes,
+ * so the result is identical to the sequential extractSituations().
+ *
+ * @param [in] worldModel - the current world model information
+ * @param [out] situationVector - the vector of situations to be analyzed with RSS
+ * @param [in,out] buffer - the buffers to be used for the extraction
+ * @param [in] workerPool - the worker pool to be used
+ * @param [in] sceneResults - optional results providing the situations of scenes not to be extracted (e.g. the
+ * unchanged scenes of the RssSceneCache). No situation is added for the culled scenes. Can be nullptr.
+ *
+ * @return true if the situations could be created, false if there was an error during the operation.
+ */
+bool extractSituations(world::WorldModel const &worldModel,
+                       situation::SituationVector &situationVector,
+                       ParallelExtractionBuffer &buffer,
+                       RssWorkerPool &workerPool,
+                       RssSceneResults const *sceneResults);
+
+} // namespace RssSituationExtraction
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,246 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssSituationPrediction.hpp"
+#include <algorithm>
+#include "physics/Math.hpp"
+
+namespace ad_rss {
+namespace core {
+namespace RssSituationPrediction {
+
+namespace {
+
+bool isIntersectionSituation(situation::Situation const &situation)
+{
+  return (situation.situationType == situation::SituationType::IntersectionEgoHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionObjectHasPriority)
+    || (situation.situationType == situation::SituationType::IntersectionSamePriority);
+}
+
+bool isLongitudinalOverlap(situation::LongitudinalRelativePosition const &position)
+{
+  return (position == situation::LongitudinalRelativePosition::OverlapFront)
+    || (position == situation::LongitudinalRelativePosition::Overlap)
+    || (position == situation::LongitudinalRelativePosition::OverlapBack);
+}
+
+physics::Distance reduceDistance(physics::Distance const &distance, physics::Distance const &displacement)
+{
+  return std::max(physics::Distance(0.), distance - displacement);
+}
+
+/*!
+ * @brief the distance after the displacements of the vehicles, negative if the vehicles would have passed each other
+ */
+physics::Distance predictDistance(situation::Situation const &situation,
+                                  physics::CoordinateSystemAxis const &axis,
+                                  physics::Distance const &distance,
+                                  physics::Distance const &egoDisplacement,
+                                  physics::Distance const &otherDisplacement)
+{
+  return distance + egoDisplacement * getEgoDistanceChangeFactor(situation, axis)
+    + otherDisplacement * getOtherDistanceChangeFactor(situation, axis);
+}
+
+} // namespace
+
+double getEgoDistanceChangeFactor(situation::Situation const &situation, physics::CoordinateSystemAxis const &axis)
+{
+  if (axis == physics::CoordinateSystemAxis::Lateral)
+  {
+    return (situation.relativePosition.lateralPosition == situation::LateralRelativePosition::AtLeft) ? -1. : 1.;
+  }
+  situation::LongitudinalRelativePosition const &position = situation.relativePosition.longitudinalPosition;
+  if ((situation.situationType == situation::SituationType::SameDirection)
+      && ((position == situation::LongitudinalRelativePosition::InFront)
+          || (position == situation::LongitudinalRelativePosition::OverlapFront)))
+  {
+    return 1.;
+  }
+  return -1.;
+}
+
+double getOtherDistanceChangeFactor(situation::Situation const &situation, physics::CoordinateSystemAxis const &axis)
+{
+  if (isIntersectionSituation(situation))
+  {
+    // the other vehicle doesn't change the distance of the ego vehicle to the intersection
+    return 0.;
+  }
+  if ((situation.situationType == situation::SituationType::OppositeDirection)
+      && (axis == physics::CoordinateSystemAxis::Longitudinal))
+  {
+    return -1.;
+  }
+  return -getEgoDistanceChangeFactor(situation, axis);
+}
+
+bool propagateMotion(RssRolloutKinematics const &kinematics,
+                     physics::Duration const &stepDuration,
+                     VehicleMotion &motion)
+{
+  physics::Distance offsetLon(0.);
+  physics::Distance offsetLat(0.);
+  physics::Speed speedLon(0.);
+  physics::Speed speedLat(0.);
+  bool const result = physics::calculateDistanceOffsetAfterResponseTime(physics::CoordinateSystemAxis::Longitudinal,
+                                                                        motion.speedLon,
+                                                                        kinematics.accelerationLon,
+                                                                        stepDuration,
+                                                                        offsetLon)
+    && physics::calculateSpeedAfterResponseTime(physics::CoordinateSystemAxis::Longitudinal,
+                                                motion.speedLon,
+                                                kinematics.accelerationLon,
+                                                stepDuration,
+                                                speedLon)
+    && physics::calculateDistanceOffsetAfterResponseTime(physics::CoordinateSystemAxis::Lateral,
+                                                         motion.speedLat,
+                                                         kinematics.accelerationLat,
+                                                         stepDuration,
+                                                         offsetLat)
+    && physics::calculateSpeedAfterResponseTime(physics::CoordinateSystemAxis::Lateral,
+                                                motion.speedLat,
+                                                kinematics.accelerationLat,
+                                                stepDuration,
+                                                speedLat);
+  if (result)
+  {
+    motion.speedLon = speedLon;
+    motion.speedLat = speedLat;
+    motion.displacementLon += offsetLon;
+    motion.displacementLat += offsetLat;
+  }
+  return result;
+}
+
+void predictSituation(situation::Situation const &situation,
+                      VehicleMotion const &egoMotion,
+                      VehicleMotion const &otherMotion,
+                      physics::TimeIndex const timeIndex,
+                      situation::Situation &predictedSituation)
+{
+  predictedSituation = situation;
+  predictedSituation.timeIndex = timeIndex;
+  predictedSituation.egoVehicleState.velocity.speedLon = egoMotion.speedLon;
+  predictedSituation.egoVehicleState.velocity.speedLat = egoMotion.speedLat;
+  predictedSituation.otherVehicleState.velocity.speedLon = otherMotion.speedLon;
+  predictedSituation.otherVehicleState.velocity.speedLat = otherMotion.speedLat;
+
+  if (isIntersectionSituation(situation))
+  {
+    situation::VehicleState &egoVehicle = predictedSituation.egoVehicleState;
+    egoVehicle.distanceToEnterIntersection
+      = reduceDistance(egoVehicle.distanceToEnterIntersection, egoMotion.displacementLon);
+    egoVehicle.distanceToLeaveIntersection
+      = reduceDistance(egoVehicle.distanceToLeaveIntersection, egoMotion.displacementLon);
+    situation::VehicleState &otherVehicle = predictedSituation.otherVehicleState;
+    otherVehicle.distanceToEnterIntersection
+      = reduceDistance(otherVehicle.distanceToEnterIntersection, otherMotion.displacementLon);
+    otherVehicle.distanceToLeaveIntersection
+      = reduceDistance(otherVehicle.distanceToLeaveIntersection, otherMotion.displacementLon);
+    return;
+  }
+
+  situation::RelativePosition &relativePosition = predictedSituation.relativePosition;
+  if (!isLongitudinalOverlap(relativePosition.longitudinalPosition))
+  {
+    relativePosition.longitudinalDistance = predictDistance(situation,
+                                                            physics::CoordinateSystemAxis::Longitudinal,
+                                                            relativePosition.longitudinalDistance,
+                                                            egoMotion.displacementLon,
+                                                            otherMotion.displacementLon);
+    if (relativePosition.longitudinalDistance <= physics::Distance(0.))
+    {
+      relativePosition.longitudinalPosition = situation::LongitudinalRelativePosition::Overlap;
+      relativePosition.longitudinalDistance = physics::Distance(0.);
+    }
+  }
+
+  if ((relativePosition.lateralPosition == situation::LateralRelativePosition::AtLeft)
+      || (relativePosition.lateralPosition == situation::LateralRelativePosition::AtRight))
+  {
+    relativePosition.lateralDistance = predictDistance(situation,
+                                                       physics::CoordinateSystemAxis::Lateral,
+                                                       relativePosition.lateralDistance,
+                                                       egoMotion.displacementLat,
+                                                       otherMotion.displacementLat);
+    if (relativePosition.lateralDistance <= physics::Distance(0.))
+    {
+      relativePosition.lateralPosition = situation::LateralRelativePosition::Overlap;
+      relativePosition.lateralDistance = physics::Distance(0.);
+    }
+  }
+}
+
+bool predictSituations(situation::SituationVector const &situationVector,
+                       RssTrajectoryRollout const &rollout,
+                       physics::TimeIndex const timeIndex,
+                       situation::SituationVector &predictedSituations)
+{
+  std::size_t const numberOfSituations = situationVector.size();
+  predictedSituations.resize(numberOfSituations * rollout.steps.size());
+
+  bool result = true;
+  for (std::size_t situationIndex = 0u; result && (situationIndex < numberOfSituations); situationIndex++)
+  {
+    situation::Situation const &situation = situationVector[situationIndex];
+    VehicleMotion egoMotion;
+    egoMotion.speedLon = situation.egoVehicleState.velocity.speedLon;
+    egoMotion.speedLat = situation.egoVehicleState.velocity.speedLat;
+    VehicleMotion otherMotion;
+    otherMotion.speedLon = situation.otherVehicleState.velocity.speedLon;
+    otherMotion.speedLat = situation.otherVehicleState.velocity.speedLat;
+
+    for (std::size_t step = 0u; result && (step < rollout.steps.size()); step++)
+    {
+      RssRolloutStep const &rolloutStep = rollout.steps[step];
+      RssRolloutKinematics const otherKinematics = rolloutStep.objectKinematics.empty()
+        ? RssRolloutKinematics()
+        : rolloutStep.objectKinematics[situationIndex];
+      result = propagateMotion(rolloutStep.egoKinematics, rollout.stepDuration, egoMotion)
+        && propagateMotion(otherKinematics, rollout.stepDuration, otherMotion);
+      if (result)
+      {
+        predictSituation(situation,
+                         egoMotion,
+                         otherMotion,
+                         timeIndex + static_cast<physics::TimeIndex>(step + 1u),
+                         predictedSituations[step * numberOfSituations + situationIndex]);
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace RssSituationPrediction
+} // namespace core
+} // namespace ad_rss
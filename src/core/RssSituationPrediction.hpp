@@ -0,0 +1,145 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "ad_rss/core/RssTrajectoryRollout.hpp"
+#include "ad_rss/physics/CoordinateSystemAxis.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief namespace RssSituationPrediction
+ *
+ * Prediction of situations after a motion of the vehicles, based on the relative position of the vehicles within the
+ * situation. The other vehicle of an opposite direction situation is approaching the ego vehicle. For the lateral
+ * distance, a positive lateral speed of the vehicle at the left moves it towards the vehicle at the right, as
+ * considered by the lateral safe distance.
+ */
+namespace RssSituationPrediction {
+
+/*!
+ * @brief the motion of a vehicle within a trajectory rollout
+ */
+struct VehicleMotion
+{
+  /*!
+   * @brief the current speeds of the vehicle
+   */
+  physics::Speed speedLon{0.};
+  physics::Speed speedLat{0.};
+
+  /*!
+   * @brief the displacement of the vehicle since the beginning of the rollout
+   */
+  physics::Distance displacementLon{0.};
+  physics::Distance displacementLat{0.};
+};
+
+/*!
+ * @brief the change of the checked distance of the situation by a displacement of the ego vehicle along the axis
+ *
+ * @return 1 if the distance increases, -1 if it decreases
+ */
+double getEgoDistanceChangeFactor(situation::Situation const &situation, physics::CoordinateSystemAxis const &axis);
+
+/*!
+ * @brief the change of the checked distance of the situation by a displacement of the other vehicle along the axis
+ *
+ * @return 1 if the distance increases, -1 if it decreases, 0 if the distance is not affected (intersection)
+ */
+double getOtherDistanceChangeFactor(situation::Situation const &situation, physics::CoordinateSystemAxis const &axis);
+
+/*!
+ * @brief move the vehicle for one step with the given kinematics using the motion primitives of physics/Math.hpp
+ *
+ * @param[in] kinematics the accelerations of the vehicle during the step
+ * @param[in] stepDuration the duration of the step
+ * @param[in,out] motion the motion of the vehicle
+ *
+ * @return true on success, false otherwise
+ */
+bool propagateMotion(RssRolloutKinematics const &kinematics,
+                     physics::Duration const &stepDuration,
+                     VehicleMotion &motion);
+
+/*!
+ * @brief predict the situation after the motion of the vehicles
+ *
+ * The speeds of the vehicles are replaced by the speeds of the motions, the distances are changed by the
+ * displacements. If a distance between the vehicles vanishes, the vehicles are considered to overlap from then on,
+ * since the extent of the overlap is not known to the situation. The distances to the intersection are reduced by the
+ * longitudinal displacement of the respective vehicle.
+ *
+ * @param[in] situation the current situation
+ * @param[in] egoMotion the motion of the ego vehicle
+ * @param[in] otherMotion the motion of the other vehicle
+ * @param[in] timeIndex the time index of the predicted situation
+ * @param[out] predictedSituation the predicted situation
+ */
+void predictSituation(situation::Situation const &situation,
+                      VehicleMotion const &egoMotion,
+                      VehicleMotion const &otherMotion,
+                      physics::TimeIndex const timeIndex,
+                      situation::Situation &predictedSituation);
+
+/*!
+ * @brief predict the situations at the steps of a trajectory rollout
+ *
+ * @param[in] situationVector the current situations
+ * @param[in] rollout the trajectory rollout
+ * @param[in] timeIndex the current time index, the steps get the following time indices
+ * @param[out] predictedSituations the predicted situations, ordered by the steps; each step contains the predictions
+ * of all situations in the order of the situationVector
+ *
+ * @return true on success, false otherwise
+ */
+bool predictSituations(situation::SituationVector const &situationVector,
+                       RssTrajectoryRollout const &rollout,
+                       physics::TimeIndex const timeIndex,
+                       situation::SituationVector &predictedSituations);
+
+} // namespace RssSituationPrediction
+} // namespace core
+} // namespace ad_rss
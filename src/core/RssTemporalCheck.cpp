@@ -0,0 +1,110 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssTemporalCheck.hpp"
+#include <algorithm>
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+RssCheckConfiguration getSequentialConfiguration(RssCheckConfiguration const &configuration)
+{
+  // the time steps are processed in parallel instead of the scenes of a time step; the scene cache of the incremental
+  // evaluation and the schedule of the lazy re-evaluation depend on the previous time step, so these can't be used by
+  // the parallel stages
+  RssCheckConfiguration sequentialConfiguration = configuration;
+  sequentialConfiguration.numberOfWorkerThreads = 0u;
+  sequentialConfiguration.enableIncrementalEvaluation = false;
+  sequentialConfiguration.enableLazyReevaluation = false;
+  return sequentialConfiguration;
+}
+
+} // namespace
+
+RssTemporalCheck::RssTemporalCheck(RssCheckConfiguration const &configuration,
+                                   std::size_t const numberOfWorkerThreads,
+                                   std::size_t const windowSize)
+  : mRssCheck(getSequentialConfiguration(configuration))
+  , mWorkerPool(numberOfWorkerThreads)
+  , mTicks(std::max(windowSize, std::size_t(1u)))
+{
+  for (auto &tick : mTicks)
+  {
+    mRssCheck.initializeTickBuffer(tick);
+  }
+}
+
+RssTemporalCheck::~RssTemporalCheck()
+{
+}
+
+std::size_t RssTemporalCheck::getWindowSize() const
+{
+  return mTicks.size();
+}
+
+void RssTemporalCheck::checkWindow(WorldModelProvider &worldModelProvider,
+                                   std::size_t const firstTickNumber,
+                                   std::size_t const numberOfTicks)
+{
+  std::size_t const numberOfWindowTicks = std::min(numberOfTicks, mTicks.size());
+
+  mWorldModelProvider = &worldModelProvider;
+  mFirstTickNumber = firstTickNumber;
+  mWorkerPool.execute(*this, numberOfWindowTicks);
+  mWorldModelProvider = nullptr;
+
+  for (std::size_t i = 0u; i < numberOfWindowTicks; i++)
+  {
+    auto const startTime = std::chrono::steady_clock::now();
+    mRssCheck.checkStatefulStages(mTicks[i]);
+    mTicks[i].processingTime += std::chrono::steady_clock::now() - startTime;
+  }
+}
+
+void RssTemporalCheck::execute(std::size_t const, std::size_t const itemIndex)
+{
+  RssCheckTickBuffer &tick = mTicks[itemIndex];
+  auto const startTime = std::chrono::steady_clock::now();
+  tick.worldModelValid = mWorldModelProvider->provideWorldModel(mFirstTickNumber + itemIndex, tick.worldModel);
+  mRssCheck.checkStatelessStages(tick);
+  tick.processingTime = std::chrono::steady_clock::now() - startTime;
+}
+
+RssCheckTickBuffer const &RssTemporalCheck::getTick(std::size_t const index) const
+{
+  return mTicks[index];
+}
+
+} // namespace core
+} // namespace ad_rss
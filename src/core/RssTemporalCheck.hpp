@@ -0,0 +1,219 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ad_rss/core/RssCheck.hpp"
+#include "core/RssBroadPhase.hpp"
+#include "core/RssSituationCheckBuffer.hpp"
+#include "core/RssSituationExtractionBuffer.hpp"
+#include "core/RssWorkerPool.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief the world model, the intermediate results and the results of a single time step processed by RssCheck in
+ * separate stages (see RssCheck::checkStatelessStages() and RssCheck::checkStatefulStages())
+ */
+struct RssCheckTickBuffer
+{
+  /**
+   * @brief the world model of the time step
+   */
+  world::WorldModel worldModel;
+
+  /**
+   * @brief false if the world model could not be provided, the time step fails then
+   */
+  bool worldModelValid{false};
+
+  /**
+   * @brief the buffers of the situation extraction
+   */
+  RssSituationExtraction::ExtractionBuffer extractionBuffer;
+
+  /**
+   * @brief the broad phase of the time step, only available if the broad-phase culling is enabled
+   */
+  std::unique_ptr<RssBroadPhase> broadPhase;
+
+  /**
+   * @brief the result of the situation extraction
+   */
+  bool extractionResult{false};
+
+  /**
+   * @brief the buffers and intermediate results of the situation checks
+   */
+  SituationCheckBuffer situationCheckBuffer;
+
+  /**
+   * @brief the situations of the time step
+   */
+  situation::SituationVector situationVector;
+
+  /**
+   * @brief the response states of the situations
+   */
+  state::ResponseStateVector responseStateVector;
+
+  /**
+   * @brief the acceleration restriction, only valid if the result is true
+   */
+  world::AccelerationRestriction accelerationRestriction;
+
+  /**
+   * @brief true if the acceleration restriction could be calculated
+   */
+  bool result{false};
+
+  /**
+   * @brief the processing time of the time step: providing the world model and all processing stages
+   */
+  std::chrono::steady_clock::duration processingTime{0};
+};
+
+/**
+ * @brief class RssTemporalCheck
+ *
+ * Processing of consecutive time steps by an RssCheck with the processing steps not depending on previous time steps
+ * performed in parallel across the time steps.
+ *
+ * The situation extraction and the checks of the non-intersection situations don't depend on previous time steps.
+ * Only the checks of the intersection situations (and of the increasing time index) and the response resolving keep
+ * state from one time step to the next. Therefore, the time steps are processed in windows: the world models of all
+ * time steps of a window are provided, extracted and checked for the non-intersection situations in parallel by a
+ * worker pool, before the stateful stages are performed for the time steps of the window in order. The results are
+ * identical to calling RssCheck::calculateAccelerationRestriction() for the world models one after the other.
+ *
+ * The tick buffers are kept over the windows, so that processing the windows doesn't allocate memory in steady state.
+ */
+class RssTemporalCheck : private RssWorkerPool::Task
+{
+public:
+  /**
+   * @brief interface providing the world models of the time steps
+   */
+  class WorldModelProvider
+  {
+  public:
+    virtual ~WorldModelProvider() = default;
+
+    /**
+     * @brief provide the world model of a time step
+     *
+     * This function is called concurrently by the workers and is not allowed to throw.
+     *
+     * @param[in] tickNumber the number of the time step
+     * @param[out] worldModel the world model of the time step, reusing the capacity of the previous one
+     *
+     * @return true if the world model could be provided
+     */
+    virtual bool provideWorldModel(std::size_t const tickNumber, world::WorldModel &worldModel) = 0;
+  };
+
+  /**
+   * @brief constructor
+   *
+   * @param[in] configuration the configuration of the RssCheck, the worker threads and the incremental evaluation of
+   * the configuration are not used.
+   * @param[in] numberOfWorkerThreads the number of worker threads processing the time steps of a window in parallel
+   * @param[in] windowSize the maximum number of time steps of a window
+   *
+   * @throws std::system_error if the threads could not be created
+   */
+  RssTemporalCheck(RssCheckConfiguration const &configuration,
+                   std::size_t const numberOfWorkerThreads,
+                   std::size_t const windowSize);
+
+  ~RssTemporalCheck() override;
+
+  RssTemporalCheck(RssTemporalCheck const &) = delete;
+  RssTemporalCheck &operator=(RssTemporalCheck const &) = delete;
+
+  /**
+   * @brief the maximum number of time steps of a window
+   */
+  std::size_t getWindowSize() const;
+
+  /**
+   * @brief process a window of time steps
+   *
+   * The windows have to be processed in the order of the time steps.
+   *
+   * @param[in] worldModelProvider the provider of the world models
+   * @param[in] firstTickNumber the number of the first time step of the window
+   * @param[in] numberOfTicks the number of time steps of the window, at most getWindowSize()
+   */
+  void checkWindow(WorldModelProvider &worldModelProvider,
+                   std::size_t const firstTickNumber,
+                   std::size_t const numberOfTicks);
+
+  /**
+   * @brief the results of a time step of the last processed window
+   *
+   * @param[in] index the index of the time step within the window
+   */
+  RssCheckTickBuffer const &getTick(std::size_t const index) const;
+
+private:
+  /**
+   * @brief provide the world model and perform the stateless stages of a time step of the current window
+   *
+   * Executed by the worker pool.
+   */
+  void execute(std::size_t const workerIndex, std::size_t const itemIndex) override;
+
+  RssCheck mRssCheck;
+  RssWorkerPool mWorkerPool;
+  std::vector<RssCheckTickBuffer> mTicks;
+  WorldModelProvider *mWorldModelProvider{nullptr};
+  std::size_t mFirstTickNumber{0u};
+};
+
+} // namespace core
+} // namespace ad_rss
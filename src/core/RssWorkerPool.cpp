@@ -0,0 +1,146 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssWorkerPool.hpp"
+
+namespace ad_rss {
+namespace core {
+
+RssWorkerPool::RssWorkerPool(std::size_t const numberOfThreads)
+{
+// without exception support a failing thread creation terminates the program
+#if !defined(AD_RSS_NO_EXCEPTIONS)
+  try
+#endif
+  {
+    mThreads.reserve(numberOfThreads);
+    for (std::size_t i = 0u; i < numberOfThreads; i++)
+    {
+      mThreads.emplace_back(&RssWorkerPool::run, this, i + 1u);
+    }
+  }
+#if !defined(AD_RSS_NO_EXCEPTIONS)
+  catch (...)
+  {
+    // the already started threads have to be joined before the exception leaves the constructor
+    shutdown();
+    throw;
+  }
+#endif
+}
+
+RssWorkerPool::~RssWorkerPool()
+{
+  shutdown();
+}
+
+void RssWorkerPool::shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mShutdown = true;
+  }
+  mStartCondition.notify_all();
+  for (auto &thread : mThreads)
+  {
+    if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+}
+
+std::size_t RssWorkerPool::getNumberOfWorkers() const
+{
+  return mThreads.size() + 1u;
+}
+
+void RssWorkerPool::execute(Task &task, std::size_t const numberOfItems)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTask = &task;
+    mNumberOfItems = numberOfItems;
+    mActiveThreads = mThreads.size();
+    mGeneration++;
+  }
+  mStartCondition.notify_all();
+
+  processItems(0u);
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  mFinishedCondition.wait(lock, [this] { return mActiveThreads == 0u; });
+  mTask = nullptr;
+}
+
+void RssWorkerPool::run(std::size_t const workerIndex)
+{
+  uint64_t lastGeneration = 0u;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mStartCondition.wait(lock, [this, lastGeneration] { return mShutdown || (mGeneration != lastGeneration); });
+      if (mShutdown)
+      {
+        return;
+      }
+      lastGeneration = mGeneration;
+    }
+
+    processItems(workerIndex);
+
+    bool finished = false;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mActiveThreads--;
+      finished = (mActiveThreads == 0u);
+    }
+    if (finished)
+    {
+      mFinishedCondition.notify_one();
+    }
+  }
+}
+
+void RssWorkerPool::processItems(std::size_t const workerIndex)
+{
+  // static assignment of the items to the workers: a worker processes the same items in every execution as long as
+  // the number of items doesn't change, so the buffers used per worker stop growing after warm-up
+  std::size_t const numberOfWorkers = getNumberOfWorkers();
+  for (std::size_t itemIndex = workerIndex; itemIndex < mNumberOfItems; itemIndex += numberOfWorkers)
+  {
+    mTask->execute(workerIndex, itemIndex);
+  }
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,134 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief class RssWorkerPool
+ *
+ * A fixed pool of worker threads processing the items of a task in parallel.
+ * The threads are created on construction and kept until destruction, so executing a task doesn't require any
+ * thread creation or heap allocation.
+ */
+class RssWorkerPool
+{
+public:
+  /**
+   * @brief interface of a task to be executed by the worker pool
+   */
+  class Task
+  {
+  public:
+    virtual ~Task() = default;
+
+    /**
+     * @brief process a single item of the task
+     *
+     * This function is called concurrently by the workers and is not allowed to throw.
+     *
+     * @param[in] workerIndex the index of the executing worker within [0; getNumberOfWorkers())
+     * @param[in] itemIndex the index of the item to be processed
+     */
+    virtual void execute(std::size_t const workerIndex, std::size_t const itemIndex) = 0;
+  };
+
+  /**
+   * @brief constructor
+   *
+   * @param[in] numberOfThreads the number of worker threads to be created.
+   *
+   * @throws std::system_error if the threads could not be created
+   */
+  explicit RssWorkerPool(std::size_t const numberOfThreads);
+
+  /**
+   * @brief destructor; stops and joins the worker threads
+   */
+  ~RssWorkerPool();
+
+  RssWorkerPool(RssWorkerPool const &) = delete;
+  RssWorkerPool &operator=(RssWorkerPool const &) = delete;
+
+  /**
+   * @brief the number of workers, i.e. the worker threads plus the calling thread
+   */
+  std::size_t getNumberOfWorkers() const;
+
+  /**
+   * @brief execute the task for all items [0; numberOfItems)
+   *
+   * The calling thread takes part in the processing as worker 0. The function returns when all items are processed.
+   * The items are assigned round-robin to the workers, i.e. worker w processes the items w, w + getNumberOfWorkers(),
+   * ... The order of execution between the workers is not defined, so the task has to store its results per item.
+   *
+   * @param[in] task the task to be executed
+   * @param[in] numberOfItems the number of items to be processed
+   */
+  void execute(Task &task, std::size_t const numberOfItems);
+
+private:
+  void run(std::size_t const workerIndex);
+  void processItems(std::size_t const workerIndex);
+  void shutdown();
+
+  std::vector<std::thread> mThreads;
+  std::mutex mMutex;
+  std::condition_variable mStartCondition;
+  std::condition_variable mFinishedCondition;
+  Task *mTask{nullptr};
+  std::size_t mNumberOfItems{0u};
+  uint64_t mGeneration{0u};
+  std::size_t mActiveThreads{0u};
+  bool mShutdown{false};
+};
+
+} // namespace core
+} // namespace ad_rss
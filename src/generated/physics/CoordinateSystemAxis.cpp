@@ -39,6 +39,7 @@
 
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::physics::CoordinateSystemAxis const e)
 {
@@ -71,5 +72,6 @@ template <>::ad_rss::physics::CoordinateSystemAxis fromString(std::string const
   {
     return ::ad_rss::physics::CoordinateSystemAxis::Lateral;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::physics::CoordinateSystemAxis>(-1); // LCOV_EXCL_LINE
 }
@@ -39,6 +39,7 @@
 
 #include "ad_rss/situation/LateralRelativePosition.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::situation::LateralRelativePosition const e)
 {
@@ -101,5 +102,6 @@ template <>::ad_rss::situation::LateralRelativePosition fromString(std::string c
   {
     return ::ad_rss::situation::LateralRelativePosition::AtRight;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::situation::LateralRelativePosition>(-1); // LCOV_EXCL_LINE
 }
@@ -39,6 +39,7 @@
 
 #include "ad_rss/situation/LongitudinalRelativePosition.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::situation::LongitudinalRelativePosition const e)
 {
@@ -101,5 +102,6 @@ template <>::ad_rss::situation::LongitudinalRelativePosition fromString(std::str
   {
     return ::ad_rss::situation::LongitudinalRelativePosition::AtBack;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::situation::LongitudinalRelativePosition>(-1); // LCOV_EXCL_LINE
 }
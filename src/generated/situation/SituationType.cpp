@@ -39,6 +39,7 @@
 
 #include "ad_rss/situation/SituationType.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::situation::SituationType const e)
 {
@@ -111,5 +112,6 @@ template <>::ad_rss::situation::SituationType fromString(std::string const &str)
   {
     return ::ad_rss::situation::SituationType::IntersectionSamePriority;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::situation::SituationType>(-1); // LCOV_EXCL_LINE
 }
@@ -39,6 +39,7 @@
 
 #include "ad_rss/state/LongitudinalResponse.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::state::LongitudinalResponse const e)
 {
@@ -81,5 +82,6 @@ template <>::ad_rss::state::LongitudinalResponse fromString(std::string const &s
   {
     return ::ad_rss::state::LongitudinalResponse::BrakeMin;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::state::LongitudinalResponse>(-1); // LCOV_EXCL_LINE
 }
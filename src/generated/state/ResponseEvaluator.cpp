@@ -39,6 +39,7 @@
 
 #include "ad_rss/state/ResponseEvaluator.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::state::ResponseEvaluator const e)
 {
@@ -176,5 +177,6 @@ template <>::ad_rss::state::ResponseEvaluator fromString(std::string const &str)
   {
     return ::ad_rss::state::ResponseEvaluator::IntersectionOverlap;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::state::ResponseEvaluator>(-1); // LCOV_EXCL_LINE
 }
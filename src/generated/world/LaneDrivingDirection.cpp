@@ -39,6 +39,7 @@
 
 #include "ad_rss/world/LaneDrivingDirection.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::world::LaneDrivingDirection const e)
 {
@@ -81,5 +82,6 @@ template <>::ad_rss::world::LaneDrivingDirection fromString(std::string const &s
   {
     return ::ad_rss::world::LaneDrivingDirection::Negative;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::world::LaneDrivingDirection>(-1); // LCOV_EXCL_LINE
 }
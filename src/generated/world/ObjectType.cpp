@@ -39,6 +39,7 @@
 
 #include "ad_rss/world/ObjectType.hpp"
 #include <stdexcept>
+#include "ad_rss/physics/RangeError.hpp"
 
 std::string toString(::ad_rss::world::ObjectType const e)
 {
@@ -81,5 +82,6 @@ template <>::ad_rss::world::ObjectType fromString(std::string const &str)
   {
     return ::ad_rss::world::ObjectType::ArtificialObject;
   }
-  throw std::out_of_range("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  ::ad_rss::physics::raiseRangeError("Invalid enum literal"); // LCOV_EXCL_BR_LINE
+  return static_cast<::ad_rss::world::ObjectType>(-1); // LCOV_EXCL_LINE
 }
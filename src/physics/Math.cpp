@@ -30,9 +30,7 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "physics/Math.hpp"
-#include <algorithm>
-#include <limits>
-#include "ad_rss/physics/Operations.hpp"
+#include "physics/MathT.hpp"
 
 namespace ad_rss {
 namespace physics {
@@ -41,32 +39,19 @@ Distance calculateDistanceOffsetInAccerlatedMovement(Speed const &speed,
                                                      Acceleration const &acceleration,
                                                      Duration const &duration)
 {
-  // s(t) =(a/2) * t^2 + v0 * t
-  Distance const distanceOffset = (acceleration * 0.5 * duration * duration) + (speed * duration);
-  return distanceOffset;
+  return MathT<CheckedPhysicsTypes>::calculateDistanceOffsetInAccerlatedMovement(speed, acceleration, duration);
 }
 
 Speed calculateSpeedInAcceleratedMovement(Speed const &speed,
                                           Acceleration const &acceleration,
                                           Duration const &duration)
 {
-  // v(t) =v0 + a * t
-  Speed const resultingSpeed = speed + acceleration * duration;
-  return resultingSpeed;
+  return MathT<CheckedPhysicsTypes>::calculateSpeedInAcceleratedMovement(speed, acceleration, duration);
 }
 
 bool calculateStoppingDistance(Speed const &currentSpeed, Acceleration const &deceleration, Distance &stoppingDistance)
 {
-  if (deceleration <= Acceleration(0.))
-  {
-    // deceleration must be positive
-    return false;
-  }
-
-  // s = v^2 / (2 *a)
-  // keep the signbit of the current Speed
-  stoppingDistance = (currentSpeed * std::fabs(currentSpeed)) / (2.0 * deceleration);
-  return true;
+  return MathT<CheckedPhysicsTypes>::calculateStoppingDistance(currentSpeed, deceleration, stoppingDistance);
 }
 
 bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
@@ -75,30 +60,8 @@ bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
                                      Duration const &responseTime,
                                      Speed &resultingSpeed)
 {
-  if (responseTime < Duration(0.))
-  {
-    // time must not be negative
-    return false;
-  }
-
-  if (axis == CoordinateSystemAxis::Longitudinal)
-  {
-    // in longitudinal direction the speed has to be always >= 0.
-    if (currentSpeed < Speed(0.))
-    {
-      return false;
-    }
-  }
-
-  resultingSpeed = calculateSpeedInAcceleratedMovement(currentSpeed, acceleration, responseTime);
-
-  if (axis == CoordinateSystemAxis::Longitudinal)
-  {
-    // Only deceleration till stop is allowed
-    resultingSpeed = std::max(Speed(0.), resultingSpeed);
-  }
-
-  return true;
+  return MathT<CheckedPhysicsTypes>::calculateSpeedAfterResponseTime(
+    axis, currentSpeed, acceleration, responseTime, resultingSpeed);
 }
 
 bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
@@ -107,32 +70,48 @@ bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
                                               Duration const &responseTime,
                                               Distance &distanceOffset)
 {
-  if (responseTime < Duration(0.))
-  {
-    // time must not be negative
-    return false;
-  }
-
-  Duration resultingResponseTime = responseTime;
-  if (axis == CoordinateSystemAxis::Longitudinal)
-  {
-    if (currentSpeed < Speed(0.))
-    {
-      // in longitudinal direction the speed has to be always >= 0.
-      return false;
-    }
+  return MathT<CheckedPhysicsTypes>::calculateDistanceOffsetAfterResponseTime(
+    axis, currentSpeed, acceleration, responseTime, distanceOffset);
+}
 
-    if (acceleration < Acceleration(0.))
-    {
-      // on deceleration restrict the time to the time required to stop
-      resultingResponseTime = -1. * currentSpeed / acceleration;
-      resultingResponseTime = std::min(resultingResponseTime, responseTime);
-    }
-  }
+bool calculateStoppingDistance(SpeedRange const &currentSpeed,
+                               Acceleration const &deceleration,
+                               MetricRange &stoppingDistance)
+{
+  return calculateNonDecreasingRange(
+    currentSpeed,
+    [&deceleration](Speed const &speed, Distance &distance) {
+      return calculateStoppingDistance(speed, deceleration, distance);
+    },
+    stoppingDistance);
+}
 
-  distanceOffset = calculateDistanceOffsetInAccerlatedMovement(currentSpeed, acceleration, resultingResponseTime);
+bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
+                                     SpeedRange const &currentSpeed,
+                                     Acceleration const &acceleration,
+                                     Duration const &responseTime,
+                                     SpeedRange &resultingSpeed)
+{
+  return calculateNonDecreasingRange(
+    currentSpeed,
+    [&axis, &acceleration, &responseTime](Speed const &speed, Speed &speedAfterResponseTime) {
+      return calculateSpeedAfterResponseTime(axis, speed, acceleration, responseTime, speedAfterResponseTime);
+    },
+    resultingSpeed);
+}
 
-  return true;
+bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
+                                              SpeedRange const &currentSpeed,
+                                              Acceleration const &acceleration,
+                                              Duration const &responseTime,
+                                              MetricRange &distanceOffset)
+{
+  return calculateNonDecreasingRange(
+    currentSpeed,
+    [&axis, &acceleration, &responseTime](Speed const &speed, Distance &distance) {
+      return calculateDistanceOffsetAfterResponseTime(axis, speed, acceleration, responseTime, distance);
+    },
+    distanceOffset);
 }
 
 bool calculateTimeForDistance(Speed const &currentSpeed,
@@ -140,47 +119,8 @@ bool calculateTimeForDistance(Speed const &currentSpeed,
                               Distance const &distanceToCover,
                               Duration &requiredTime)
 {
-  if (currentSpeed < Speed(0.))
-  {
-    return false;
-  }
-
-  bool result = true;
-
-  if (acceleration == Acceleration(0.))
-  {
-    // non-accelerated constant movement:
-    // t = s/v
-    if (currentSpeed == Speed(0.))
-    {
-      requiredTime = std::numeric_limits<Duration>::max();
-    }
-    else
-    {
-      requiredTime = distanceToCover / currentSpeed;
-    }
-  }
-  else
-  {
-    // constant accelerated movement:
-    // t = -v_0/a +- sqrt(v_0^2/a^2 + 2s/a)
-    Duration const firstPart = -1. * currentSpeed / acceleration;
-
-    Duration const secondPart = std::sqrt((firstPart * firstPart) + (2. * distanceToCover / acceleration));
-
-    Duration t1 = firstPart + secondPart;
-    Duration t2 = firstPart - secondPart;
-
-    if (t2 > Duration(0.))
-    {
-      requiredTime = t2;
-    }
-    else
-    {
-      requiredTime = t1;
-    }
-  }
-  return result;
+  return MathT<CheckedPhysicsTypes>::calculateTimeForDistance(
+    currentSpeed, acceleration, distanceToCover, requiredTime);
 }
 
 bool calculateTimeToCoverDistance(Speed const &currentSpeed,
@@ -190,60 +130,80 @@ bool calculateTimeToCoverDistance(Speed const &currentSpeed,
                                   Distance const &distanceToCover,
                                   Duration &requiredTime)
 {
-  if ((currentSpeed < Speed(0.)) || (deceleration < Acceleration(0.)) || (distanceToCover < Distance(0.)))
-  {
-    return false;
-  }
-
-  bool result = false;
-
-  Distance distanceAfterResponseTime;
-
-  result = calculateDistanceOffsetAfterResponseTime( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Longitudinal,
-    currentSpeed,
-    acceleration,
-    responseTime,
-    distanceAfterResponseTime);
+  return MathT<CheckedPhysicsTypes>::calculateTimeToCoverDistance(
+    currentSpeed, responseTime, acceleration, deceleration, distanceToCover, requiredTime);
+}
 
-  if (result)
+void calculateTimeToCoverDistanceTerms(Speed const &currentSpeed,
+                                       Duration const &responseTime,
+                                       Acceleration const &acceleration,
+                                       Acceleration const &deceleration,
+                                       TimeToCoverDistanceTerms &terms)
+{
+  typedef MathT<CheckedPhysicsTypes> Math;
+
+  terms.currentSpeed = currentSpeed;
+  terms.responseTime = responseTime;
+  terms.acceleration = acceleration;
+  terms.deceleration = deceleration;
+  terms.inputValid = false;
+  terms.distanceAfterResponseTimeValid = false;
+  terms.distanceToStopValid = false;
+  AD_RSS_TRY
   {
-    if (distanceAfterResponseTime > distanceToCover)
+    // without exception support the calculation continues after a range error, so the terms check for it explicitly
+    terms.inputValid = !((currentSpeed < Speed(0.)) || (deceleration < Acceleration(0.))) && !rangeErrorRaised();
+    if (terms.inputValid)
     {
-      result = calculateTimeForDistance(currentSpeed, acceleration, distanceToCover, requiredTime);
+      terms.distanceAfterResponseTimeValid = Math::calculateDistanceOffsetAfterResponseTime(
+        CoordinateSystemAxis::Longitudinal, currentSpeed, acceleration, responseTime, terms.distanceAfterResponseTime);
+      terms.distanceAfterResponseTimeValid = terms.distanceAfterResponseTimeValid && !rangeErrorRaised();
     }
-    else
+    if (terms.distanceAfterResponseTimeValid)
     {
-      Speed resultingSpeed;
-
-      result = calculateSpeedAfterResponseTime( // LCOV_EXCL_LINE: wrong detection
-        CoordinateSystemAxis::Longitudinal,
-        currentSpeed,
-        acceleration,
-        responseTime,
-        resultingSpeed);
-
       Distance stoppingDistance;
-      result = result && calculateStoppingDistance(resultingSpeed, deceleration, stoppingDistance);
-
+      bool result = Math::calculateSpeedAfterResponseTime(
+        CoordinateSystemAxis::Longitudinal, currentSpeed, acceleration, responseTime, terms.resultingSpeed);
+      result = result && Math::calculateStoppingDistance(terms.resultingSpeed, deceleration, stoppingDistance);
       if (result)
       {
-        if (distanceAfterResponseTime + stoppingDistance > distanceToCover)
-        {
-          Distance remainingDistance = distanceToCover - distanceAfterResponseTime;
-
-          result = calculateTimeForDistance(resultingSpeed, deceleration, remainingDistance, requiredTime);
-          requiredTime += responseTime;
-        }
-        else
-        {
-          requiredTime = std::numeric_limits<Duration>::max();
-        }
+        terms.distanceToStop = terms.distanceAfterResponseTime + stoppingDistance;
+        terms.distanceToStopValid = !rangeErrorRaised();
       }
     }
   }
+  AD_RSS_CATCH_ALL
+  {
+    // the failing term stays invalid
+  }
+}
+
+bool calculateTimeToCoverDistance(TimeToCoverDistanceTerms const &terms,
+                                  Distance const &distanceToCover,
+                                  Duration &requiredTime)
+{
+  typedef MathT<CheckedPhysicsTypes> Math;
+
+  if (!terms.inputValid || (distanceToCover < Distance(0.)) || !terms.distanceAfterResponseTimeValid)
+  {
+    return false;
+  }
 
-  return result;
+  if (terms.distanceAfterResponseTime > distanceToCover)
+  {
+    return Math::calculateTimeForDistance(terms.currentSpeed, terms.acceleration, distanceToCover, requiredTime);
+  }
+  if (!terms.distanceToStopValid)
+  {
+    return false;
+  }
+  return Math::calculateTimeToCoverDistanceAfterResponseTime(terms.resultingSpeed,
+                                                             terms.responseTime,
+                                                             terms.deceleration,
+                                                             terms.distanceAfterResponseTime,
+                                                             terms.distanceToStop,
+                                                             distanceToCover,
+                                                             requiredTime);
 }
 
 } // namespace physics
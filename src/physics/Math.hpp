@@ -39,7 +39,9 @@
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
 #include "ad_rss/physics/Distance.hpp"
 #include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/MetricRange.hpp"
 #include "ad_rss/physics/Speed.hpp"
+#include "physics/SpeedRange.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -62,6 +64,22 @@ namespace physics {
  */
 bool calculateStoppingDistance(Speed const &currentSpeed, Acceleration const &deceleration, Distance &stoppingDistance);
 
+/**
+ * @brief Calculate the range of the stopping distance for a given speed range and deceleration
+ *
+ * Interval evaluation of calculateStoppingDistance(): the stopping distance is non-decreasing in the current speed,
+ * so the resulting range contains the stopping distance of every speed within \a currentSpeed.
+ *
+ * @param[in]  currentSpeed           is the range of the current speed of the vehicle
+ * @param[in]  deceleration           is the applied (positive) deceleration
+ * @param[out] stoppingDistance       is the range of the resulting stopping distance
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateStoppingDistance(SpeedRange const &currentSpeed,
+                               Acceleration const &deceleration,
+                               MetricRange &stoppingDistance);
+
 /**
  * @brief Calculate the vehicle speed after a given period of time on a constant accelerated movement
  *
@@ -83,6 +101,26 @@ bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
                                      Duration const &responseTime,
                                      Speed &resultingSpeed);
 
+/**
+ * @brief Calculate the range of the vehicle speed after a given period of time for a given speed range
+ *
+ * Interval evaluation of calculateSpeedAfterResponseTime(): the resulting speed is non-decreasing in the current
+ * speed, so the resulting range contains the resulting speed of every speed within \a currentSpeed.
+ *
+ * @param[in]  axis            is the coordinate axis this calculation is for
+ * @param[in]  currentSpeed    is the range of the current speed of the vehicle
+ * @param[in]  acceleration    is the acceleration of the vehicle
+ * @param[in]  responseTime    is the (positive) period of time the vehicle keeps accelerating
+ * @param[out] resultingSpeed  is the range of the resulting speed after \a responseTime
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
+                                     SpeedRange const &currentSpeed,
+                                     Acceleration const &acceleration,
+                                     Duration const &responseTime,
+                                     SpeedRange &resultingSpeed);
+
 /**
  * @brief Calculate the distance offset of a vehicle after a given period of time on a constant accelerated movement
  *
@@ -107,6 +145,26 @@ bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
                                               Duration const &responseTime,
                                               Distance &distanceOffset);
 
+/**
+ * @brief Calculate the range of the distance offset of a vehicle after a given period of time for a given speed range
+ *
+ * Interval evaluation of calculateDistanceOffsetAfterResponseTime(): the distance offset is non-decreasing in the
+ * current speed, so the resulting range contains the distance offset of every speed within \a currentSpeed.
+ *
+ * @param[in]  axis             is the coordinate axis this calculation is for
+ * @param[in]  currentSpeed     is the range of the current speed of the vehicle
+ * @param[in]  acceleration     is the acceleration of the vehicle
+ * @param[in]  responseTime     is the (positive) period of time the vehicle keeps accelerating
+ * @param[out] distanceOffset   is the range of the distance offset from the current position
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
+                                              SpeedRange const &currentSpeed,
+                                              Acceleration const &acceleration,
+                                              Duration const &responseTime,
+                                              MetricRange &distanceOffset);
+
 /**
  * @brief Calculate the time needed to cover a given distance
  *
@@ -130,5 +188,68 @@ bool calculateTimeToCoverDistance(Speed const &currentSpeed,
                                   Distance const &distanceToCover,
                                   Duration &requiredTime);
 
+/**
+ * @brief the terms of calculateTimeToCoverDistance() not depending on the distance to cover
+ *
+ * Allows to calculate the time to cover different distances for the same vehicle motion without repeating the
+ * calculation of the response time and stopping phase.
+ */
+struct TimeToCoverDistanceTerms
+{
+  /** the current speed of the vehicle */
+  Speed currentSpeed;
+  /** the response time of the vehicle */
+  Duration responseTime;
+  /** the acceleration of the vehicle during the response time */
+  Acceleration acceleration;
+  /** the (positive) deceleration of the vehicle after the response time */
+  Acceleration deceleration;
+  /** true if the input of the calculation is valid */
+  bool inputValid{false};
+  /** true if distanceAfterResponseTime could be calculated */
+  bool distanceAfterResponseTimeValid{false};
+  /** the distance covered within the response time */
+  Distance distanceAfterResponseTime;
+  /** true if resultingSpeed and distanceToStop could be calculated */
+  bool distanceToStopValid{false};
+  /** the speed after the response time */
+  Speed resultingSpeed;
+  /** the distance covered until the vehicle stops */
+  Distance distanceToStop;
+};
+
+/**
+ * @brief Calculate the terms of calculateTimeToCoverDistance() not depending on the distance to cover
+ *
+ * Failures of the single calculations are recorded within the terms and reported by
+ * calculateTimeToCoverDistance(TimeToCoverDistanceTerms const &, Distance const &, Duration &) on use.
+ *
+ * @param[in] currentSpeed the current speed of the vehicle
+ * @param[in] responseTime the response time of the vehicle
+ * @param[in] acceleration the acceleration of the vehicle during responseTime
+ * @param[in] deceleration the applied (positive) deceleration after responseTime
+ * @param[out] terms the calculated terms
+ */
+void calculateTimeToCoverDistanceTerms(Speed const &currentSpeed,
+                                       Duration const &responseTime,
+                                       Acceleration const &acceleration,
+                                       Acceleration const &deceleration,
+                                       TimeToCoverDistanceTerms &terms);
+
+/**
+ * @brief Calculate the time needed to cover a given distance from already calculated terms
+ *
+ * Provides the same result as calculateTimeToCoverDistance() for the input of the terms.
+ *
+ * @param[in] terms the terms calculated by calculateTimeToCoverDistanceTerms()
+ * @param[in] distanceToCover distance that should be covered
+ * @param[out] requiredTime time needed to cover the distance
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateTimeToCoverDistance(TimeToCoverDistanceTerms const &terms,
+                                  Distance const &distanceToCover,
+                                  Duration &requiredTime);
+
 } // namespace physics
 } // namespace ad_rss
@@ -0,0 +1,407 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "physics/MathBatch.hpp"
+#include <cmath>
+#include <initializer_list>
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/DurationSquared.hpp"
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/physics/SpeedSquared.hpp"
+#include "physics/MathBatchKernelsT.hpp"
+
+namespace ad_rss {
+namespace physics {
+
+namespace {
+
+/**
+ * @brief scalar instruction set of the batch kernels
+ */
+struct SimdScalar
+{
+  typedef double Vec;
+  typedef bool Mask;
+  static const std::size_t cWidth = 1u;
+
+  static Vec load(double const *values)
+  {
+    return *values;
+  }
+  static void store(double *values, Vec const &value)
+  {
+    *values = value;
+  }
+  static Vec set(double const value)
+  {
+    return value;
+  }
+  static Vec add(Vec const &left, Vec const &right)
+  {
+    return left + right;
+  }
+  static Vec sub(Vec const &left, Vec const &right)
+  {
+    return left - right;
+  }
+  static Vec mul(Vec const &left, Vec const &right)
+  {
+    return left * right;
+  }
+  static Vec div(Vec const &left, Vec const &right)
+  {
+    return left / right;
+  }
+  static Vec sqrt(Vec const &value)
+  {
+    return std::sqrt(value);
+  }
+  static Vec abs(Vec const &value)
+  {
+    return std::fabs(value);
+  }
+  static Mask less(Vec const &left, Vec const &right)
+  {
+    return left < right;
+  }
+  static Mask greater(Vec const &left, Vec const &right)
+  {
+    return left > right;
+  }
+  static Mask lessEqual(Vec const &left, Vec const &right)
+  {
+    return left <= right;
+  }
+  static Mask greaterEqual(Vec const &left, Vec const &right)
+  {
+    return left >= right;
+  }
+  static Mask signBit(Vec const &value)
+  {
+    return std::signbit(value);
+  }
+  static Mask andMask(Mask const &left, Mask const &right)
+  {
+    return left && right;
+  }
+  static Mask orMask(Mask const &left, Mask const &right)
+  {
+    return left || right;
+  }
+  static Mask xorMask(Mask const &left, Mask const &right)
+  {
+    return left != right;
+  }
+  static Mask notMask(Mask const &mask)
+  {
+    return !mask;
+  }
+  static Mask trueMask()
+  {
+    return true;
+  }
+  static Vec select(Mask const &mask, Vec const &left, Vec const &right)
+  {
+    return mask ? left : right;
+  }
+  static bool allTrue(Mask const &mask)
+  {
+    return mask;
+  }
+};
+
+template <typename PhysicsType> MathBatchRange getMathBatchRange()
+{
+  MathBatchRange const range = {PhysicsType::cMinValue, PhysicsType::cMaxValue, PhysicsType::cPrecisionValue};
+  return range;
+}
+
+MathBatchConstants createMathBatchConstants()
+{
+  MathBatchConstants constants;
+  constants.acceleration = getMathBatchRange<Acceleration>();
+  constants.distance = getMathBatchRange<Distance>();
+  constants.duration = getMathBatchRange<Duration>();
+  constants.durationSquared = getMathBatchRange<DurationSquared>();
+  constants.speed = getMathBatchRange<Speed>();
+  constants.speedSquared = getMathBatchRange<SpeedSquared>();
+  return constants;
+}
+
+MathBatchConstants const &getMathBatchConstants()
+{
+  static MathBatchConstants const constants = createMathBatchConstants();
+  return constants;
+}
+
+bool cpuSupports(MathBatchImplementation const implementation)
+{
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  __builtin_cpu_init();
+  switch (implementation)
+  {
+    case MathBatchImplementation::SSE2:
+      return __builtin_cpu_supports("sse2");
+    case MathBatchImplementation::AVX2:
+      return __builtin_cpu_supports("avx2");
+    default:
+      return false;
+  }
+#else
+  (void)implementation;
+  return false;
+#endif
+}
+
+MathBatchKernels const *getMathBatchKernels(MathBatchImplementation const implementation);
+
+MathBatchKernels const *selectMathBatchKernels()
+{
+  for (auto implementation : {MathBatchImplementation::AVX2, MathBatchImplementation::SSE2})
+  {
+    MathBatchKernels const *kernels = getMathBatchKernels(implementation);
+    if (kernels != nullptr)
+    {
+      return kernels;
+    }
+  }
+  return getMathBatchKernels(MathBatchImplementation::Scalar);
+}
+
+MathBatchKernels const *getMathBatchKernels(MathBatchImplementation const implementation)
+{
+  switch (implementation)
+  {
+    case MathBatchImplementation::Auto:
+    {
+      // the selection by the CPU features is performed only once
+      static MathBatchKernels const *bestKernels = selectMathBatchKernels();
+      return bestKernels;
+    }
+    case MathBatchImplementation::Scalar:
+      return &MathBatchKernelsT<SimdScalar>::cKernels;
+    case MathBatchImplementation::SSE2:
+      return cpuSupports(implementation) ? getMathBatchKernelsSse2() : nullptr;
+    case MathBatchImplementation::AVX2:
+      return cpuSupports(implementation) ? getMathBatchKernelsAvx2() : nullptr;
+    default:
+      return nullptr;
+  }
+}
+
+/**
+ * @brief execute a batch calculation
+ *
+ * The part of the arrays fitting the vector width of the kernels is processed by the kernels of the implementation,
+ * the remaining elements by the scalar kernels.
+ *
+ * @param[in] implementation the implementation to be used
+ * @param[in] count the number of elements
+ * @param[in] calculation the calculation called with the kernels, the offset and the number of elements to process
+ */
+template <typename Calculation>
+bool executeBatch(MathBatchImplementation const implementation, std::size_t const count, Calculation calculation)
+{
+  MathBatchKernels const *kernels = getMathBatchKernels(implementation);
+  if (kernels == nullptr)
+  {
+    return false;
+  }
+  std::size_t const vectorCount = count - (count % kernels->width);
+  bool result = calculation(*kernels, 0u, vectorCount);
+  if (vectorCount < count)
+  {
+    result = calculation(*getMathBatchKernels(MathBatchImplementation::Scalar), vectorCount, count - vectorCount)
+      && result;
+  }
+  return result;
+}
+
+/**
+ * @brief ensure that the arrays are provided
+ */
+bool arraysProvided(std::size_t const count, std::initializer_list<double const *> arrays)
+{
+  if (count == 0u)
+  {
+    return true;
+  }
+  for (auto array : arrays)
+  {
+    if (array == nullptr)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+bool isMathBatchImplementationAvailable(MathBatchImplementation const implementation)
+{
+  return getMathBatchKernels(implementation) != nullptr;
+}
+
+bool calculateStoppingDistanceBatch(std::size_t const count,
+                                    double const *currentSpeed,
+                                    double const *deceleration,
+                                    double *stoppingDistance,
+                                    MathBatchImplementation const implementation)
+{
+  if (!arraysProvided(count, {currentSpeed, deceleration, stoppingDistance}))
+  {
+    return false;
+  }
+  return executeBatch(
+    implementation,
+    count,
+    [&](MathBatchKernels const &kernels, std::size_t const offset, std::size_t const batchCount) {
+      return kernels.calculateStoppingDistance(
+        getMathBatchConstants(), batchCount, currentSpeed + offset, deceleration + offset, stoppingDistance + offset);
+    });
+}
+
+bool calculateSpeedAfterResponseTimeBatch(CoordinateSystemAxis const &axis,
+                                          std::size_t const count,
+                                          double const *currentSpeed,
+                                          double const *acceleration,
+                                          double const *responseTime,
+                                          double *resultingSpeed,
+                                          MathBatchImplementation const implementation)
+{
+  if (!arraysProvided(count, {currentSpeed, acceleration, responseTime, resultingSpeed}))
+  {
+    return false;
+  }
+  bool const longitudinal = (axis == CoordinateSystemAxis::Longitudinal);
+  return executeBatch(
+    implementation,
+    count,
+    [&](MathBatchKernels const &kernels, std::size_t const offset, std::size_t const batchCount) {
+      return kernels.calculateSpeedAfterResponseTime(getMathBatchConstants(),
+                                                     longitudinal,
+                                                     batchCount,
+                                                     currentSpeed + offset,
+                                                     acceleration + offset,
+                                                     responseTime + offset,
+                                                     resultingSpeed + offset);
+    });
+}
+
+bool calculateDistanceOffsetAfterResponseTimeBatch(CoordinateSystemAxis const &axis,
+                                                   std::size_t const count,
+                                                   double const *currentSpeed,
+                                                   double const *acceleration,
+                                                   double const *responseTime,
+                                                   double *distanceOffset,
+                                                   MathBatchImplementation const implementation)
+{
+  if (!arraysProvided(count, {currentSpeed, acceleration, responseTime, distanceOffset}))
+  {
+    return false;
+  }
+  bool const longitudinal = (axis == CoordinateSystemAxis::Longitudinal);
+  return executeBatch(
+    implementation,
+    count,
+    [&](MathBatchKernels const &kernels, std::size_t const offset, std::size_t const batchCount) {
+      return kernels.calculateDistanceOffsetAfterResponseTime(getMathBatchConstants(),
+                                                              longitudinal,
+                                                              batchCount,
+                                                              currentSpeed + offset,
+                                                              acceleration + offset,
+                                                              responseTime + offset,
+                                                              distanceOffset + offset);
+    });
+}
+
+bool calculateTimeToCoverDistanceBatch(std::size_t const count,
+                                       double const *currentSpeed,
+                                       double const *responseTime,
+                                       double const *acceleration,
+                                       double const *deceleration,
+                                       double const *distanceToCover,
+                                       double *requiredTime,
+                                       MathBatchImplementation const implementation)
+{
+  if (!arraysProvided(count, {currentSpeed, responseTime, acceleration, deceleration, distanceToCover, requiredTime}))
+  {
+    return false;
+  }
+  return executeBatch(
+    implementation,
+    count,
+    [&](MathBatchKernels const &kernels, std::size_t const offset, std::size_t const batchCount) {
+      return kernels.calculateTimeToCoverDistance(getMathBatchConstants(),
+                                                  batchCount,
+                                                  currentSpeed + offset,
+                                                  responseTime + offset,
+                                                  acceleration + offset,
+                                                  deceleration + offset,
+                                                  distanceToCover + offset,
+                                                  requiredTime + offset);
+    });
+}
+
+bool calculateDistanceOffsetAfterStatedBrakingPatternBatch(CoordinateSystemAxis const &axis,
+                                                           std::size_t const count,
+                                                           double const *currentSpeed,
+                                                           double const *responseTime,
+                                                           double const *acceleration,
+                                                           double const *deceleration,
+                                                           double *distanceOffset,
+                                                           MathBatchImplementation const implementation)
+{
+  if (!arraysProvided(count, {currentSpeed, responseTime, acceleration, deceleration, distanceOffset}))
+  {
+    return false;
+  }
+  bool const longitudinal = (axis == CoordinateSystemAxis::Longitudinal);
+  return executeBatch(
+    implementation,
+    count,
+    [&](MathBatchKernels const &kernels, std::size_t const offset, std::size_t const batchCount) {
+      return kernels.calculateDistanceOffsetAfterStatedBrakingPattern(getMathBatchConstants(),
+                                                                      longitudinal,
+                                                                      batchCount,
+                                                                      currentSpeed + offset,
+                                                                      responseTime + offset,
+                                                                      acceleration + offset,
+                                                                      deceleration + offset,
+                                                                      distanceOffset + offset);
+    });
+}
+
+} // namespace physics
+} // namespace ad_rss
@@ -0,0 +1,213 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "ad_rss/physics/CoordinateSystemAxis.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief the implementation used by the batch calculations
+ */
+enum class MathBatchImplementation : int32_t
+{
+  /*!
+   * the best implementation available on the current CPU
+   */
+  Auto = 0,
+
+  /*!
+   * plain scalar implementation
+   */
+  Scalar = 1,
+
+  /*!
+   * implementation using SSE2 instructions
+   */
+  SSE2 = 2,
+
+  /*!
+   * implementation using AVX2 instructions
+   */
+  AVX2 = 3
+};
+
+/**
+ * @brief Check if a batch implementation is compiled in and supported by the current CPU
+ *
+ * @param[in] implementation the implementation to check
+ *
+ * @return true if the implementation is available
+ */
+bool isMathBatchImplementationAvailable(MathBatchImplementation const implementation);
+
+/**
+ * @brief Batch variant of calculateStoppingDistance()
+ *
+ * The batch variants operate on arrays of count elements, one array per parameter (structure of arrays).
+ * For every element the result is identical to the result of the respective scalar function of Math.hpp. The batch
+ * calculation fails if the scalar function fails (returns false or throws) for at least one element. Nevertheless,
+ * the results of all other elements are provided.
+ *
+ * @param[in]  count                  is the number of elements
+ * @param[in]  currentSpeed           is the current speed of the vehicles
+ * @param[in]  deceleration           is the applied (positive) deceleration
+ * @param[out] stoppingDistance       is the resulting stopping distance
+ * @param[in]  implementation         is the implementation to be used
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateStoppingDistanceBatch(std::size_t const count,
+                                    double const *currentSpeed,
+                                    double const *deceleration,
+                                    double *stoppingDistance,
+                                    MathBatchImplementation const implementation = MathBatchImplementation::Auto);
+
+/**
+ * @brief Batch variant of calculateSpeedAfterResponseTime()
+ *
+ * See calculateStoppingDistanceBatch() for the handling of the batch.
+ *
+ * @param[in]  axis            is the coordinate axis this calculation is for
+ * @param[in]  count           is the number of elements
+ * @param[in]  currentSpeed    is the current speed of the vehicles
+ * @param[in]  acceleration    is the acceleration of the vehicles
+ * @param[in]  responseTime    is the (positive) period of time the vehicles keep accelerating
+ * @param[out] resultingSpeed  is the resulting speed after \a responseTime
+ * @param[in]  implementation  is the implementation to be used
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateSpeedAfterResponseTimeBatch(CoordinateSystemAxis const &axis,
+                                          std::size_t const count,
+                                          double const *currentSpeed,
+                                          double const *acceleration,
+                                          double const *responseTime,
+                                          double *resultingSpeed,
+                                          MathBatchImplementation const implementation
+                                          = MathBatchImplementation::Auto);
+
+/**
+ * @brief Batch variant of calculateDistanceOffsetAfterResponseTime()
+ *
+ * See calculateStoppingDistanceBatch() for the handling of the batch.
+ *
+ * @param[in]  axis            is the coordinate axis this calculation is for
+ * @param[in]  count           is the number of elements
+ * @param[in]  currentSpeed    is the current speed of the vehicles
+ * @param[in]  acceleration    is the acceleration of the vehicles
+ * @param[in]  responseTime    is the (positive) period of time the vehicles keep accelerating
+ * @param[out] distanceOffset  is the distance offset of the vehicles after \a responseTime
+ * @param[in]  implementation  is the implementation to be used
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateDistanceOffsetAfterResponseTimeBatch(CoordinateSystemAxis const &axis,
+                                                   std::size_t const count,
+                                                   double const *currentSpeed,
+                                                   double const *acceleration,
+                                                   double const *responseTime,
+                                                   double *distanceOffset,
+                                                   MathBatchImplementation const implementation
+                                                   = MathBatchImplementation::Auto);
+
+/**
+ * @brief Batch variant of calculateTimeToCoverDistance()
+ *
+ * See calculateStoppingDistanceBatch() for the handling of the batch.
+ *
+ * @param[in]  count           is the number of elements
+ * @param[in]  currentSpeed    is the current speed of the vehicles
+ * @param[in]  responseTime    is the response time of the vehicles
+ * @param[in]  acceleration    is the acceleration of the vehicles during the response time
+ * @param[in]  deceleration    is the deceleration of the vehicles after the response time
+ * @param[in]  distanceToCover is the distance to be covered by the vehicles
+ * @param[out] requiredTime    is the required time to cover the distance
+ * @param[in]  implementation  is the implementation to be used
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateTimeToCoverDistanceBatch(std::size_t const count,
+                                       double const *currentSpeed,
+                                       double const *responseTime,
+                                       double const *acceleration,
+                                       double const *deceleration,
+                                       double const *distanceToCover,
+                                       double *requiredTime,
+                                       MathBatchImplementation const implementation = MathBatchImplementation::Auto);
+
+/**
+ * @brief Batch variant of situation::calculateDistanceOffsetAfterStatedBrakingPattern() for input within the valid
+ * input range
+ *
+ * In contrast to the other batch functions, the input values have to be within the valid input range of the
+ * respective members of situation::VehicleState. As for the scalar calculation on such input (see MathT), only the
+ * calculated values which might leave the valid range of their type are checked. The results are identical to the
+ * scalar function.
+ *
+ * See calculateStoppingDistanceBatch() for the handling of the batch.
+ *
+ * @param[in]  axis            is the coordinate axis this calculation is for
+ * @param[in]  count           is the number of elements
+ * @param[in]  currentSpeed    is the current speed of the vehicles
+ * @param[in]  responseTime    is the response time of the vehicles
+ * @param[in]  acceleration    is the acceleration of the vehicles during the response time
+ * @param[in]  deceleration    is the applied deceleration after the response time
+ * @param[out] distanceOffset  is the distance offset of the vehicles after the stated braking pattern
+ * @param[in]  implementation  is the implementation to be used
+ *
+ * @return true on success, false otherwise
+ */
+bool calculateDistanceOffsetAfterStatedBrakingPatternBatch(CoordinateSystemAxis const &axis,
+                                                           std::size_t const count,
+                                                           double const *currentSpeed,
+                                                           double const *responseTime,
+                                                           double const *acceleration,
+                                                           double const *deceleration,
+                                                           double *distanceOffset,
+                                                           MathBatchImplementation const implementation
+                                                           = MathBatchImplementation::Auto);
+
+} // namespace physics
+} // namespace ad_rss
@@ -0,0 +1,139 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief the valid range and the comparison precision of a physics type used by the batch kernels
+ */
+struct MathBatchRange
+{
+  double minimum;
+  double maximum;
+  double precision;
+};
+
+/**
+ * @brief the ranges of the physics types used by the batch kernels
+ *
+ * The kernels get these passed by the caller, so that the kernel implementations do not depend on the physics types.
+ */
+struct MathBatchConstants
+{
+  MathBatchRange acceleration;
+  MathBatchRange distance;
+  MathBatchRange duration;
+  MathBatchRange durationSquared;
+  MathBatchRange speed;
+  MathBatchRange speedSquared;
+};
+
+/**
+ * @brief table of the batch kernels of one implementation
+ *
+ * Each kernel processes count elements, where count has to be a multiple of width. The kernels return false if the
+ * calculation of at least one element failed.
+ */
+struct MathBatchKernels
+{
+  std::size_t width;
+
+  bool (*calculateStoppingDistance)(MathBatchConstants const &constants,
+                                    std::size_t count,
+                                    double const *currentSpeed,
+                                    double const *deceleration,
+                                    double *stoppingDistance);
+
+  bool (*calculateSpeedAfterResponseTime)(MathBatchConstants const &constants,
+                                          bool longitudinal,
+                                          std::size_t count,
+                                          double const *currentSpeed,
+                                          double const *acceleration,
+                                          double const *responseTime,
+                                          double *resultingSpeed);
+
+  bool (*calculateDistanceOffsetAfterResponseTime)(MathBatchConstants const &constants,
+                                                   bool longitudinal,
+                                                   std::size_t count,
+                                                   double const *currentSpeed,
+                                                   double const *acceleration,
+                                                   double const *responseTime,
+                                                   double *distanceOffset);
+
+  bool (*calculateTimeToCoverDistance)(MathBatchConstants const &constants,
+                                       std::size_t count,
+                                       double const *currentSpeed,
+                                       double const *responseTime,
+                                       double const *acceleration,
+                                       double const *deceleration,
+                                       double const *distanceToCover,
+                                       double *requiredTime);
+
+  bool (*calculateDistanceOffsetAfterStatedBrakingPattern)(MathBatchConstants const &constants,
+                                                           bool longitudinal,
+                                                           std::size_t count,
+                                                           double const *currentSpeed,
+                                                           double const *responseTime,
+                                                           double const *acceleration,
+                                                           double const *deceleration,
+                                                           double *distanceOffset);
+};
+
+/**
+ * @brief the SSE2 batch kernels
+ *
+ * @returns nullptr if not compiled in
+ */
+MathBatchKernels const *getMathBatchKernelsSse2();
+
+/**
+ * @brief the AVX2 batch kernels
+ *
+ * @returns nullptr if not compiled in
+ */
+MathBatchKernels const *getMathBatchKernelsAvx2();
+
+} // namespace physics
+} // namespace ad_rss
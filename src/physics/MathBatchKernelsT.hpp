@@ -0,0 +1,534 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cfloat>
+#include "physics/MathBatchKernels.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief implementation of the batch kernels for a given SIMD instruction set
+ *
+ * The Simd type provides the vector type Vec with cWidth double values, the corresponding Mask type and the
+ * element-wise operations on these.
+ *
+ * The kernels perform the same floating point operations in the same order as the scalar functions of Math.hpp, so
+ * the results are identical. Instead of branching, all branches are calculated and the results are selected per
+ * element. The checks the physics types perform on every operation are collected as a mask of the successfully
+ * calculated elements. A check fails an element only if it is located in the branch taken by the element.
+ *
+ * The Simd type has to be declared within an anonymous namespace of the translation unit instantiating this
+ * template. Otherwise, code compiled for a specific instruction set could be shared with other translation units.
+ */
+template <typename Simd> class MathBatchKernelsT
+{
+public:
+  typedef typename Simd::Vec Vec;
+  typedef typename Simd::Mask Mask;
+
+  static bool calculateStoppingDistance(MathBatchConstants const &constants,
+                                        std::size_t count,
+                                        double const *currentSpeed,
+                                        double const *deceleration,
+                                        double *stoppingDistance)
+  {
+    bool result = true;
+    for (std::size_t i = 0u; i < count; i += Simd::cWidth)
+    {
+      Mask success = Simd::trueMask();
+      Vec const value = stoppingDistanceKernel(
+        constants, Simd::load(currentSpeed + i), Simd::load(deceleration + i), Simd::trueMask(), success);
+      Simd::store(stoppingDistance + i, value);
+      result = Simd::allTrue(success) && result;
+    }
+    return result;
+  }
+
+  static bool calculateSpeedAfterResponseTime(MathBatchConstants const &constants,
+                                              bool longitudinal,
+                                              std::size_t count,
+                                              double const *currentSpeed,
+                                              double const *acceleration,
+                                              double const *responseTime,
+                                              double *resultingSpeed)
+  {
+    bool result = true;
+    for (std::size_t i = 0u; i < count; i += Simd::cWidth)
+    {
+      Mask success = Simd::trueMask();
+      Vec const value = speedAfterResponseTimeKernel(constants,
+                                                     longitudinal,
+                                                     Simd::load(currentSpeed + i),
+                                                     Simd::load(acceleration + i),
+                                                     Simd::load(responseTime + i),
+                                                     Simd::trueMask(),
+                                                     success);
+      Simd::store(resultingSpeed + i, value);
+      result = Simd::allTrue(success) && result;
+    }
+    return result;
+  }
+
+  static bool calculateDistanceOffsetAfterResponseTime(MathBatchConstants const &constants,
+                                                       bool longitudinal,
+                                                       std::size_t count,
+                                                       double const *currentSpeed,
+                                                       double const *acceleration,
+                                                       double const *responseTime,
+                                                       double *distanceOffset)
+  {
+    bool result = true;
+    for (std::size_t i = 0u; i < count; i += Simd::cWidth)
+    {
+      Mask success = Simd::trueMask();
+      Vec const value = distanceOffsetAfterResponseTimeKernel(constants,
+                                                              longitudinal,
+                                                              Simd::load(currentSpeed + i),
+                                                              Simd::load(acceleration + i),
+                                                              Simd::load(responseTime + i),
+                                                              Simd::trueMask(),
+                                                              success);
+      Simd::store(distanceOffset + i, value);
+      result = Simd::allTrue(success) && result;
+    }
+    return result;
+  }
+
+  static bool calculateTimeToCoverDistance(MathBatchConstants const &constants,
+                                           std::size_t count,
+                                           double const *currentSpeed,
+                                           double const *responseTime,
+                                           double const *acceleration,
+                                           double const *deceleration,
+                                           double const *distanceToCover,
+                                           double *requiredTime)
+  {
+    bool result = true;
+    for (std::size_t i = 0u; i < count; i += Simd::cWidth)
+    {
+      Mask success = Simd::trueMask();
+      Vec const value = timeToCoverDistanceKernel(constants,
+                                                  Simd::load(currentSpeed + i),
+                                                  Simd::load(responseTime + i),
+                                                  Simd::load(acceleration + i),
+                                                  Simd::load(deceleration + i),
+                                                  Simd::load(distanceToCover + i),
+                                                  Simd::trueMask(),
+                                                  success);
+      Simd::store(requiredTime + i, value);
+      result = Simd::allTrue(success) && result;
+    }
+    return result;
+  }
+
+  static bool calculateDistanceOffsetAfterStatedBrakingPattern(MathBatchConstants const &constants,
+                                                               bool longitudinal,
+                                                               std::size_t count,
+                                                               double const *currentSpeed,
+                                                               double const *responseTime,
+                                                               double const *acceleration,
+                                                               double const *deceleration,
+                                                               double *distanceOffset)
+  {
+    bool result = true;
+    for (std::size_t i = 0u; i < count; i += Simd::cWidth)
+    {
+      Mask success = Simd::trueMask();
+      Vec const value = statedBrakingPatternKernel(constants,
+                                                   longitudinal,
+                                                   Simd::load(currentSpeed + i),
+                                                   Simd::load(responseTime + i),
+                                                   Simd::load(acceleration + i),
+                                                   Simd::load(deceleration + i),
+                                                   success);
+      Simd::store(distanceOffset + i, value);
+      result = Simd::allTrue(success) && result;
+    }
+    return result;
+  }
+
+  /**
+   * @brief the kernel table of this implementation
+   */
+  static MathBatchKernels const cKernels;
+
+private:
+  /**
+   * @brief isValid() of the physics types: normal or zero and within the range
+   */
+  static Mask isValid(Vec const &value, MathBatchRange const &range)
+  {
+    Vec const absValue = Simd::abs(value);
+    Mask const normalOrZero = Simd::orMask(Simd::greaterEqual(absValue, Simd::set(DBL_MIN)),
+                                           Simd::notMask(Simd::greater(absValue, Simd::set(0.))));
+    Mask const withinRange = Simd::andMask(Simd::greaterEqual(value, Simd::set(range.minimum)),
+                                           Simd::lessEqual(value, Simd::set(range.maximum)));
+    return Simd::andMask(normalOrZero, withinRange);
+  }
+
+  /**
+   * @brief the elements of the active mask fulfilling the condition fail
+   */
+  static void fail(Mask const &condition, Mask const &active, Mask &success)
+  {
+    success = Simd::andMask(success, Simd::notMask(Simd::andMask(active, condition)));
+  }
+
+  /**
+   * @brief ensureValid() of the physics types: the elements of the active mask holding an invalid value fail
+   */
+  static Vec checked(Vec const &value, MathBatchRange const &range, Mask const &active, Mask &success)
+  {
+    fail(Simd::notMask(isValid(value, range)), active, success);
+    return value;
+  }
+
+  /**
+   * @brief ensureValidNonZero() of the physics types
+   */
+  static Vec checkedNonZero(Vec const &value, MathBatchRange const &range, Mask const &active, Mask &success)
+  {
+    fail(isEqual(checked(value, range, active, success), Simd::set(0.), range), active, success);
+    return value;
+  }
+
+  static Mask isEqual(Vec const &left, Vec const &right, MathBatchRange const &range)
+  {
+    return Simd::less(Simd::abs(Simd::sub(left, right)), Simd::set(range.precision));
+  }
+
+  static Mask isLess(Vec const &left, Vec const &right, MathBatchRange const &range)
+  {
+    return Simd::andMask(Simd::less(left, right), Simd::notMask(isEqual(left, right, range)));
+  }
+
+  static Mask isGreater(Vec const &left, Vec const &right, MathBatchRange const &range)
+  {
+    return Simd::andMask(Simd::greater(left, right), Simd::notMask(isEqual(left, right, range)));
+  }
+
+  static Mask isLessEqual(Vec const &left, Vec const &right, MathBatchRange const &range)
+  {
+    return Simd::orMask(Simd::less(left, right), isEqual(left, right, range));
+  }
+
+  static Vec stoppingDistanceKernel(
+    MathBatchConstants const &c, Vec const &currentSpeed, Vec const &deceleration, Mask const &active, Mask &success)
+  {
+    checked(currentSpeed, c.speed, active, success);
+    checked(deceleration, c.acceleration, active, success);
+
+    // deceleration must be positive
+    fail(isLessEqual(deceleration, Simd::set(0.), c.acceleration), active, success);
+
+    // s = v^2 / (2 *a)
+    // keep the signbit of the current Speed
+    Vec const speedSquared
+      = checked(Simd::mul(currentSpeed, Simd::abs(currentSpeed)), c.speedSquared, active, success);
+    Vec const doubleDeceleration
+      = checkedNonZero(Simd::mul(deceleration, Simd::set(2.0)), c.acceleration, active, success);
+    return checked(Simd::div(speedSquared, doubleDeceleration), c.distance, active, success);
+  }
+
+  static Vec speedAfterResponseTimeKernel(MathBatchConstants const &c,
+                                          bool longitudinal,
+                                          Vec const &currentSpeed,
+                                          Vec const &acceleration,
+                                          Vec const &responseTime,
+                                          Mask const &active,
+                                          Mask &success)
+  {
+    checked(currentSpeed, c.speed, active, success);
+    checked(acceleration, c.acceleration, active, success);
+    checked(responseTime, c.duration, active, success);
+
+    // time must not be negative
+    fail(isLess(responseTime, Simd::set(0.), c.duration), active, success);
+
+    if (longitudinal)
+    {
+      // in longitudinal direction the speed has to be always >= 0.
+      fail(isLess(currentSpeed, Simd::set(0.), c.speed), active, success);
+    }
+
+    // v(t) =v0 + a * t
+    Vec const speedOffset = checked(Simd::mul(acceleration, responseTime), c.speed, active, success);
+    Vec resultingSpeed = checked(Simd::add(currentSpeed, speedOffset), c.speed, active, success);
+
+    if (longitudinal)
+    {
+      // Only deceleration till stop is allowed
+      resultingSpeed
+        = Simd::select(isLess(Simd::set(0.), resultingSpeed, c.speed), resultingSpeed, Simd::set(0.));
+    }
+    return resultingSpeed;
+  }
+
+  static Vec distanceOffsetAfterResponseTimeKernel(MathBatchConstants const &c,
+                                                   bool longitudinal,
+                                                   Vec const &currentSpeed,
+                                                   Vec const &acceleration,
+                                                   Vec const &responseTime,
+                                                   Mask const &active,
+                                                   Mask &success)
+  {
+    checked(currentSpeed, c.speed, active, success);
+    checked(acceleration, c.acceleration, active, success);
+    checked(responseTime, c.duration, active, success);
+
+    // time must not be negative
+    fail(isLess(responseTime, Simd::set(0.), c.duration), active, success);
+
+    Vec resultingResponseTime = responseTime;
+    if (longitudinal)
+    {
+      // in longitudinal direction the speed has to be always >= 0.
+      fail(isLess(currentSpeed, Simd::set(0.), c.speed), active, success);
+
+      // on deceleration restrict the time to the time required to stop
+      Mask const decelerating = isLess(acceleration, Simd::set(0.), c.acceleration);
+      Mask const deceleratingActive = Simd::andMask(active, decelerating);
+      Vec const negativeSpeed = checked(Simd::mul(currentSpeed, Simd::set(-1.)), c.speed, deceleratingActive, success);
+      Vec const timeToStop
+        = checked(Simd::div(negativeSpeed, checkedNonZero(acceleration, c.acceleration, deceleratingActive, success)),
+                  c.duration,
+                  deceleratingActive,
+                  success);
+      Vec const restrictedResponseTime
+        = Simd::select(isLess(responseTime, timeToStop, c.duration), responseTime, timeToStop);
+      resultingResponseTime = Simd::select(decelerating, restrictedResponseTime, responseTime);
+    }
+
+    return distanceOffsetInAcceleratedMovementKernel(
+      c, currentSpeed, acceleration, resultingResponseTime, active, success);
+  }
+
+  static Vec distanceOffsetInAcceleratedMovementKernel(MathBatchConstants const &c,
+                                                       Vec const &speed,
+                                                       Vec const &acceleration,
+                                                       Vec const &duration,
+                                                       Mask const &active,
+                                                       Mask &success)
+  {
+    // s(t) =(a/2) * t^2 + v0 * t
+    Vec const halfAcceleration = checked(Simd::mul(acceleration, Simd::set(0.5)), c.acceleration, active, success);
+    Vec const accelerationPartSpeed = checked(Simd::mul(halfAcceleration, duration), c.speed, active, success);
+    Vec const accelerationPart = checked(Simd::mul(accelerationPartSpeed, duration), c.distance, active, success);
+    Vec const speedPart = checked(Simd::mul(speed, duration), c.distance, active, success);
+    return checked(Simd::add(accelerationPart, speedPart), c.distance, active, success);
+  }
+
+  static Vec timeForDistanceKernel(MathBatchConstants const &c,
+                                   Vec const &currentSpeed,
+                                   Vec const &acceleration,
+                                   Vec const &distanceToCover,
+                                   Mask const &active,
+                                   Mask &success)
+  {
+    checked(currentSpeed, c.speed, active, success);
+    checked(acceleration, c.acceleration, active, success);
+
+    fail(isLess(currentSpeed, Simd::set(0.), c.speed), active, success);
+
+    // non-accelerated constant movement:
+    // t = s/v
+    Mask const notAccelerated = isEqual(acceleration, Simd::set(0.), c.acceleration);
+    Mask const standingStill = isEqual(currentSpeed, Simd::set(0.), c.speed);
+    Mask const movingActive = Simd::andMask(Simd::andMask(active, notAccelerated), Simd::notMask(standingStill));
+    checked(distanceToCover, c.distance, movingActive, success);
+    Vec const constantMovementTime = Simd::select(
+      standingStill,
+      Simd::set(c.duration.maximum),
+      checked(Simd::div(distanceToCover, currentSpeed), c.duration, movingActive, success));
+
+    // constant accelerated movement:
+    // t = -v_0/a +- sqrt(v_0^2/a^2 + 2s/a)
+    Mask const acceleratedActive = Simd::andMask(active, Simd::notMask(notAccelerated));
+    Vec const negativeSpeed = checked(Simd::mul(currentSpeed, Simd::set(-1.)), c.speed, acceleratedActive, success);
+    Vec const firstPart = checked(Simd::div(negativeSpeed, acceleration), c.duration, acceleratedActive, success);
+    Vec const firstPartSquared
+      = checked(Simd::mul(firstPart, firstPart), c.durationSquared, acceleratedActive, success);
+    checked(distanceToCover, c.distance, acceleratedActive, success);
+    Vec const doubleDistanceToCover
+      = checked(Simd::mul(distanceToCover, Simd::set(2.)), c.distance, acceleratedActive, success);
+    Vec const distancePart
+      = checked(Simd::div(doubleDistanceToCover, acceleration), c.durationSquared, acceleratedActive, success);
+    Vec const secondPartSquared
+      = checked(Simd::add(firstPartSquared, distancePart), c.durationSquared, acceleratedActive, success);
+    Vec const secondPart = checked(Simd::sqrt(secondPartSquared), c.duration, acceleratedActive, success);
+    Vec const t1 = checked(Simd::add(firstPart, secondPart), c.duration, acceleratedActive, success);
+    Vec const t2 = checked(Simd::sub(firstPart, secondPart), c.duration, acceleratedActive, success);
+    Vec const acceleratedMovementTime = Simd::select(isGreater(t2, Simd::set(0.), c.duration), t2, t1);
+
+    return Simd::select(notAccelerated, constantMovementTime, acceleratedMovementTime);
+  }
+
+  static Vec timeToCoverDistanceKernel(MathBatchConstants const &c,
+                                       Vec const &currentSpeed,
+                                       Vec const &responseTime,
+                                       Vec const &acceleration,
+                                       Vec const &deceleration,
+                                       Vec const &distanceToCover,
+                                       Mask const &active,
+                                       Mask &success)
+  {
+    checked(currentSpeed, c.speed, active, success);
+    checked(deceleration, c.acceleration, active, success);
+    checked(distanceToCover, c.distance, active, success);
+
+    fail(isLess(currentSpeed, Simd::set(0.), c.speed), active, success);
+    fail(isLess(deceleration, Simd::set(0.), c.acceleration), active, success);
+    fail(isLess(distanceToCover, Simd::set(0.), c.distance), active, success);
+
+    Vec const distanceAfterResponseTime
+      = distanceOffsetAfterResponseTimeKernel(c, true, currentSpeed, acceleration, responseTime, active, success);
+
+    // the distance is covered within the response time
+    Mask const coveredWithinResponseTime = isGreater(distanceAfterResponseTime, distanceToCover, c.distance);
+    Vec const timeWithinResponseTime = timeForDistanceKernel(c,
+                                                             currentSpeed,
+                                                             acceleration,
+                                                             distanceToCover,
+                                                             Simd::andMask(active, coveredWithinResponseTime),
+                                                             success);
+
+    // the distance is covered while braking
+    Mask const brakingActive = Simd::andMask(active, Simd::notMask(coveredWithinResponseTime));
+    Vec const resultingSpeed
+      = speedAfterResponseTimeKernel(c, true, currentSpeed, acceleration, responseTime, brakingActive, success);
+    Vec const stoppingDistance = stoppingDistanceKernel(c, resultingSpeed, deceleration, brakingActive, success);
+    Vec const distanceToStop
+      = checked(Simd::add(distanceAfterResponseTime, stoppingDistance), c.distance, brakingActive, success);
+    Mask const coveredWhileBraking = isGreater(distanceToStop, distanceToCover, c.distance);
+    Mask const coveredWhileBrakingActive = Simd::andMask(brakingActive, coveredWhileBraking);
+    Vec const remainingDistance = checked(
+      Simd::sub(distanceToCover, distanceAfterResponseTime), c.distance, coveredWhileBrakingActive, success);
+    Vec const brakingTime = timeForDistanceKernel(
+      c, resultingSpeed, deceleration, remainingDistance, coveredWhileBrakingActive, success);
+    Vec const timeWhileBraking
+      = checked(Simd::add(brakingTime, responseTime), c.duration, coveredWhileBrakingActive, success);
+
+    return Simd::select(coveredWithinResponseTime,
+                        timeWithinResponseTime,
+                        Simd::select(coveredWhileBraking, timeWhileBraking, Simd::set(c.duration.maximum)));
+  }
+
+  /**
+   * @brief the stated braking pattern of situation::calculateDistanceOffsetAfterStatedBrakingPattern()
+   *
+   * In contrast to the other kernels, the input is expected to be within the valid input range of the vehicle state.
+   * Therefore, only the values checked by MathT<UncheckedPhysicsTypes> are checked.
+   */
+  static Vec statedBrakingPatternKernel(MathBatchConstants const &c,
+                                        bool longitudinal,
+                                        Vec const &currentSpeed,
+                                        Vec const &responseTime,
+                                        Vec const &acceleration,
+                                        Vec const &deceleration,
+                                        Mask &success)
+  {
+    Mask const active = Simd::trueMask();
+
+    // time must not be negative
+    fail(isLess(responseTime, Simd::set(0.), c.duration), active, success);
+
+    // v(t) =v0 + a * t
+    Vec resultingSpeed
+      = checked(Simd::add(currentSpeed, Simd::mul(acceleration, responseTime)), c.speed, active, success);
+    Vec resultingResponseTime = responseTime;
+    if (longitudinal)
+    {
+      // in longitudinal direction the speed has to be always >= 0.
+      fail(isLess(currentSpeed, Simd::set(0.), c.speed), active, success);
+
+      // Only deceleration till stop is allowed
+      resultingSpeed
+        = Simd::select(isLess(Simd::set(0.), resultingSpeed, c.speed), resultingSpeed, Simd::set(0.));
+
+      // on deceleration restrict the time to the time required to stop
+      Mask const decelerating = isLess(acceleration, Simd::set(0.), c.acceleration);
+      Vec const timeToStop = checked(
+        Simd::div(Simd::mul(currentSpeed, Simd::set(-1.)), acceleration), c.duration, decelerating, success);
+      Vec const restrictedResponseTime
+        = Simd::select(isLess(responseTime, timeToStop, c.duration), responseTime, timeToStop);
+      resultingResponseTime = Simd::select(decelerating, restrictedResponseTime, responseTime);
+    }
+
+    // s(t) =(a/2) * t^2 + v0 * t
+    Vec const distanceOffsetAfterResponseTime = checked(
+      Simd::add(Simd::mul(Simd::mul(Simd::mul(acceleration, Simd::set(0.5)), resultingResponseTime),
+                          resultingResponseTime),
+                Simd::mul(currentSpeed, resultingResponseTime)),
+      c.distance,
+      active,
+      success);
+
+    // if the speed after the response time has the same direction as the acceleration,
+    // further braking to full stop in that moving direction has to be added
+    Mask const brakingToStop
+      = Simd::notMask(Simd::xorMask(Simd::signBit(resultingSpeed), Simd::signBit(acceleration)));
+    Vec const absDeceleration = Simd::abs(deceleration);
+    fail(isLessEqual(absDeceleration, Simd::set(0.), c.acceleration), brakingToStop, success);
+    Vec const distanceToStop = checked(Simd::div(Simd::mul(resultingSpeed, Simd::abs(resultingSpeed)),
+                                                 Simd::mul(absDeceleration, Simd::set(2.0))),
+                                       c.distance,
+                                       brakingToStop,
+                                       success);
+
+    Vec const distanceOffset
+      = Simd::add(distanceOffsetAfterResponseTime, Simd::select(brakingToStop, distanceToStop, Simd::set(0.)));
+    return checked(distanceOffset, c.distance, active, success);
+  }
+};
+
+template <typename Simd>
+MathBatchKernels const MathBatchKernelsT<Simd>::cKernels
+  = {Simd::cWidth,
+     MathBatchKernelsT<Simd>::calculateStoppingDistance,
+     MathBatchKernelsT<Simd>::calculateSpeedAfterResponseTime,
+     MathBatchKernelsT<Simd>::calculateDistanceOffsetAfterResponseTime,
+     MathBatchKernelsT<Simd>::calculateTimeToCoverDistance,
+     MathBatchKernelsT<Simd>::calculateDistanceOffsetAfterStatedBrakingPattern};
+
+} // namespace physics
+} // namespace ad_rss
@@ -0,0 +1,159 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "physics/MathBatchKernelsT.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ad_rss {
+namespace physics {
+
+#if defined(__SSE2__)
+
+namespace {
+
+/**
+ * @brief SSE2 instruction set of the batch kernels
+ */
+struct SimdSse2
+{
+  typedef __m128d Vec;
+  typedef __m128d Mask;
+  static const std::size_t cWidth = 2u;
+
+  static Vec load(double const *values)
+  {
+    return _mm_loadu_pd(values);
+  }
+  static void store(double *values, Vec const &value)
+  {
+    _mm_storeu_pd(values, value);
+  }
+  static Vec set(double const value)
+  {
+    return _mm_set1_pd(value);
+  }
+  static Vec add(Vec const &left, Vec const &right)
+  {
+    return _mm_add_pd(left, right);
+  }
+  static Vec sub(Vec const &left, Vec const &right)
+  {
+    return _mm_sub_pd(left, right);
+  }
+  static Vec mul(Vec const &left, Vec const &right)
+  {
+    return _mm_mul_pd(left, right);
+  }
+  static Vec div(Vec const &left, Vec const &right)
+  {
+    return _mm_div_pd(left, right);
+  }
+  static Vec sqrt(Vec const &value)
+  {
+    return _mm_sqrt_pd(value);
+  }
+  static Vec abs(Vec const &value)
+  {
+    return _mm_andnot_pd(_mm_set1_pd(-0.), value);
+  }
+  static Mask less(Vec const &left, Vec const &right)
+  {
+    return _mm_cmplt_pd(left, right);
+  }
+  static Mask greater(Vec const &left, Vec const &right)
+  {
+    return _mm_cmpgt_pd(left, right);
+  }
+  static Mask lessEqual(Vec const &left, Vec const &right)
+  {
+    return _mm_cmple_pd(left, right);
+  }
+  static Mask greaterEqual(Vec const &left, Vec const &right)
+  {
+    return _mm_cmpge_pd(left, right);
+  }
+  static Mask signBit(Vec const &value)
+  {
+    // broadcast the sign bit of the upper 32 bits to the whole element
+    return _mm_castsi128_pd(
+      _mm_shuffle_epi32(_mm_srai_epi32(_mm_castpd_si128(value), 31), _MM_SHUFFLE(3, 3, 1, 1)));
+  }
+  static Mask andMask(Mask const &left, Mask const &right)
+  {
+    return _mm_and_pd(left, right);
+  }
+  static Mask orMask(Mask const &left, Mask const &right)
+  {
+    return _mm_or_pd(left, right);
+  }
+  static Mask xorMask(Mask const &left, Mask const &right)
+  {
+    return _mm_xor_pd(left, right);
+  }
+  static Mask notMask(Mask const &mask)
+  {
+    return _mm_xor_pd(mask, trueMask());
+  }
+  static Mask trueMask()
+  {
+    return _mm_castsi128_pd(_mm_set1_epi32(-1));
+  }
+  static Vec select(Mask const &mask, Vec const &left, Vec const &right)
+  {
+    return _mm_or_pd(_mm_and_pd(mask, left), _mm_andnot_pd(mask, right));
+  }
+  static bool allTrue(Mask const &mask)
+  {
+    return _mm_movemask_pd(mask) == 0x3;
+  }
+};
+
+} // namespace
+
+MathBatchKernels const *getMathBatchKernelsSse2()
+{
+  return &MathBatchKernelsT<SimdSse2>::cKernels;
+}
+
+#else
+
+MathBatchKernels const *getMathBatchKernelsSse2()
+{
+  return nullptr;
+}
+
+#endif
+
+} // namespace physics
+} // namespace ad_rss
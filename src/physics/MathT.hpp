@@ -0,0 +1,352 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include "ad_rss/physics/CoordinateSystemAxis.hpp"
+#include "physics/Unchecked.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief implementation of the physics calculations for a given set of physics types
+ *
+ * Instantiated with CheckedPhysicsTypes by the functions of Math.hpp. The instantiation with
+ * UncheckedPhysicsTypes performs the identical calculations with plain double arithmetic for input values
+ * already checked to be within valid input range (i.e. of the situation::VehicleState). Instead of checking every
+ * single operation, only the calculated values which might leave the valid range of their type for such input
+ * values are checked by PhysicsTypes::ensureValid(). Therefore, both instantiations provide the same results and
+ * fail in the same cases. See Math.hpp for the documentation of the functions.
+ *
+ * Without exception support (AD_RSS_NO_EXCEPTIONS) a range error does not leave the calculation. Therefore, the
+ * functions returning a bool return false as soon as a range error has been raised. The functions returning the
+ * calculated value only raise the range error, their callers have to check rangeErrorRaised() before using the value.
+ */
+template <typename PhysicsTypes> class MathT
+{
+public:
+  typedef typename PhysicsTypes::Acceleration Acceleration;
+  typedef typename PhysicsTypes::Distance Distance;
+  typedef typename PhysicsTypes::Duration Duration;
+  typedef typename PhysicsTypes::Speed Speed;
+
+  static Distance calculateDistanceOffsetInAccerlatedMovement(Speed const &speed,
+                                                              Acceleration const &acceleration,
+                                                              Duration const &duration)
+  {
+    // s(t) =(a/2) * t^2 + v0 * t
+    Distance const distanceOffset = (acceleration * 0.5 * duration * duration) + (speed * duration);
+    PhysicsTypes::ensureValid(distanceOffset);
+    return distanceOffset;
+  }
+
+  static Speed calculateSpeedInAcceleratedMovement(Speed const &speed,
+                                                   Acceleration const &acceleration,
+                                                   Duration const &duration)
+  {
+    // v(t) =v0 + a * t
+    Speed const resultingSpeed = speed + acceleration * duration;
+    PhysicsTypes::ensureValid(resultingSpeed);
+    return resultingSpeed;
+  }
+
+  static bool
+  calculateStoppingDistance(Speed const &currentSpeed, Acceleration const &deceleration, Distance &stoppingDistance)
+  {
+    using std::fabs;
+
+    if (deceleration <= Acceleration(0.))
+    {
+      // deceleration must be positive
+      return false;
+    }
+
+    // s = v^2 / (2 *a)
+    // keep the signbit of the current Speed
+    stoppingDistance = (currentSpeed * fabs(currentSpeed)) / (2.0 * deceleration);
+    return PhysicsTypes::ensureValid(stoppingDistance);
+  }
+
+  static bool calculateSpeedAfterResponseTime(CoordinateSystemAxis const &axis,
+                                              Speed const &currentSpeed,
+                                              Acceleration const &acceleration,
+                                              Duration const &responseTime,
+                                              Speed &resultingSpeed)
+  {
+    if (responseTime < Duration(0.))
+    {
+      // time must not be negative
+      return false;
+    }
+
+    if (axis == CoordinateSystemAxis::Longitudinal)
+    {
+      // in longitudinal direction the speed has to be always >= 0.
+      if (currentSpeed < Speed(0.))
+      {
+        return false;
+      }
+    }
+
+    resultingSpeed = calculateSpeedInAcceleratedMovement(currentSpeed, acceleration, responseTime);
+    if (rangeErrorRaised())
+    {
+      return false;
+    }
+
+    if (axis == CoordinateSystemAxis::Longitudinal)
+    {
+      // Only deceleration till stop is allowed
+      resultingSpeed = std::max(Speed(0.), resultingSpeed);
+    }
+
+    return true;
+  }
+
+  static bool calculateDistanceOffsetAfterResponseTime(CoordinateSystemAxis const &axis,
+                                                       Speed const &currentSpeed,
+                                                       Acceleration const &acceleration,
+                                                       Duration const &responseTime,
+                                                       Distance &distanceOffset)
+  {
+    if (responseTime < Duration(0.))
+    {
+      // time must not be negative
+      return false;
+    }
+
+    Duration resultingResponseTime = responseTime;
+    if (axis == CoordinateSystemAxis::Longitudinal)
+    {
+      if (currentSpeed < Speed(0.))
+      {
+        // in longitudinal direction the speed has to be always >= 0.
+        return false;
+      }
+
+      if (acceleration < Acceleration(0.))
+      {
+        // on deceleration restrict the time to the time required to stop
+        resultingResponseTime = -1. * currentSpeed / acceleration;
+        if (!PhysicsTypes::ensureValid(resultingResponseTime))
+        {
+          return false;
+        }
+        resultingResponseTime = std::min(resultingResponseTime, responseTime);
+      }
+    }
+
+    distanceOffset = calculateDistanceOffsetInAccerlatedMovement(currentSpeed, acceleration, resultingResponseTime);
+
+    return !rangeErrorRaised();
+  }
+
+  static bool calculateTimeForDistance(Speed const &currentSpeed,
+                                       Acceleration const &acceleration,
+                                       Distance const &distanceToCover,
+                                       Duration &requiredTime)
+  {
+    using std::sqrt;
+
+    if (currentSpeed < Speed(0.))
+    {
+      return false;
+    }
+
+    bool result = true;
+
+    if (acceleration == Acceleration(0.))
+    {
+      // non-accelerated constant movement:
+      // t = s/v
+      if (currentSpeed == Speed(0.))
+      {
+        requiredTime = Duration::getMax();
+      }
+      else
+      {
+        requiredTime = distanceToCover / currentSpeed;
+        result = PhysicsTypes::ensureValid(requiredTime);
+      }
+    }
+    else
+    {
+      // constant accelerated movement:
+      // t = -v_0/a +- sqrt(v_0^2/a^2 + 2s/a)
+      Duration const firstPart = -1. * currentSpeed / acceleration;
+      auto const doubleDistanceToCover = 2. * distanceToCover;
+      if (!PhysicsTypes::ensureValid(firstPart) || !PhysicsTypes::ensureValid(doubleDistanceToCover))
+      {
+        return false;
+      }
+      auto const secondPartSquared = (firstPart * firstPart) + (doubleDistanceToCover / acceleration);
+      if (!PhysicsTypes::ensureValid(secondPartSquared))
+      {
+        return false;
+      }
+      Duration const secondPart = sqrt(secondPartSquared);
+      if (!PhysicsTypes::ensureValid(secondPart))
+      {
+        return false;
+      }
+
+      Duration t1 = firstPart + secondPart;
+      Duration t2 = firstPart - secondPart;
+      if (!PhysicsTypes::ensureValid(t1) || !PhysicsTypes::ensureValid(t2))
+      {
+        return false;
+      }
+
+      if (t2 > Duration(0.))
+      {
+        requiredTime = t2;
+      }
+      else
+      {
+        requiredTime = t1;
+      }
+    }
+    return result;
+  }
+
+  static bool calculateTimeToCoverDistance(Speed const &currentSpeed,
+                                           Duration const &responseTime,
+                                           Acceleration const &acceleration,
+                                           Acceleration const &deceleration,
+                                           Distance const &distanceToCover,
+                                           Duration &requiredTime)
+  {
+    if ((currentSpeed < Speed(0.)) || (deceleration < Acceleration(0.)) || (distanceToCover < Distance(0.)))
+    {
+      return false;
+    }
+
+    bool result = false;
+
+    Distance distanceAfterResponseTime;
+
+    result = calculateDistanceOffsetAfterResponseTime( // LCOV_EXCL_LINE: wrong detection
+      CoordinateSystemAxis::Longitudinal,
+      currentSpeed,
+      acceleration,
+      responseTime,
+      distanceAfterResponseTime);
+
+    if (result)
+    {
+      if (distanceAfterResponseTime > distanceToCover)
+      {
+        result = calculateTimeForDistance(currentSpeed, acceleration, distanceToCover, requiredTime);
+      }
+      else
+      {
+        Speed resultingSpeed;
+
+        result = calculateSpeedAfterResponseTime( // LCOV_EXCL_LINE: wrong detection
+          CoordinateSystemAxis::Longitudinal,
+          currentSpeed,
+          acceleration,
+          responseTime,
+          resultingSpeed);
+
+        Distance stoppingDistance;
+        result = result && calculateStoppingDistance(resultingSpeed, deceleration, stoppingDistance);
+
+        if (result)
+        {
+          Distance const distanceToStop = distanceAfterResponseTime + stoppingDistance;
+          result = PhysicsTypes::ensureValid(distanceToStop)
+            && calculateTimeToCoverDistanceAfterResponseTime(resultingSpeed,
+                                                             responseTime,
+                                                             deceleration,
+                                                             distanceAfterResponseTime,
+                                                             distanceToStop,
+                                                             distanceToCover,
+                                                             requiredTime);
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief the part of calculateTimeToCoverDistance() when the distance is not covered within the response time
+   *
+   * @param[in] resultingSpeed the speed after the response time
+   * @param[in] responseTime the response time
+   * @param[in] deceleration the (positive) deceleration applied after the response time
+   * @param[in] distanceAfterResponseTime the distance covered within the response time
+   * @param[in] distanceToStop the distance covered until the vehicle stops
+   * @param[in] distanceToCover the distance that should be covered
+   * @param[out] requiredTime time needed to cover the distance
+   *
+   * @return true on success, false otherwise
+   */
+  static bool calculateTimeToCoverDistanceAfterResponseTime(Speed const &resultingSpeed,
+                                                            Duration const &responseTime,
+                                                            Acceleration const &deceleration,
+                                                            Distance const &distanceAfterResponseTime,
+                                                            Distance const &distanceToStop,
+                                                            Distance const &distanceToCover,
+                                                            Duration &requiredTime)
+  {
+    bool result = true;
+    if (distanceToStop > distanceToCover)
+    {
+      Distance remainingDistance = distanceToCover - distanceAfterResponseTime;
+
+      result = calculateTimeForDistance(resultingSpeed, deceleration, remainingDistance, requiredTime);
+      requiredTime += responseTime;
+      result = PhysicsTypes::ensureValid(requiredTime) && result;
+    }
+    else
+    {
+      requiredTime = Duration::getMax();
+    }
+    return result;
+  }
+};
+
+} // namespace physics
+} // namespace ad_rss
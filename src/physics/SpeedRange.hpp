@@ -0,0 +1,113 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <limits>
+#include "ad_rss/physics/Speed.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief A speed range described by its borders: [minimum, maximum]
+ *
+ * Used by the interval evaluation of the physics calculations (see Math.hpp) to describe an uncertain speed, e.g.
+ * as provided by the perception.
+ */
+struct SpeedRange
+{
+  bool operator==(SpeedRange const &other) const
+  {
+    return (minimum == other.minimum) && (maximum == other.maximum);
+  }
+
+  bool operator!=(SpeedRange const &other) const
+  {
+    return !operator==(other);
+  }
+
+  /**
+   * @brief The minimum value of the speed range
+   */
+  Speed minimum{std::numeric_limits<Speed>::lowest()};
+
+  /**
+   * @brief The maximum value of the speed range
+   */
+  Speed maximum{std::numeric_limits<Speed>::max()};
+};
+
+/**
+ * @brief Calculate the range of a calculation which is non-decreasing in the speed for a given speed range
+ *
+ * As the calculation is non-decreasing, the borders of the resulting range are the results of the calculation for
+ * the borders of the speed range. Therefore, two evaluations are sufficient to bound the result for every speed
+ * within the range.
+ *
+ * @param[in]  speedRange   the speed range, minimum <= maximum
+ * @param[in]  calculation  the calculation with the signature bool(Speed const &, ResultType &)
+ * @param[out] resultRange  the range of the result, providing the members minimum and maximum
+ *
+ * @return true on success, false otherwise
+ */
+template <typename NonDecreasingCalculation, typename ResultRange>
+bool calculateNonDecreasingRange(SpeedRange const &speedRange,
+                                 NonDecreasingCalculation const &calculation,
+                                 ResultRange &resultRange)
+{
+  if (speedRange.maximum < speedRange.minimum)
+  {
+    return false;
+  }
+
+  ResultRange result;
+  bool const calculationResult
+    = calculation(speedRange.minimum, result.minimum) && calculation(speedRange.maximum, result.maximum);
+  if (calculationResult)
+  {
+    resultRange = result;
+  }
+  return calculationResult;
+}
+
+} // namespace physics
+} // namespace ad_rss
@@ -0,0 +1,315 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include "ad_rss/physics/Operations.hpp"
+#include "ad_rss/physics/RangeError.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/**
+ * @brief unchecked variant of the physics type PhysicsType
+ *
+ * The generated physics types ensure on every operation that the operands and the result are valid
+ * (see e.g. Distance::ensureValid()). Unchecked provides the same operations and comparison semantics, i.e.
+ * the comparison operators consider the precision PhysicsType::cPrecisionValue, but without any validity checks.
+ * It is intended for calculations on values already checked to be within valid input range; the result has
+ * to be converted back by toChecked(), which ensures the validity of the result once.
+ */
+template <typename PhysicsType> class Unchecked
+{
+public:
+  /**
+   * @brief default constructor, the default value is NaN as for the generated physics types
+   */
+  Unchecked()
+    : mValue(std::numeric_limits<double>::quiet_NaN())
+  {
+  }
+
+  /**
+   * @brief standard constructor
+   */
+  explicit Unchecked(double const value)
+    : mValue(value)
+  {
+  }
+
+  /**
+   * @brief constructor from the checked physics type
+   */
+  explicit Unchecked(PhysicsType const &value)
+    : mValue(static_cast<double>(value))
+  {
+  }
+
+  bool operator==(Unchecked const &other) const
+  {
+    return std::fabs(mValue - other.mValue) < PhysicsType::cPrecisionValue;
+  }
+
+  bool operator!=(Unchecked const &other) const
+  {
+    return !operator==(other);
+  }
+
+  bool operator>(Unchecked const &other) const
+  {
+    return (mValue > other.mValue) && operator!=(other);
+  }
+
+  bool operator<(Unchecked const &other) const
+  {
+    return (mValue < other.mValue) && operator!=(other);
+  }
+
+  bool operator>=(Unchecked const &other) const
+  {
+    return (mValue > other.mValue) || operator==(other);
+  }
+
+  bool operator<=(Unchecked const &other) const
+  {
+    return (mValue < other.mValue) || operator==(other);
+  }
+
+  Unchecked operator+(Unchecked const &other) const
+  {
+    return Unchecked(mValue + other.mValue);
+  }
+
+  Unchecked &operator+=(Unchecked const &other)
+  {
+    mValue += other.mValue;
+    return *this;
+  }
+
+  Unchecked operator-(Unchecked const &other) const
+  {
+    return Unchecked(mValue - other.mValue);
+  }
+
+  Unchecked &operator-=(Unchecked const &other)
+  {
+    mValue -= other.mValue;
+    return *this;
+  }
+
+  Unchecked operator*(double const &scalar) const
+  {
+    return Unchecked(mValue * scalar);
+  }
+
+  Unchecked operator/(double const &scalar) const
+  {
+    return Unchecked(mValue / scalar);
+  }
+
+  double operator/(Unchecked const &other) const
+  {
+    return mValue / other.mValue;
+  }
+
+  Unchecked operator-() const
+  {
+    return Unchecked(-mValue);
+  }
+
+  explicit operator double() const
+  {
+    return mValue;
+  }
+
+  /**
+   * @returns the value as checked physics type
+   *
+   * Throws an std::out_of_range() exception if the value is not valid
+   */
+  PhysicsType toChecked() const
+  {
+    PhysicsType const result(mValue);
+    result.ensureValid();
+    return result;
+  }
+
+  static Unchecked getMax()
+  {
+    return Unchecked(PhysicsType::cMaxValue);
+  }
+
+private:
+  double mValue;
+};
+
+template <typename PhysicsType>
+inline Unchecked<PhysicsType> operator*(double const &scalar, Unchecked<PhysicsType> const &value)
+{
+  return value.operator*(scalar);
+}
+
+template <typename PhysicsType> inline Unchecked<PhysicsType> fabs(Unchecked<PhysicsType> const &value)
+{
+  return Unchecked<PhysicsType>(std::fabs(static_cast<double>(value)));
+}
+
+typedef Unchecked<Acceleration> UncheckedAcceleration;
+typedef Unchecked<Distance> UncheckedDistance;
+typedef Unchecked<DistanceSquared> UncheckedDistanceSquared;
+typedef Unchecked<Duration> UncheckedDuration;
+typedef Unchecked<DurationSquared> UncheckedDurationSquared;
+typedef Unchecked<Speed> UncheckedSpeed;
+typedef Unchecked<SpeedSquared> UncheckedSpeedSquared;
+
+/*!
+ * @brief Arithmetic physics operations of the unchecked types, see Operations.hpp
+ */
+inline UncheckedSpeed operator*(UncheckedAcceleration const &a, UncheckedDuration const &t)
+{
+  return UncheckedSpeed(static_cast<double>(a) * static_cast<double>(t));
+}
+
+inline UncheckedSpeed operator*(UncheckedDuration const &t, UncheckedAcceleration const &a)
+{
+  return operator*(a, t);
+}
+
+inline UncheckedDistance operator*(UncheckedSpeed const &v, UncheckedDuration const &t)
+{
+  return UncheckedDistance(static_cast<double>(v) * static_cast<double>(t));
+}
+
+inline UncheckedDistance operator*(UncheckedDuration const &t, UncheckedSpeed const &v)
+{
+  return operator*(v, t);
+}
+
+inline UncheckedDistanceSquared operator*(UncheckedDistance const &s1, UncheckedDistance const &s2)
+{
+  return UncheckedDistanceSquared(static_cast<double>(s1) * static_cast<double>(s2));
+}
+
+inline UncheckedDurationSquared operator*(UncheckedDuration const &t1, UncheckedDuration const &t2)
+{
+  return UncheckedDurationSquared(static_cast<double>(t1) * static_cast<double>(t2));
+}
+
+inline UncheckedSpeedSquared operator*(UncheckedSpeed const &v1, UncheckedSpeed const &v2)
+{
+  return UncheckedSpeedSquared(static_cast<double>(v1) * static_cast<double>(v2));
+}
+
+inline UncheckedDuration operator/(UncheckedDistance const &s, UncheckedSpeed const &v)
+{
+  return UncheckedDuration(static_cast<double>(s) / static_cast<double>(v));
+}
+
+inline UncheckedDuration operator/(UncheckedSpeed const &v, UncheckedAcceleration const &a)
+{
+  return UncheckedDuration(static_cast<double>(v) / static_cast<double>(a));
+}
+
+inline UncheckedDistance operator/(UncheckedSpeedSquared const &v2, UncheckedAcceleration const &a)
+{
+  return UncheckedDistance(static_cast<double>(v2) / static_cast<double>(a));
+}
+
+inline UncheckedDurationSquared operator/(UncheckedDistance const &s, UncheckedAcceleration const &a)
+{
+  return UncheckedDurationSquared(static_cast<double>(s) / static_cast<double>(a));
+}
+
+inline UncheckedDuration sqrt(UncheckedDurationSquared const &t2)
+{
+  return UncheckedDuration(std::sqrt(static_cast<double>(t2)));
+}
+
+/**
+ * @brief the set of physics types performing validity checks on every operation (the default)
+ */
+struct CheckedPhysicsTypes
+{
+  typedef physics::Acceleration Acceleration;
+  typedef physics::Distance Distance;
+  typedef physics::Duration Duration;
+  typedef physics::Speed Speed;
+
+  /**
+   * @brief ensure the validity of a calculated value
+   *
+   * Nothing to check, the checked physics types ensure the validity on every operation.
+   *
+   * @returns \c false if a range error has been raised (only possible without exception support), \c true otherwise
+   */
+  template <typename PhysicsType> static bool ensureValid(PhysicsType const &)
+  {
+    return !rangeErrorRaised();
+  }
+};
+
+/**
+ * @brief the set of unchecked physics types
+ */
+struct UncheckedPhysicsTypes
+{
+  typedef UncheckedAcceleration Acceleration;
+  typedef UncheckedDistance Distance;
+  typedef UncheckedDuration Duration;
+  typedef UncheckedSpeed Speed;
+
+  /**
+   * @brief ensure the validity of a calculated value
+   *
+   * Raises a range error if the value is not valid.
+   *
+   * @returns \c false if a range error has been raised (only possible without exception support), \c true otherwise
+   */
+  template <typename PhysicsType> static bool ensureValid(Unchecked<PhysicsType> const &value)
+  {
+    static_cast<void>(value.toChecked());
+    return !rangeErrorRaised();
+  }
+};
+
+} // namespace physics
+} // namespace ad_rss
@@ -0,0 +1,112 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "situation/RssEgoVehicleTerms.hpp"
+#include <cstring>
+
+namespace ad_rss {
+namespace situation {
+
+namespace {
+
+template <typename PhysicsType> bool isBitwiseEqual(PhysicsType const &left, PhysicsType const &right)
+{
+  double const leftValue = static_cast<double>(left);
+  double const rightValue = static_cast<double>(right);
+  return std::memcmp(&leftValue, &rightValue, sizeof(double)) == 0;
+}
+
+} // namespace
+
+void RssEgoVehicleTerms::calculate(VehicleState const &egoVehicle)
+{
+  mEgoVehicle = egoVehicle;
+  for (std::size_t i = 0u; i < mDistanceTerms.size(); i++)
+  {
+    DistanceTerm &distanceTerm = mDistanceTerms[i];
+    AD_RSS_TRY
+    {
+      distanceTerm.valid
+        = calculateVehicleDistanceTerm(mEgoVehicle, static_cast<VehicleDistanceTerm>(i), distanceTerm.distance);
+    }
+    AD_RSS_CATCH_ALL
+    {
+      distanceTerm.valid = false;
+    }
+  }
+
+  physics::calculateTimeToCoverDistanceTerms(mEgoVehicle.velocity.speedLon,
+                                             mEgoVehicle.responseTime,
+                                             mEgoVehicle.dynamics.alphaLon.accelMax,
+                                             mEgoVehicle.dynamics.alphaLon.brakeMin,
+                                             mTimeToEnterIntersection);
+  physics::calculateTimeToCoverDistanceTerms(mEgoVehicle.velocity.speedLon,
+                                             mEgoVehicle.responseTime,
+                                             -1. * mEgoVehicle.dynamics.alphaLon.brakeMax,
+                                             mEgoVehicle.dynamics.alphaLon.brakeMax,
+                                             mTimeToLeaveIntersection);
+  mCalculated = true;
+}
+
+void RssEgoVehicleTerms::reset()
+{
+  mCalculated = false;
+}
+
+bool RssEgoVehicleTerms::isCalculatedFor(VehicleState const &vehicle) const
+{
+  return mCalculated && isBitwiseEqual(vehicle.velocity.speedLon, mEgoVehicle.velocity.speedLon)
+    && isBitwiseEqual(vehicle.velocity.speedLat, mEgoVehicle.velocity.speedLat)
+    && isBitwiseEqual(vehicle.responseTime, mEgoVehicle.responseTime)
+    && isBitwiseEqual(vehicle.dynamics.alphaLon.accelMax, mEgoVehicle.dynamics.alphaLon.accelMax)
+    && isBitwiseEqual(vehicle.dynamics.alphaLon.brakeMax, mEgoVehicle.dynamics.alphaLon.brakeMax)
+    && isBitwiseEqual(vehicle.dynamics.alphaLon.brakeMin, mEgoVehicle.dynamics.alphaLon.brakeMin)
+    && isBitwiseEqual(vehicle.dynamics.alphaLon.brakeMinCorrect, mEgoVehicle.dynamics.alphaLon.brakeMinCorrect)
+    && isBitwiseEqual(vehicle.dynamics.alphaLat.accelMax, mEgoVehicle.dynamics.alphaLat.accelMax)
+    && isBitwiseEqual(vehicle.dynamics.alphaLat.brakeMin, mEgoVehicle.dynamics.alphaLat.brakeMin);
+}
+
+bool RssEgoVehicleTerms::getDistanceTerm(VehicleDistanceTerm const term, physics::UncheckedDistance &distance) const
+{
+  std::size_t const index = static_cast<std::size_t>(term);
+  if (index >= mDistanceTerms.size())
+  {
+    return false;
+  }
+  if (mDistanceTerms[index].valid)
+  {
+    distance = mDistanceTerms[index].distance;
+  }
+  return mDistanceTerms[index].valid;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,160 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <array>
+#include "ad_rss/situation/Situation.hpp"
+#include "physics/Math.hpp"
+#include "situation/RssFormulasT.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief The terms of the RSS calculations depending on the ego vehicle state only
+ *
+ * Within a time step, all situations share the same ego vehicle state. Therefore, the ego vehicle terms are
+ * calculated once per time step and reused by the checks of all situations.
+ *
+ * The terms are only used for vehicle states bitwise identical to the one the terms were calculated for, so that
+ * the results are identical to the calculation within each situation check.
+ */
+class RssEgoVehicleTerms
+{
+public:
+  /**
+   * @brief Calculate the terms of the given ego vehicle state
+   *
+   * @param[in] egoVehicle the ego vehicle state, already checked to be within valid input range
+   *
+   * Failing calculations are recorded and reported on use.
+   */
+  void calculate(VehicleState const &egoVehicle);
+
+  /**
+   * @brief Drop the calculated terms
+   */
+  void reset();
+
+  /**
+   * @return true if the terms are calculated for the given vehicle state
+   */
+  bool isCalculatedFor(VehicleState const &vehicle) const;
+
+  /**
+   * @brief Get a distance term of the ego vehicle
+   *
+   * @param[in]  term     the term
+   * @param[out] distance the distance of the term
+   *
+   * @return true if the term was calculated successfully, false otherwise
+   */
+  bool getDistanceTerm(VehicleDistanceTerm const term, physics::UncheckedDistance &distance) const;
+
+  /**
+   * @return the terms of the time the ego vehicle needs to enter an intersection (accelerating with accelMax
+   * during the response time, then braking with brakeMin)
+   */
+  physics::TimeToCoverDistanceTerms const &getTimeToEnterIntersectionTerms() const
+  {
+    return mTimeToEnterIntersection;
+  }
+
+  /**
+   * @return the terms of the time the ego vehicle needs to leave an intersection (braking with brakeMax)
+   */
+  physics::TimeToCoverDistanceTerms const &getTimeToLeaveIntersectionTerms() const
+  {
+    return mTimeToLeaveIntersection;
+  }
+
+private:
+  struct DistanceTerm
+  {
+    bool valid{false};
+    physics::UncheckedDistance distance{0.};
+  };
+
+  bool mCalculated{false};
+  VehicleState mEgoVehicle;
+  std::array<DistanceTerm, static_cast<std::size_t>(VehicleDistanceTerm::Count)> mDistanceTerms;
+  physics::TimeToCoverDistanceTerms mTimeToEnterIntersection;
+  physics::TimeToCoverDistanceTerms mTimeToLeaveIntersection;
+};
+
+/**
+ * @brief Distance term calculation taking the terms of the ego vehicle from RssEgoVehicleTerms
+ *
+ * Has the signature of calculateVehicleDistanceTerm(). The terms of all other vehicles are calculated.
+ */
+class EgoVehicleDistanceTermCalculation
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] egoVehicleTerms the terms of the ego vehicle
+   * @param[in] situation the situation to be checked
+   */
+  EgoVehicleDistanceTermCalculation(RssEgoVehicleTerms const &egoVehicleTerms, Situation const &situation)
+    : mEgoVehicleTerms(egoVehicleTerms)
+    , mEgoVehicle(egoVehicleTerms.isCalculatedFor(situation.egoVehicleState) ? &situation.egoVehicleState : nullptr)
+  {
+  }
+
+  bool operator()(VehicleState const &vehicle,
+                  VehicleDistanceTerm const term,
+                  physics::UncheckedDistance &distance) const
+  {
+    if (&vehicle == mEgoVehicle)
+    {
+      return mEgoVehicleTerms.getDistanceTerm(term, distance);
+    }
+    return calculateVehicleDistanceTerm(vehicle, term, distance);
+  }
+
+private:
+  RssEgoVehicleTerms const &mEgoVehicleTerms;
+  VehicleState const *mEgoVehicle;
+};
+
+} // namespace situation
+} // namespace ad_rss
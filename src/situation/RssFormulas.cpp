@@ -31,8 +31,11 @@
 
 #include "situation/RssFormulas.hpp"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include "ad_rss/situation/VehicleStateValidInputRange.hpp"
-#include "physics/Math.hpp"
+#include "physics/MathT.hpp"
+#include "situation/RssFormulasT.hpp"
 
 namespace ad_rss {
 namespace situation {
@@ -43,68 +46,178 @@ using physics::CoordinateSystemAxis;
 using physics::Distance;
 using physics::Duration;
 using physics::Speed;
-using physics::calculateStoppingDistance;
-
-bool calculateDistanceOffsetAfterStatedBrakingPattern(CoordinateSystemAxis const &axis,
-                                                      Speed const &currentSpeed,
-                                                      Duration const &responseTime,
-                                                      Acceleration const &acceleration,
-                                                      Acceleration const &deceleration,
-                                                      Distance &distanceOffset)
+using physics::UncheckedAcceleration;
+using physics::UncheckedDistance;
+using physics::UncheckedDuration;
+using physics::UncheckedSpeed;
+typedef physics::MathT<physics::UncheckedPhysicsTypes> UncheckedMath;
+
+namespace {
+
+/**
+ * @brief implementation of calculateDistanceOffsetAfterStatedBrakingPattern() for a given set of physics types
+ */
+template <typename PhysicsTypes>
+bool calculateDistanceOffsetAfterStatedBrakingPatternT(CoordinateSystemAxis const &axis,
+                                                       typename PhysicsTypes::Speed const &currentSpeed,
+                                                       typename PhysicsTypes::Duration const &responseTime,
+                                                       typename PhysicsTypes::Acceleration const &acceleration,
+                                                       typename PhysicsTypes::Acceleration const &deceleration,
+                                                       typename PhysicsTypes::Distance &distanceOffset)
 {
-  Speed resultingSpeed = Speed(0.);
-  bool result = calculateSpeedAfterResponseTime(axis, currentSpeed, acceleration, responseTime, resultingSpeed);
+  typedef physics::MathT<PhysicsTypes> Math;
+  typedef typename PhysicsTypes::Distance DistanceType;
+  typedef typename PhysicsTypes::Speed SpeedType;
+  using std::fabs;
 
-  Distance distanceOffsetAfterResponseTime = Distance(0.);
-  result = result && calculateDistanceOffsetAfterResponseTime(
+  SpeedType resultingSpeed = SpeedType(0.);
+  bool result = Math::calculateSpeedAfterResponseTime(axis, currentSpeed, acceleration, responseTime, resultingSpeed);
+
+  DistanceType distanceOffsetAfterResponseTime = DistanceType(0.);
+  result = result && Math::calculateDistanceOffsetAfterResponseTime(
                        axis, currentSpeed, acceleration, responseTime, distanceOffsetAfterResponseTime);
 
-  Distance distanceToStop = Distance(0.);
+  DistanceType distanceToStop = DistanceType(0.);
   if (std::signbit(static_cast<double>(resultingSpeed)) == std::signbit(static_cast<double>(acceleration)))
   {
     // if speed after stated braking pattern has the same direction as the acceleration
     // (always the case in longitudinal situation)
     // further braking to full stop in that moving direction has to be added
-    result = result && calculateStoppingDistance(resultingSpeed, std::fabs(deceleration), distanceToStop);
+    result = result && Math::calculateStoppingDistance(resultingSpeed, fabs(deceleration), distanceToStop);
   }
 
   if (result)
   {
     distanceOffset = distanceOffsetAfterResponseTime + distanceToStop;
+    result = PhysicsTypes::ensureValid(distanceOffset);
   }
 
   return result;
 }
 
-bool calculateSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
-                                                    VehicleState const &followingVehicle,
-                                                    Distance &safeDistance)
+/**
+ * @brief calculateDistanceOffsetAfterStatedBrakingPattern() for input already checked to be within valid input range
+ *
+ * The calculation is performed using the unchecked physics types.
+ */
+bool calculateDistanceOffsetAfterStatedBrakingPatternUnchecked(CoordinateSystemAxis const &axis,
+                                                               Speed const &currentSpeed,
+                                                               Duration const &responseTime,
+                                                               Acceleration const &acceleration,
+                                                               Acceleration const &deceleration,
+                                                               UncheckedDistance &distanceOffset)
 {
-  if (!withinValidInputRange(leadingVehicle) || !withinValidInputRange(followingVehicle))
+  return calculateDistanceOffsetAfterStatedBrakingPatternT<physics::UncheckedPhysicsTypes>(
+    axis,
+    UncheckedSpeed(currentSpeed),
+    UncheckedDuration(responseTime),
+    UncheckedAcceleration(acceleration),
+    UncheckedAcceleration(deceleration),
+    distanceOffset);
+}
+
+} // namespace
+
+bool calculateDistanceOffsetAfterStatedBrakingPattern(CoordinateSystemAxis const &axis,
+                                                      Speed const &currentSpeed,
+                                                      Duration const &responseTime,
+                                                      Acceleration const &acceleration,
+                                                      Acceleration const &deceleration,
+                                                      Distance &distanceOffset)
+{
+  return calculateDistanceOffsetAfterStatedBrakingPatternT<physics::CheckedPhysicsTypes>(
+    axis, currentSpeed, responseTime, acceleration, deceleration, distanceOffset);
+}
+
+bool calculateVehicleDistanceTerm(VehicleState const &vehicle,
+                                  VehicleDistanceTerm const term,
+                                  UncheckedDistance &distance)
+{
+  bool result = false;
+  switch (term)
   {
-    return false;
+    case VehicleDistanceTerm::LongitudinalStatedBrakingMin:
+      result = calculateDistanceOffsetAfterStatedBrakingPatternUnchecked(CoordinateSystemAxis::Longitudinal,
+                                                                         vehicle.velocity.speedLon,
+                                                                         vehicle.responseTime,
+                                                                         vehicle.dynamics.alphaLon.accelMax,
+                                                                         vehicle.dynamics.alphaLon.brakeMin,
+                                                                         distance);
+      break;
+    case VehicleDistanceTerm::LongitudinalStatedBrakingMinCorrect:
+      result = calculateDistanceOffsetAfterStatedBrakingPatternUnchecked(CoordinateSystemAxis::Longitudinal,
+                                                                         vehicle.velocity.speedLon,
+                                                                         vehicle.responseTime,
+                                                                         vehicle.dynamics.alphaLon.accelMax,
+                                                                         vehicle.dynamics.alphaLon.brakeMinCorrect,
+                                                                         distance);
+      break;
+    case VehicleDistanceTerm::LongitudinalStoppingMax:
+      result = UncheckedMath::calculateStoppingDistance(UncheckedSpeed(vehicle.velocity.speedLon),
+                                                        UncheckedAcceleration(vehicle.dynamics.alphaLon.brakeMax),
+                                                        distance);
+      break;
+    case VehicleDistanceTerm::LateralStatedBrakingLeft:
+      result = calculateDistanceOffsetAfterStatedBrakingPatternUnchecked(CoordinateSystemAxis::Lateral,
+                                                                         vehicle.velocity.speedLat,
+                                                                         vehicle.responseTime,
+                                                                         vehicle.dynamics.alphaLat.accelMax,
+                                                                         vehicle.dynamics.alphaLat.brakeMin,
+                                                                         distance);
+      break;
+    case VehicleDistanceTerm::LateralStatedBrakingRight:
+      result = calculateDistanceOffsetAfterStatedBrakingPatternUnchecked(CoordinateSystemAxis::Lateral,
+                                                                         vehicle.velocity.speedLat,
+                                                                         vehicle.responseTime,
+                                                                         -vehicle.dynamics.alphaLat.accelMax,
+                                                                         -vehicle.dynamics.alphaLat.brakeMin,
+                                                                         distance);
+      break;
+    default:
+      result = false;
+      break;
   }
+  return result;
+}
 
-  Distance distanceStatedBraking = Distance(0.);
+namespace {
 
-  bool result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Longitudinal,
-    followingVehicle.velocity.speedLon,
-    followingVehicle.responseTime,
-    followingVehicle.dynamics.alphaLon.accelMax,
-    followingVehicle.dynamics.alphaLon.brakeMin,
-    distanceStatedBraking);
-  Distance distanceMaxBrake = Distance(0.);
-  result = result && calculateStoppingDistance(
-                       leadingVehicle.velocity.speedLon, leadingVehicle.dynamics.alphaLon.brakeMax, distanceMaxBrake);
+bool calculateSafeLongitudinalDistanceSameDirectionInputRangeChecked(VehicleState const &leadingVehicle,
+                                                                     VehicleState const &followingVehicle,
+                                                                     Distance &safeDistance)
+{
+  return calculateSafeLongitudinalDistanceSameDirectionT(
+    leadingVehicle, followingVehicle, safeDistance, calculateVehicleDistanceTerm);
+}
 
-  if (result)
+bool calculateSafeLongitudinalDistanceOppositeDirectionInputRangeChecked(VehicleState const &correctVehicle,
+                                                                         VehicleState const &oppositeVehicle,
+                                                                         Distance &safeDistance)
+{
+  return calculateSafeLongitudinalDistanceOppositeDirectionT(
+    correctVehicle, oppositeVehicle, safeDistance, calculateVehicleDistanceTerm);
+}
+
+bool calculateSafeLateralDistanceInputRangeChecked(VehicleState const &leftVehicle,
+                                                   VehicleState const &rightVehicle,
+                                                   Distance &safeDistance)
+{
+  return calculateSafeLateralDistanceT(leftVehicle, rightVehicle, safeDistance, calculateVehicleDistanceTerm);
+}
+
+} // namespace
+
+bool calculateSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                    VehicleState const &followingVehicle,
+                                                    Distance &safeDistance)
+{
+  if (!withinValidInputRange(leadingVehicle) || !withinValidInputRange(followingVehicle))
   {
-    safeDistance = distanceStatedBraking - distanceMaxBrake;
-    safeDistance = std::max(safeDistance, Distance(0.));
+    return false;
   }
 
-  return result;
+  return calculateSafeLongitudinalDistanceSameDirectionInputRangeChecked(
+    leadingVehicle, followingVehicle, safeDistance);
 }
 
 bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
@@ -113,170 +226,776 @@ bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehic
                                                 Distance &safeDistance,
                                                 bool &isDistanceSafe)
 {
-  if (vehicleDistance < Distance(0.))
+  return checkSafeDistanceT(calculateSafeLongitudinalDistanceSameDirection,
+                           leadingVehicle,
+                           followingVehicle,
+                           vehicleDistance,
+                           safeDistance,
+                           isDistanceSafe);
+}
+
+bool checkSafeLongitudinalDistanceSameDirectionInputRangeChecked(VehicleState const &leadingVehicle,
+                                                                 VehicleState const &followingVehicle,
+                                                                 Distance const &vehicleDistance,
+                                                                 Distance &safeDistance,
+                                                                 bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(calculateSafeLongitudinalDistanceSameDirectionInputRangeChecked,
+                           leadingVehicle,
+                           followingVehicle,
+                           vehicleDistance,
+                           safeDistance,
+                           isDistanceSafe);
+}
+
+bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                        VehicleState const &oppositeVehicle,
+                                                        Distance &safeDistance)
+{
+  if (!withinValidInputRange(correctVehicle) || !withinValidInputRange(oppositeVehicle))
   {
     return false;
   }
 
-  isDistanceSafe = false;
-  safeDistance = Distance::getMax();
+  return calculateSafeLongitudinalDistanceOppositeDirectionInputRangeChecked(
+    correctVehicle, oppositeVehicle, safeDistance);
+}
 
-  bool const result = calculateSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, safeDistance);
+bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                    VehicleState const &oppositeVehicle,
+                                                    Distance const &vehicleDistance,
+                                                    Distance &safeDistance,
+                                                    bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(calculateSafeLongitudinalDistanceOppositeDirection,
+                           correctVehicle,
+                           oppositeVehicle,
+                           vehicleDistance,
+                           safeDistance,
+                           isDistanceSafe);
+}
 
-  if (vehicleDistance > safeDistance)
+bool checkSafeLongitudinalDistanceOppositeDirectionInputRangeChecked(VehicleState const &correctVehicle,
+                                                                     VehicleState const &oppositeVehicle,
+                                                                     Distance const &vehicleDistance,
+                                                                     Distance &safeDistance,
+                                                                     bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(calculateSafeLongitudinalDistanceOppositeDirectionInputRangeChecked,
+                           correctVehicle,
+                           oppositeVehicle,
+                           vehicleDistance,
+                           safeDistance,
+                           isDistanceSafe);
+}
+
+bool checkStopInFrontIntersection(VehicleState const &vehicle, Distance &safeDistance, bool &isDistanceSafe)
+{
+  if (!withinValidInputRange(vehicle))
   {
-    isDistanceSafe = true;
+    return false;
   }
-  return result;
+
+  return checkStopInFrontIntersectionInputRangeChecked(vehicle, safeDistance, isDistanceSafe);
 }
 
-bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
-                                                        VehicleState const &oppositeVehicle,
-                                                        Distance &safeDistance)
+bool checkStopInFrontIntersectionInputRangeChecked(VehicleState const &vehicle,
+                                                   Distance &safeDistance,
+                                                   bool &isDistanceSafe)
 {
-  if (!withinValidInputRange(correctVehicle) || !withinValidInputRange(oppositeVehicle))
+  return checkStopInFrontIntersectionT(vehicle, safeDistance, isDistanceSafe, calculateVehicleDistanceTerm);
+}
+
+bool calculateSafeLateralDistance(VehicleState const &leftVehicle,
+                                  VehicleState const &rightVehicle,
+                                  Distance &safeDistance)
+{
+  if (!withinValidInputRange(leftVehicle) || !withinValidInputRange(rightVehicle))
   {
     return false;
   }
 
-  Distance distanceStatedBrakingCorrect = Distance(0.);
+  return calculateSafeLateralDistanceInputRangeChecked(leftVehicle, rightVehicle, safeDistance);
+}
 
-  bool result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Longitudinal,
-    correctVehicle.velocity.speedLon,
-    correctVehicle.responseTime,
-    correctVehicle.dynamics.alphaLon.accelMax,
-    correctVehicle.dynamics.alphaLon.brakeMinCorrect,
-    distanceStatedBrakingCorrect);
+bool checkSafeLateralDistance(VehicleState const &leftVehicle,
+                              VehicleState const &rightVehicle,
+                              Distance const &vehicleDistance,
+                              Distance &safeDistance,
+                              bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(
+    calculateSafeLateralDistance, leftVehicle, rightVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+}
 
-  Distance distanceStatedBrakingOpposite = Distance(0.);
+bool checkSafeLateralDistanceInputRangeChecked(VehicleState const &leftVehicle,
+                                               VehicleState const &rightVehicle,
+                                               Distance const &vehicleDistance,
+                                               Distance &safeDistance,
+                                               bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(calculateSafeLateralDistanceInputRangeChecked,
+                           leftVehicle,
+                           rightVehicle,
+                           vehicleDistance,
+                           safeDistance,
+                           isDistanceSafe);
+}
 
-  if (result)
+bool calculateDistanceOffsetAfterStatedBrakingPattern(CoordinateSystemAxis const &axis,
+                                                      physics::SpeedRange const &currentSpeed,
+                                                      Duration const &responseTime,
+                                                      Acceleration const &acceleration,
+                                                      Acceleration const &deceleration,
+                                                      physics::MetricRange &distanceOffset)
+{
+  return physics::calculateNonDecreasingRange(
+    currentSpeed,
+    [&axis, &responseTime, &acceleration, &deceleration](Speed const &speed, Distance &distance) {
+      return calculateDistanceOffsetAfterStatedBrakingPattern(
+        axis, speed, responseTime, acceleration, deceleration, distance);
+    },
+    distanceOffset);
+}
+
+bool calculateSafeLongitudinalDistanceRangeSameDirection(VehicleState const &leadingVehicle,
+                                                         VehicleStateUncertainty const &leadingUncertainty,
+                                                         VehicleState const &followingVehicle,
+                                                         VehicleStateUncertainty const &followingUncertainty,
+                                                         physics::MetricRange &safeDistance)
+{
+  if (!withinValidInputRange(leadingVehicle) || !withinValidInputRange(leadingUncertainty)
+      || !withinValidInputRange(followingVehicle) || !withinValidInputRange(followingUncertainty))
+  {
+    return false;
+  }
+
+  return calculateSafeDistanceRangeT(calculateSafeLongitudinalDistanceSameDirectionT<DistanceTermBoundCalculation>,
+                                     leadingVehicle,
+                                     leadingUncertainty,
+                                     followingVehicle,
+                                     followingUncertainty,
+                                     safeDistance);
+}
+
+bool calculateSafeLongitudinalDistanceRangeOppositeDirection(VehicleState const &correctVehicle,
+                                                             VehicleStateUncertainty const &correctUncertainty,
+                                                             VehicleState const &oppositeVehicle,
+                                                             VehicleStateUncertainty const &oppositeUncertainty,
+                                                             physics::MetricRange &safeDistance)
+{
+  if (!withinValidInputRange(correctVehicle) || !withinValidInputRange(correctUncertainty)
+      || !withinValidInputRange(oppositeVehicle) || !withinValidInputRange(oppositeUncertainty))
+  {
+    return false;
+  }
+
+  return calculateSafeDistanceRangeT(calculateSafeLongitudinalDistanceOppositeDirectionT<DistanceTermBoundCalculation>,
+                                     correctVehicle,
+                                     correctUncertainty,
+                                     oppositeVehicle,
+                                     oppositeUncertainty,
+                                     safeDistance);
+}
+
+bool calculateSafeLateralDistanceRange(VehicleState const &leftVehicle,
+                                       VehicleStateUncertainty const &leftUncertainty,
+                                       VehicleState const &rightVehicle,
+                                       VehicleStateUncertainty const &rightUncertainty,
+                                       physics::MetricRange &safeDistance)
+{
+  if (!withinValidInputRange(leftVehicle) || !withinValidInputRange(leftUncertainty)
+      || !withinValidInputRange(rightVehicle) || !withinValidInputRange(rightUncertainty))
+  {
+    return false;
+  }
+
+  return calculateSafeDistanceRangeT(calculateSafeLateralDistanceT<DistanceTermBoundCalculation>,
+                                     leftVehicle,
+                                     leftUncertainty,
+                                     rightVehicle,
+                                     rightUncertainty,
+                                     safeDistance);
+}
+
+bool checkStopInFrontIntersection(VehicleState const &vehicle,
+                                  VehicleStateUncertainty const &uncertainty,
+                                  Distance &safeDistance,
+                                  bool &isDistanceSafe)
+{
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(uncertainty))
+  {
+    return false;
+  }
+
+  DistanceTermBoundCalculation const upperBoundCalculation(vehicle, uncertainty, uncertainty, true);
+  return checkStopInFrontIntersectionT(vehicle, safeDistance, isDistanceSafe, upperBoundCalculation);
+}
+
+namespace {
+
+/**
+ * @brief closed form inverse of the distance offset of the stated braking pattern with respect to the acceleration
+ *
+ * With the speed at the end of the response time w = v + a * t, the distance offset is
+ * s = t * (v + w) / 2 + max(w, 0)^2 / (2 * b), which is solved for w. In longitudinal direction the vehicle stops
+ * within the response time for w < 0, resulting in s = v^2 / (2 * -a) instead.
+ */
+double calculateMaxAcceleration(CoordinateSystemAxis const &axis,
+                                double const currentSpeed,
+                                double const responseTime,
+                                double const deceleration,
+                                double const maxDistanceOffset)
+{
+  if (maxDistanceOffset >= 0.5 * responseTime * currentSpeed)
   {
-    result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-      CoordinateSystemAxis::Longitudinal,
-      oppositeVehicle.velocity.speedLon,
-      oppositeVehicle.responseTime,
-      oppositeVehicle.dynamics.alphaLon.accelMax,
-      oppositeVehicle.dynamics.alphaLon.brakeMin,
-      distanceStatedBrakingOpposite);
+    double const halfBrakingSpeed = 0.5 * deceleration * responseTime;
+    double const resultingSpeed = -halfBrakingSpeed
+      + std::sqrt(halfBrakingSpeed * halfBrakingSpeed
+                  + deceleration * (2. * maxDistanceOffset - responseTime * currentSpeed));
+    return (resultingSpeed - currentSpeed) / responseTime;
   }
 
+  if (axis == CoordinateSystemAxis::Lateral)
+  {
+    return 2. * (maxDistanceOffset - responseTime * currentSpeed) / (responseTime * responseTime);
+  }
+
+  if (maxDistanceOffset > 0.)
+  {
+    return -currentSpeed * currentSpeed / (2. * maxDistanceOffset);
+  }
+
+  // not even an immediate stop is sufficient
+  return std::numeric_limits<double>::lowest();
+}
+
+/**
+ * @brief closed form inverse of the distance offset of the stated braking pattern with respect to the current speed
+ *
+ * With the speed at the end of the response time w = v + a * t, the distance offset is
+ * s = t * w - a * t^2 / 2 + max(w, 0)^2 / (2 * b), which is solved for w. For a >= 0, w < 0 is only possible in
+ * lateral direction.
+ */
+double calculateMaxSpeed(double const acceleration,
+                         double const responseTime,
+                         double const deceleration,
+                         double const maxDistanceOffset)
+{
+  double const accelerationOffset = 0.5 * acceleration * responseTime * responseTime;
+  if (maxDistanceOffset + accelerationOffset >= 0.)
+  {
+    double const brakingSpeed = deceleration * responseTime;
+    double const resultingSpeed = -brakingSpeed
+      + std::sqrt(brakingSpeed * brakingSpeed + 2. * deceleration * (maxDistanceOffset + accelerationOffset));
+    return resultingSpeed - acceleration * responseTime;
+  }
+
+  return (maxDistanceOffset - accelerationOffset) / responseTime;
+}
+
+Acceleration toAccelerationLimit(double const value)
+{
+  return Acceleration(std::max(Acceleration::cMinValue, std::min(value, Acceleration::cMaxValue)));
+}
+
+Speed toSpeedLimit(double const value)
+{
+  return Speed(std::max(Speed::cMinValue, std::min(value, Speed::cMaxValue)));
+}
+
+/**
+ * @brief calculate the limits of the vehicle applying the stated braking pattern for the given vehicle distance
+ *
+ * As the vehicle distance has to exceed the safe distance by the precision of the distance (see checkSafeDistanceT()),
+ * the distance offset of the vehicle must not exceed vehicleDistance - Distance::cPrecisionValue + otherDistanceOffset.
+ */
+void calculateLimits(CoordinateSystemAxis const &axis,
+                     double const currentSpeed,
+                     double const acceleration,
+                     Duration const &responseTime,
+                     Acceleration const &deceleration,
+                     Distance const &vehicleDistance,
+                     double const otherDistanceOffset,
+                     Acceleration &maxAcceleration,
+                     Speed &maxSpeed)
+{
+  double const distanceBudget = static_cast<double>(vehicleDistance) - Distance::cPrecisionValue;
+  if (distanceBudget < 0.)
+  {
+    // the distance is never safe
+    maxAcceleration = std::numeric_limits<Acceleration>::lowest();
+    maxSpeed = std::numeric_limits<Speed>::lowest();
+    return;
+  }
+
+  double const maxDistanceOffset = distanceBudget + otherDistanceOffset;
+  maxAcceleration = toAccelerationLimit(calculateMaxAcceleration(axis,
+                                                                 currentSpeed,
+                                                                 static_cast<double>(responseTime),
+                                                                 static_cast<double>(deceleration),
+                                                                 maxDistanceOffset));
+  maxSpeed = toSpeedLimit(calculateMaxSpeed(
+    acceleration, static_cast<double>(responseTime), static_cast<double>(deceleration), maxDistanceOffset));
+}
+
+} // namespace
+
+bool calculateMaxAccelerationForDistanceOffset(CoordinateSystemAxis const &axis,
+                                               Speed const &currentSpeed,
+                                               Duration const &responseTime,
+                                               Acceleration const &deceleration,
+                                               Distance const &maxDistanceOffset,
+                                               Acceleration &maxAcceleration)
+{
+  if ((responseTime <= Duration(0.)) || (deceleration <= Acceleration(0.))
+      || ((axis == CoordinateSystemAxis::Longitudinal) && (currentSpeed < Speed(0.))))
+  {
+    return false;
+  }
+
+  maxAcceleration = toAccelerationLimit(calculateMaxAcceleration(axis,
+                                                                 static_cast<double>(currentSpeed),
+                                                                 static_cast<double>(responseTime),
+                                                                 static_cast<double>(deceleration),
+                                                                 static_cast<double>(maxDistanceOffset)));
+  return true;
+}
+
+bool calculateMaxSpeedForDistanceOffset(Acceleration const &acceleration,
+                                        Duration const &responseTime,
+                                        Acceleration const &deceleration,
+                                        Distance const &maxDistanceOffset,
+                                        Speed &maxSpeed)
+{
+  if ((responseTime <= Duration(0.)) || (deceleration <= Acceleration(0.)) || (acceleration < Acceleration(0.)))
+  {
+    return false;
+  }
+
+  maxSpeed = toSpeedLimit(calculateMaxSpeed(static_cast<double>(acceleration),
+                                            static_cast<double>(responseTime),
+                                            static_cast<double>(deceleration),
+                                            static_cast<double>(maxDistanceOffset)));
+  return true;
+}
+
+bool calculateSafeLongitudinalLimitsSameDirection(VehicleState const &leadingVehicle,
+                                                  VehicleState const &followingVehicle,
+                                                  Distance const &vehicleDistance,
+                                                  Acceleration &maxAcceleration,
+                                                  Speed &maxSpeed)
+{
+  if (!withinValidInputRange(leadingVehicle) || !withinValidInputRange(followingVehicle)
+      || (vehicleDistance < Distance(0.)))
+  {
+    return false;
+  }
+
+  UncheckedDistance distanceMaxBrake = UncheckedDistance(0.);
+  bool const result
+    = calculateVehicleDistanceTerm(leadingVehicle, VehicleDistanceTerm::LongitudinalStoppingMax, distanceMaxBrake);
   if (result)
   {
-    safeDistance = distanceStatedBrakingCorrect + distanceStatedBrakingOpposite;
+    calculateLimits(CoordinateSystemAxis::Longitudinal,
+                    static_cast<double>(followingVehicle.velocity.speedLon),
+                    static_cast<double>(followingVehicle.dynamics.alphaLon.accelMax),
+                    followingVehicle.responseTime,
+                    followingVehicle.dynamics.alphaLon.brakeMin,
+                    vehicleDistance,
+                    static_cast<double>(distanceMaxBrake),
+                    maxAcceleration,
+                    maxSpeed);
+  }
+  return result;
+}
+
+bool calculateSafeLongitudinalLimitsOppositeDirection(VehicleState const &vehicle,
+                                                      VehicleState const &otherVehicle,
+                                                      Distance const &vehicleDistance,
+                                                      Acceleration &maxAcceleration,
+                                                      Speed &maxSpeed)
+{
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(otherVehicle) || (vehicleDistance < Distance(0.)))
+  {
+    return false;
+  }
+
+  Acceleration deceleration = vehicle.dynamics.alphaLon.brakeMin;
+  VehicleDistanceTerm otherTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMinCorrect;
+  if (vehicle.isInCorrectLane)
+  {
+    deceleration = vehicle.dynamics.alphaLon.brakeMinCorrect;
+    otherTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMin;
   }
 
+  UncheckedDistance distanceStatedBrakingOther = UncheckedDistance(0.);
+  bool const result = calculateVehicleDistanceTerm(otherVehicle, otherTerm, distanceStatedBrakingOther);
+  if (result)
+  {
+    calculateLimits(CoordinateSystemAxis::Longitudinal,
+                    static_cast<double>(vehicle.velocity.speedLon),
+                    static_cast<double>(vehicle.dynamics.alphaLon.accelMax),
+                    vehicle.responseTime,
+                    deceleration,
+                    vehicleDistance,
+                    -static_cast<double>(distanceStatedBrakingOther),
+                    maxAcceleration,
+                    maxSpeed);
+  }
   return result;
 }
 
-bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
-                                                    VehicleState const &oppositeVehicle,
-                                                    Distance const &vehicleDistance,
-                                                    Distance &safeDistance,
-                                                    bool &isDistanceSafe)
+bool calculateSafeLateralLimits(VehicleState const &vehicle,
+                                VehicleState const &otherVehicle,
+                                LateralRelativePosition const &lateralPosition,
+                                Distance const &vehicleDistance,
+                                Acceleration &maxAcceleration,
+                                physics::SpeedRange &speedRange)
 {
-  if (vehicleDistance < Distance(0.))
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(otherVehicle) || (vehicleDistance < Distance(0.))
+      || ((lateralPosition != LateralRelativePosition::AtLeft)
+          && (lateralPosition != LateralRelativePosition::AtRight)))
   {
     return false;
   }
 
-  isDistanceSafe = false;
-  safeDistance = Distance::getMax();
-  bool const result = calculateSafeLongitudinalDistanceOppositeDirection(correctVehicle, oppositeVehicle, safeDistance);
+  bool const isLeftVehicle = (lateralPosition == LateralRelativePosition::AtLeft);
 
-  if (vehicleDistance > safeDistance)
+  // the stated braking pattern of the right vehicle is the one of the left vehicle mirrored at the lateral axis,
+  // so the right vehicle is handled as left vehicle with negated lateral speed
+  UncheckedDistance distanceOffsetOther = UncheckedDistance(0.);
+  bool const result = calculateVehicleDistanceTerm(otherVehicle,
+                                                   isLeftVehicle ? VehicleDistanceTerm::LateralStatedBrakingRight
+                                                                 : VehicleDistanceTerm::LateralStatedBrakingLeft,
+                                                   distanceOffsetOther);
+  if (result)
   {
-    isDistanceSafe = true;
+    double const lateralSpeed = static_cast<double>(vehicle.velocity.speedLat);
+    double const otherDistanceOffset = static_cast<double>(distanceOffsetOther);
+    Speed maxSpeedTowardsOther;
+    calculateLimits(CoordinateSystemAxis::Lateral,
+                    isLeftVehicle ? lateralSpeed : -lateralSpeed,
+                    static_cast<double>(vehicle.dynamics.alphaLat.accelMax),
+                    vehicle.responseTime,
+                    vehicle.dynamics.alphaLat.brakeMin,
+                    vehicleDistance,
+                    isLeftVehicle ? otherDistanceOffset : -otherDistanceOffset,
+                    maxAcceleration,
+                    maxSpeedTowardsOther);
+
+    speedRange = physics::SpeedRange();
+    if (isLeftVehicle)
+    {
+      speedRange.maximum = maxSpeedTowardsOther;
+    }
+    else
+    {
+      speedRange.minimum = Speed(-static_cast<double>(maxSpeedTowardsOther));
+    }
   }
   return result;
 }
 
-bool checkStopInFrontIntersection(VehicleState const &vehicle, Distance &safeDistance, bool &isDistanceSafe)
+bool calculateStopInFrontIntersectionLimits(VehicleState const &vehicle,
+                                            Acceleration &maxAcceleration,
+                                            Speed &maxSpeed)
 {
   if (!withinValidInputRange(vehicle))
   {
     return false;
   }
 
-  isDistanceSafe = false;
+  calculateLimits(CoordinateSystemAxis::Longitudinal,
+                  static_cast<double>(vehicle.velocity.speedLon),
+                  static_cast<double>(vehicle.dynamics.alphaLon.accelMax),
+                  vehicle.responseTime,
+                  vehicle.dynamics.alphaLon.brakeMin,
+                  vehicle.distanceToEnterIntersection,
+                  0.,
+                  maxAcceleration,
+                  maxSpeed);
+  return true;
+}
 
-  safeDistance = Distance(0.);
-  bool result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Longitudinal,
-    vehicle.velocity.speedLon,
-    vehicle.responseTime,
-    vehicle.dynamics.alphaLon.accelMax,
-    vehicle.dynamics.alphaLon.brakeMin,
-    safeDistance);
+namespace {
+
+/**
+ * @brief closed form partial derivatives of the distance offset of the stated braking pattern
+ *
+ * See calculateDistanceOffsetAfterStatedBrakingPatternT(): the distance offset during the response time is
+ * v * t + a * t^2 / 2, or v^2 / (2 * -a) if the vehicle stops longitudinally within the response time. If the speed
+ * w = v + a * t after the response time has the same direction as the acceleration, the distance to stop
+ * w * |w| / (2 * |b|) is added.
+ */
+DistanceGradient calculateDistanceOffsetGradient(CoordinateSystemAxis const &axis,
+                                                 double const currentSpeed,
+                                                 double const responseTime,
+                                                 double const acceleration,
+                                                 double const deceleration)
+{
+  double speedDerivative = 0.;
+  double accelerationDerivative = 0.;
+  double responseTimeDerivative = 0.;
 
-  if (safeDistance < vehicle.distanceToEnterIntersection)
+  double const resultingSpeed = currentSpeed + acceleration * responseTime;
+  if ((axis == CoordinateSystemAxis::Longitudinal) && (resultingSpeed < 0.))
+  {
+    // the vehicle stops within the response time, only possible on deceleration
+    speedDerivative = -currentSpeed / acceleration;
+    accelerationDerivative = currentSpeed * currentSpeed / (2. * acceleration * acceleration);
+  }
+  else
   {
-    isDistanceSafe = true;
+    speedDerivative = responseTime;
+    accelerationDerivative = 0.5 * responseTime * responseTime;
+    responseTimeDerivative = resultingSpeed;
+    if (std::signbit(resultingSpeed) == std::signbit(acceleration))
+    {
+      double const stoppingDistanceDerivative = std::fabs(resultingSpeed) / std::fabs(deceleration);
+      speedDerivative += stoppingDistanceDerivative;
+      accelerationDerivative += stoppingDistanceDerivative * responseTime;
+      responseTimeDerivative += stoppingDistanceDerivative * acceleration;
+    }
   }
 
-  return result;
+  DistanceGradient gradient;
+  gradient.speed = Duration(speedDerivative);
+  gradient.acceleration = physics::DurationSquared(accelerationDerivative);
+  gradient.responseTime = Speed(responseTimeDerivative);
+  return gradient;
 }
 
-bool calculateSafeLateralDistance(VehicleState const &leftVehicle,
-                                  VehicleState const &rightVehicle,
-                                  Distance &safeDistance)
+/**
+ * @brief partial derivatives of the longitudinal stated braking pattern of the vehicle with the given deceleration
+ */
+DistanceGradient calculateLongitudinalDistanceOffsetGradient(VehicleState const &vehicle,
+                                                             Acceleration const &deceleration)
 {
-  if (!withinValidInputRange(leftVehicle) || !withinValidInputRange(rightVehicle))
+  return calculateDistanceOffsetGradient(CoordinateSystemAxis::Longitudinal,
+                                         static_cast<double>(vehicle.velocity.speedLon),
+                                         static_cast<double>(vehicle.responseTime),
+                                         static_cast<double>(vehicle.dynamics.alphaLon.accelMax),
+                                         static_cast<double>(deceleration));
+}
+
+/**
+ * @brief calculate the margin of the vehicle distance and its gradient from the safe distance and its gradient
+ *
+ * If clampSafeDistance is set, negative safe distances are replaced by zero, as done by the safe distance
+ * calculations.
+ */
+void calculateMargin(Distance const &vehicleDistance,
+                     UncheckedDistance const &safeDistance,
+                     DistanceGradient const &safeDistanceGradient,
+                     bool const clampSafeDistance,
+                     Distance &margin,
+                     DistanceGradient &marginGradient)
+{
+  if (clampSafeDistance && (static_cast<double>(safeDistance) < 0.))
+  {
+    margin = vehicleDistance;
+    marginGradient = DistanceGradient();
+    return;
+  }
+
+  margin = Distance(static_cast<double>(vehicleDistance) - static_cast<double>(safeDistance));
+  marginGradient.speed = Duration(-static_cast<double>(safeDistanceGradient.speed));
+  marginGradient.acceleration = physics::DurationSquared(-static_cast<double>(safeDistanceGradient.acceleration));
+  marginGradient.responseTime = Speed(-static_cast<double>(safeDistanceGradient.responseTime));
+}
+
+} // namespace
+
+bool calculateDistanceOffsetGradientAfterStatedBrakingPattern(CoordinateSystemAxis const &axis,
+                                                              Speed const &currentSpeed,
+                                                              Duration const &responseTime,
+                                                              Acceleration const &acceleration,
+                                                              Acceleration const &deceleration,
+                                                              DistanceGradient &gradient)
+{
+  if ((responseTime < Duration(0.)) || (deceleration == Acceleration(0.))
+      || ((axis == CoordinateSystemAxis::Longitudinal) && (currentSpeed < Speed(0.))))
+  {
+    return false;
+  }
+
+  gradient = calculateDistanceOffsetGradient(axis,
+                                             static_cast<double>(currentSpeed),
+                                             static_cast<double>(responseTime),
+                                             static_cast<double>(acceleration),
+                                             static_cast<double>(deceleration));
+  return true;
+}
+
+bool calculateSafeLongitudinalMarginSameDirection(VehicleState const &vehicle,
+                                                  VehicleState const &otherVehicle,
+                                                  LongitudinalRelativePosition const &longitudinalPosition,
+                                                  Distance const &vehicleDistance,
+                                                  Distance &margin,
+                                                  DistanceGradient &marginGradient)
+{
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(otherVehicle) || (vehicleDistance < Distance(0.)))
   {
     return false;
   }
 
+  bool const isLeadingVehicle = (longitudinalPosition == LongitudinalRelativePosition::InFront)
+    || (longitudinalPosition == LongitudinalRelativePosition::OverlapFront);
+
+  UncheckedDistance distanceStatedBraking = UncheckedDistance(0.);
+  UncheckedDistance distanceMaxBrake = UncheckedDistance(0.);
+  DistanceGradient safeDistanceGradient;
   bool result = false;
-  Distance distanceOffsetStatedBrakingLeft = Distance(0.);
-  Distance distanceOffsetStatedBrakingRight = Distance(0.);
-
-  result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Lateral,
-    leftVehicle.velocity.speedLat,
-    leftVehicle.responseTime,
-    leftVehicle.dynamics.alphaLat.accelMax,
-    leftVehicle.dynamics.alphaLat.brakeMin,
-    distanceOffsetStatedBrakingLeft);
-
-  result = result && calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-                       CoordinateSystemAxis::Lateral,
-                       rightVehicle.velocity.speedLat,
-                       rightVehicle.responseTime,
-                       -rightVehicle.dynamics.alphaLat.accelMax,
-                       -rightVehicle.dynamics.alphaLat.brakeMin,
-                       distanceOffsetStatedBrakingRight);
+  if (isLeadingVehicle)
+  {
+    result = calculateVehicleDistanceTerm(
+               otherVehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceStatedBraking)
+      && calculateVehicleDistanceTerm(vehicle, VehicleDistanceTerm::LongitudinalStoppingMax, distanceMaxBrake);
+
+    // the stopping distance v^2 / (2 * brakeMax) is subtracted
+    double const speed = static_cast<double>(vehicle.velocity.speedLon);
+    safeDistanceGradient.speed = Duration(-speed / static_cast<double>(vehicle.dynamics.alphaLon.brakeMax));
+  }
+  else
+  {
+    result = calculateVehicleDistanceTerm(
+               vehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceStatedBraking)
+      && calculateVehicleDistanceTerm(otherVehicle, VehicleDistanceTerm::LongitudinalStoppingMax, distanceMaxBrake);
+
+    safeDistanceGradient = calculateLongitudinalDistanceOffsetGradient(vehicle, vehicle.dynamics.alphaLon.brakeMin);
+  }
 
   if (result)
   {
-    // safe distance is the difference of both distances
-    // Note: The fluctuation margin is already considered in the vehicle bounding boxes
-    safeDistance = distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight;
-    safeDistance = std::max(safeDistance, Distance(0.));
+    calculateMargin(vehicleDistance,
+                    distanceStatedBraking - distanceMaxBrake,
+                    safeDistanceGradient,
+                    true,
+                    margin,
+                    marginGradient);
   }
   return result;
 }
 
-bool checkSafeLateralDistance(VehicleState const &leftVehicle,
-                              VehicleState const &rightVehicle,
-                              Distance const &vehicleDistance,
-                              Distance &safeDistance,
-                              bool &isDistanceSafe)
+bool calculateSafeLongitudinalMarginOppositeDirection(VehicleState const &vehicle,
+                                                      VehicleState const &otherVehicle,
+                                                      Distance const &vehicleDistance,
+                                                      Distance &margin,
+                                                      DistanceGradient &marginGradient)
+{
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(otherVehicle) || (vehicleDistance < Distance(0.)))
+  {
+    return false;
+  }
+
+  Acceleration deceleration = vehicle.dynamics.alphaLon.brakeMin;
+  VehicleDistanceTerm vehicleTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMin;
+  VehicleDistanceTerm otherTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMinCorrect;
+  if (vehicle.isInCorrectLane)
+  {
+    deceleration = vehicle.dynamics.alphaLon.brakeMinCorrect;
+    vehicleTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMinCorrect;
+    otherTerm = VehicleDistanceTerm::LongitudinalStatedBrakingMin;
+  }
+
+  UncheckedDistance distanceStatedBraking = UncheckedDistance(0.);
+  UncheckedDistance distanceStatedBrakingOther = UncheckedDistance(0.);
+  bool const result = calculateVehicleDistanceTerm(vehicle, vehicleTerm, distanceStatedBraking)
+    && calculateVehicleDistanceTerm(otherVehicle, otherTerm, distanceStatedBrakingOther);
+  if (result)
+  {
+    calculateMargin(vehicleDistance,
+                    distanceStatedBraking + distanceStatedBrakingOther,
+                    calculateLongitudinalDistanceOffsetGradient(vehicle, deceleration),
+                    false,
+                    margin,
+                    marginGradient);
+  }
+  return result;
+}
+
+bool calculateSafeLateralMargin(VehicleState const &vehicle,
+                                VehicleState const &otherVehicle,
+                                LateralRelativePosition const &lateralPosition,
+                                Distance const &vehicleDistance,
+                                Distance &margin,
+                                DistanceGradient &marginGradient)
 {
-  if (vehicleDistance < Distance(0.))
+  if (!withinValidInputRange(vehicle) || !withinValidInputRange(otherVehicle) || (vehicleDistance < Distance(0.))
+      || ((lateralPosition != LateralRelativePosition::AtLeft)
+          && (lateralPosition != LateralRelativePosition::AtRight)))
   {
     return false;
   }
 
-  isDistanceSafe = false;
-  safeDistance = Distance::getMax();
-  bool const result = calculateSafeLateralDistance(leftVehicle, rightVehicle, safeDistance);
+  bool const isLeftVehicle = (lateralPosition == LateralRelativePosition::AtLeft);
+
+  UncheckedDistance distanceOffsetLeft = UncheckedDistance(0.);
+  UncheckedDistance distanceOffsetRight = UncheckedDistance(0.);
+  bool const result
+    = calculateVehicleDistanceTerm(
+        isLeftVehicle ? vehicle : otherVehicle, VehicleDistanceTerm::LateralStatedBrakingLeft, distanceOffsetLeft)
+    && calculateVehicleDistanceTerm(
+         isLeftVehicle ? otherVehicle : vehicle, VehicleDistanceTerm::LateralStatedBrakingRight, distanceOffsetRight);
+  if (result)
+  {
+    double const acceleration = static_cast<double>(vehicle.dynamics.alphaLat.accelMax);
+    double const deceleration = static_cast<double>(vehicle.dynamics.alphaLat.brakeMin);
+    DistanceGradient safeDistanceGradient;
+    if (isLeftVehicle)
+    {
+      safeDistanceGradient = calculateDistanceOffsetGradient(CoordinateSystemAxis::Lateral,
+                                                             static_cast<double>(vehicle.velocity.speedLat),
+                                                             static_cast<double>(vehicle.responseTime),
+                                                             acceleration,
+                                                             deceleration);
+    }
+    else
+    {
+      // the right vehicle applies the negated acceleration values and its distance offset is subtracted
+      DistanceGradient const offsetGradient
+        = calculateDistanceOffsetGradient(CoordinateSystemAxis::Lateral,
+                                          static_cast<double>(vehicle.velocity.speedLat),
+                                          static_cast<double>(vehicle.responseTime),
+                                          -acceleration,
+                                          -deceleration);
+      safeDistanceGradient.speed = Duration(-static_cast<double>(offsetGradient.speed));
+      safeDistanceGradient.acceleration = offsetGradient.acceleration;
+      safeDistanceGradient.responseTime = Speed(-static_cast<double>(offsetGradient.responseTime));
+    }
+
+    calculateMargin(vehicleDistance,
+                    distanceOffsetLeft - distanceOffsetRight,
+                    safeDistanceGradient,
+                    true,
+                    margin,
+                    marginGradient);
+  }
+  return result;
+}
 
-  if (vehicleDistance > safeDistance)
+bool calculateStopInFrontIntersectionMargin(VehicleState const &vehicle,
+                                            Distance &margin,
+                                            DistanceGradient &marginGradient)
+{
+  if (!withinValidInputRange(vehicle))
   {
-    isDistanceSafe = true;
+    return false;
   }
 
+  UncheckedDistance distanceStatedBraking = UncheckedDistance(0.);
+  bool const result
+    = calculateVehicleDistanceTerm(vehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceStatedBraking);
+  if (result)
+  {
+    calculateMargin(vehicle.distanceToEnterIntersection,
+                    distanceStatedBraking,
+                    calculateLongitudinalDistanceOffsetGradient(vehicle, vehicle.dynamics.alphaLon.brakeMin),
+                    false,
+                    margin,
+                    marginGradient);
+  }
   return result;
 }
 
@@ -36,7 +36,13 @@
 #pragma once
 
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
+#include "ad_rss/physics/DurationSquared.hpp"
+#include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/situation/LateralRelativePosition.hpp"
+#include "ad_rss/situation/LongitudinalRelativePosition.hpp"
 #include "ad_rss/situation/VehicleState.hpp"
+#include "physics/SpeedRange.hpp"
+#include "situation/SituationUncertainty.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -112,6 +118,18 @@ bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehic
                                                 physics::Distance &safeDistance,
                                                 bool &isDistanceSafe);
 
+/**
+ * @brief Check if the longitudinal distance between the two vehicles is safe without checking the vehicle states
+ *
+ * Same as checkSafeLongitudinalDistanceSameDirection(), but both vehicle states have to be already checked to be
+ * within valid input range (e.g. as part of the situation).
+ */
+bool checkSafeLongitudinalDistanceSameDirectionInputRangeChecked(VehicleState const &leadingVehicle,
+                                                                 VehicleState const &followingVehicle,
+                                                                 physics::Distance const &vehicleDistance,
+                                                                 physics::Distance &safeDistance,
+                                                                 bool &isDistanceSafe);
+
 /**
  * @brief Calculate  the safe longitudinal distance between to vehicles driving in opposite direction
  * The calculation will assume that the correctVehicle is on the correct lane
@@ -164,6 +182,19 @@ bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctV
                                                     physics::Distance &safeDistance,
                                                     bool &isDistanceSafe);
 
+/**
+ * @brief Check if the longitudinal distance between to vehicles driving in opposite direction is safe without
+ * checking the vehicle states
+ *
+ * Same as checkSafeLongitudinalDistanceOppositeDirection(), but both vehicle states have to be already checked to be
+ * within valid input range (e.g. as part of the situation).
+ */
+bool checkSafeLongitudinalDistanceOppositeDirectionInputRangeChecked(VehicleState const &correctVehicle,
+                                                                     VehicleState const &oppositeVehicle,
+                                                                     physics::Distance const &vehicleDistance,
+                                                                     physics::Distance &safeDistance,
+                                                                     bool &isDistanceSafe);
+
 /**
  * @brief Check if the vehicle can safely break longitudinaly in front of the intersection.
  *        Assuming: Using \a "stated breaking pattern" for breaking
@@ -184,6 +215,17 @@ bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctV
  */
 bool checkStopInFrontIntersection(VehicleState const &vehicle, physics::Distance &safeDistance, bool &isDistanceSafe);
 
+/**
+ * @brief Check if the vehicle can safely break longitudinaly in front of the intersection without checking the
+ * vehicle state
+ *
+ * Same as checkStopInFrontIntersection(), but the vehicle state has to be already checked to be
+ * within valid input range (e.g. as part of the situation).
+ */
+bool checkStopInFrontIntersectionInputRangeChecked(VehicleState const &vehicle,
+                                                   physics::Distance &safeDistance,
+                                                   bool &isDistanceSafe);
+
 /**
  * @brief Calculate the \a "safe lateral distance" between the two vehicles,
  *        Assuming: Both vehicles apply \a "stated breaking pattern"
@@ -244,5 +286,395 @@ bool checkSafeLateralDistance(VehicleState const &leftVehicle,
                               physics::Distance &safeDistance,
                               bool &isDistanceSafe);
 
+/**
+ * @brief Check if the lateral distance between to vehicles is safe without checking the vehicle states
+ *
+ * Same as checkSafeLateralDistance(), but both vehicle states have to be already checked to be
+ * within valid input range (e.g. as part of the situation).
+ */
+bool checkSafeLateralDistanceInputRangeChecked(VehicleState const &leftVehicle,
+                                               VehicleState const &rightVehicle,
+                                               physics::Distance const &vehicleDistance,
+                                               physics::Distance &safeDistance,
+                                               bool &isDistanceSafe);
+
+/**
+ * @brief Calculate the range of the distance offset of a vehicle when applying the \a "stated braking pattern" for a
+ *        given speed range
+ *
+ * Interval evaluation of calculateDistanceOffsetAfterStatedBrakingPattern(): the distance offset is non-decreasing
+ * in the current speed, so the resulting range contains the distance offset of every speed within \a currentSpeed.
+ *
+ * @param[in]  axis              is the coordinate axis this calculation is for
+ * @param[in]  currentSpeed      is the range of the current vehicle speed
+ * @param[in]  responseTime      is the response time of the vehicle
+ * @param[in]  acceleration      the acceleration of the vehicle during responseTime
+ * @param[in]  deceleration      is the applied breaking deceleration
+ * @param[out] distanceOffset    is the range of the distance offset of the vehicle from the current position after
+ *                               \a "the stated braking pattern"
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateDistanceOffsetAfterStatedBrakingPattern(physics::CoordinateSystemAxis const &axis,
+                                                      physics::SpeedRange const &currentSpeed,
+                                                      physics::Duration const &responseTime,
+                                                      physics::Acceleration const &acceleration,
+                                                      physics::Acceleration const &deceleration,
+                                                      physics::MetricRange &distanceOffset);
+
+/**
+ * @brief Calculate the range of the \a "safe longitudinal distance" between the two vehicles driving in same
+ *        direction for uncertain vehicle speeds
+ *
+ * Interval evaluation of calculateSafeLongitudinalDistanceSameDirection(): the speeds of the vehicle states are
+ * replaced by the ranges of the uncertainties. The resulting range contains the safe distance of every combination
+ * of speeds within the ranges; the maximum is the worst case.
+ *
+ * @param[in]  leadingVehicle          is the state of the leading vehicle
+ * @param[in]  leadingUncertainty      is the uncertainty of the leading vehicle state
+ * @param[in]  followingVehicle        is the state of the following vehicle
+ * @param[in]  followingUncertainty    is the uncertainty of the following vehicle state
+ * @param[out] safeDistance            is the range of the safe longitudinal distance
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalDistanceRangeSameDirection(VehicleState const &leadingVehicle,
+                                                         VehicleStateUncertainty const &leadingUncertainty,
+                                                         VehicleState const &followingVehicle,
+                                                         VehicleStateUncertainty const &followingUncertainty,
+                                                         physics::MetricRange &safeDistance);
+
+/**
+ * @brief Calculate the range of the safe longitudinal distance between to vehicles driving in opposite direction for
+ *        uncertain vehicle speeds
+ *
+ * Interval evaluation of calculateSafeLongitudinalDistanceOppositeDirection(), see
+ * calculateSafeLongitudinalDistanceRangeSameDirection().
+ *
+ * @param[in]  correctVehicle          is the state of the vehicle driving in the correct lane
+ * @param[in]  correctUncertainty      is the uncertainty of the correct vehicle state
+ * @param[in]  oppositeVehicle         is the state of the vehicle driving in the wrong lane
+ * @param[in]  oppositeUncertainty     is the uncertainty of the opposite vehicle state
+ * @param[out] safeDistance            is the range of the safe longitudinal distance
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalDistanceRangeOppositeDirection(VehicleState const &correctVehicle,
+                                                             VehicleStateUncertainty const &correctUncertainty,
+                                                             VehicleState const &oppositeVehicle,
+                                                             VehicleStateUncertainty const &oppositeUncertainty,
+                                                             physics::MetricRange &safeDistance);
+
+/**
+ * @brief Calculate the range of the \a "safe lateral distance" between the two vehicles for uncertain vehicle speeds
+ *
+ * Interval evaluation of calculateSafeLateralDistance(), see
+ * calculateSafeLongitudinalDistanceRangeSameDirection().
+ *
+ * @param[in]  leftVehicle          is the state of the left vehicle
+ * @param[in]  leftUncertainty      is the uncertainty of the left vehicle state
+ * @param[in]  rightVehicle         is the state of the right vehicle
+ * @param[in]  rightUncertainty     is the uncertainty of the right vehicle state
+ * @param[out] safeDistance         is the range of the safe lateral distance
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLateralDistanceRange(VehicleState const &leftVehicle,
+                                       VehicleStateUncertainty const &leftUncertainty,
+                                       VehicleState const &rightVehicle,
+                                       VehicleStateUncertainty const &rightUncertainty,
+                                       physics::MetricRange &safeDistance);
+
+/**
+ * @brief Check if the vehicle can safely break longitudinaly in front of the intersection for an uncertain vehicle
+ *        speed
+ *
+ * Interval evaluation of checkStopInFrontIntersection(): the distance is only considered to be safe if it is safe
+ * for every speed within the uncertainty.
+ *
+ * @param[in]  vehicle             is the state of the vehicle
+ * @param[in]  uncertainty         is the uncertainty of the vehicle state
+ * @param[out] safeDistance        the worst case safe distance according to the stated braking pattern
+ * @param[out] isDistanceSafe      true if the distance is safe, false otherwise
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool checkStopInFrontIntersection(VehicleState const &vehicle,
+                                  VehicleStateUncertainty const &uncertainty,
+                                  physics::Distance &safeDistance,
+                                  bool &isDistanceSafe);
+
+
+/**
+ * @brief Calculate the maximum acceleration of a vehicle applying the \a "stated braking pattern" such that its
+ *        distance offset doesn't exceed a given maximum
+ *
+ * Inverse of calculateDistanceOffsetAfterStatedBrakingPattern() with respect to the acceleration during the response
+ * time, evaluated in closed form. The distance offset is non-decreasing in the acceleration. Therefore, the distance
+ * offset for every acceleration <= maxAcceleration doesn't exceed the maximum distance offset.
+ *
+ * A negative maximum acceleration indicates that the vehicle has to decelerate already during the response time.
+ * If even an immediate longitudinal stop exceeds the maximum distance offset, the lowest acceleration is returned.
+ *
+ * @param[in]  axis                  is the respective axis: longitudinal or lateral
+ * @param[in]  currentSpeed          is the current vehicle speed
+ * @param[in]  responseTime          is the response time of the vehicle, > 0
+ * @param[in]  deceleration          is the positive deceleration applied after the response time
+ * @param[in]  maxDistanceOffset     is the maximum distance offset
+ * @param[out] maxAcceleration       is the maximum acceleration during the response time
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateMaxAccelerationForDistanceOffset(physics::CoordinateSystemAxis const &axis,
+                                               physics::Speed const &currentSpeed,
+                                               physics::Duration const &responseTime,
+                                               physics::Acceleration const &deceleration,
+                                               physics::Distance const &maxDistanceOffset,
+                                               physics::Acceleration &maxAcceleration);
+
+/**
+ * @brief Calculate the maximum current speed of a vehicle applying the \a "stated braking pattern" such that its
+ *        distance offset doesn't exceed a given maximum
+ *
+ * Inverse of calculateDistanceOffsetAfterStatedBrakingPattern() with respect to the current speed, evaluated in
+ * closed form. The distance offset is non-decreasing in the current speed. Therefore, the distance offset for every
+ * speed <= maxSpeed doesn't exceed the maximum distance offset.
+ *
+ * The calculation covers both axes: in longitudinal direction, a negative maximum speed indicates that the maximum
+ * distance offset is exceeded even when the vehicle is standing still.
+ *
+ * @param[in]  acceleration          is the acceleration during the response time, >= 0
+ * @param[in]  responseTime          is the response time of the vehicle, > 0
+ * @param[in]  deceleration          is the positive deceleration applied after the response time
+ * @param[in]  maxDistanceOffset     is the maximum distance offset
+ * @param[out] maxSpeed              is the maximum current speed
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateMaxSpeedForDistanceOffset(physics::Acceleration const &acceleration,
+                                        physics::Duration const &responseTime,
+                                        physics::Acceleration const &deceleration,
+                                        physics::Distance const &maxDistanceOffset,
+                                        physics::Speed &maxSpeed);
+
+/**
+ * @brief Calculate the limits of the following vehicle keeping the longitudinal distance between two vehicles driving
+ *        in same direction safe
+ *
+ * Inverse of checkSafeLongitudinalDistanceSameDirection() with respect to the maximum longitudinal acceleration and
+ * the longitudinal speed of the following vehicle: the distance is safe as long as
+ * followingVehicle.dynamics.alphaLon.accelMax <= maxAcceleration and followingVehicle.velocity.speedLon <= maxSpeed
+ * (each one with the other value unchanged).
+ *
+ * @param[in]  leadingVehicle        the state of the leading vehicle
+ * @param[in]  followingVehicle      the state of the following vehicle
+ * @param[in]  vehicleDistance       the (positive) distance between the two vehicles
+ * @param[out] maxAcceleration       the maximum longitudinal acceleration of the following vehicle
+ *                                   (see calculateMaxAccelerationForDistanceOffset())
+ * @param[out] maxSpeed              the maximum longitudinal speed of the following vehicle
+ *                                   (see calculateMaxSpeedForDistanceOffset())
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalLimitsSameDirection(VehicleState const &leadingVehicle,
+                                                  VehicleState const &followingVehicle,
+                                                  physics::Distance const &vehicleDistance,
+                                                  physics::Acceleration &maxAcceleration,
+                                                  physics::Speed &maxSpeed);
+
+/**
+ * @brief Calculate the limits of a vehicle keeping the longitudinal distance to a vehicle driving in opposite
+ *        direction safe
+ *
+ * Inverse of checkSafeLongitudinalDistanceOppositeDirection() with respect to the maximum longitudinal acceleration
+ * and the longitudinal speed of the vehicle. The vehicle is considered to be the correct vehicle if it is in its
+ * correct lane, otherwise the other vehicle is the correct one.
+ *
+ * @param[in]  vehicle               the state of the vehicle to be limited
+ * @param[in]  otherVehicle          the state of the vehicle driving in opposite direction
+ * @param[in]  vehicleDistance       the (positive) distance between the two vehicles
+ * @param[out] maxAcceleration       the maximum longitudinal acceleration of the vehicle
+ * @param[out] maxSpeed              the maximum longitudinal speed of the vehicle
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalLimitsOppositeDirection(VehicleState const &vehicle,
+                                                      VehicleState const &otherVehicle,
+                                                      physics::Distance const &vehicleDistance,
+                                                      physics::Acceleration &maxAcceleration,
+                                                      physics::Speed &maxSpeed);
+
+/**
+ * @brief Calculate the limits of a vehicle keeping the lateral distance to another vehicle safe
+ *
+ * Inverse of checkSafeLateralDistance() with respect to the maximum lateral acceleration and the lateral speed of the
+ * vehicle. The lateral speed is limited from above if the vehicle is the left one and from below if the vehicle is
+ * the right one.
+ *
+ * @param[in]  vehicle               the state of the vehicle to be limited
+ * @param[in]  otherVehicle          the state of the other vehicle
+ * @param[in]  lateralPosition       the lateral position of the vehicle relative to the other vehicle:
+ *                                   AtLeft or AtRight
+ * @param[in]  vehicleDistance       the (positive) lateral distance between the two vehicles
+ * @param[out] maxAcceleration       the maximum lateral acceleration of the vehicle
+ * @param[out] speedRange            the range of the lateral speed of the vehicle
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLateralLimits(VehicleState const &vehicle,
+                                VehicleState const &otherVehicle,
+                                LateralRelativePosition const &lateralPosition,
+                                physics::Distance const &vehicleDistance,
+                                physics::Acceleration &maxAcceleration,
+                                physics::SpeedRange &speedRange);
+
+/**
+ * @brief Calculate the limits of a vehicle keeping it able to safely break longitudinaly in front of the intersection
+ *
+ * Inverse of checkStopInFrontIntersection() with respect to the maximum longitudinal acceleration and the longitudinal
+ * speed of the vehicle.
+ *
+ * @param[in]  vehicle               the state of the vehicle
+ * @param[out] maxAcceleration       the maximum longitudinal acceleration of the vehicle
+ * @param[out] maxSpeed              the maximum longitudinal speed of the vehicle
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateStopInFrontIntersectionLimits(VehicleState const &vehicle,
+                                            physics::Acceleration &maxAcceleration,
+                                            physics::Speed &maxSpeed);
+
+
+/**
+ * @brief The partial derivatives of a distance with respect to the state of a vehicle
+ */
+struct DistanceGradient
+{
+  /**
+   * @brief the partial derivative with respect to the speed of the vehicle
+   */
+  physics::Duration speed{0.};
+
+  /**
+   * @brief the partial derivative with respect to the acceleration of the vehicle during the response time
+   */
+  physics::DurationSquared acceleration{0.};
+
+  /**
+   * @brief the partial derivative with respect to the response time of the vehicle
+   */
+  physics::Speed responseTime{0.};
+};
+
+/**
+ * @brief Calculate the partial derivatives of the distance offset of a vehicle when applying the \a "stated braking
+ *        pattern"
+ *
+ * Closed form derivatives of calculateDistanceOffsetAfterStatedBrakingPattern() with respect to the current speed,
+ * the acceleration and the response time. The distance offset is continuously differentiable in these values.
+ *
+ * @param[in]  axis                  is the respective axis: longitudinal or lateral
+ * @param[in]  currentSpeed          is the current vehicle speed
+ * @param[in]  responseTime          is the response time of the vehicle
+ * @param[in]  acceleration          the acceleration of the vehicle during responseTime
+ * @param[in]  deceleration          is the applied breaking deceleration
+ * @param[out] gradient              the partial derivatives of the distance offset
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateDistanceOffsetGradientAfterStatedBrakingPattern(physics::CoordinateSystemAxis const &axis,
+                                                              physics::Speed const &currentSpeed,
+                                                              physics::Duration const &responseTime,
+                                                              physics::Acceleration const &acceleration,
+                                                              physics::Acceleration const &deceleration,
+                                                              DistanceGradient &gradient);
+
+/**
+ * @brief Calculate the margin of the longitudinal distance between two vehicles driving in same direction and its
+ *        gradient with respect to the state of a vehicle
+ *
+ * The margin is the vehicle distance minus the safe distance of checkSafeLongitudinalDistanceSameDirection(), so the
+ * distance is safe if the margin is at least Distance::cPrecisionValue. The gradient refers to the longitudinal speed,
+ * the maximum longitudinal acceleration and the response time of the vehicle. As long as the safe distance is zero,
+ * the gradient is zero as well.
+ *
+ * @param[in]  vehicle               the state of the vehicle the gradient refers to
+ * @param[in]  otherVehicle          the state of the other vehicle
+ * @param[in]  longitudinalPosition  the longitudinal position of the vehicle relative to the other vehicle:
+ *                                   the vehicle is leading if InFront or OverlapFront, otherwise following
+ * @param[in]  vehicleDistance       the (positive) distance between the two vehicles
+ * @param[out] margin                the margin of the vehicle distance
+ * @param[out] marginGradient        the gradient of the margin
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalMarginSameDirection(VehicleState const &vehicle,
+                                                  VehicleState const &otherVehicle,
+                                                  LongitudinalRelativePosition const &longitudinalPosition,
+                                                  physics::Distance const &vehicleDistance,
+                                                  physics::Distance &margin,
+                                                  DistanceGradient &marginGradient);
+
+/**
+ * @brief Calculate the margin of the longitudinal distance between two vehicles driving in opposite direction and its
+ *        gradient with respect to the state of a vehicle
+ *
+ * See calculateSafeLongitudinalMarginSameDirection(). The vehicle is considered to be the correct vehicle if it is in
+ * its correct lane, otherwise the other vehicle is the correct one.
+ *
+ * @param[in]  vehicle               the state of the vehicle the gradient refers to
+ * @param[in]  otherVehicle          the state of the vehicle driving in opposite direction
+ * @param[in]  vehicleDistance       the (positive) distance between the two vehicles
+ * @param[out] margin                the margin of the vehicle distance
+ * @param[out] marginGradient        the gradient of the margin
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalMarginOppositeDirection(VehicleState const &vehicle,
+                                                      VehicleState const &otherVehicle,
+                                                      physics::Distance const &vehicleDistance,
+                                                      physics::Distance &margin,
+                                                      DistanceGradient &marginGradient);
+
+/**
+ * @brief Calculate the margin of the lateral distance between two vehicles and its gradient with respect to the state
+ *        of a vehicle
+ *
+ * See calculateSafeLongitudinalMarginSameDirection(). The gradient refers to the lateral speed, the maximum lateral
+ * acceleration and the response time of the vehicle.
+ *
+ * @param[in]  vehicle               the state of the vehicle the gradient refers to
+ * @param[in]  otherVehicle          the state of the other vehicle
+ * @param[in]  lateralPosition       the lateral position of the vehicle relative to the other vehicle:
+ *                                   AtLeft or AtRight
+ * @param[in]  vehicleDistance       the (positive) lateral distance between the two vehicles
+ * @param[out] margin                the margin of the vehicle distance
+ * @param[out] marginGradient        the gradient of the margin
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLateralMargin(VehicleState const &vehicle,
+                                VehicleState const &otherVehicle,
+                                LateralRelativePosition const &lateralPosition,
+                                physics::Distance const &vehicleDistance,
+                                physics::Distance &margin,
+                                DistanceGradient &marginGradient);
+
+/**
+ * @brief Calculate the margin of the distance of a vehicle to the intersection and its gradient with respect to the
+ *        state of the vehicle
+ *
+ * The margin is the distance to enter the intersection minus the safe distance of checkStopInFrontIntersection().
+ *
+ * @param[in]  vehicle               the state of the vehicle
+ * @param[out] margin                the margin of the distance to enter the intersection
+ * @param[out] marginGradient        the gradient of the margin
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateStopInFrontIntersectionMargin(VehicleState const &vehicle,
+                                            physics::Distance &margin,
+                                            DistanceGradient &marginGradient);
+
 } // namespace situation
 } // namespace ad_rss
@@ -0,0 +1,371 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include "physics/Unchecked.hpp"
+#include "situation/RssFormulas.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief the distance terms of the safe distance calculations depending on the state of a single vehicle only
+ */
+enum class VehicleDistanceTerm
+{
+  LongitudinalStatedBrakingMin,        /*!< longitudinal stated braking pattern with brakeMin */
+  LongitudinalStatedBrakingMinCorrect, /*!< longitudinal stated braking pattern with brakeMinCorrect */
+  LongitudinalStoppingMax,             /*!< longitudinal stopping distance with brakeMax */
+  LateralStatedBrakingLeft,            /*!< lateral stated braking pattern of the left vehicle */
+  LateralStatedBrakingRight,           /*!< lateral stated braking pattern of the right vehicle */
+  Count                                /*!< the number of terms */
+};
+
+/**
+ * @brief Calculate a distance term of a vehicle
+ *
+ * @param[in]  vehicle  the vehicle state, already checked to be within valid input range
+ * @param[in]  term     the term to calculate
+ * @param[out] distance the calculated distance
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateVehicleDistanceTerm(VehicleState const &vehicle,
+                                  VehicleDistanceTerm const term,
+                                  physics::UncheckedDistance &distance);
+
+/**
+ * @brief implementation of calculateSafeLongitudinalDistanceSameDirection() for a given distance term calculation
+ *
+ * The vehicle states have to be already checked to be within valid input range. The distance terms are provided by
+ * \a calculateDistanceTerm with the signature of calculateVehicleDistanceTerm().
+ */
+template <typename DistanceTermCalculation>
+bool calculateSafeLongitudinalDistanceSameDirectionT(VehicleState const &leadingVehicle,
+                                                     VehicleState const &followingVehicle,
+                                                     physics::Distance &safeDistance,
+                                                     DistanceTermCalculation const &calculateDistanceTerm)
+{
+  physics::UncheckedDistance distanceStatedBraking = physics::UncheckedDistance(0.);
+  bool result = calculateDistanceTerm(
+    followingVehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceStatedBraking);
+
+  physics::UncheckedDistance distanceMaxBrake = physics::UncheckedDistance(0.);
+  result
+    = result && calculateDistanceTerm(leadingVehicle, VehicleDistanceTerm::LongitudinalStoppingMax, distanceMaxBrake);
+
+  if (result)
+  {
+    safeDistance = (distanceStatedBraking - distanceMaxBrake).toChecked();
+    safeDistance = std::max(safeDistance, physics::Distance(0.));
+  }
+
+  return result;
+}
+
+/**
+ * @brief implementation of calculateSafeLongitudinalDistanceOppositeDirection() for a given distance term
+ * calculation
+ *
+ * The vehicle states have to be already checked to be within valid input range. The distance terms are provided by
+ * \a calculateDistanceTerm with the signature of calculateVehicleDistanceTerm().
+ */
+template <typename DistanceTermCalculation>
+bool calculateSafeLongitudinalDistanceOppositeDirectionT(VehicleState const &correctVehicle,
+                                                         VehicleState const &oppositeVehicle,
+                                                         physics::Distance &safeDistance,
+                                                         DistanceTermCalculation const &calculateDistanceTerm)
+{
+  physics::UncheckedDistance distanceStatedBrakingCorrect = physics::UncheckedDistance(0.);
+  bool result = calculateDistanceTerm(
+    correctVehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMinCorrect, distanceStatedBrakingCorrect);
+
+  physics::UncheckedDistance distanceStatedBrakingOpposite = physics::UncheckedDistance(0.);
+  result = result
+    && calculateDistanceTerm(
+             oppositeVehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceStatedBrakingOpposite);
+
+  if (result)
+  {
+    safeDistance = (distanceStatedBrakingCorrect + distanceStatedBrakingOpposite).toChecked();
+  }
+
+  return result;
+}
+
+/**
+ * @brief implementation of calculateSafeLateralDistance() for a given distance term calculation
+ *
+ * The vehicle states have to be already checked to be within valid input range. The distance terms are provided by
+ * \a calculateDistanceTerm with the signature of calculateVehicleDistanceTerm().
+ */
+template <typename DistanceTermCalculation>
+bool calculateSafeLateralDistanceT(VehicleState const &leftVehicle,
+                                   VehicleState const &rightVehicle,
+                                   physics::Distance &safeDistance,
+                                   DistanceTermCalculation const &calculateDistanceTerm)
+{
+  physics::UncheckedDistance distanceOffsetStatedBrakingLeft = physics::UncheckedDistance(0.);
+  bool result = calculateDistanceTerm(
+    leftVehicle, VehicleDistanceTerm::LateralStatedBrakingLeft, distanceOffsetStatedBrakingLeft);
+
+  physics::UncheckedDistance distanceOffsetStatedBrakingRight = physics::UncheckedDistance(0.);
+  result = result && calculateDistanceTerm(
+                       rightVehicle, VehicleDistanceTerm::LateralStatedBrakingRight, distanceOffsetStatedBrakingRight);
+
+  if (result)
+  {
+    // safe distance is the difference of both distances
+    // Note: The fluctuation margin is already considered in the vehicle bounding boxes
+    safeDistance = (distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight).toChecked();
+    safeDistance = std::max(safeDistance, physics::Distance(0.));
+  }
+  return result;
+}
+
+/**
+ * @brief compare the vehicle distance with the safe distance provided by the given calculation
+ *
+ * @param[in] calculateSafeDistance the safe distance calculation with the signature of
+ * calculateSafeLongitudinalDistanceSameDirection()
+ */
+template <typename SafeDistanceCalculation>
+bool checkSafeDistanceT(SafeDistanceCalculation const &calculateSafeDistance,
+                        VehicleState const &firstVehicle,
+                        VehicleState const &secondVehicle,
+                        physics::Distance const &vehicleDistance,
+                        physics::Distance &safeDistance,
+                        bool &isDistanceSafe)
+{
+  if (vehicleDistance < physics::Distance(0.))
+  {
+    return false;
+  }
+
+  isDistanceSafe = false;
+  safeDistance = physics::Distance::getMax();
+
+  bool const result = calculateSafeDistance(firstVehicle, secondVehicle, safeDistance);
+
+  if (vehicleDistance > safeDistance)
+  {
+    isDistanceSafe = true;
+  }
+  return result;
+}
+
+/**
+ * @brief implementation of checkSafeLongitudinalDistanceSameDirectionInputRangeChecked() for a given distance term
+ * calculation
+ */
+template <typename DistanceTermCalculation>
+bool checkSafeLongitudinalDistanceSameDirectionT(VehicleState const &leadingVehicle,
+                                                 VehicleState const &followingVehicle,
+                                                 physics::Distance const &vehicleDistance,
+                                                 physics::Distance &safeDistance,
+                                                 bool &isDistanceSafe,
+                                                 DistanceTermCalculation const &calculateDistanceTerm)
+{
+  return checkSafeDistanceT(
+    [&calculateDistanceTerm](VehicleState const &leading, VehicleState const &following, physics::Distance &distance) {
+      return calculateSafeLongitudinalDistanceSameDirectionT(leading, following, distance, calculateDistanceTerm);
+    },
+    leadingVehicle,
+    followingVehicle,
+    vehicleDistance,
+    safeDistance,
+    isDistanceSafe);
+}
+
+/**
+ * @brief implementation of checkSafeLongitudinalDistanceOppositeDirectionInputRangeChecked() for a given distance
+ * term calculation
+ */
+template <typename DistanceTermCalculation>
+bool checkSafeLongitudinalDistanceOppositeDirectionT(VehicleState const &correctVehicle,
+                                                     VehicleState const &oppositeVehicle,
+                                                     physics::Distance const &vehicleDistance,
+                                                     physics::Distance &safeDistance,
+                                                     bool &isDistanceSafe,
+                                                     DistanceTermCalculation const &calculateDistanceTerm)
+{
+  return checkSafeDistanceT(
+    [&calculateDistanceTerm](VehicleState const &correct, VehicleState const &opposite, physics::Distance &distance) {
+      return calculateSafeLongitudinalDistanceOppositeDirectionT(correct, opposite, distance, calculateDistanceTerm);
+    },
+    correctVehicle,
+    oppositeVehicle,
+    vehicleDistance,
+    safeDistance,
+    isDistanceSafe);
+}
+
+/**
+ * @brief implementation of checkSafeLateralDistanceInputRangeChecked() for a given distance term calculation
+ */
+template <typename DistanceTermCalculation>
+bool checkSafeLateralDistanceT(VehicleState const &leftVehicle,
+                               VehicleState const &rightVehicle,
+                               physics::Distance const &vehicleDistance,
+                               physics::Distance &safeDistance,
+                               bool &isDistanceSafe,
+                               DistanceTermCalculation const &calculateDistanceTerm)
+{
+  return checkSafeDistanceT(
+    [&calculateDistanceTerm](VehicleState const &left, VehicleState const &right, physics::Distance &distance) {
+      return calculateSafeLateralDistanceT(left, right, distance, calculateDistanceTerm);
+    },
+    leftVehicle,
+    rightVehicle,
+    vehicleDistance,
+    safeDistance,
+    isDistanceSafe);
+}
+
+/**
+ * @brief implementation of checkStopInFrontIntersectionInputRangeChecked() for a given distance term calculation
+ */
+template <typename DistanceTermCalculation>
+bool checkStopInFrontIntersectionT(VehicleState const &vehicle,
+                                   physics::Distance &safeDistance,
+                                   bool &isDistanceSafe,
+                                   DistanceTermCalculation const &calculateDistanceTerm)
+{
+  isDistanceSafe = false;
+
+  safeDistance = physics::Distance(0.);
+  physics::UncheckedDistance distanceOffset = physics::UncheckedDistance(0.);
+  bool const result = calculateDistanceTerm(vehicle, VehicleDistanceTerm::LongitudinalStatedBrakingMin, distanceOffset);
+  if (result)
+  {
+    safeDistance = distanceOffset.toChecked();
+  }
+
+  if (safeDistance < vehicle.distanceToEnterIntersection)
+  {
+    isDistanceSafe = true;
+  }
+
+  return result;
+}
+
+/**
+ * @brief the distance term calculation of the interval evaluation
+ *
+ * All distance terms are non-decreasing in the speed of the vehicle. The safe distance calculations either add a
+ * term to or subtract a term from the safe distance. Therefore, the lower and upper bound of the safe distance for
+ * uncertain speeds are obtained by calculating each term with the appropriate border of the speed range.
+ *
+ * The vehicle state provided to the calculation is identified by its address: the uncertainty of the first vehicle
+ * is applied to the first vehicle state the object is constructed with, the one of the second vehicle otherwise.
+ */
+class DistanceTermBoundCalculation
+{
+public:
+  DistanceTermBoundCalculation(VehicleState const &firstVehicle,
+                               VehicleStateUncertainty const &firstUncertainty,
+                               VehicleStateUncertainty const &secondUncertainty,
+                               bool const upperBound)
+    : mFirstVehicle(firstVehicle)
+    , mFirstUncertainty(firstUncertainty)
+    , mSecondUncertainty(secondUncertainty)
+    , mUpperBound(upperBound)
+  {
+  }
+
+  bool operator()(VehicleState const &vehicle,
+                  VehicleDistanceTerm const term,
+                  physics::UncheckedDistance &distance) const
+  {
+    VehicleStateUncertainty const &uncertainty = (&vehicle == &mFirstVehicle) ? mFirstUncertainty : mSecondUncertainty;
+    bool const useMaximumSpeed = (addsToSafeDistance(term) == mUpperBound);
+
+    VehicleState boundVehicle = vehicle;
+    boundVehicle.velocity.speedLon = useMaximumSpeed ? uncertainty.speedLon.maximum : uncertainty.speedLon.minimum;
+    boundVehicle.velocity.speedLat = useMaximumSpeed ? uncertainty.speedLat.maximum : uncertainty.speedLat.minimum;
+    return calculateVehicleDistanceTerm(boundVehicle, term, distance);
+  }
+
+private:
+  static bool addsToSafeDistance(VehicleDistanceTerm const term)
+  {
+    return (term != VehicleDistanceTerm::LongitudinalStoppingMax)
+      && (term != VehicleDistanceTerm::LateralStatedBrakingRight);
+  }
+
+  VehicleState const &mFirstVehicle;
+  VehicleStateUncertainty const &mFirstUncertainty;
+  VehicleStateUncertainty const &mSecondUncertainty;
+  bool const mUpperBound;
+};
+
+/**
+ * @brief implementation of the interval evaluation of a safe distance calculation
+ *
+ * The vehicle states and their uncertainties have to be already checked to be within valid input range.
+ *
+ * @param[in] calculateSafeDistance the safe distance calculation, e.g.
+ * calculateSafeLongitudinalDistanceSameDirectionT<DistanceTermBoundCalculation>
+ */
+template <typename SafeDistanceCalculation>
+bool calculateSafeDistanceRangeT(SafeDistanceCalculation const &calculateSafeDistance,
+                                 VehicleState const &firstVehicle,
+                                 VehicleStateUncertainty const &firstUncertainty,
+                                 VehicleState const &secondVehicle,
+                                 VehicleStateUncertainty const &secondUncertainty,
+                                 physics::MetricRange &safeDistance)
+{
+  DistanceTermBoundCalculation const lowerBoundCalculation(firstVehicle, firstUncertainty, secondUncertainty, false);
+  DistanceTermBoundCalculation const upperBoundCalculation(firstVehicle, firstUncertainty, secondUncertainty, true);
+
+  physics::MetricRange resultRange;
+  bool const result = calculateSafeDistance(firstVehicle, secondVehicle, resultRange.minimum, lowerBoundCalculation)
+    && calculateSafeDistance(firstVehicle, secondVehicle, resultRange.maximum, upperBoundCalculation);
+  if (result)
+  {
+    safeDistance = resultRange;
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -33,7 +33,9 @@
 #include <cmath>
 #include <limits>
 #include "physics/Math.hpp"
+#include "situation/RssEgoVehicleTerms.hpp"
 #include "situation/RssFormulas.hpp"
+#include "situation/RssFormulasT.hpp"
 #include "situation/RssSituation.hpp"
 
 namespace ad_rss {
@@ -48,11 +50,9 @@ RssIntersectionChecker::RssIntersectionChecker()
 
 RssIntersectionChecker::~RssIntersectionChecker()
 {
-  mLastSafeStateMap.clear();
-  mCurrentSafeStateMap.clear();
 }
 
-bool checkLateralIntersect(Situation const &situation, bool &isSafe)
+bool checkLateralIntersect(Situation const &situation, RssEgoVehicleTerms const &egoVehicleTerms, bool &isSafe)
 {
   isSafe = false;
 
@@ -66,12 +66,24 @@ bool checkLateralIntersect(Situation const &situation, bool &isSafe)
   Duration timeToLeaveEgo;
   Duration timeToLeaveOther;
 
-  bool result = calculateTimeToCoverDistance(situation.egoVehicleState.velocity.speedLon,
-                                             situation.egoVehicleState.responseTime,
-                                             situation.egoVehicleState.dynamics.alphaLon.accelMax,
-                                             situation.egoVehicleState.dynamics.alphaLon.brakeMin,
-                                             situation.egoVehicleState.distanceToEnterIntersection,
-                                             timeToReachEgo);
+  bool const useEgoVehicleTerms = egoVehicleTerms.isCalculatedFor(situation.egoVehicleState);
+
+  bool result = false;
+  if (useEgoVehicleTerms)
+  {
+    result = calculateTimeToCoverDistance(egoVehicleTerms.getTimeToEnterIntersectionTerms(),
+                                          situation.egoVehicleState.distanceToEnterIntersection,
+                                          timeToReachEgo);
+  }
+  else
+  {
+    result = calculateTimeToCoverDistance(situation.egoVehicleState.velocity.speedLon,
+                                          situation.egoVehicleState.responseTime,
+                                          situation.egoVehicleState.dynamics.alphaLon.accelMax,
+                                          situation.egoVehicleState.dynamics.alphaLon.brakeMin,
+                                          situation.egoVehicleState.distanceToEnterIntersection,
+                                          timeToReachEgo);
+  }
 
   result = result && calculateTimeToCoverDistance(situation.otherVehicleState.velocity.speedLon,
                                                   situation.otherVehicleState.responseTime,
@@ -80,12 +92,21 @@ bool checkLateralIntersect(Situation const &situation, bool &isSafe)
                                                   situation.otherVehicleState.distanceToEnterIntersection,
                                                   timeToReachOther);
 
-  result = result && calculateTimeToCoverDistance(situation.egoVehicleState.velocity.speedLon,
-                                                  situation.egoVehicleState.responseTime,
-                                                  -1. * situation.egoVehicleState.dynamics.alphaLon.brakeMax,
-                                                  situation.egoVehicleState.dynamics.alphaLon.brakeMax,
-                                                  situation.egoVehicleState.distanceToLeaveIntersection,
-                                                  timeToLeaveEgo);
+  if (result && useEgoVehicleTerms)
+  {
+    result = calculateTimeToCoverDistance(egoVehicleTerms.getTimeToLeaveIntersectionTerms(),
+                                          situation.egoVehicleState.distanceToLeaveIntersection,
+                                          timeToLeaveEgo);
+  }
+  else if (result)
+  {
+    result = calculateTimeToCoverDistance(situation.egoVehicleState.velocity.speedLon,
+                                          situation.egoVehicleState.responseTime,
+                                          -1. * situation.egoVehicleState.dynamics.alphaLon.brakeMax,
+                                          situation.egoVehicleState.dynamics.alphaLon.brakeMax,
+                                          situation.egoVehicleState.distanceToLeaveIntersection,
+                                          timeToLeaveEgo);
+  }
 
   result = result && calculateTimeToCoverDistance(situation.otherVehicleState.velocity.speedLon,
                                                   situation.otherVehicleState.responseTime,
@@ -112,6 +133,7 @@ bool checkLateralIntersect(Situation const &situation, bool &isSafe)
 }
 
 bool checkIntersectionSafe(Situation const &situation,
+                           RssEgoVehicleTerms const &egoVehicleTerms,
                            ::ad_rss::state::ResponseInformation &responseInformation,
                            bool &isSafe,
                            IntersectionState &intersectionState)
@@ -126,6 +148,8 @@ bool checkIntersectionSafe(Situation const &situation,
   bool result = true;
   isSafe = false;
 
+  EgoVehicleDistanceTermCalculation const calculateDistanceTerm(egoVehicleTerms, situation);
+
   /**
    * Check if a non prio vehicle has safe distance to the intersection
    */
@@ -133,13 +157,15 @@ bool checkIntersectionSafe(Situation const &situation,
   {
     responseInformation.responseEvaluator = state::ResponseEvaluator::IntersectionOtherPriorityEgoAbleToStop;
     responseInformation.currentDistance = situation.egoVehicleState.distanceToEnterIntersection;
-    result = checkStopInFrontIntersection(situation.egoVehicleState, responseInformation.safeDistance, isSafe);
+    result = checkStopInFrontIntersectionT(
+      situation.egoVehicleState, responseInformation.safeDistance, isSafe, calculateDistanceTerm);
   }
   if (result && !isSafe && !situation.otherVehicleState.hasPriority)
   {
     responseInformation.responseEvaluator = state::ResponseEvaluator::IntersectionEgoPriorityOtherAbleToStop;
     responseInformation.currentDistance = situation.otherVehicleState.distanceToEnterIntersection;
-    result = checkStopInFrontIntersection(situation.otherVehicleState, responseInformation.safeDistance, isSafe);
+    result = checkStopInFrontIntersectionT(
+      situation.otherVehicleState, responseInformation.safeDistance, isSafe, calculateDistanceTerm);
   }
 
   if (isSafe)
@@ -155,20 +181,22 @@ bool checkIntersectionSafe(Situation const &situation,
     if (situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront)
     {
       responseInformation.responseEvaluator = state::ResponseEvaluator::IntersectionEgoInFront;
-      result = checkSafeLongitudinalDistanceSameDirection(situation.egoVehicleState,
-                                                          situation.otherVehicleState,
-                                                          situation.relativePosition.longitudinalDistance,
-                                                          responseInformation.safeDistance,
-                                                          isSafe);
+      result = checkSafeLongitudinalDistanceSameDirectionT(situation.egoVehicleState,
+                                                           situation.otherVehicleState,
+                                                           situation.relativePosition.longitudinalDistance,
+                                                           responseInformation.safeDistance,
+                                                           isSafe,
+                                                           calculateDistanceTerm);
     }
     else
     {
       responseInformation.responseEvaluator = state::ResponseEvaluator::IntersectionOtherInFront;
-      result = checkSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
-                                                          situation.egoVehicleState,
-                                                          situation.relativePosition.longitudinalDistance,
-                                                          responseInformation.safeDistance,
-                                                          isSafe);
+      result = checkSafeLongitudinalDistanceSameDirectionT(situation.otherVehicleState,
+                                                           situation.egoVehicleState,
+                                                           situation.relativePosition.longitudinalDistance,
+                                                           responseInformation.safeDistance,
+                                                           isSafe,
+                                                           calculateDistanceTerm);
     }
     if (isSafe)
     {
@@ -179,7 +207,7 @@ bool checkIntersectionSafe(Situation const &situation,
       responseInformation.responseEvaluator = state::ResponseEvaluator::IntersectionOverlap;
       responseInformation.currentDistance = physics::Distance(0.);
       responseInformation.safeDistance = physics::Distance(0.);
-      result = checkLateralIntersect(situation, isSafe);
+      result = checkLateralIntersect(situation, egoVehicleTerms, isSafe);
 
       if (isSafe)
       {
@@ -191,7 +219,9 @@ bool checkIntersectionSafe(Situation const &situation,
   return result;
 }
 
-bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situation, state::ResponseState &rssState)
+bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situation,
+                                                           RssEgoVehicleTerms const &egoVehicleTerms,
+                                                           state::ResponseState &rssState)
 {
   if (situation.egoVehicleState.hasPriority && situation.otherVehicleState.hasPriority)
   {
@@ -199,15 +229,14 @@ bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situ
     return false;
   }
   bool result = false;
-  try
+  AD_RSS_TRY
   {
     if (situation.timeIndex != mCurrentTimeIndex)
     {
       /**
-       * next time step: current safe state map becomes last state now
+       * next time step: current safe states become the last states now
        */
-      mLastSafeStateMap.swap(mCurrentSafeStateMap);
-      mCurrentSafeStateMap.clear();
+      mSafeStateTable.nextGeneration();
       mCurrentTimeIndex = situation.timeIndex;
     }
 
@@ -235,23 +264,25 @@ bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situ
     /**
      * Check if the intersection is safe and determine the intersection state of the situation
      */
-    result
-      = checkIntersectionSafe(situation, rssState.longitudinalState.responseInformation, isSafe, intersectionState);
+    result = checkIntersectionSafe(
+      situation, egoVehicleTerms, rssState.longitudinalState.responseInformation, isSafe, intersectionState);
+    // a failing calculation must not update the safe state table
+    result = result && !physics::rangeErrorRaised();
 
     if (result)
     {
       rssState.longitudinalState.isSafe = isSafe;
 
-      auto const previousIntersectionState = mLastSafeStateMap.find(situation.situationId);
+      auto const previousIntersectionState = mSafeStateTable.findPrevious(situation.situationId);
 
       if (!isSafe)
       {
         /**
          * Situation is unsafe determine proper response
          */
-        if (previousIntersectionState != mLastSafeStateMap.end())
+        if (previousIntersectionState != nullptr)
         {
-          switch (previousIntersectionState->second)
+          switch (*previousIntersectionState)
           {
             case IntersectionState::NonPrioAbleToBreak:
             {
@@ -287,8 +318,7 @@ bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situ
           /**
            * Store the last safe intersection state for next time step
            */
-          mCurrentSafeStateMap.insert(
-            RssIntersectionStateMap::value_type(situation.situationId, previousIntersectionState->second));
+          mSafeStateTable.insertCurrent(situation.situationId, *previousIntersectionState);
         }
         else
         {
@@ -306,11 +336,11 @@ bool RssIntersectionChecker::calculateRssStateIntersection(Situation const &situ
         rssState.longitudinalState.response = ::ad_rss::state::LongitudinalResponse::None;
 
         // Update the last safe state
-        mCurrentSafeStateMap.insert(RssIntersectionStateMap::value_type(situation.situationId, intersectionState));
+        mSafeStateTable.insertCurrent(situation.situationId, intersectionState);
       }
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     result = false;
   }
@@ -36,9 +36,9 @@
 #pragma once
 
 #include <cstdint>
-#include <map>
 #include "ad_rss/situation/Situation.hpp"
 #include "ad_rss/state/ResponseState.hpp"
+#include "situation/RssSituationStateTable.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -49,6 +49,8 @@ namespace ad_rss {
  */
 namespace situation {
 
+class RssEgoVehicleTerms;
+
 /*!
  * \brief Enum LongitudinalResponse
  *
@@ -87,28 +89,26 @@ public:
    * @brief Calculate safety checks and determine required rssState for intersection situations
    *
    * @param[in]  situation situation to analyze
+   * @param[in]  egoVehicleTerms the terms of the ego vehicle, used if calculated for the ego vehicle state of the
+   * situation
    * @param[out] rssState  rssState of the ego vehicle
    *
    * @returns false if a failure occurred during calculations, true otherwise
    *
    */
-  bool calculateRssStateIntersection(Situation const &situation, state::ResponseState &rssState);
+  bool calculateRssStateIntersection(Situation const &situation,
+                                     RssEgoVehicleTerms const &egoVehicleTerms,
+                                     state::ResponseState &rssState);
 
 private:
-  typedef std::map<SituationId, IntersectionState> RssIntersectionStateMap;
-  /**
-   * @brief last safe IntersectionState of each situation of previous time step
-   */
-  RssIntersectionStateMap mLastSafeStateMap;
-
   /**
-   * @brief last safe IntersectionState of each situation of current time step
+   * @brief last safe IntersectionState of each situation of the previous and the current time step
    */
-  RssIntersectionStateMap mCurrentSafeStateMap;
+  RssSituationStateTable<IntersectionState> mSafeStateTable;
 
   /**
    * @brief time index of the current processing step
-   * If time index increases we need to update the mLastSafeStateMap
+   * If time index changes, the table needs to move on to the next generation
    */
   physics::TimeIndex mCurrentTimeIndex{0u};
 };
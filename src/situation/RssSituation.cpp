@@ -30,11 +30,124 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "situation/RssSituation.hpp"
+#include "ad_rss/situation/SituationValidInputRange.hpp"
+#include "situation/RssEgoVehicleTerms.hpp"
 #include "situation/RssFormulas.hpp"
+#include "situation/RssSituationT.hpp"
 
 namespace ad_rss {
 namespace situation {
 
+namespace {
+
+bool calculateLateralRssState(Situation const &situation,
+                              EgoVehicleDistanceTermCalculation const &calculateDistanceTerm,
+                              state::ResponseState &responseState)
+{
+  return calculateLateralRssStateT(situation,
+                                   responseState.lateralStateLeft,
+                                   responseState.lateralStateRight,
+                                   [&calculateDistanceTerm](VehicleState const &leftVehicle,
+                                                            VehicleState const &rightVehicle,
+                                                            physics::Distance const &vehicleDistance,
+                                                            physics::Distance &safeDistance,
+                                                            bool &isDistanceSafe) {
+                                     return checkSafeLateralDistanceT(leftVehicle,
+                                                                      rightVehicle,
+                                                                      vehicleDistance,
+                                                                      safeDistance,
+                                                                      isDistanceSafe,
+                                                                      calculateDistanceTerm);
+                                   });
+}
+
+/**
+ * @returns the uncertainty of the given vehicle state of the situation
+ */
+VehicleStateUncertainty const &getVehicleStateUncertainty(Situation const &situation,
+                                                          SituationUncertainty const &uncertainty,
+                                                          VehicleState const &vehicle)
+{
+  if (&vehicle == &situation.egoVehicleState)
+  {
+    return uncertainty.egoVehicleState;
+  }
+  return uncertainty.otherVehicleState;
+}
+
+/**
+ * @returns the situation with the distances of the relative position replaced by their worst case, the minimum
+ */
+Situation createWorstCaseSituation(Situation const &situation, SituationUncertainty const &uncertainty)
+{
+  Situation worstCaseSituation = situation;
+  worstCaseSituation.relativePosition.longitudinalDistance = uncertainty.longitudinalDistance.minimum;
+  worstCaseSituation.relativePosition.lateralDistance = uncertainty.lateralDistance.minimum;
+  return worstCaseSituation;
+}
+
+/**
+ * @brief check the vehicle distance against the worst case of the safe distance range
+ *
+ * @param[in] calculateSafeDistance the safe distance calculation, e.g.
+ * calculateSafeLongitudinalDistanceSameDirectionT<DistanceTermBoundCalculation>
+ * @param[in] situation the worst case situation the vehicle states are part of
+ * @param[in] uncertainty the uncertainty of the situation
+ */
+template <typename SafeDistanceCalculation>
+bool checkWorstCaseSafeDistance(SafeDistanceCalculation const &calculateSafeDistance,
+                                Situation const &situation,
+                                SituationUncertainty const &uncertainty,
+                                VehicleState const &firstVehicle,
+                                VehicleState const &secondVehicle,
+                                physics::Distance const &vehicleDistance,
+                                physics::Distance &safeDistance,
+                                bool &isDistanceSafe)
+{
+  return checkSafeDistanceT(
+    [&calculateSafeDistance, &situation, &uncertainty](
+      VehicleState const &first, VehicleState const &second, physics::Distance &distance) {
+      // only the upper bound of the safe distance range is required for the worst case
+      DistanceTermBoundCalculation const upperBoundCalculation(
+        first,
+        getVehicleStateUncertainty(situation, uncertainty, first),
+        getVehicleStateUncertainty(situation, uncertainty, second),
+        true);
+      return calculateSafeDistance(first, second, distance, upperBoundCalculation);
+    },
+    firstVehicle,
+    secondVehicle,
+    vehicleDistance,
+    safeDistance,
+    isDistanceSafe);
+}
+
+bool calculateWorstCaseLateralRssState(Situation const &worstCaseSituation,
+                                       SituationUncertainty const &uncertainty,
+                                       state::ResponseState &responseState)
+{
+  return calculateLateralRssStateT(
+    worstCaseSituation,
+    responseState.lateralStateLeft,
+    responseState.lateralStateRight,
+    [&worstCaseSituation, &uncertainty](VehicleState const &leftVehicle,
+                                        VehicleState const &rightVehicle,
+                                        physics::Distance const &vehicleDistance,
+                                        physics::Distance &safeDistance,
+                                        bool &isDistanceSafe) {
+      return checkWorstCaseSafeDistance(calculateSafeLateralDistanceT<DistanceTermBoundCalculation>,
+                                        worstCaseSituation,
+                                        uncertainty,
+                                        leftVehicle,
+                                        rightVehicle,
+                                        vehicleDistance,
+                                        safeDistance,
+                                        isDistanceSafe);
+    });
+}
+
+} // namespace
+
 bool calculateRssStateNonIntersectionSameDirection(Situation const &situation, state::ResponseState &responseState)
 {
   bool result = calculateLongitudinalRssStateNonIntersectionSameDirection(situation, responseState.longitudinalState);
@@ -56,172 +169,141 @@ bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situatio
   return result;
 }
 
-bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &situation,
-                                                               state::LongitudinalRssState &rssState)
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   RssEgoVehicleTerms const &egoVehicleTerms,
+                                                   state::ResponseState &responseState)
 {
-  bool result = false;
-
-  rssState.response = state::LongitudinalResponse::BrakeMin;
-  rssState.responseInformation.currentDistance = situation.relativePosition.longitudinalDistance;
-
-  bool isSafe = false;
-
-  if ((LongitudinalRelativePosition::InFront == situation.relativePosition.longitudinalPosition)
-      || (LongitudinalRelativePosition::OverlapFront == situation.relativePosition.longitudinalPosition))
-  {
-    rssState.responseInformation.responseEvaluator
-      = state::ResponseEvaluator::LongitudinalDistanceSameDirectionEgoFront;
-
-    // The ego vehicle is leading in this situation so we don't need to break longitudinal
-    rssState.response = state::LongitudinalResponse::None;
-
-    result = checkSafeLongitudinalDistanceSameDirection(situation.egoVehicleState,
-                                                        situation.otherVehicleState,
-                                                        situation.relativePosition.longitudinalDistance,
-                                                        rssState.responseInformation.safeDistance,
-                                                        isSafe);
-  }
-  else
+  EgoVehicleDistanceTermCalculation const calculateDistanceTerm(egoVehicleTerms, situation);
+  bool result = calculateLongitudinalRssStateNonIntersectionSameDirectionT(
+    situation,
+    responseState.longitudinalState,
+    [&calculateDistanceTerm](VehicleState const &leadingVehicle,
+                             VehicleState const &followingVehicle,
+                             physics::Distance const &vehicleDistance,
+                             physics::Distance &safeDistance,
+                             bool &isDistanceSafe) {
+      return checkSafeLongitudinalDistanceSameDirectionT(
+        leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe, calculateDistanceTerm);
+    });
+  if (result)
   {
-    rssState.responseInformation.responseEvaluator
-      = state::ResponseEvaluator::LongitudinalDistanceSameDirectionOtherInFront;
-
-    result = checkSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
-                                                        situation.egoVehicleState,
-                                                        situation.relativePosition.longitudinalDistance,
-                                                        rssState.responseInformation.safeDistance,
-                                                        isSafe);
+    result = calculateLateralRssState(situation, calculateDistanceTerm, responseState);
   }
+  return result;
+}
 
-  rssState.isSafe = isSafe;
-  if (isSafe)
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       RssEgoVehicleTerms const &egoVehicleTerms,
+                                                       state::ResponseState &responseState)
+{
+  EgoVehicleDistanceTermCalculation const calculateDistanceTerm(egoVehicleTerms, situation);
+  bool result = calculateLongitudinalRssStateNonIntersectionOppositeDirectionT(
+    situation,
+    responseState.longitudinalState,
+    [&calculateDistanceTerm](VehicleState const &correctVehicle,
+                             VehicleState const &oppositeVehicle,
+                             physics::Distance const &vehicleDistance,
+                             physics::Distance &safeDistance,
+                             bool &isDistanceSafe) {
+      return checkSafeLongitudinalDistanceOppositeDirectionT(
+        correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe, calculateDistanceTerm);
+    });
+  if (result)
   {
-    rssState.response = state::LongitudinalResponse::None;
+    result = calculateLateralRssState(situation, calculateDistanceTerm, responseState);
   }
-
   return result;
 }
 
-bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation const &situation,
-                                                                   state::LongitudinalRssState &rssState)
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   SituationUncertainty const &uncertainty,
+                                                   state::ResponseState &responseState)
 {
-  bool result = false;
-
-  bool isSafe = false;
-  rssState.response = state::LongitudinalResponse::BrakeMin;
-  rssState.responseInformation.currentDistance = situation.relativePosition.longitudinalDistance;
-
-  if (situation.egoVehicleState.isInCorrectLane)
+  if (!withinValidInputRange(situation) || !withinValidInputRange(uncertainty))
   {
-    rssState.responseInformation.responseEvaluator
-      = state::ResponseEvaluator::LongitudinalDistanceOppositeDirectionEgoCorrectLane;
-
-    result = checkSafeLongitudinalDistanceOppositeDirection(situation.egoVehicleState,
-                                                            situation.otherVehicleState,
-                                                            situation.relativePosition.longitudinalDistance,
-                                                            rssState.responseInformation.safeDistance,
-                                                            isSafe);
-    rssState.response = state::LongitudinalResponse::BrakeMinCorrect;
+    return false;
   }
-  else
-  {
-    rssState.responseInformation.responseEvaluator = state::ResponseEvaluator::LongitudinalDistanceOppositeDirection;
 
-    result = checkSafeLongitudinalDistanceOppositeDirection(situation.otherVehicleState,
-                                                            situation.egoVehicleState,
-                                                            situation.relativePosition.longitudinalDistance,
-                                                            rssState.responseInformation.safeDistance,
-                                                            isSafe);
-  }
-
-  rssState.isSafe = isSafe;
-  if (rssState.isSafe)
+  Situation const worstCaseSituation = createWorstCaseSituation(situation, uncertainty);
+  bool result = calculateLongitudinalRssStateNonIntersectionSameDirectionT(
+    worstCaseSituation,
+    responseState.longitudinalState,
+    [&worstCaseSituation, &uncertainty](VehicleState const &leadingVehicle,
+                                        VehicleState const &followingVehicle,
+                                        physics::Distance const &vehicleDistance,
+                                        physics::Distance &safeDistance,
+                                        bool &isDistanceSafe) {
+      return checkWorstCaseSafeDistance(calculateSafeLongitudinalDistanceSameDirectionT<DistanceTermBoundCalculation>,
+                                        worstCaseSituation,
+                                        uncertainty,
+                                        leadingVehicle,
+                                        followingVehicle,
+                                        vehicleDistance,
+                                        safeDistance,
+                                        isDistanceSafe);
+    });
+  if (result)
   {
-    rssState.response = state::LongitudinalResponse::None;
+    result = calculateWorstCaseLateralRssState(worstCaseSituation, uncertainty, responseState);
   }
-
   return result;
 }
 
-bool calculateLateralRssState(Situation const &situation,
-                              state::LateralRssState &rssStateLeft,
-                              state::LateralRssState &rssStateRight)
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       SituationUncertainty const &uncertainty,
+                                                       state::ResponseState &responseState)
 {
-  rssStateLeft.isSafe = false;
-  rssStateLeft.response = state::LateralResponse::BrakeMin;
-  rssStateRight.isSafe = false;
-  rssStateRight.response = state::LateralResponse::BrakeMin;
-
-  bool isDistanceSafe = false;
-
-  bool result = false;
-  if (LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
-  {
-    rssStateLeft.responseInformation.responseEvaluator = state::ResponseEvaluator::None;
-    rssStateLeft.responseInformation.currentDistance = physics::Distance::getMax();
-    rssStateLeft.responseInformation.safeDistance = physics::Distance::getMax();
-
-    // ego is the left vehicle, so right side has to be checked
-    rssStateRight.responseInformation.responseEvaluator = state::ResponseEvaluator::LateralDistance;
-    rssStateRight.responseInformation.currentDistance = situation.relativePosition.lateralDistance;
-    result = checkSafeLateralDistance(situation.egoVehicleState,
-                                      situation.otherVehicleState,
-                                      situation.relativePosition.lateralDistance,
-                                      rssStateRight.responseInformation.safeDistance,
-                                      isDistanceSafe);
-  }
-  else if (LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
-  {
-    rssStateRight.responseInformation.responseEvaluator = state::ResponseEvaluator::None;
-    rssStateRight.responseInformation.currentDistance = physics::Distance::getMax();
-    rssStateRight.responseInformation.safeDistance = physics::Distance::getMax();
-
-    // ego is the right vehicle, so left side has to be checked
-    rssStateLeft.responseInformation.responseEvaluator = state::ResponseEvaluator::LateralDistance;
-    rssStateLeft.responseInformation.currentDistance = situation.relativePosition.lateralDistance;
-    result = checkSafeLateralDistance(situation.otherVehicleState,
-                                      situation.egoVehicleState,
-                                      situation.relativePosition.lateralDistance,
-                                      rssStateLeft.responseInformation.safeDistance,
-                                      isDistanceSafe);
-  }
-  else
+  if (!withinValidInputRange(situation) || !withinValidInputRange(uncertainty))
   {
-    rssStateLeft.responseInformation.responseEvaluator = state::ResponseEvaluator::LateralDistance;
-    rssStateLeft.responseInformation.currentDistance = physics::Distance(0);
-    rssStateLeft.responseInformation.safeDistance = physics::Distance(0);
-    rssStateRight.responseInformation.responseEvaluator = state::ResponseEvaluator::LateralDistance;
-    rssStateRight.responseInformation.currentDistance = physics::Distance(0);
-    rssStateRight.responseInformation.safeDistance = physics::Distance(0);
-
-    // lateral distance is zero, never safe
-    result = true;
+    return false;
   }
 
-  if (isDistanceSafe)
-  {
-    rssStateLeft.isSafe = true;
-    rssStateLeft.response = state::LateralResponse::None;
-    rssStateRight.isSafe = true;
-    rssStateRight.response = state::LateralResponse::None;
-  }
-  else if ((LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
-           || (LateralRelativePosition::OverlapLeft == situation.relativePosition.lateralPosition))
-  {
-    // ego is the left vehicle, so the collision is on the right side
-    rssStateLeft.isSafe = true;
-    rssStateLeft.response = state::LateralResponse::None;
-  }
-  else if ((LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
-           || (LateralRelativePosition::OverlapRight == situation.relativePosition.lateralPosition))
+  Situation const worstCaseSituation = createWorstCaseSituation(situation, uncertainty);
+  bool result = calculateLongitudinalRssStateNonIntersectionOppositeDirectionT(
+    worstCaseSituation,
+    responseState.longitudinalState,
+    [&worstCaseSituation, &uncertainty](VehicleState const &correctVehicle,
+                                        VehicleState const &oppositeVehicle,
+                                        physics::Distance const &vehicleDistance,
+                                        physics::Distance &safeDistance,
+                                        bool &isDistanceSafe) {
+      return checkWorstCaseSafeDistance(
+        calculateSafeLongitudinalDistanceOppositeDirectionT<DistanceTermBoundCalculation>,
+        worstCaseSituation,
+        uncertainty,
+        correctVehicle,
+        oppositeVehicle,
+        vehicleDistance,
+        safeDistance,
+        isDistanceSafe);
+    });
+  if (result)
   {
-    // ego is the right vehicle, so the collision is on the left side
-    rssStateRight.isSafe = true;
-    rssStateRight.response = state::LateralResponse::None;
+    result = calculateWorstCaseLateralRssState(worstCaseSituation, uncertainty, responseState);
   }
-
   return result;
 }
 
+bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                               state::LongitudinalRssState &rssState)
+{
+  return calculateLongitudinalRssStateNonIntersectionSameDirectionT(
+    situation, rssState, checkSafeLongitudinalDistanceSameDirectionInputRangeChecked);
+}
+
+bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                                   state::LongitudinalRssState &rssState)
+{
+  return calculateLongitudinalRssStateNonIntersectionOppositeDirectionT(
+    situation, rssState, checkSafeLongitudinalDistanceOppositeDirectionInputRangeChecked);
+}
+
+bool calculateLateralRssState(Situation const &situation,
+                              state::LateralRssState &rssStateLeft,
+                              state::LateralRssState &rssStateRight)
+{
+  return calculateLateralRssStateT(situation, rssStateLeft, rssStateRight, checkSafeLateralDistanceInputRangeChecked);
+}
+
 } // namespace situation
 } // namespace ad_rss
@@ -36,6 +36,7 @@
 
 #include "ad_rss/situation/Situation.hpp"
 #include "ad_rss/state/ResponseState.hpp"
+#include "situation/SituationUncertainty.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -46,6 +47,8 @@ namespace ad_rss {
  */
 namespace situation {
 
+class RssEgoVehicleTerms;
+
 /**
  * @brief Calculate safety checks and determine required responseState for non intersection same direction scenario
  *
@@ -66,6 +69,76 @@ bool calculateRssStateNonIntersectionSameDirection(Situation const &situation, s
  */
 bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation, state::ResponseState &responseState);
 
+/**
+ * @brief Calculate safety checks and determine required responseState for non intersection same direction scenario
+ * reusing the already calculated terms of the ego vehicle
+ *
+ * Same as calculateRssStateNonIntersectionSameDirection(Situation const &, state::ResponseState &). The terms of the
+ * ego vehicle are taken from \a egoVehicleTerms if calculated for the ego vehicle state of the situation.
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  egoVehicleTerms the terms of the ego vehicle
+ * @param[out] responseState  response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   RssEgoVehicleTerms const &egoVehicleTerms,
+                                                   state::ResponseState &responseState);
+
+/**
+ * @brief Calculate safety checks and determine required responseState for non intersection opposite direction
+ * scenario reusing the already calculated terms of the ego vehicle
+ *
+ * Same as calculateRssStateNonIntersectionOppositeDirection(Situation const &, state::ResponseState &). The terms of
+ * the ego vehicle are taken from \a egoVehicleTerms if calculated for the ego vehicle state of the situation.
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  egoVehicleTerms the terms of the ego vehicle
+ * @param[out] responseState  response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       RssEgoVehicleTerms const &egoVehicleTerms,
+                                                       state::ResponseState &responseState);
+
+/**
+ * @brief Calculate the worst case responseState for non intersection same direction scenario with uncertain input
+ *
+ * Interval evaluation of calculateRssStateNonIntersectionSameDirection(Situation const &, state::ResponseState &):
+ * the speeds of the vehicle states and the distances of the relative position are replaced by the ranges of the
+ * uncertainty. A single evaluation provides the worst case, i.e. the situation is only considered to be safe if it is
+ * safe for every combination of values within the ranges. The reported current distances are the minimum, the
+ * reported safe distances the maximum of the ranges.
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  uncertainty the uncertainty of the situation
+ * @param[out] responseState  worst case response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   SituationUncertainty const &uncertainty,
+                                                   state::ResponseState &responseState);
+
+/**
+ * @brief Calculate the worst case responseState for non intersection opposite direction scenario with uncertain input
+ *
+ * Interval evaluation of calculateRssStateNonIntersectionOppositeDirection(Situation const &, state::ResponseState
+ * &), see calculateRssStateNonIntersectionSameDirection(Situation const &, SituationUncertainty const &,
+ * state::ResponseState &).
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  uncertainty the uncertainty of the situation
+ * @param[out] responseState  worst case response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       SituationUncertainty const &uncertainty,
+                                                       state::ResponseState &responseState);
+
 /**
  * @brief Calculate safety checks and determine required rssState for longitudinal direction for
  * non intersection scenario when both vehicles are driving in same direction
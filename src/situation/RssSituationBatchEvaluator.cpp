@@ -0,0 +1,322 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "situation/RssSituationBatchEvaluator.hpp"
+#include <algorithm>
+#include "physics/MathBatch.hpp"
+#include "situation/RssSituationT.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+// make the code more readable
+using physics::Acceleration;
+using physics::CoordinateSystemAxis;
+using physics::Distance;
+using physics::Duration;
+using physics::Speed;
+using physics::UncheckedDistance;
+
+void RssSituationBatchEvaluator::StatedBrakingPatternBatch::clear()
+{
+  currentSpeed.clear();
+  responseTime.clear();
+  acceleration.clear();
+  deceleration.clear();
+}
+
+std::size_t RssSituationBatchEvaluator::StatedBrakingPatternBatch::add(Speed const &speed,
+                                                                       Duration const &duration,
+                                                                       Acceleration const &accelerationValue,
+                                                                       Acceleration const &decelerationValue)
+{
+  currentSpeed.push_back(static_cast<double>(speed));
+  responseTime.push_back(static_cast<double>(duration));
+  acceleration.push_back(static_cast<double>(accelerationValue));
+  deceleration.push_back(static_cast<double>(decelerationValue));
+  return currentSpeed.size() - 1u;
+}
+
+bool RssSituationBatchEvaluator::StatedBrakingPatternBatch::calculate(CoordinateSystemAxis const &axis)
+{
+  distanceOffset.resize(currentSpeed.size());
+  return physics::calculateDistanceOffsetAfterStatedBrakingPatternBatch(axis,
+                                                                        currentSpeed.size(),
+                                                                        currentSpeed.data(),
+                                                                        responseTime.data(),
+                                                                        acceleration.data(),
+                                                                        deceleration.data(),
+                                                                        distanceOffset.data());
+}
+
+UncheckedDistance
+RssSituationBatchEvaluator::StatedBrakingPatternBatch::getDistanceOffset(std::size_t const index) const
+{
+  // the validity of the distance offset is already ensured by the batch calculation
+  return UncheckedDistance(distanceOffset[index]);
+}
+
+void RssSituationBatchEvaluator::StoppingDistanceBatch::clear()
+{
+  currentSpeed.clear();
+  deceleration.clear();
+}
+
+std::size_t RssSituationBatchEvaluator::StoppingDistanceBatch::add(Speed const &speed,
+                                                                   Acceleration const &decelerationValue)
+{
+  currentSpeed.push_back(static_cast<double>(speed));
+  deceleration.push_back(static_cast<double>(decelerationValue));
+  return currentSpeed.size() - 1u;
+}
+
+bool RssSituationBatchEvaluator::StoppingDistanceBatch::calculate()
+{
+  stoppingDistance.resize(currentSpeed.size());
+  return physics::calculateStoppingDistanceBatch(
+    currentSpeed.size(), currentSpeed.data(), deceleration.data(), stoppingDistance.data());
+}
+
+void RssSituationBatchEvaluator::collectRequests(Situation const &situation,
+                                                 SafeDistanceRequest &longitudinalRequest,
+                                                 SafeDistanceRequest &lateralRequest)
+{
+  // the vehicle assignment follows the one of the situation-wise calculation (see RssSituationT.hpp)
+  VehicleState const &egoVehicle = situation.egoVehicleState;
+  VehicleState const &otherVehicle = situation.otherVehicleState;
+
+  if (situation.situationType == SituationType::SameDirection)
+  {
+    bool const egoLeading
+      = (LongitudinalRelativePosition::InFront == situation.relativePosition.longitudinalPosition)
+      || (LongitudinalRelativePosition::OverlapFront == situation.relativePosition.longitudinalPosition);
+    VehicleState const &leadingVehicle = egoLeading ? egoVehicle : otherVehicle;
+    VehicleState const &followingVehicle = egoLeading ? otherVehicle : egoVehicle;
+    longitudinalRequest.type = SafeDistanceType::LongitudinalSameDirection;
+    longitudinalRequest.first
+      = mLongitudinalStopping.add(leadingVehicle.velocity.speedLon, leadingVehicle.dynamics.alphaLon.brakeMax);
+    longitudinalRequest.second = mLongitudinalStatedBraking.add(followingVehicle.velocity.speedLon,
+                                                                followingVehicle.responseTime,
+                                                                followingVehicle.dynamics.alphaLon.accelMax,
+                                                                followingVehicle.dynamics.alphaLon.brakeMin);
+  }
+  else
+  {
+    VehicleState const &correctVehicle = egoVehicle.isInCorrectLane ? egoVehicle : otherVehicle;
+    VehicleState const &oppositeVehicle = egoVehicle.isInCorrectLane ? otherVehicle : egoVehicle;
+    longitudinalRequest.type = SafeDistanceType::LongitudinalOppositeDirection;
+    longitudinalRequest.first = mLongitudinalStatedBraking.add(correctVehicle.velocity.speedLon,
+                                                               correctVehicle.responseTime,
+                                                               correctVehicle.dynamics.alphaLon.accelMax,
+                                                               correctVehicle.dynamics.alphaLon.brakeMinCorrect);
+    longitudinalRequest.second = mLongitudinalStatedBraking.add(oppositeVehicle.velocity.speedLon,
+                                                                oppositeVehicle.responseTime,
+                                                                oppositeVehicle.dynamics.alphaLon.accelMax,
+                                                                oppositeVehicle.dynamics.alphaLon.brakeMin);
+  }
+
+  lateralRequest.type = SafeDistanceType::Lateral;
+  if ((LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
+      || (LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition))
+  {
+    bool const egoLeft = (LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition);
+    VehicleState const &leftVehicle = egoLeft ? egoVehicle : otherVehicle;
+    VehicleState const &rightVehicle = egoLeft ? otherVehicle : egoVehicle;
+    lateralRequest.first = mLateralStatedBraking.add(leftVehicle.velocity.speedLat,
+                                                     leftVehicle.responseTime,
+                                                     leftVehicle.dynamics.alphaLat.accelMax,
+                                                     leftVehicle.dynamics.alphaLat.brakeMin);
+    lateralRequest.second = mLateralStatedBraking.add(rightVehicle.velocity.speedLat,
+                                                      rightVehicle.responseTime,
+                                                      -rightVehicle.dynamics.alphaLat.accelMax,
+                                                      -rightVehicle.dynamics.alphaLat.brakeMin);
+  }
+}
+
+/**
+ * @brief safe distance check providing the safe distance from the results of the batches
+ *
+ * Performs the same comparison as the situation-wise checks (see RssFormulas.hpp).
+ */
+class RssSituationBatchEvaluator::RequestEvaluator
+{
+public:
+  RequestEvaluator(RssSituationBatchEvaluator const &evaluator, SafeDistanceRequest const &request)
+    : mEvaluator(evaluator)
+    , mRequest(request)
+  {
+  }
+
+  bool operator()(VehicleState const &,
+                  VehicleState const &,
+                  Distance const &vehicleDistance,
+                  Distance &safeDistance,
+                  bool &isDistanceSafe)
+  {
+    if (vehicleDistance < Distance(0.))
+    {
+      return false;
+    }
+
+    isDistanceSafe = false;
+    safeDistance = mEvaluator.calculateSafeDistance(mRequest);
+    if (vehicleDistance > safeDistance)
+    {
+      isDistanceSafe = true;
+    }
+    return true;
+  }
+
+private:
+  RssSituationBatchEvaluator const &mEvaluator;
+  SafeDistanceRequest const &mRequest;
+};
+
+Distance RssSituationBatchEvaluator::calculateSafeDistance(SafeDistanceRequest const &request) const
+{
+  Distance safeDistance = Distance::getMax();
+  switch (request.type)
+  {
+    case SafeDistanceType::LongitudinalSameDirection:
+    {
+      UncheckedDistance const distanceStatedBraking = mLongitudinalStatedBraking.getDistanceOffset(request.second);
+      UncheckedDistance const distanceMaxBrake
+        = UncheckedDistance(mLongitudinalStopping.stoppingDistance[request.first]);
+      safeDistance = (distanceStatedBraking - distanceMaxBrake).toChecked();
+      safeDistance = std::max(safeDistance, Distance(0.));
+      break;
+    }
+    case SafeDistanceType::LongitudinalOppositeDirection:
+      safeDistance = (mLongitudinalStatedBraking.getDistanceOffset(request.first)
+                      + mLongitudinalStatedBraking.getDistanceOffset(request.second))
+                       .toChecked();
+      break;
+    case SafeDistanceType::Lateral:
+      safeDistance = (mLateralStatedBraking.getDistanceOffset(request.first)
+                      - mLateralStatedBraking.getDistanceOffset(request.second))
+                       .toChecked();
+      safeDistance = std::max(safeDistance, Distance(0.));
+      break;
+    default:
+      break;
+  }
+  return safeDistance;
+}
+
+namespace {
+
+/**
+ * @brief calculate the response state of a non-intersection situation with the given safe distance checks
+ */
+template <typename LongitudinalCheck, typename LateralCheck>
+bool calculateRssState(Situation const &situation,
+                       state::ResponseState &responseState,
+                       LongitudinalCheck longitudinalCheck,
+                       LateralCheck lateralCheck)
+{
+  bool result = false;
+  if (situation.situationType == SituationType::SameDirection)
+  {
+    result = calculateLongitudinalRssStateNonIntersectionSameDirectionT(
+      situation, responseState.longitudinalState, longitudinalCheck);
+  }
+  else
+  {
+    result = calculateLongitudinalRssStateNonIntersectionOppositeDirectionT(
+      situation, responseState.longitudinalState, longitudinalCheck);
+  }
+  if (result)
+  {
+    result = calculateLateralRssStateT(
+      situation, responseState.lateralStateLeft, responseState.lateralStateRight, lateralCheck);
+  }
+  return result;
+}
+
+} // namespace
+
+bool RssSituationBatchEvaluator::calculateRssStates(SituationVector const &situationVector,
+                                                    std::vector<std::size_t> const &situationIndices,
+                                                    state::ResponseStateVector &responseStateVector)
+{
+  bool result = true;
+  AD_RSS_TRY
+  {
+    mLongitudinalStatedBraking.clear();
+    mLateralStatedBraking.clear();
+    mLongitudinalStopping.clear();
+    mRequests.resize(2u * situationIndices.size());
+
+    // collect the input of all calculations grouped by the situation type
+    for (auto const situationType : {SituationType::SameDirection, SituationType::OppositeDirection})
+    {
+      for (std::size_t i = 0u; i < situationIndices.size(); i++)
+      {
+        Situation const &situation = situationVector[situationIndices[i]];
+        if (situation.situationType != situationType)
+        {
+          continue;
+        }
+        collectRequests(situation, mRequests[2u * i], mRequests[2u * i + 1u]);
+      }
+    }
+
+    // perform the calculations of all situations at once
+    result = mLongitudinalStatedBraking.calculate(CoordinateSystemAxis::Longitudinal)
+      && mLateralStatedBraking.calculate(CoordinateSystemAxis::Lateral) && mLongitudinalStopping.calculate();
+
+    // provide the response states from the results
+    for (std::size_t i = 0u; (i < situationIndices.size()) && result; i++)
+    {
+      Situation const &situation = situationVector[situationIndices[i]];
+      if ((situation.situationType != SituationType::SameDirection)
+          && (situation.situationType != SituationType::OppositeDirection))
+      {
+        result = false;
+      }
+      else
+      {
+        result = calculateRssState(situation,
+                                   responseStateVector[situationIndices[i]],
+                                   RequestEvaluator(*this, mRequests[2u * i]),
+                                   RequestEvaluator(*this, mRequests[2u * i + 1u]));
+      }
+    }
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,165 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ad_rss/physics/CoordinateSystemAxis.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "ad_rss/state/ResponseStateVector.hpp"
+#include "physics/Unchecked.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief Batch evaluation of the non-intersection situations
+ *
+ * The situations are grouped by their SituationType and the vehicle states entering the safe distance calculations
+ * are laid out as structure of arrays. The motion calculations of all situations are then performed within a single
+ * vectorized sweep per calculation (see physics/MathBatch.hpp) instead of one call chain per situation.
+ *
+ * The results are identical to the situation-wise calculateRssStateNonIntersectionSameDirection() and
+ * calculateRssStateNonIntersectionOppositeDirection(): the resulting response states are provided by the same
+ * implementation (see RssSituationT.hpp), only the safe distance checks are fed from the batch results.
+ *
+ * The buffers of the evaluator keep their capacity, so that no heap allocations are required in steady state.
+ */
+class RssSituationBatchEvaluator
+{
+public:
+  /**
+   * @brief Calculate the response states of the given non-intersection situations
+   *
+   * @param[in] situationVector the situations, already checked to be within valid input range
+   * @param[in] situationIndices the indices of the situations to be evaluated. Only situations of type SameDirection
+   * and OppositeDirection are supported.
+   * @param[in,out] responseStateVector the response states of the situations. The entries of the given indices have
+   * to be initialized as unsafe response states of the respective situation and are calculated in place.
+   *
+   * @return true if all situations could be evaluated. If false is returned, the calculated response states are
+   * undefined and the situations have to be evaluated one by one to determine the failing ones.
+   */
+  bool calculateRssStates(SituationVector const &situationVector,
+                          std::vector<std::size_t> const &situationIndices,
+                          state::ResponseStateVector &responseStateVector);
+
+private:
+  /**
+   * @brief structure of arrays of the input and output of calculateDistanceOffsetAfterStatedBrakingPattern()
+   */
+  struct StatedBrakingPatternBatch
+  {
+    void clear();
+    std::size_t add(physics::Speed const &speed,
+                    physics::Duration const &responseTime,
+                    physics::Acceleration const &acceleration,
+                    physics::Acceleration const &deceleration);
+    bool calculate(physics::CoordinateSystemAxis const &axis);
+    physics::UncheckedDistance getDistanceOffset(std::size_t const index) const;
+
+    std::vector<double> currentSpeed;
+    std::vector<double> responseTime;
+    std::vector<double> acceleration;
+    std::vector<double> deceleration;
+    std::vector<double> distanceOffset;
+  };
+
+  /**
+   * @brief structure of arrays of the input and output of calculateStoppingDistance()
+   */
+  struct StoppingDistanceBatch
+  {
+    void clear();
+    std::size_t add(physics::Speed const &speed, physics::Acceleration const &deceleration);
+    bool calculate();
+
+    std::vector<double> currentSpeed;
+    std::vector<double> deceleration;
+    std::vector<double> stoppingDistance;
+  };
+
+  /**
+   * @brief the safe distance calculations
+   */
+  enum class SafeDistanceType
+  {
+    LongitudinalSameDirection,
+    LongitudinalOppositeDirection,
+    Lateral
+  };
+
+  /**
+   * @brief a safe distance calculation of a situation referring to the entries of the batches
+   *
+   * LongitudinalSameDirection: stopping distance of the leading vehicle and longitudinal stated braking pattern
+   * of the following vehicle.
+   * LongitudinalOppositeDirection: longitudinal stated braking pattern of the vehicle in correct lane and of
+   * the opposite vehicle.
+   * Lateral: lateral stated braking pattern of the left and the right vehicle.
+   */
+  struct SafeDistanceRequest
+  {
+    SafeDistanceType type;
+    std::size_t first;
+    std::size_t second;
+  };
+
+  class RequestEvaluator;
+
+  /**
+   * @brief add the input of the safe distance calculations of the situation to the batches
+   */
+  void collectRequests(Situation const &situation,
+                       SafeDistanceRequest &longitudinalRequest,
+                       SafeDistanceRequest &lateralRequest);
+
+  physics::Distance calculateSafeDistance(SafeDistanceRequest const &request) const;
+
+  StatedBrakingPatternBatch mLongitudinalStatedBraking;
+  StatedBrakingPatternBatch mLateralStatedBraking;
+  StoppingDistanceBatch mLongitudinalStopping;
+  // one longitudinal and one lateral request per evaluated situation
+  std::vector<SafeDistanceRequest> mRequests;
+};
+
+} // namespace situation
+} // namespace ad_rss
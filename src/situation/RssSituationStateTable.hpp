@@ -0,0 +1,327 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ad_rss/situation/SituationId.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief Table storing a state per situation id for the previous and the current processing step
+ *
+ * The table is an open addressing hash table over a flat array of slots. Each slot holds the entries of one
+ * situation id for two generations. An entry is only valid if its generation stamp equals the generation of the
+ * previous or the current step; moving on to the next step therefore only changes the generation stamps of the
+ * table, which implicitly expires all entries of older steps without touching the slots.
+ *
+ * The slots are preallocated on construction for the given number of situations per step, so that no heap
+ * allocations are required as long as this number isn't exceeded. If more situations are stored, the table grows.
+ */
+template <typename StateType> class RssSituationStateTable
+{
+public:
+  /**
+   * @brief constructor
+   *
+   * @param[in] maxNumberOfSituations the number of situations per step the memory is preallocated for
+   */
+  explicit RssSituationStateTable(std::size_t maxNumberOfSituations = 100u)
+  {
+    // both generations may hold distinct situation ids and the load factor is kept below 1/2
+    std::size_t capacity = 16u;
+    while (capacity < 4u * maxNumberOfSituations)
+    {
+      capacity *= 2u;
+    }
+    resize(capacity);
+    mRehashBuffer.resize(capacity);
+  }
+
+  /**
+   * @brief find the state of the given situation id stored in the previous step
+   *
+   * @returns pointer to the state or nullptr if there is no such state
+   */
+  StateType const *findPrevious(SituationId const &situationId) const
+  {
+    return find(situationId, mPreviousGeneration);
+  }
+
+  /**
+   * @brief find the state of the given situation id stored in the current step
+   *
+   * @returns pointer to the state or nullptr if there is no such state
+   */
+  StateType const *findCurrent(SituationId const &situationId) const
+  {
+    return find(situationId, mCurrentGeneration);
+  }
+
+  /**
+   * @brief store the state of the given situation id for the current step
+   *
+   * An already stored state of the situation id in the current step is not overwritten.
+   *
+   * @returns true if the state was stored, false if there is already a state of the situation id in the current step
+   */
+  bool insertCurrent(SituationId const &situationId, StateType const &state)
+  {
+    std::size_t slotIndex = findSlot(situationId);
+    if (slotIndex == mSlots.size())
+    {
+      if (4u * (mNumberOfUsedSlots + 1u) > 3u * mSlots.size())
+      {
+        rehash();
+      }
+      slotIndex = claimSlot(situationId);
+    }
+
+    Slot &slot = mSlots[slotIndex];
+    if ((slot.entries[0].generation == mCurrentGeneration) || (slot.entries[1].generation == mCurrentGeneration))
+    {
+      return false;
+    }
+    Entry &entry = (slot.entries[0].generation == mPreviousGeneration) ? slot.entries[1] : slot.entries[0];
+    entry.generation = mCurrentGeneration;
+    entry.state = state;
+    return true;
+  }
+
+  /**
+   * @brief the current step becomes the previous step, the states of the former previous step expire
+   */
+  void nextGeneration()
+  {
+    mPreviousGeneration = mCurrentGeneration;
+    mCurrentGeneration = ++mGenerationCounter;
+  }
+
+  /**
+   * @brief discard all states stored in the current step, the states of the previous step are kept
+   */
+  void discardCurrentGeneration()
+  {
+    mCurrentGeneration = ++mGenerationCounter;
+  }
+
+  /**
+   * @brief remove all states from the table
+   */
+  void clear()
+  {
+    for (auto &slot : mSlots)
+    {
+      slot = Slot();
+    }
+    mNumberOfUsedSlots = 0u;
+  }
+
+  /**
+   * @returns the number of slots of the table
+   */
+  std::size_t getCapacity() const
+  {
+    return mSlots.size();
+  }
+
+private:
+  /**
+   * @brief the state of a situation id in one generation
+   */
+  struct Entry
+  {
+    uint64_t generation{0u};
+    StateType state{};
+  };
+
+  /**
+   * @brief the entries of a situation id
+   */
+  struct Slot
+  {
+    SituationId situationId{0u};
+    bool used{false};
+    Entry entries[2];
+  };
+
+  bool isLive(Slot const &slot) const
+  {
+    return (slot.entries[0].generation == mPreviousGeneration) || (slot.entries[0].generation == mCurrentGeneration)
+      || (slot.entries[1].generation == mPreviousGeneration) || (slot.entries[1].generation == mCurrentGeneration);
+  }
+
+  std::size_t hash(SituationId const &situationId) const
+  {
+    // fibonacci hashing, the capacity is always a power of two
+    return static_cast<std::size_t>((static_cast<uint64_t>(situationId) * 11400714819323198485ull) >> mHashShift);
+  }
+
+  /**
+   * @returns the index of the slot of the situation id or mSlots.size() if there is no such slot
+   */
+  std::size_t findSlot(SituationId const &situationId) const
+  {
+    std::size_t const mask = mSlots.size() - 1u;
+    for (std::size_t slotIndex = hash(situationId); mSlots[slotIndex].used; slotIndex = (slotIndex + 1u) & mask)
+    {
+      if (mSlots[slotIndex].situationId == situationId)
+      {
+        return slotIndex;
+      }
+    }
+    return mSlots.size();
+  }
+
+  StateType const *find(SituationId const &situationId, uint64_t generation) const
+  {
+    std::size_t const slotIndex = findSlot(situationId);
+    if (slotIndex == mSlots.size())
+    {
+      return nullptr;
+    }
+    Slot const &slot = mSlots[slotIndex];
+    for (auto const &entry : slot.entries)
+    {
+      if (entry.generation == generation)
+      {
+        return &entry.state;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief claim a slot for a situation id not contained in the table
+   *
+   * An expired slot along the probing sequence is reused, otherwise the next unused slot is taken.
+   */
+  std::size_t claimSlot(SituationId const &situationId)
+  {
+    std::size_t const mask = mSlots.size() - 1u;
+    std::size_t slotIndex = hash(situationId);
+    while (mSlots[slotIndex].used && isLive(mSlots[slotIndex]))
+    {
+      slotIndex = (slotIndex + 1u) & mask;
+    }
+    Slot &slot = mSlots[slotIndex];
+    if (!slot.used)
+    {
+      slot.used = true;
+      mNumberOfUsedSlots++;
+    }
+    slot.situationId = situationId;
+    slot.entries[0].generation = 0u;
+    slot.entries[1].generation = 0u;
+    return slotIndex;
+  }
+
+  /**
+   * @brief drop all expired slots from the table
+   *
+   * The table only grows if more than half of the slots are still live; otherwise the memory of the
+   * preallocated rehash buffer is reused and no heap allocation takes place.
+   */
+  void rehash()
+  {
+    std::size_t numberOfLiveSlots = 0u;
+    for (auto const &slot : mSlots)
+    {
+      if (slot.used && isLive(slot))
+      {
+        numberOfLiveSlots++;
+      }
+    }
+
+    std::size_t capacity = mSlots.size();
+    if (2u * (numberOfLiveSlots + 1u) > capacity)
+    {
+      capacity *= 2u;
+    }
+
+    mRehashBuffer.swap(mSlots);
+    resize(capacity);
+
+    std::size_t const mask = mSlots.size() - 1u;
+    for (auto const &slot : mRehashBuffer)
+    {
+      if (slot.used && isLive(slot))
+      {
+        std::size_t slotIndex = hash(slot.situationId);
+        while (mSlots[slotIndex].used)
+        {
+          slotIndex = (slotIndex + 1u) & mask;
+        }
+        mSlots[slotIndex] = slot;
+        mNumberOfUsedSlots++;
+      }
+    }
+    mRehashBuffer.resize(capacity);
+  }
+
+  /**
+   * @brief reset the slots of the table to the given capacity, which has to be a power of two
+   */
+  void resize(std::size_t capacity)
+  {
+    mSlots.assign(capacity, Slot());
+    mNumberOfUsedSlots = 0u;
+    mHashShift = 64u;
+    for (std::size_t size = capacity; size > 1u; size /= 2u)
+    {
+      mHashShift--;
+    }
+  }
+
+  std::vector<Slot> mSlots;
+  std::vector<Slot> mRehashBuffer;
+  std::size_t mNumberOfUsedSlots{0u};
+  uint32_t mHashShift{64u};
+  uint64_t mGenerationCounter{2u};
+  uint64_t mPreviousGeneration{1u};
+  uint64_t mCurrentGeneration{2u};
+};
+
+} // namespace situation
+} // namespace ad_rss
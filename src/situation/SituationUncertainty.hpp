@@ -0,0 +1,162 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/physics/MetricRangeValidInputRange.hpp"
+#include "ad_rss/situation/Situation.hpp"
+#include "ad_rss/world/VelocityValidInputRange.hpp"
+#include "physics/SpeedRange.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief the uncertainty of the state of a vehicle, e.g. as provided by the perception
+ *
+ * Within the interval evaluation, the speeds of the vehicle state are replaced by these ranges.
+ */
+struct VehicleStateUncertainty
+{
+  /**
+   * @brief the range of the longitudinal speed of the vehicle
+   */
+  physics::SpeedRange speedLon;
+
+  /**
+   * @brief the range of the lateral speed of the vehicle
+   */
+  physics::SpeedRange speedLat;
+};
+
+/**
+ * @brief the uncertainty of a situation, e.g. as provided by the perception
+ *
+ * Within the interval evaluation, the speeds of the vehicle states and the distances of the relative position are
+ * replaced by these ranges. The relative position itself (i.e. which vehicle is in front or at the left) is
+ * taken over from the situation.
+ */
+struct SituationUncertainty
+{
+  /**
+   * @brief the uncertainty of the ego vehicle state
+   */
+  VehicleStateUncertainty egoVehicleState;
+
+  /**
+   * @brief the uncertainty of the other vehicle state
+   */
+  VehicleStateUncertainty otherVehicleState;
+
+  /**
+   * @brief the range of the longitudinal distance between the vehicles
+   */
+  physics::MetricRange longitudinalDistance;
+
+  /**
+   * @brief the range of the lateral distance between the vehicles
+   */
+  physics::MetricRange lateralDistance;
+};
+
+/**
+ * @brief create a vehicle state uncertainty without any uncertainty, i.e. the speed ranges only contain the speeds
+ * of the vehicle state
+ */
+inline VehicleStateUncertainty createVehicleStateUncertainty(VehicleState const &vehicle)
+{
+  VehicleStateUncertainty uncertainty;
+  uncertainty.speedLon.minimum = vehicle.velocity.speedLon;
+  uncertainty.speedLon.maximum = vehicle.velocity.speedLon;
+  uncertainty.speedLat.minimum = vehicle.velocity.speedLat;
+  uncertainty.speedLat.maximum = vehicle.velocity.speedLat;
+  return uncertainty;
+}
+
+/**
+ * @brief create a situation uncertainty without any uncertainty, i.e. the ranges only contain the values of the
+ * situation
+ */
+inline SituationUncertainty createSituationUncertainty(Situation const &situation)
+{
+  SituationUncertainty uncertainty;
+  uncertainty.egoVehicleState = createVehicleStateUncertainty(situation.egoVehicleState);
+  uncertainty.otherVehicleState = createVehicleStateUncertainty(situation.otherVehicleState);
+  uncertainty.longitudinalDistance.minimum = situation.relativePosition.longitudinalDistance;
+  uncertainty.longitudinalDistance.maximum = situation.relativePosition.longitudinalDistance;
+  uncertainty.lateralDistance.minimum = situation.relativePosition.lateralDistance;
+  uncertainty.lateralDistance.maximum = situation.relativePosition.lateralDistance;
+  return uncertainty;
+}
+
+} // namespace situation
+} // namespace ad_rss
+
+/**
+ * @brief check if the given VehicleStateUncertainty is within valid input range
+ *
+ * @returns \c true if the velocities composed of the borders of the speed ranges are within valid input range and the
+ * minimum of each range is not above its maximum
+ */
+inline bool withinValidInputRange(::ad_rss::situation::VehicleStateUncertainty const &input)
+{
+  ::ad_rss::world::Velocity minimumVelocity;
+  minimumVelocity.speedLon = input.speedLon.minimum;
+  minimumVelocity.speedLat = input.speedLat.minimum;
+  ::ad_rss::world::Velocity maximumVelocity;
+  maximumVelocity.speedLon = input.speedLon.maximum;
+  maximumVelocity.speedLat = input.speedLat.maximum;
+  // the comparison of the borders requires valid speeds, so check the velocities first
+  return withinValidInputRange(minimumVelocity) && withinValidInputRange(maximumVelocity)
+    && (input.speedLon.minimum <= input.speedLon.maximum) && (input.speedLat.minimum <= input.speedLat.maximum);
+}
+
+/**
+ * @brief check if the given SituationUncertainty is within valid input range
+ *
+ * @returns \c true if the uncertainties of the vehicle states and the distance ranges are within valid input range
+ */
+inline bool withinValidInputRange(::ad_rss::situation::SituationUncertainty const &input)
+{
+  return withinValidInputRange(input.egoVehicleState) && withinValidInputRange(input.otherVehicleState)
+    && withinValidInputRange(input.longitudinalDistance) && withinValidInputRange(input.lateralDistance);
+}
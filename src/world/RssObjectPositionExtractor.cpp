@@ -49,8 +49,35 @@ using physics::Distance;
 using physics::MetricRange;
 
 RssObjectPositionExtractor::RssObjectPositionExtractor(OccupiedRegionVector const &occupiedRegions)
-  : mOccupiedRegions(occupiedRegions)
 {
+  reset(occupiedRegions);
+}
+
+void RssObjectPositionExtractor::reset(OccupiedRegionVector const &occupiedRegions)
+{
+  mOccupiedRegions = &occupiedRegions;
+  mRemainingRegions = occupiedRegions.size();
+  mRegionProcessed.assign(occupiedRegions.size(), false);
+
+  mSortedRegionIndices.resize(occupiedRegions.size());
+  for (std::size_t i = 0u; i < occupiedRegions.size(); i++)
+  {
+    mSortedRegionIndices[i] = i;
+  }
+  // the index is part of the key to keep the original order of regions within the same segment
+  // (std::stable_sort is not used, because it may allocate temporary memory)
+  std::sort(mSortedRegionIndices.begin(),
+            mSortedRegionIndices.end(),
+            [&occupiedRegions](std::size_t const left, std::size_t const right) {
+              return (occupiedRegions[left].segmentId < occupiedRegions[right].segmentId)
+                || ((occupiedRegions[left].segmentId == occupiedRegions[right].segmentId) && (left < right));
+            });
+
+  mCurrentLongitudinalMax = Distance(0.);
+  mCurrentLongitudinalMin = Distance(0.);
+  mIntersectionReached = false;
+  mIntersectionEndReached = false;
+  mObjectDimensions = ObjectDimensions();
   mObjectDimensions.intersectionPosition.maximum = Distance(0.);
 }
 
@@ -69,26 +96,28 @@ bool RssObjectPositionExtractor::newLaneSegment(MetricRange lateralDistance, Lan
 {
   bool result = true;
 
-  bool noAdditionalObjects = false;
-  while (!noAdditionalObjects && !mOccupiedRegions.empty())
+  if (mRemainingRegions > 0u)
   {
-    auto const objectSegment
-      = std::find_if(mOccupiedRegions.begin(), mOccupiedRegions.end(), [laneSegment](OccupiedRegion const &region) {
-          return region.segmentId == laneSegment.id;
-        });
-    if (objectSegment == mOccupiedRegions.end())
-    {
-      noAdditionalObjects = true;
-    }
-    else
+    OccupiedRegionVector const &occupiedRegions = *mOccupiedRegions;
+    auto objectSegment = std::lower_bound(mSortedRegionIndices.cbegin(),
+                                          mSortedRegionIndices.cend(),
+                                          laneSegment.id,
+                                          [&occupiedRegions](std::size_t const index, LaneSegmentId const &segmentId) {
+                                            return occupiedRegions[index].segmentId < segmentId;
+                                          });
+
+    // all regions of a segment are processed at once, so only the first lane segment with this id takes these
+    for (; (objectSegment != mSortedRegionIndices.cend())
+         && (occupiedRegions[*objectSegment].segmentId == laneSegment.id) && !mRegionProcessed[*objectSegment];
+         objectSegment++)
     {
-      Distance latMinPosition = lateralDistance.minimum + (objectSegment->latRange.minimum * laneSegment.width.minimum);
-      Distance latMaxPosition = lateralDistance.maximum + (objectSegment->latRange.maximum * laneSegment.width.maximum);
+      OccupiedRegion const &region = occupiedRegions[*objectSegment];
+
+      Distance latMinPosition = lateralDistance.minimum + (region.latRange.minimum * laneSegment.width.minimum);
+      Distance latMaxPosition = lateralDistance.maximum + (region.latRange.maximum * laneSegment.width.maximum);
 
-      Distance lonMinPosition
-        = mCurrentLongitudinalMin + (objectSegment->lonRange.minimum * laneSegment.length.minimum);
-      Distance lonMaxPosition
-        = mCurrentLongitudinalMax + (objectSegment->lonRange.maximum * laneSegment.length.maximum);
+      Distance lonMinPosition = mCurrentLongitudinalMin + (region.lonRange.minimum * laneSegment.length.minimum);
+      Distance lonMaxPosition = mCurrentLongitudinalMax + (region.lonRange.maximum * laneSegment.length.maximum);
 
       mObjectDimensions.lateralDimensions.minimum
         = std::min(mObjectDimensions.lateralDimensions.minimum, latMinPosition);
@@ -110,7 +139,8 @@ bool RssObjectPositionExtractor::newLaneSegment(MetricRange lateralDistance, Lan
         mObjectDimensions.onNegativeLane = true;
       }
 
-      mOccupiedRegions.erase(objectSegment);
+      mRegionProcessed[*objectSegment] = true;
+      mRemainingRegions--;
     }
   }
 
@@ -141,8 +171,8 @@ bool RssObjectPositionExtractor::newLaneSegment(MetricRange lateralDistance, Lan
 
 bool RssObjectPositionExtractor::getObjectDimensions(ObjectDimensions &objectDimensions)
 {
-  // if mOccupiedRegions is not empty, something went wrong
-  if (!mOccupiedRegions.empty())
+  // if not all occupied regions are processed, something went wrong
+  if (mRemainingRegions > 0u)
   {
     return false;
   }
@@ -34,7 +34,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <limits>
+#include <vector>
 #include "ad_rss/world/LaneSegment.hpp"
 #include "ad_rss/world/Object.hpp"
 
@@ -102,13 +104,32 @@ public:
 class RssObjectPositionExtractor
 {
 public:
+  /**
+   * @brief Default constructor
+   *
+   * The extractor has to be initialized by a call to reset() before use.
+   */
+  RssObjectPositionExtractor() = default;
+
   /**
    * @brief Constructor
    *
-   * @param occupiedRegions representing the object
+   * @param occupiedRegions representing the object. The occupied regions are not copied, so these have to stay valid
+   * while the extractor is in use.
    */
   explicit RssObjectPositionExtractor(OccupiedRegionVector const &occupiedRegions);
 
+  /**
+   * @brief Reinitialize the extractor for a new object
+   *
+   * The memory already allocated by the extractor is reused, so that after warm-up no further heap allocations are
+   * required.
+   *
+   * @param occupiedRegions representing the object. The occupied regions are not copied, so these have to stay valid
+   * while the extractor is in use.
+   */
+  void reset(OccupiedRegionVector const &occupiedRegions);
+
   /**
    * @brief Indicate that there is a new road segment
    *
@@ -141,7 +162,27 @@ public:
   bool getObjectDimensions(ObjectDimensions &objectDimensions);
 
 private:
-  OccupiedRegionVector mOccupiedRegions;
+  /**
+   * @brief the occupied regions of the object
+   */
+  OccupiedRegionVector const *mOccupiedRegions{nullptr};
+
+  /**
+   * @brief the indices of the occupied regions sorted by their segment id
+   *
+   * Regions with equal segment id are kept in their original order.
+   */
+  std::vector<std::size_t> mSortedRegionIndices;
+
+  /**
+   * @brief flags indicating if the occupied region (by index) was already processed
+   */
+  std::vector<bool> mRegionProcessed;
+
+  /**
+   * @brief the number of occupied regions not yet processed
+   */
+  std::size_t mRemainingRegions{0u};
 
   physics::Distance mCurrentLongitudinalMax{0};
   physics::Distance mCurrentLongitudinalMin{0};
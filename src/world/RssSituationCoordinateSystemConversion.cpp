@@ -38,6 +38,7 @@
 
 #include "world/RssObjectPositionExtractor.hpp"
 #include "world/RssSituationCoordinateSystemConversion.hpp"
+#include "world/RssWorldModelComparison.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -55,7 +56,7 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
 {
   bool result = true;
 
-  try
+  AD_RSS_TRY
   {
     MetricRange currentLateralPosition;
 
@@ -89,7 +90,7 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
       }
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     return false;
   }
@@ -146,82 +147,149 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
  *
  */
 
-bool calculateObjectDimensions(std::vector<Object> const &objects,
-                               RoadArea const &roadArea,
-                               std::vector<ObjectDimensions> &objectDimensions)
+bool calculateObjectDimensions(RoadArea const &roadArea,
+                               std::vector<MetricRange> const &lateralRanges,
+                               RssObjectPositionExtractor &extractor,
+                               ObjectDimensions &objectPosition)
 {
   bool result = true;
 
-  try
+  MetricRange longitudinalDimensions;
+
+  longitudinalDimensions.maximum = Distance(0.);
+  longitudinalDimensions.minimum = Distance(0.);
+
+  for (auto roadSegment = roadArea.cbegin(); roadSegment != roadArea.cend() && result; roadSegment++)
   {
-    std::vector<MetricRange> lateralRanges;
-    result = calculateLateralDimensions(roadArea, lateralRanges);
-    if (result)
-    {
-      MetricRange longitudinalDimensions;
+    Distance longitudinalDistanceMax = Distance(0.);
+    Distance longitudinalDistanceMin = Distance(0.);
+    result = extractor.newRoadSegment(longitudinalDimensions.minimum, longitudinalDimensions.maximum);
 
-      longitudinalDimensions.maximum = Distance(0.);
-      longitudinalDimensions.minimum = Distance(0.);
+    // This is needed, because we want to look for the minimum
+    longitudinalDistanceMin = std::numeric_limits<Distance>::max();
 
-      std::vector<RssObjectPositionExtractor> extractors;
-      for (const auto &object : objects)
+    for (std::size_t i = 0u; i < roadSegment->size() && result; i++)
+    {
+      if (i < lateralRanges.size())
       {
-        if (object.occupiedRegions.empty())
-        {
-          return false;
-        }
-        extractors.push_back(RssObjectPositionExtractor(object.occupiedRegions));
+        result = extractor.newLaneSegment(lateralRanges[i], (*roadSegment)[i]);
       }
-
-      for (auto roadSegment = roadArea.cbegin(); roadSegment != roadArea.cend() && result; roadSegment++)
+      else
       {
-        Distance longitudinalDistanceMax = Distance(0.);
-        Distance longitudinalDistanceMin = Distance(0.);
-        for (auto &extractor : extractors)
-        {
-          result = result && extractor.newRoadSegment(longitudinalDimensions.minimum, longitudinalDimensions.maximum);
-        }
+        result = false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
+      }
 
-        // This is needed, because we want to look for the minimum
-        longitudinalDistanceMin = std::numeric_limits<Distance>::max();
+      longitudinalDistanceMax = std::max(longitudinalDistanceMax, (*roadSegment)[i].length.maximum);
+      longitudinalDistanceMin = std::min(longitudinalDistanceMin, (*roadSegment)[i].length.minimum);
+    }
 
-        for (std::size_t i = 0u; i < roadSegment->size() && result; i++)
-        {
-          if (i < lateralRanges.size())
-          {
-            for (auto &extractor : extractors)
-            {
-              result = result && extractor.newLaneSegment(lateralRanges[i], (*roadSegment)[i]);
-            }
-          }
-          else
-          {
-            result = false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
-          }
-
-          longitudinalDistanceMax = std::max(longitudinalDistanceMax, (*roadSegment)[i].length.maximum);
-          longitudinalDistanceMin = std::min(longitudinalDistanceMin, (*roadSegment)[i].length.minimum);
-        }
+    if (result)
+    {
+      longitudinalDimensions.maximum += longitudinalDistanceMax;
+      longitudinalDimensions.minimum += longitudinalDistanceMin;
+    }
+  }
 
-        if (result)
-        {
-          longitudinalDimensions.maximum += longitudinalDistanceMax;
-          longitudinalDimensions.minimum += longitudinalDistanceMin;
-        }
-      }
+  if (result)
+  {
+    result = extractor.getObjectDimensions(objectPosition);
+  }
+
+  return result;
+}
+
+/**
+ * @brief the id of the first lane segment of the first road segment of the road area (0 if not available)
+ */
+LaneSegmentId getFirstLaneSegmentId(RoadArea const &roadArea)
+{
+  if (roadArea.empty() || roadArea.front().empty())
+  {
+    return 0u;
+  }
+  return roadArea.front().front().id;
+}
 
-      if (result)
+/**
+ * @brief the id of the last lane segment of the last road segment of the road area (0 if not available)
+ */
+LaneSegmentId getLastLaneSegmentId(RoadArea const &roadArea)
+{
+  if (roadArea.empty() || roadArea.back().empty())
+  {
+    return 0u;
+  }
+  return roadArea.back().back().id;
+}
+
+/**
+ * @brief check if the cache entry was calculated for a road area identical to the given one
+ */
+bool isCachedRoadArea(EgoVehicleRoadDimensions const &cacheEntry,
+                      RoadArea const &roadArea,
+                      LaneSegmentId const firstLaneSegmentId,
+                      LaneSegmentId const lastLaneSegmentId)
+{
+  // compare the cheap keys first, the complete comparison is only required for matching keys
+  return (cacheEntry.numberOfRoadSegments == roadArea.size()) && (cacheEntry.firstLaneSegmentId == firstLaneSegmentId)
+    && (cacheEntry.lastLaneSegmentId == lastLaneSegmentId) && isIdentical(cacheEntry.egoVehicleRoad, roadArea);
+}
+
+bool calculateEgoVehicleDimensions(Object const &egoVehicle,
+                                   RoadArea const &egoVehicleRoad,
+                                   ObjectDimensionsBuffer &buffer,
+                                   EgoVehicleRoadDimensions const *&egoVehicleRoadDimensions)
+{
+  egoVehicleRoadDimensions = nullptr;
+  if (egoVehicle.occupiedRegions.empty())
+  {
+    return false;
+  }
+
+  bool result = true;
+
+  AD_RSS_TRY
+  {
+    LaneSegmentId const firstLaneSegmentId = getFirstLaneSegmentId(egoVehicleRoad);
+    LaneSegmentId const lastLaneSegmentId = getLastLaneSegmentId(egoVehicleRoad);
+    for (std::size_t i = 0u; i < buffer.egoVehicleCacheSize; i++)
+    {
+      if (isCachedRoadArea(buffer.egoVehicleCache[i], egoVehicleRoad, firstLaneSegmentId, lastLaneSegmentId))
       {
-        for (auto &extractor : extractors)
-        {
-          ObjectDimensions extractedDimensions;
-          result = result && extractor.getObjectDimensions(extractedDimensions);
-          objectDimensions.push_back(extractedDimensions);
-        }
+        egoVehicleRoadDimensions = &buffer.egoVehicleCache[i];
+        return true;
       }
     }
+
+    if (buffer.egoVehicleCacheSize == buffer.egoVehicleCache.size())
+    {
+      buffer.egoVehicleCache.emplace_back();
+    }
+    EgoVehicleRoadDimensions &cacheEntry = buffer.egoVehicleCache[buffer.egoVehicleCacheSize];
+
+    cacheEntry.lateralRanges.clear();
+    result = calculateLateralDimensions(egoVehicleRoad, cacheEntry.lateralRanges);
+
+    if (result)
+    {
+      buffer.extractor.reset(egoVehicle.occupiedRegions);
+      result = calculateObjectDimensions(
+        egoVehicleRoad, cacheEntry.lateralRanges, buffer.extractor, cacheEntry.egoVehiclePosition);
+    }
+
+    // a failing calculation must not enter the cache
+    if (result && !physics::rangeErrorRaised())
+    {
+      cacheEntry.numberOfRoadSegments = egoVehicleRoad.size();
+      cacheEntry.firstLaneSegmentId = firstLaneSegmentId;
+      cacheEntry.lastLaneSegmentId = lastLaneSegmentId;
+      // the assignment reuses the memory of the entry
+      cacheEntry.egoVehicleRoad = egoVehicleRoad;
+      buffer.egoVehicleCacheSize++;
+      egoVehicleRoadDimensions = &cacheEntry;
+    }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
   {
     return false;
   }
@@ -232,30 +300,52 @@ bool calculateObjectDimensions(std::vector<Object> const &objects,
 bool calculateObjectDimensions(Object const &egoVehicle,
                                Scene const &currentScene,
                                ObjectDimensions &egoVehiclePosition,
-                               ObjectDimensions &objectPosition)
+                               ObjectDimensions &objectPosition,
+                               ObjectDimensionsBuffer &buffer)
 {
+  if (egoVehicle.occupiedRegions.empty() || currentScene.object.occupiedRegions.empty())
+  {
+    return false;
+  }
+
   bool result = true;
 
-  try
+  AD_RSS_TRY
   {
-    std::vector<Object> objects;
-    objects.push_back(egoVehicle);
-    objects.push_back(currentScene.object);
+    EgoVehicleRoadDimensions const *egoVehicleRoadDimensions = nullptr;
+    result = calculateEgoVehicleDimensions(egoVehicle, currentScene.egoVehicleRoad, buffer, egoVehicleRoadDimensions);
 
-    std::vector<ObjectDimensions> objectDimensions;
-    result = calculateObjectDimensions(objects, currentScene.egoVehicleRoad, objectDimensions);
-
-    if (result && (objectDimensions.size() == 2))
-    {
-      egoVehiclePosition = objectDimensions[0];
-      objectPosition = objectDimensions[1];
-    }
-    else
+    if (result)
     {
-      result = false;
+      egoVehiclePosition = egoVehicleRoadDimensions->egoVehiclePosition;
+      buffer.extractor.reset(currentScene.object.occupiedRegions);
+      result = calculateObjectDimensions(currentScene.egoVehicleRoad,
+                                         egoVehicleRoadDimensions->lateralRanges,
+                                         buffer.extractor,
+                                         objectPosition);
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
+  {
+    return false;
+  }
+
+  return result;
+}
+
+bool calculateObjectDimensions(Object const &egoVehicle,
+                               Scene const &currentScene,
+                               ObjectDimensions &egoVehiclePosition,
+                               ObjectDimensions &objectPosition)
+{
+  bool result = false;
+
+  AD_RSS_TRY
+  {
+    ObjectDimensionsBuffer buffer;
+    result = calculateObjectDimensions(egoVehicle, currentScene, egoVehiclePosition, objectPosition, buffer);
+  }
+  AD_RSS_CATCH_ALL
   {
     return false;
   }
@@ -265,28 +355,47 @@ bool calculateObjectDimensions(Object const &egoVehicle,
 
 bool calculateObjectDimensions(Object const &object,
                                ::ad_rss::world::RoadArea const &roadArea,
-                               ObjectDimensions &objectPosition)
+                               ObjectDimensions &objectPosition,
+                               ObjectDimensionsBuffer &buffer)
 {
+  if (object.occupiedRegions.empty())
+  {
+    return false;
+  }
+
   bool result = true;
 
-  try
+  AD_RSS_TRY
   {
-    std::vector<Object> objects;
-    objects.push_back(object);
-
-    std::vector<ObjectDimensions> objectDimensions;
-    result = calculateObjectDimensions(objects, roadArea, objectDimensions);
+    buffer.lateralRanges.clear();
+    result = calculateLateralDimensions(roadArea, buffer.lateralRanges);
 
-    if (result && (objectDimensions.size() == 1))
-    {
-      objectPosition = objectDimensions[0];
-    }
-    else
+    if (result)
     {
-      result = false;
+      buffer.extractor.reset(object.occupiedRegions);
+      result = calculateObjectDimensions(roadArea, buffer.lateralRanges, buffer.extractor, objectPosition);
     }
   }
-  catch (...)
+  AD_RSS_CATCH_ALL
+  {
+    return false;
+  }
+
+  return result;
+}
+
+bool calculateObjectDimensions(Object const &object,
+                               ::ad_rss::world::RoadArea const &roadArea,
+                               ObjectDimensions &objectPosition)
+{
+  bool result = false;
+
+  AD_RSS_TRY
+  {
+    ObjectDimensionsBuffer buffer;
+    result = calculateObjectDimensions(object, roadArea, objectPosition, buffer);
+  }
+  AD_RSS_CATCH_ALL
   {
     return false;
   }
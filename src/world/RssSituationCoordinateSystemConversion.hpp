@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
 #include "ad_rss/situation/VehicleState.hpp"
 #include "ad_rss/world/Object.hpp"
 #include "ad_rss/world/WorldModel.hpp"
@@ -48,6 +50,126 @@ namespace ad_rss {
  */
 namespace world {
 
+/**
+ * @brief the position ranges of the ego vehicle within a specific road area
+ */
+struct EgoVehicleRoadDimensions
+{
+  /**
+   * @brief the number of road segments of the road area the dimensions were calculated for
+   *
+   * Together with firstLaneSegmentId and lastLaneSegmentId used to reject non-matching entries cheaply before the
+   * road areas are compared completely.
+   */
+  std::size_t numberOfRoadSegments{0u};
+
+  /**
+   * @brief the id of the first lane segment of the first road segment (0 if not available)
+   */
+  LaneSegmentId firstLaneSegmentId{0u};
+
+  /**
+   * @brief the id of the last lane segment of the last road segment (0 if not available)
+   */
+  LaneSegmentId lastLaneSegmentId{0u};
+
+  /**
+   * @brief a copy of the road area the dimensions were calculated for
+   *
+   * The entry does not refer to the world model, so it stays valid when the world model is modified or destroyed.
+   */
+  RoadArea egoVehicleRoad;
+
+  /**
+   * @brief the lateral ranges of the lanes within the road area (see calculateLateralDimensions())
+   */
+  std::vector<physics::MetricRange> lateralRanges;
+
+  /**
+   * @brief the position ranges of the ego vehicle within the road area
+   */
+  ObjectDimensions egoVehiclePosition;
+};
+
+/**
+ * @brief buffers required for the calculation of the object position ranges
+ *
+ * Passing the same buffer to consecutive calculations reuses the already allocated memory.
+ * Once the buffers have grown to the required size no further heap allocations take place.
+ *
+ * In addition, the buffer caches the ego vehicle position ranges per distinct ego vehicle road area. Since the
+ * ego vehicle is the same for all scenes of a world model, the ego vehicle position has to be calculated only once
+ * for all scenes sharing identical ego vehicle road areas. The cache has to be cleared by clearEgoVehicleCache()
+ * whenever the ego vehicle changes.
+ */
+struct ObjectDimensionsBuffer
+{
+  /**
+   * @brief clear the cached ego vehicle position ranges
+   *
+   * The allocated memory is kept for reuse.
+   */
+  void clearEgoVehicleCache()
+  {
+    egoVehicleCacheSize = 0u;
+  }
+
+  /**
+   * @brief the lateral ranges of the lanes within the road area (see calculateLateralDimensions())
+   */
+  std::vector<physics::MetricRange> lateralRanges;
+
+  /**
+   * @brief the extractor used for the objects
+   */
+  RssObjectPositionExtractor extractor;
+
+  /**
+   * @brief the cached ego vehicle position ranges
+   *
+   * Only the first egoVehicleCacheSize entries are valid, the remaining ones are kept for memory reuse.
+   */
+  std::vector<EgoVehicleRoadDimensions> egoVehicleCache;
+
+  /**
+   * @brief the number of valid entries within the egoVehicleCache
+   */
+  std::size_t egoVehicleCacheSize{0u};
+};
+
+/**
+ * @brief Calculate the position ranges of the ego vehicle within the given road area
+ *
+ * If the position ranges were already calculated for an identical road area since the last call to
+ * ObjectDimensionsBuffer::clearEgoVehicleCache() the cached result is returned.
+ *
+ * @param[in] egoVehicle information about the egoVehicle
+ * @param[in] egoVehicleRoad the road area of the ego vehicle
+ * @param[in,out] buffer: the buffers to be used for the calculation
+ * @param[out] egoVehicleRoadDimensions: the cache entry holding the lateral ranges and the ego vehicle position
+ * ranges. The entry stays valid until the buffer is used for the next calculation.
+ */
+bool calculateEgoVehicleDimensions(Object const &egoVehicle,
+                                   RoadArea const &egoVehicleRoad,
+                                   ObjectDimensionsBuffer &buffer,
+                                   EgoVehicleRoadDimensions const *&egoVehicleRoadDimensions);
+
+/**
+ * @brief Calculate the object position ranges in the situation coordinate system
+ *
+ * @param[in] egoVehicle information about the egoVehicle
+ * @param[in] currentScene information about the other object and the lanes
+ * @param[out] egoVehiclePosition: position ranges in the situation coordinate system of the egoVehicle
+ * @param[out] objectPosition: position ranges in the situation coordinate system of the other object
+ * @param[in,out] buffer: the buffers to be used for the calculation. The ego vehicle position is taken from the
+ * cache of the buffer if available (see calculateEgoVehicleDimensions()).
+ */
+bool calculateObjectDimensions(Object const &egoVehicle,
+                               Scene const &currentScene,
+                               ObjectDimensions &egoVehiclePosition,
+                               ObjectDimensions &objectPosition,
+                               ObjectDimensionsBuffer &buffer);
+
 /**
  * @brief Calculate the object position ranges in the situation coordinate system
  *
@@ -70,6 +192,19 @@ bool calculateObjectDimensions(Object const &egoVehicle,
  */
 bool calculateObjectDimensions(Object const &object, RoadArea const &roadArea, ObjectDimensions &objectPosition);
 
+/**
+ * @brief Calculate the object position ranges in the situation coordinate system
+ *
+ * @param[in] object: information about the object
+ * @param[in] roadArea: information about the lanes
+ * @param[out] objectPosition: position ranges in the situation coordinate system of the other object
+ * @param[in,out] buffer: the buffers to be used for the calculation
+ */
+bool calculateObjectDimensions(Object const &object,
+                               RoadArea const &roadArea,
+                               ObjectDimensions &objectPosition,
+                               ObjectDimensionsBuffer &buffer);
+
 /**
  * @brief Convert object to vehicle state
  *
@@ -0,0 +1,142 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#include "world/RssWorldModelComparison.hpp"
+#include <functional>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+namespace {
+
+template <typename PhysicsType> bool isIdenticalValue(PhysicsType const &left, PhysicsType const &right)
+{
+  std::equal_to<double> const isEqual;
+  return isEqual(static_cast<double>(left), static_cast<double>(right));
+}
+
+template <typename RangeType> bool isIdenticalRange(RangeType const &left, RangeType const &right)
+{
+  return isIdenticalValue(left.minimum, right.minimum) && isIdenticalValue(left.maximum, right.maximum);
+}
+
+bool isIdentical(LaneSegment const &left, LaneSegment const &right)
+{
+  return (left.id == right.id) && (left.type == right.type) && (left.drivingDirection == right.drivingDirection)
+    && isIdenticalRange(left.length, right.length) && isIdenticalRange(left.width, right.width);
+}
+
+bool isIdentical(OccupiedRegion const &left, OccupiedRegion const &right)
+{
+  return (left.segmentId == right.segmentId) && isIdenticalRange(left.lonRange, right.lonRange)
+    && isIdenticalRange(left.latRange, right.latRange);
+}
+
+bool isIdentical(Dynamics const &left, Dynamics const &right)
+{
+  return isIdenticalValue(left.alphaLon.accelMax, right.alphaLon.accelMax)
+    && isIdenticalValue(left.alphaLon.brakeMax, right.alphaLon.brakeMax)
+    && isIdenticalValue(left.alphaLon.brakeMin, right.alphaLon.brakeMin)
+    && isIdenticalValue(left.alphaLon.brakeMinCorrect, right.alphaLon.brakeMinCorrect)
+    && isIdenticalValue(left.alphaLat.accelMax, right.alphaLat.accelMax)
+    && isIdenticalValue(left.alphaLat.brakeMin, right.alphaLat.brakeMin)
+    && isIdenticalValue(left.lateralFluctuationMargin, right.lateralFluctuationMargin);
+}
+
+} // namespace
+
+bool isIdentical(RoadArea const &left, RoadArea const &right)
+{
+  if (&left == &right)
+  {
+    return true;
+  }
+  if (left.size() != right.size())
+  {
+    return false;
+  }
+  for (std::size_t segmentIndex = 0u; segmentIndex < left.size(); segmentIndex++)
+  {
+    RoadSegment const &leftSegment = left[segmentIndex];
+    RoadSegment const &rightSegment = right[segmentIndex];
+    if (leftSegment.size() != rightSegment.size())
+    {
+      return false;
+    }
+    for (std::size_t laneIndex = 0u; laneIndex < leftSegment.size(); laneIndex++)
+    {
+      if (!isIdentical(leftSegment[laneIndex], rightSegment[laneIndex]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool isIdentical(Object const &left, Object const &right)
+{
+  if ((left.objectId != right.objectId) || (left.objectType != right.objectType)
+      || (left.occupiedRegions.size() != right.occupiedRegions.size()) || !isIdentical(left.dynamics, right.dynamics)
+      || !isIdenticalValue(left.velocity.speedLon, right.velocity.speedLon)
+      || !isIdenticalValue(left.velocity.speedLat, right.velocity.speedLat)
+      || !isIdenticalValue(left.responseTime, right.responseTime))
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < left.occupiedRegions.size(); i++)
+  {
+    if (!isIdentical(left.occupiedRegions[i], right.occupiedRegions[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isIdentical(Scene const &left, Scene const &right)
+{
+  return (left.situationType == right.situationType) && isIdentical(left.object, right.object)
+    && isIdentical(left.egoVehicleRoad, right.egoVehicleRoad)
+    && isIdentical(left.intersectingRoad, right.intersectingRoad);
+}
+
+} // namespace world
+} // namespace ad_rss
@@ -0,0 +1,85 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/world/Object.hpp"
+#include "ad_rss/world/RoadArea.hpp"
+#include "ad_rss/world/Scene.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/**
+ * @brief Check if two road areas are identical
+ *
+ * In contrast to the comparison operators of the data types, which respect the precision of the physics types,
+ * the values are compared for exact equality. Identical inputs are required when reusing previously calculated
+ * results.
+ *
+ * @param[in] left the first road area
+ * @param[in] right the second road area
+ *
+ * @returns true if both road areas are identical
+ */
+bool isIdentical(RoadArea const &left, RoadArea const &right);
+
+/**
+ * @brief Check if two objects are identical (see isIdentical(RoadArea const &, RoadArea const &))
+ *
+ * @param[in] left the first object
+ * @param[in] right the second object
+ *
+ * @returns true if both objects are identical
+ */
+bool isIdentical(Object const &left, Object const &right);
+
+/**
+ * @brief Check if two scenes are identical (see isIdentical(RoadArea const &, RoadArea const &))
+ *
+ * @param[in] left the first scene
+ * @param[in] right the second scene
+ *
+ * @returns true if both scenes are identical
+ */
+bool isIdentical(Scene const &left, Scene const &right);
+
+} // namespace world
+} // namespace ad_rss
@@ -0,0 +1,69 @@
+# ----------------- BEGIN LICENSE BLOCK ---------------------------------
+#
+# INTEL CONFIDENTIAL
+#
+# Copyright (c) 2019 Intel Corporation
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors
+#    may be used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+#    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+#    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+#    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+#    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+#    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+#    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+#    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+#    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#    POSSIBILITY OF SUCH DAMAGE.
+#
+
+#####################################################################
+# Check the symbols of an object file compiled for a specific instruction set
+#
+# The object file must not define any external symbol (incl. weak symbols of inline functions) besides its entry
+# point, otherwise the linker might select code using the instruction set for other translation units.
+#
+# Parameters: NM - the nm executable, OBJECT - the object file, ENTRY_POINT - the demangled name of the entry point
+#####################################################################
+
+execute_process(COMMAND "${NM}" -C -g --defined-only "${OBJECT}"
+  RESULT_VARIABLE nm_result
+  OUTPUT_VARIABLE nm_output
+  ERROR_VARIABLE nm_error)
+if(NOT nm_result EQUAL 0)
+  message(FATAL_ERROR "Failed to read the symbols of ${OBJECT}: ${nm_error}")
+endif()
+
+string(REPLACE "\n" ";" symbol_lines "${nm_output}")
+set(entry_point_found FALSE)
+set(unexpected_symbols "")
+foreach(symbol_line ${symbol_lines})
+  # format: <address> <type> <name>
+  string(REGEX REPLACE "^[0-9a-fA-F]* *[A-Za-z] " "" symbol "${symbol_line}")
+  if("${symbol}" STREQUAL "${ENTRY_POINT}")
+    set(entry_point_found TRUE)
+  elseif(NOT "${symbol}" STREQUAL "")
+    set(unexpected_symbols "${unexpected_symbols}\n  ${symbol_line}")
+  endif()
+endforeach()
+
+if(NOT entry_point_found)
+  message(FATAL_ERROR "${OBJECT} doesn't define the entry point ${ENTRY_POINT}")
+endif()
+if(NOT "${unexpected_symbols}" STREQUAL "")
+  message(FATAL_ERROR "${OBJECT} defines external symbols besides ${ENTRY_POINT}:${unexpected_symbols}")
+endif()
+message(STATUS "${OBJECT} only defines ${ENTRY_POINT}")
@@ -0,0 +1,138 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckAllocationTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  ::ad_rss::core::RssCheckConfiguration configuration;
+
+  void performAllocationTest()
+  {
+    ::ad_rss::world::AccelerationRestriction accelerationRestriction;
+    ::ad_rss::core::RssCheck rssCheck(configuration);
+
+    // warm-up: the internal buffers grow to their required size
+    for (uint32_t i = 0; i < 3; i++)
+    {
+      worldModel.timeIndex++;
+      ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+    }
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+      worldModel.timeIndex++;
+      gNewCallCounter = 0u;
+      ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+      EXPECT_EQ(0u, gNewCallCounter);
+    }
+  }
+};
+
+class RssCheckAllocationSameDirectionTest : public RssCheckAllocationTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 4u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment6;
+      case 1u:
+        return objectOnSegment7;
+      case 2u:
+        return objectOnSegment8;
+      default:
+        return objectOnSegment4;
+    }
+  }
+};
+
+TEST_F(RssCheckAllocationSameDirectionTest, noAllocationsAfterWarmUp)
+{
+  performAllocationTest();
+}
+
+TEST_F(RssCheckAllocationSameDirectionTest, noAllocationsAfterWarmUpWithWorkerThreads)
+{
+  configuration.numberOfWorkerThreads = 2u;
+  performAllocationTest();
+}
+
+TEST_F(RssCheckAllocationSameDirectionTest, noAllocationsAfterWarmUpWithBatchEvaluation)
+{
+  configuration.enableBatchEvaluation = true;
+  performAllocationTest();
+}
+
+class RssCheckAllocationIntersectionTest : public RssCheckAllocationTestBase<RssCheckTestBase>
+{
+protected:
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+};
+
+TEST_F(RssCheckAllocationIntersectionTest, noAllocationsAfterWarmUp)
+{
+  performAllocationTest();
+}
+
+TEST_F(RssCheckAllocationIntersectionTest, noAllocationsAfterWarmUpWithWorkerThreads)
+{
+  configuration.numberOfWorkerThreads = 2u;
+  performAllocationTest();
+}
+
+} // namespace core
+} // namespace ad_rss
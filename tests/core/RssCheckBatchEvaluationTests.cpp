@@ -0,0 +1,91 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckMixedScenesTestBase.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckBatchEvaluationTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  void updateScenes(uint32_t const tick)
+  {
+    worldModel.egoVehicle.velocity.speedLon = Speed(5. + tick);
+    worldModel.egoVehicle.velocity.speedLat = Speed(0.1 * tick - 1.);
+    for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+    {
+      worldModel.scenes[i].object.velocity.speedLon = Speed(25. - tick + static_cast<double>(i));
+      worldModel.scenes[i].object.velocity.speedLat = Speed(0.2 * static_cast<double>(i % 3u) - 0.2);
+    }
+  }
+};
+
+TEST_F(RssCheckBatchEvaluationTests, changingWorldModel)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBatchEvaluation = true;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) { updateScenes(tick); });
+}
+
+TEST_F(RssCheckBatchEvaluationTests, changingWorldModelWithIncrementalEvaluationAndWorkerThreads)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBatchEvaluation = true;
+  configuration.enableIncrementalEvaluation = true;
+  configuration.numberOfWorkerThreads = 2u;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) {
+    if ((tick % 2u) == 0u)
+    {
+      updateScenes(tick);
+    }
+  });
+}
+
+TEST_F(RssCheckBatchEvaluationTests, failingSituation)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBatchEvaluation = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+
+  // input within the valid input range, but the speed after the response time exceeds the range of Speed
+  worldModel.egoVehicle.velocity.speedLon = Speed(100.);
+  worldModel.egoVehicle.dynamics.alphaLon.accelMax = Acceleration(100.);
+  worldModel.egoVehicle.responseTime = Duration(10.);
+  worldModel.timeIndex++;
+  EXPECT_FALSE(defaultRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+}
+
+} // namespace core
+} // namespace ad_rss
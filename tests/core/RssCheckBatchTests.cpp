@@ -0,0 +1,141 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckBatch.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckBatchTests : public RssCheckTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment6;
+      case 1u:
+        return objectOnSegment7;
+      default:
+        return objectOnSegment8;
+    }
+  }
+
+  std::vector<world::WorldModel> createWorldModels(std::size_t const batchSize)
+  {
+    std::vector<world::WorldModel> worldModels;
+    for (std::size_t i = 0u; i < batchSize; i++)
+    {
+      worldModels.push_back(worldModel);
+      worldModels.back().egoVehicle.velocity.speedLon = Speed(5. + static_cast<double>(i));
+    }
+    return worldModels;
+  }
+};
+
+TEST_F(RssCheckBatchTests, resultsEqualSingleChecks)
+{
+  std::size_t const batchSize = 7u;
+  std::vector<world::WorldModel> worldModels = createWorldModels(batchSize);
+  std::vector<std::unique_ptr<RssCheck>> singleChecks;
+  for (std::size_t i = 0u; i < batchSize; i++)
+  {
+    singleChecks.push_back(std::unique_ptr<RssCheck>(new RssCheck()));
+  }
+
+  RssCheckBatch rssCheckBatch(batchSize, 3u);
+  ASSERT_EQ(batchSize, rssCheckBatch.getBatchSize());
+
+  std::vector<world::AccelerationRestriction> accelerationRestrictions(batchSize);
+  bool checkResults[batchSize];
+  for (uint32_t tick = 0u; tick < 10u; tick++)
+  {
+    for (std::size_t i = 0u; i < batchSize; i++)
+    {
+      worldModels[i].timeIndex++;
+      worldModels[i].scenes[0].object.velocity.speedLon = Speed(20. - tick);
+    }
+
+    ASSERT_TRUE(rssCheckBatch.calculateAccelerationRestrictions(
+      worldModels.data(), worldModels.size(), accelerationRestrictions.data(), checkResults));
+
+    for (std::size_t i = 0u; i < batchSize; i++)
+    {
+      world::AccelerationRestriction expectedRestriction;
+      ASSERT_TRUE(singleChecks[i]->calculateAccelerationRestriction(worldModels[i], expectedRestriction));
+      ASSERT_TRUE(checkResults[i]);
+      ASSERT_EQ(expectedRestriction, accelerationRestrictions[i]);
+    }
+  }
+}
+
+TEST_F(RssCheckBatchTests, singleFailingEntry)
+{
+  std::size_t const batchSize = 4u;
+  std::vector<world::WorldModel> worldModels = createWorldModels(batchSize);
+  worldModels[2].timeIndex = 0u;
+
+  RssCheckBatch rssCheckBatch(batchSize);
+  std::vector<world::AccelerationRestriction> accelerationRestrictions(batchSize);
+  bool checkResults[batchSize];
+  ASSERT_FALSE(rssCheckBatch.calculateAccelerationRestrictions(
+    worldModels.data(), worldModels.size(), accelerationRestrictions.data(), checkResults));
+  ASSERT_TRUE(checkResults[0]);
+  ASSERT_TRUE(checkResults[1]);
+  ASSERT_FALSE(checkResults[2]);
+  ASSERT_TRUE(checkResults[3]);
+}
+
+TEST_F(RssCheckBatchTests, invalidInputs)
+{
+  std::size_t const batchSize = 2u;
+  std::vector<world::WorldModel> worldModels = createWorldModels(batchSize + 1u);
+  std::vector<world::AccelerationRestriction> accelerationRestrictions(batchSize + 1u);
+
+  RssCheckBatch rssCheckBatch(batchSize, 1u);
+  ASSERT_FALSE(rssCheckBatch.calculateAccelerationRestrictions(
+    worldModels.data(), worldModels.size(), accelerationRestrictions.data(), nullptr));
+  ASSERT_FALSE(
+    rssCheckBatch.calculateAccelerationRestrictions(nullptr, batchSize, accelerationRestrictions.data(), nullptr));
+  ASSERT_FALSE(rssCheckBatch.calculateAccelerationRestrictions(worldModels.data(), batchSize, nullptr, nullptr));
+  ASSERT_TRUE(rssCheckBatch.calculateAccelerationRestrictions(
+    worldModels.data(), batchSize, accelerationRestrictions.data(), nullptr));
+}
+
+} // namespace core
+} // namespace ad_rss
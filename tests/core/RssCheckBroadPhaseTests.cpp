@@ -0,0 +1,267 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+#include <algorithm>
+#include <cstdio>
+#include "RssCheckMixedScenesTestBase.hpp"
+#include "ad_rss/core/RssLogReplay.hpp"
+#include "ad_rss/core/RssLogWriter.hpp"
+#include "core/RssBroadPhase.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckBroadPhaseTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  // the objects on the segments 6 and 7 are far ahead of the ego vehicle, the ones on the segments 3 to 5 not
+  Distance getMiddleRoadSegmentLength() override
+  {
+    return Distance(400);
+  }
+
+  void updateScenes(uint32_t const tick)
+  {
+    worldModel.egoVehicle.velocity.speedLon = Speed(5. + 2. * tick);
+    worldModel.egoVehicle.velocity.speedLat = Speed(0.1 * tick - 1.);
+    for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+    {
+      worldModel.scenes[i].object.velocity.speedLon = Speed(25. - tick + static_cast<double>(i));
+      worldModel.scenes[i].object.velocity.speedLat = Speed(0.2 * static_cast<double>(i % 3u) - 0.2);
+    }
+  }
+};
+
+TEST_F(RssCheckBroadPhaseTests, changingWorldModel)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBroadPhaseCulling = true;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) { updateScenes(tick); });
+}
+
+TEST_F(RssCheckBroadPhaseTests, changingWorldModelWithIncrementalAndBatchEvaluationAndWorkerThreads)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBroadPhaseCulling = true;
+  configuration.enableIncrementalEvaluation = true;
+  configuration.enableBatchEvaluation = true;
+  configuration.numberOfWorkerThreads = 2u;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) {
+    if ((tick % 2u) == 0u)
+    {
+      updateScenes(tick);
+    }
+  });
+}
+
+TEST_F(RssCheckBroadPhaseTests, culledScenes)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBroadPhaseCulling = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+  world::AccelerationRestriction defaultAccelerationRestriction;
+  situation::SituationVector defaultSituationVector;
+  state::ResponseStateVector defaultResponseStateVector;
+  ASSERT_TRUE(defaultRssCheck.calculateAccelerationRestriction(
+    worldModel, defaultAccelerationRestriction, defaultSituationVector, defaultResponseStateVector));
+  EXPECT_EQ(defaultAccelerationRestriction, accelerationRestriction);
+
+  RssBroadPhase broadPhase;
+  broadPhase.cullScenes(worldModel, nullptr);
+  // same and opposite direction scenes of the objects on the segments 6 and 7
+  EXPECT_EQ(4u, broadPhase.getNumberOfCulledScenes());
+  ASSERT_EQ(defaultSituationVector.size(), situationVector.size() + broadPhase.getNumberOfCulledScenes());
+
+  // no situation is extracted from the culled scenes, the other situations and response states are unchanged
+  std::size_t situationIndex = 0u;
+  std::size_t defaultSituationIndex = 0u;
+  for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); sceneIndex++)
+  {
+    EXPECT_EQ(nullptr, broadPhase.getSituation(sceneIndex));
+    EXPECT_EQ(nullptr, broadPhase.getResponseState(sceneIndex));
+    if (worldModel.scenes[sceneIndex].situationType == situation::SituationType::NotRelevant)
+    {
+      EXPECT_FALSE(broadPhase.isSceneCulled(sceneIndex));
+      continue;
+    }
+    ASSERT_LT(defaultSituationIndex, defaultSituationVector.size());
+    if (broadPhase.isSceneCulled(sceneIndex))
+    {
+      // the exact evaluation is longitudinally safe, too
+      EXPECT_TRUE(defaultResponseStateVector[defaultSituationIndex].longitudinalState.isSafe);
+      EXPECT_EQ(situation::SituationId(worldModel.scenes[sceneIndex].object.objectId),
+                defaultSituationVector[defaultSituationIndex].situationId);
+    }
+    else
+    {
+      ASSERT_LT(situationIndex, situationVector.size());
+      EXPECT_EQ(defaultSituationVector[defaultSituationIndex], situationVector[situationIndex]);
+      EXPECT_EQ(defaultResponseStateVector[defaultSituationIndex], responseStateVector[situationIndex]);
+      situationIndex++;
+    }
+    defaultSituationIndex++;
+  }
+  EXPECT_EQ(situationVector.size(), situationIndex);
+}
+
+TEST_F(RssCheckBroadPhaseTests, fastVehiclesAreNotCulled)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBroadPhaseCulling = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+
+  worldModel.egoVehicle.velocity.speedLon = Speed(60.);
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.object.velocity.speedLon = Speed(60.);
+  }
+
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+  world::AccelerationRestriction defaultAccelerationRestriction;
+  situation::SituationVector defaultSituationVector;
+  state::ResponseStateVector defaultResponseStateVector;
+  ASSERT_TRUE(defaultRssCheck.calculateAccelerationRestriction(
+    worldModel, defaultAccelerationRestriction, defaultSituationVector, defaultResponseStateVector));
+  EXPECT_EQ(defaultAccelerationRestriction, accelerationRestriction);
+  EXPECT_EQ(defaultSituationVector, situationVector);
+  EXPECT_EQ(defaultResponseStateVector, responseStateVector);
+}
+
+TEST_F(RssCheckBroadPhaseTests, failingScenesAreNotCulled)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableBroadPhaseCulling = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+
+  // the far object on segment 7 with an additional region not within the road area
+  auto farScene = std::find_if(worldModel.scenes.begin(), worldModel.scenes.end(), [](world::Scene const &scene) {
+    return (scene.situationType == situation::SituationType::SameDirection)
+      && (scene.object.occupiedRegions[0].segmentId == 7u);
+  });
+  ASSERT_NE(worldModel.scenes.end(), farScene);
+  world::Object &farObject = farScene->object;
+  farObject.occupiedRegions.push_back(farObject.occupiedRegions[0]);
+  farObject.occupiedRegions.back().segmentId = 99u;
+  worldModel.timeIndex++;
+  EXPECT_FALSE(defaultRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+
+  // the far object with the id of the ego vehicle
+  farObject.occupiedRegions.pop_back();
+  farObject.objectId = worldModel.egoVehicle.objectId;
+  worldModel.timeIndex++;
+  EXPECT_FALSE(defaultRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+}
+
+/**
+ * @brief result handler comparing the results against the sequential processing by an RssCheck
+ */
+class RssCheckBroadPhaseResultComparison : public RssLogReplay::ResultHandler
+{
+public:
+  explicit RssCheckBroadPhaseResultComparison(RssCheckConfiguration const &configuration)
+    : mRssCheck(configuration)
+  {
+  }
+
+  void handleResult(std::size_t const,
+                    world::WorldModel const &worldModel,
+                    bool const result,
+                    world::AccelerationRestriction const &accelerationRestriction,
+                    situation::SituationVector const &situationVector,
+                    state::ResponseStateVector const &responseStateVector) override
+  {
+    world::AccelerationRestriction expectedAccelerationRestriction;
+    situation::SituationVector expectedSituationVector;
+    state::ResponseStateVector expectedResponseStateVector;
+    bool const expectedResult = mRssCheck.calculateAccelerationRestriction(
+      worldModel, expectedAccelerationRestriction, expectedSituationVector, expectedResponseStateVector);
+    ASSERT_EQ(expectedResult, result);
+    EXPECT_EQ(expectedAccelerationRestriction, accelerationRestriction);
+    EXPECT_EQ(expectedSituationVector, situationVector);
+    EXPECT_EQ(expectedResponseStateVector, responseStateVector);
+    numberOfTicks++;
+  }
+
+  std::size_t numberOfTicks{0u};
+
+private:
+  RssCheck mRssCheck;
+};
+
+TEST_F(RssCheckBroadPhaseTests, temporalParallelReplay)
+{
+  char const *logFileName = "RssCheckBroadPhaseTests.rsslog";
+  RssLogWriter writer;
+  ASSERT_TRUE(writer.open(logFileName));
+  for (uint32_t tick = 0u; tick < 20u; tick++)
+  {
+    worldModel.timeIndex++;
+    updateScenes(tick);
+    ASSERT_TRUE(writer.write(worldModel));
+  }
+  ASSERT_TRUE(writer.close());
+
+  RssLogReader reader;
+  bool const opened = reader.open(logFileName);
+  std::remove(logFileName);
+  ASSERT_TRUE(opened);
+
+  RssLogReplayConfiguration configuration;
+  configuration.checkConfiguration.enableBroadPhaseCulling = true;
+  configuration.numberOfTemporalWorkerThreads = 2u;
+  configuration.temporalWindowSize = 6u;
+  RssLogReplay replay(configuration);
+  RssCheckBroadPhaseResultComparison resultComparison(configuration.checkConfiguration);
+  RssLogReplayStatistics statistics;
+  ASSERT_TRUE(replay.replay(reader, &resultComparison, statistics));
+  EXPECT_EQ(20u, resultComparison.numberOfTicks);
+  EXPECT_EQ(0u, statistics.numberOfFailedTicks);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,278 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssResponseTransformation.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "core/RssState.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckCandidateTestBase : public TESTBASE
+{
+protected:
+  static RssEgoCandidate createCandidate(world::Object const &egoVehicle, double const speedLon)
+  {
+    RssEgoCandidate candidate;
+    candidate.velocity = egoVehicle.velocity;
+    candidate.velocity.speedLon = kmhToMeterPerSec(speedLon);
+    candidate.dynamics = egoVehicle.dynamics;
+    return candidate;
+  }
+
+  /**
+   * @brief the world model with the ego vehicle state replaced by the candidate without lateral offset
+   */
+  static world::WorldModel applyCandidate(world::WorldModel const &worldModel, RssEgoCandidate const &candidate)
+  {
+    world::WorldModel candidateWorldModel = worldModel;
+    candidateWorldModel.egoVehicle.velocity = candidate.velocity;
+    candidateWorldModel.egoVehicle.dynamics = candidate.dynamics;
+    return candidateWorldModel;
+  }
+
+  std::vector<double> const candidateSpeeds{0., 10., 30., 50., 80., 100.};
+};
+
+using RssCheckCandidateTests = RssCheckCandidateTestBase<RssCheckTestBase>;
+
+TEST_F(RssCheckCandidateTests, candidates_match_modified_world_model)
+{
+  RssEgoCandidateVector candidates;
+  for (auto speed : candidateSpeeds)
+  {
+    candidates.push_back(createCandidate(worldModel.egoVehicle, speed));
+  }
+
+  RssCheck rssCheck;
+  state::ResponseStateVector candidateResponseStates;
+  ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+  ASSERT_EQ(candidateResponseStates.size(), candidates.size());
+
+  uint32_t numberOfDangerousCandidates = 0u;
+  for (std::size_t i = 0u; i < candidates.size(); i++)
+  {
+    world::WorldModel const candidateWorldModel = applyCandidate(worldModel, candidates[i]);
+    RssCheck candidateRssCheck;
+    world::AccelerationRestriction expectedRestriction;
+    ASSERT_TRUE(candidateRssCheck.calculateAccelerationRestriction(candidateWorldModel, expectedRestriction));
+
+    world::AccelerationRestriction accelerationRestriction;
+    ASSERT_TRUE(RssResponseTransformation::transformProperResponse(
+      candidateWorldModel, candidateResponseStates[i], accelerationRestriction));
+    EXPECT_EQ(accelerationRestriction, expectedRestriction) << "candidate " << i;
+    if (state::isDangerous(candidateResponseStates[i]))
+    {
+      numberOfDangerousCandidates++;
+    }
+  }
+  // the candidates cover safe and dangerous ego vehicle speeds
+  EXPECT_GT(numberOfDangerousCandidates, 0u);
+  EXPECT_LT(numberOfDangerousCandidates, candidates.size());
+}
+
+TEST_F(RssCheckCandidateTests, state_is_not_changed)
+{
+  RssEgoCandidateVector candidates;
+  for (auto speed : candidateSpeeds)
+  {
+    candidates.push_back(createCandidate(worldModel.egoVehicle, speed));
+  }
+
+  RssCheck rssCheck;
+  RssCheck referenceRssCheck;
+  for (uint32_t i = 0u; i < 20u; i++)
+  {
+    worldModel.timeIndex++;
+    worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(5. * i);
+
+    state::ResponseStateVector candidateResponseStates;
+    ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+    ASSERT_EQ(candidateResponseStates.size(), candidates.size());
+    for (auto const &responseState : candidateResponseStates)
+    {
+      EXPECT_EQ(responseState.timeIndex, worldModel.timeIndex);
+    }
+
+    world::AccelerationRestriction accelerationRestriction;
+    situation::SituationVector situationVector;
+    state::ResponseStateVector responseStateVector;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+      worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+    world::AccelerationRestriction referenceRestriction;
+    situation::SituationVector referenceSituationVector;
+    state::ResponseStateVector referenceResponseStateVector;
+    ASSERT_TRUE(referenceRssCheck.calculateAccelerationRestriction(
+      worldModel, referenceRestriction, referenceSituationVector, referenceResponseStateVector));
+
+    EXPECT_EQ(accelerationRestriction, referenceRestriction);
+    EXPECT_EQ(situationVector, referenceSituationVector);
+    EXPECT_EQ(responseStateVector, referenceResponseStateVector);
+  }
+}
+
+TEST_F(RssCheckCandidateTests, candidates_use_the_tracked_state)
+{
+  RssEgoCandidateVector candidates;
+  for (auto speed : candidateSpeeds)
+  {
+    candidates.push_back(createCandidate(worldModel.egoVehicle, speed));
+  }
+
+  RssCheck rssCheck;
+  std::vector<world::WorldModel> worldModels;
+  for (uint32_t i = 0u; i < 10u; i++)
+  {
+    worldModel.timeIndex++;
+    worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(10. * i);
+
+    state::ResponseStateVector candidateResponseStates;
+    ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+    ASSERT_EQ(candidateResponseStates.size(), candidates.size());
+
+    // the candidates are evaluated as if they were processed after the previous world models
+    for (std::size_t j = 0u; j < candidates.size(); j++)
+    {
+      RssCheck candidateRssCheck;
+      world::AccelerationRestriction expectedRestriction;
+      for (auto const &previousWorldModel : worldModels)
+      {
+        ASSERT_TRUE(candidateRssCheck.calculateAccelerationRestriction(previousWorldModel, expectedRestriction));
+      }
+      world::WorldModel const candidateWorldModel = applyCandidate(worldModel, candidates[j]);
+      ASSERT_TRUE(candidateRssCheck.calculateAccelerationRestriction(candidateWorldModel, expectedRestriction));
+
+      world::AccelerationRestriction accelerationRestriction;
+      ASSERT_TRUE(RssResponseTransformation::transformProperResponse(
+        candidateWorldModel, candidateResponseStates[j], accelerationRestriction));
+      EXPECT_EQ(accelerationRestriction, expectedRestriction) << "time step " << i << " candidate " << j;
+    }
+
+    world::AccelerationRestriction accelerationRestriction;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+    worldModels.push_back(worldModel);
+  }
+}
+
+TEST_F(RssCheckCandidateTests, lateral_offset)
+{
+  RssEgoCandidate candidate = createCandidate(worldModel.egoVehicle, 50.);
+  candidate.velocity.speedLat = Speed(0.);
+
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+  // the vehicles overlap laterally, which is kept by any lateral offset
+  ASSERT_EQ(situationVector[0].relativePosition.lateralPosition, situation::LateralRelativePosition::Overlap);
+
+  RssCheck rssCheck;
+  state::ResponseStateVector candidateResponseStates;
+  ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, RssEgoCandidateVector{candidate}, candidateResponseStates));
+  ASSERT_EQ(candidateResponseStates.size(), 1u);
+  state::ResponseState const responseState = candidateResponseStates[0];
+
+  candidate.lateralOffset = Distance(10.);
+  ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, RssEgoCandidateVector{candidate}, candidateResponseStates));
+  ASSERT_EQ(candidateResponseStates.size(), 1u);
+  EXPECT_EQ(candidateResponseStates[0], responseState);
+}
+
+TEST_F(RssCheckCandidateTests, invalid_input)
+{
+  RssEgoCandidateVector candidates{createCandidate(worldModel.egoVehicle, 10.)};
+  candidates[0].dynamics.alphaLon.brakeMax = Acceleration(-1.);
+
+  RssCheck rssCheck;
+  state::ResponseStateVector candidateResponseStates;
+  EXPECT_FALSE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+  EXPECT_TRUE(candidateResponseStates.empty());
+
+  // without candidates there is nothing to be evaluated
+  ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, RssEgoCandidateVector(), candidateResponseStates));
+  EXPECT_TRUE(candidateResponseStates.empty());
+
+  // the time index has to increase compared to the last processed time step
+  world::AccelerationRestriction accelerationRestriction;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  candidates[0] = createCandidate(worldModel.egoVehicle, 10.);
+  EXPECT_FALSE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+  worldModel.timeIndex++;
+  EXPECT_TRUE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+}
+
+template <class TESTBASE> class RssCheckCandidateLateralTestBase : public RssCheckCandidateTestBase<TESTBASE>
+{
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return TESTBASE::objectOnSegment5;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return TESTBASE::objectOnSegment3;
+  }
+};
+
+using RssCheckCandidateLateralTests = RssCheckCandidateLateralTestBase<RssCheckTestBase>;
+
+TEST_F(RssCheckCandidateLateralTests, lateral_offset)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+  ASSERT_EQ(situationVector[0].relativePosition.lateralPosition, situation::LateralRelativePosition::AtRight);
+  Distance const lateralDistance = situationVector[0].relativePosition.lateralDistance;
+
+  RssEgoCandidateVector candidates(3u, createCandidate(worldModel.egoVehicle, 50.));
+  // moving towards the other vehicle at the left, but keeping a distance
+  candidates[1].lateralOffset = Distance(0.5) - lateralDistance;
+  // moving into the other vehicle
+  candidates[2].lateralOffset = Distance(-0.5) - lateralDistance;
+
+  RssCheck rssCheck;
+  state::ResponseStateVector candidateResponseStates;
+  ASSERT_TRUE(rssCheck.evaluateCandidates(worldModel, candidates, candidateResponseStates));
+  ASSERT_EQ(candidateResponseStates.size(), candidates.size());
+
+  EXPECT_TRUE(candidateResponseStates[0].lateralStateLeft.isSafe);
+  EXPECT_FALSE(state::isDangerous(candidateResponseStates[0]));
+
+  EXPECT_FALSE(candidateResponseStates[1].lateralStateLeft.isSafe);
+  EXPECT_TRUE(candidateResponseStates[1].lateralStateRight.isSafe);
+
+  EXPECT_FALSE(candidateResponseStates[2].lateralStateLeft.isSafe);
+  EXPECT_FALSE(candidateResponseStates[2].lateralStateRight.isSafe);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,106 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckMixedScenesTestBase.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckIncrementalTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  void updatePartOfTheScenes(uint32_t const tick)
+  {
+    // the ego vehicle changes only every fifth tick
+    if ((tick % 5u) == 4u)
+    {
+      worldModel.egoVehicle.velocity.speedLon = Speed(5. + tick);
+    }
+    for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+    {
+      if ((i % 4u) == (tick % 4u))
+      {
+        worldModel.scenes[i].object.velocity.speedLon = Speed(25. - tick);
+      }
+    }
+    // modify the road of a single scene
+    if (tick == 7u)
+    {
+      worldModel.scenes[1].egoVehicleRoad[1][1].length.maximum = Distance(13.);
+    }
+  }
+};
+
+TEST_F(RssCheckIncrementalTests, unchangedWorldModel)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableIncrementalEvaluation = true;
+  compareWithDefaultRssCheck(configuration, [](uint32_t const) {});
+}
+
+TEST_F(RssCheckIncrementalTests, partiallyChangedWorldModel)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableIncrementalEvaluation = true;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) { updatePartOfTheScenes(tick); });
+}
+
+TEST_F(RssCheckIncrementalTests, partiallyChangedWorldModelWithWorkerThreads)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableIncrementalEvaluation = true;
+  configuration.numberOfWorkerThreads = 2u;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) { updatePartOfTheScenes(tick); });
+}
+
+TEST_F(RssCheckIncrementalTests, failingTickInvalidatesPreviousResults)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableIncrementalEvaluation = true;
+  RssCheck rssCheck(configuration);
+  world::AccelerationRestriction accelerationRestriction;
+
+  worldModel.timeIndex++;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+
+  // the time index has to increase
+  ASSERT_FALSE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+
+  worldModel.timeIndex++;
+  world::AccelerationRestriction expectedRestriction;
+  RssCheck defaultRssCheck;
+  ASSERT_TRUE(defaultRssCheck.calculateAccelerationRestriction(worldModel, expectedRestriction));
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  ASSERT_EQ(expectedRestriction, accelerationRestriction);
+}
+
+} // namespace core
+} // namespace ad_rss
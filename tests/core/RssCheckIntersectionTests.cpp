@@ -102,6 +102,7 @@ using RssCheckIntersectionEgoHasPriorityTest = RssCheckIntersectionEgoHasPriorit
 
 using RssCheckIntersectionEgoHasPriorityOutOfMemoryTest
   = RssCheckIntersectionEgoHasPriorityTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckIntersectionEgoHasPriorityOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -109,6 +110,7 @@ TEST_P(RssCheckIntersectionEgoHasPriorityOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckIntersectionEgoHasPriorityOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckIntersectionEgoHasPriorityTest, IntersectionTest)
 {
@@ -143,6 +145,7 @@ using RssCheckIntersectionObjectHasPriorityTest = RssCheckIntersectionObjectHasP
 
 using RssCheckIntersectionObjectHasPriorityOutOfMemoryTest
   = RssCheckIntersectionObjectHasPriorityTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckIntersectionObjectHasPriorityOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -150,6 +153,7 @@ TEST_P(RssCheckIntersectionObjectHasPriorityOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckIntersectionObjectHasPriorityOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckIntersectionObjectHasPriorityTest, IntersectionTest)
 {
@@ -174,6 +178,7 @@ using RssCheckIntersectionSamePriorityTest = RssCheckIntersectionSamePriorityTes
 
 using RssCheckIntersectionSamePriorityOutOfMemoryTest
   = RssCheckIntersectionSamePriorityTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckIntersectionSamePriorityOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -181,6 +186,7 @@ TEST_P(RssCheckIntersectionSamePriorityOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckIntersectionSamePriorityOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckIntersectionSamePriorityTest, IntersectionTest)
 {
@@ -50,11 +50,13 @@ template <class TESTBASE> class RssCheckLateralEgoRightTestBase : public TESTBAS
 using RssCheckLateralEgoRightTest = RssCheckLateralEgoRightTestBase<RssCheckTestBase>;
 
 using RssCheckLateralEgoRightOutOfMemoryTest = RssCheckLateralEgoRightTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckLateralEgoRightOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
 }
 INSTANTIATE_TEST_CASE_P(Range, RssCheckLateralEgoRightOutOfMemoryTest, ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckLateralEgoRightTest, Lateral_Velocity_Towards_Each_Other)
 {
@@ -140,11 +142,13 @@ template <class TESTBASE> class RssCheckLateralEgoLeftTestBase : public TESTBASE
 using RssCheckLateralEgoLeftTest = RssCheckLateralEgoLeftTestBase<RssCheckTestBase>;
 
 using RssCheckLateralEgoLeftOutOfMemoryTest = RssCheckLateralEgoLeftTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckLateralEgoLeftOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
 }
 INSTANTIATE_TEST_CASE_P(Range, RssCheckLateralEgoLeftOutOfMemoryTest, ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckLateralEgoLeftTest, Lateral_Velocity_Towards_Each_Other)
 {
@@ -286,6 +290,7 @@ protected:
 using RssCheckLateralEgoInTheMiddleTest = RssCheckLateralEgoInTheMiddleTestBase<RssCheckTestBase>;
 
 using RssCheckLateralEgoInTheMiddleOutOfMemoryTest = RssCheckLateralEgoInTheMiddleTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckLateralEgoInTheMiddleOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -293,6 +298,7 @@ TEST_P(RssCheckLateralEgoInTheMiddleOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckLateralEgoInTheMiddleOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckLateralEgoInTheMiddleTest, No_Lateral_Velocity)
 {
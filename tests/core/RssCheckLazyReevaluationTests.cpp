@@ -0,0 +1,205 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+#include "RssCheckMixedScenesTestBase.hpp"
+#include "core/RssReevaluationScheduler.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckLazyReevaluationTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  // the objects on the segments 6 and 7 are far ahead of the ego vehicle, the ones on the segments 3 to 5 not
+  Distance getMiddleRoadSegmentLength() override
+  {
+    return Distance(400);
+  }
+
+  void updateScenes(uint32_t const tick)
+  {
+    worldModel.egoVehicle.velocity.speedLon = Speed(5. + 2. * tick);
+    worldModel.egoVehicle.velocity.speedLat = Speed(0.1 * tick - 1.);
+    for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+    {
+      worldModel.scenes[i].object.velocity.speedLon = Speed(25. - tick + static_cast<double>(i));
+      worldModel.scenes[i].object.velocity.speedLat = Speed(0.2 * static_cast<double>(i % 3u) - 0.2);
+    }
+  }
+
+  /**
+   * @brief calculate the next time step by the lazy and the default RssCheck
+   *
+   * @returns the number of response states differing from the default RssCheck
+   */
+  std::size_t calculateNextTimeStep(RssCheck &rssCheck, RssCheck &defaultRssCheck)
+  {
+    world::AccelerationRestriction accelerationRestriction;
+    situation::SituationVector situationVector;
+    state::ResponseStateVector responseStateVector;
+    EXPECT_TRUE(rssCheck.calculateAccelerationRestriction(
+      worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+    world::AccelerationRestriction defaultAccelerationRestriction;
+    situation::SituationVector defaultSituationVector;
+    state::ResponseStateVector defaultResponseStateVector;
+    EXPECT_TRUE(defaultRssCheck.calculateAccelerationRestriction(
+      worldModel, defaultAccelerationRestriction, defaultSituationVector, defaultResponseStateVector));
+    EXPECT_EQ(defaultAccelerationRestriction, accelerationRestriction);
+    EXPECT_EQ(defaultSituationVector, situationVector);
+    EXPECT_EQ(defaultResponseStateVector.size(), responseStateVector.size());
+
+    std::size_t numberOfSkippedSituations = 0u;
+    for (std::size_t i = 0u; (i < responseStateVector.size()) && (i < defaultResponseStateVector.size()); i++)
+    {
+      state::ResponseState const &responseState = responseStateVector[i];
+      state::ResponseState const &defaultResponseState = defaultResponseStateVector[i];
+      if (responseState == defaultResponseState)
+      {
+        continue;
+      }
+
+      // skipped situation: the safe distance is an upper bound, the longitudinal state is safe
+      numberOfSkippedSituations++;
+      EXPECT_EQ(defaultResponseState.situationId, responseState.situationId);
+      EXPECT_EQ(defaultResponseState.timeIndex, responseState.timeIndex);
+      EXPECT_TRUE(defaultResponseState.longitudinalState.isSafe);
+      EXPECT_TRUE(responseState.longitudinalState.isSafe);
+      EXPECT_EQ(state::LongitudinalResponse::None, responseState.longitudinalState.response);
+      EXPECT_EQ(defaultResponseState.longitudinalState.responseInformation.responseEvaluator,
+                responseState.longitudinalState.responseInformation.responseEvaluator);
+      EXPECT_EQ(defaultResponseState.longitudinalState.responseInformation.currentDistance,
+                responseState.longitudinalState.responseInformation.currentDistance);
+      EXPECT_LE(defaultResponseState.longitudinalState.responseInformation.safeDistance,
+                responseState.longitudinalState.responseInformation.safeDistance);
+      EXPECT_LT(responseState.longitudinalState.responseInformation.safeDistance,
+                responseState.longitudinalState.responseInformation.currentDistance);
+      EXPECT_EQ(defaultResponseState.lateralStateLeft, responseState.lateralStateLeft);
+      EXPECT_EQ(defaultResponseState.lateralStateRight, responseState.lateralStateRight);
+    }
+    return numberOfSkippedSituations;
+  }
+};
+
+TEST_F(RssCheckLazyReevaluationTests, changingWorldModel)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableLazyReevaluation = true;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) { updateScenes(tick); });
+}
+
+TEST_F(RssCheckLazyReevaluationTests, changingWorldModelWithAllOptimizations)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableLazyReevaluation = true;
+  configuration.enableBroadPhaseCulling = true;
+  configuration.enableIncrementalEvaluation = true;
+  configuration.enableBatchEvaluation = true;
+  configuration.numberOfWorkerThreads = 2u;
+  compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) {
+    if ((tick % 2u) == 0u)
+    {
+      updateScenes(tick);
+    }
+  });
+}
+
+TEST_F(RssCheckLazyReevaluationTests, skippedSituations)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableLazyReevaluation = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+
+  // all situations are evaluated within the first time step
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+
+  // the same and opposite direction situations of the far objects on the segments 6 and 7 are not evaluated again
+  // while the ego vehicle is accelerating slowly, the closer ones only until their shorter horizon expires
+  for (uint32_t tick = 0u; tick < 10u; tick++)
+  {
+    worldModel.timeIndex++;
+    worldModel.egoVehicle.velocity.speedLon += Speed(0.1);
+    EXPECT_LE(4u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  }
+}
+
+TEST_F(RssCheckLazyReevaluationTests, reevaluationOfChangedInputs)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableLazyReevaluation = true;
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  worldModel.timeIndex++;
+  ASSERT_LT(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+
+  // changed dynamics
+  worldModel.timeIndex++;
+  worldModel.egoVehicle.dynamics.alphaLon.accelMax += Acceleration(0.5);
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  worldModel.timeIndex++;
+  ASSERT_LT(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+
+  // changed lateral speed
+  worldModel.timeIndex++;
+  worldModel.egoVehicle.velocity.speedLat += Speed(0.1);
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  worldModel.timeIndex++;
+  ASSERT_LT(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+
+  // speed not reachable by the worst case accelerations
+  worldModel.timeIndex++;
+  worldModel.egoVehicle.velocity.speedLon += Speed(40.);
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  worldModel.timeIndex++;
+  ASSERT_LT(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+
+  // horizon expired
+  worldModel.timeIndex += 2u * RssReevaluationScheduler::cMaximumNumberOfTimeSteps;
+  EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+}
+
+TEST_F(RssCheckLazyReevaluationTests, invalidTimeStepDuration)
+{
+  RssCheckConfiguration configuration;
+  configuration.enableLazyReevaluation = true;
+  configuration.maximumTimeStepDuration = Duration(0.);
+  RssCheck rssCheck(configuration);
+  RssCheck defaultRssCheck;
+  for (uint32_t tick = 0u; tick < 5u; tick++)
+  {
+    worldModel.timeIndex++;
+    EXPECT_EQ(0u, calculateNextTimeStep(rssCheck, defaultRssCheck));
+  }
+}
+
+} // namespace core
+} // namespace ad_rss
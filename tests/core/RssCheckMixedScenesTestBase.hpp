@@ -0,0 +1,125 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#pragma once
+
+#include <functional>
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+/**
+ * @brief test base providing a world model with same direction, opposite direction, not relevant and intersection
+ * scenes
+ */
+class RssCheckMixedScenesTestBase : public RssCheckTestBase
+{
+protected:
+  void SetUp() override
+  {
+    // the intersection scene of the base class: ego on segment 0, object on segment 8 of the intersecting road
+    RssCheckTestBase::SetUp();
+    ::ad_rss::world::Scene const intersectionScene = worldModel.scenes[0];
+
+    // add non-intersection scenes, the non-intersection road contains segment 0, too
+    roadArea.clear();
+    createRoadAreaNonIntersection();
+
+    ::ad_rss::world::Scene scene;
+    scene.egoVehicleRoad = roadArea;
+    uint64_t objectId = 100u;
+    for (auto const &object : {objectOnSegment3, objectOnSegment4, objectOnSegment5, objectOnSegment6, objectOnSegment7})
+    {
+      scene.object = object;
+
+      scene.situationType = situation::SituationType::SameDirection;
+      worldModel.scenes.push_back(scene);
+
+      scene.situationType = situation::SituationType::OppositeDirection;
+      scene.object.objectId = objectId++;
+      worldModel.scenes.push_back(scene);
+
+      scene.situationType = situation::SituationType::NotRelevant;
+      scene.object.objectId = objectId++;
+      worldModel.scenes.push_back(scene);
+    }
+    worldModel.scenes.push_back(intersectionScene);
+    worldModel.scenes.back().situationType = situation::SituationType::IntersectionObjectHasPriority;
+    worldModel.scenes.back().object.objectId = objectId++;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  /**
+   * @brief compare the results of an RssCheck with the given configuration against the default RssCheck
+   *
+   * @param[in] configuration the configuration to be compared against the default
+   * @param[in] updateWorldModel function updating the world model for the next tick
+   */
+  void compareWithDefaultRssCheck(RssCheckConfiguration const &configuration,
+                                  std::function<void(uint32_t const tick)> const &updateWorldModel)
+  {
+    RssCheck configuredRssCheck(configuration);
+    RssCheck defaultRssCheck;
+
+    for (uint32_t tick = 0u; tick < 20u; tick++)
+    {
+      worldModel.timeIndex++;
+      updateWorldModel(tick);
+
+      world::AccelerationRestriction configuredRestriction;
+      world::AccelerationRestriction defaultRestriction;
+      bool const configuredResult
+        = configuredRssCheck.calculateAccelerationRestriction(worldModel, configuredRestriction);
+      bool const defaultResult = defaultRssCheck.calculateAccelerationRestriction(worldModel, defaultRestriction);
+      ASSERT_TRUE(defaultResult);
+      ASSERT_EQ(defaultResult, configuredResult);
+      ASSERT_EQ(defaultRestriction, configuredRestriction);
+    }
+  }
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -75,12 +75,15 @@ TEST_F(RssCheckNotRelevantTest, NotRelevant)
 }
 
 using RssCheckNotRelevantOutOfMemoryTest = RssCheckNotRelevantTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckNotRelevantOutOfMemoryTest, outOfMemoryAnyTime)
 {
-  // throw at 3 will succeed, but that's expected in this case as no actual calculations are performed.
-  performOutOfMemoryTest({3u});
+  // throw at 6, 7, 8 (construction of the intersection checker) and 9 (construction of the ego vehicle terms) will
+  // succeed, but that's expected in this case as no actual calculations are performed.
+  performOutOfMemoryTest({6u, 7u, 8u, 9u});
 }
 INSTANTIATE_TEST_CASE_P(Range, RssCheckNotRelevantOutOfMemoryTest, ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 } // namespace core
 } // namespace ad_rss
@@ -71,6 +71,7 @@ TEST_F(RssCheckOppositeDirectionEgoCorrectTest, DifferentVelocities_DifferentLan
 
 using RssCheckOppositeDirectionEgoCorrectOutOfMemoryTest
   = RssCheckOppositeDirectionEgoCorrectTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckOppositeDirectionEgoCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -78,6 +79,7 @@ TEST_P(RssCheckOppositeDirectionEgoCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckOppositeDirectionEgoCorrectOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 TEST_F(RssCheckOppositeDirectionEgoCorrectTest, DifferentVelocities_NoLateralConflict)
 {
@@ -143,6 +145,7 @@ TEST_F(RssCheckOppositeDirectionOtherCorrectTest, DifferentVelocities_DifferentL
 
 using RssCheckOppositeDirectionOtherCorrectOutOfMemoryTest
   = RssCheckOppositeDirectionOtherCorrectTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckOppositeDirectionOtherCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -150,6 +153,7 @@ TEST_P(RssCheckOppositeDirectionOtherCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckOppositeDirectionOtherCorrectOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 template <class TESTBASE> class RssCheckOppositeDirectionBothCorrectTestBase : public TESTBASE
 {
@@ -193,6 +197,7 @@ TEST_F(RssCheckOppositeDirectionBothCorrectTest, DifferentVelocities_DifferentLa
 
 using RssCheckOppositeDirectionBothCorrectOutOfMemoryTest
   = RssCheckOppositeDirectionBothCorrectTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckOppositeDirectionBothCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -200,6 +205,7 @@ TEST_P(RssCheckOppositeDirectionBothCorrectOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckOppositeDirectionBothCorrectOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 } // namespace core
 } // namespace ad_rss
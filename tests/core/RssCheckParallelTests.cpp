@@ -0,0 +1,85 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckMixedScenesTestBase.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckParallelTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  void performParallelTest(uint32_t const numberOfWorkerThreads)
+  {
+    RssCheckConfiguration configuration;
+    configuration.numberOfWorkerThreads = numberOfWorkerThreads;
+    compareWithDefaultRssCheck(configuration, [this](uint32_t const tick) {
+      worldModel.egoVehicle.velocity.speedLon = Speed(5. + tick);
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.object.velocity.speedLon = Speed(25. - tick);
+      }
+    });
+  }
+};
+
+TEST_F(RssCheckParallelTests, oneWorkerThread)
+{
+  performParallelTest(1u);
+}
+
+TEST_F(RssCheckParallelTests, multipleWorkerThreads)
+{
+  performParallelTest(4u);
+}
+
+TEST_F(RssCheckParallelTests, invalidSceneFailsAsSequential)
+{
+  worldModel.scenes[4].object.occupiedRegions[0].segmentId = 99u;
+
+  RssCheckConfiguration configuration;
+  configuration.numberOfWorkerThreads = 2u;
+  RssCheck parallelRssCheck(configuration);
+  RssCheck sequentialRssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  ASSERT_FALSE(sequentialRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  ASSERT_FALSE(parallelRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+
+  // an invalid not relevant scene is ignored
+  worldModel.scenes[4].object.occupiedRegions[0].segmentId = 4u;
+  worldModel.scenes[3].object.occupiedRegions[0].segmentId = 99u;
+  worldModel.timeIndex++;
+  ASSERT_TRUE(sequentialRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+  ASSERT_TRUE(parallelRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+}
+
+} // namespace core
+} // namespace ad_rss
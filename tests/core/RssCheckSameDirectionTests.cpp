@@ -283,6 +283,7 @@ TEST_F(RssCheckSameDirectionEgoInTheMiddleTest, DifferentVelocities)
 
 using RssCheckSameDirectionOtherLeadingOutOfMemoryTest
   = RssCheckSameDirectionOtherLeadingTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckSameDirectionOtherLeadingOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -290,9 +291,11 @@ TEST_P(RssCheckSameDirectionOtherLeadingOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckSameDirectionOtherLeadingOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 using RssCheckSameDirectionEgoLeadingOutOfMemoryTest
   = RssCheckSameDirectionEgoLeadingTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckSameDirectionEgoLeadingOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -300,9 +303,11 @@ TEST_P(RssCheckSameDirectionEgoLeadingOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckSameDirectionEgoLeadingOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 using RssCheckSameDirectionEgoInTheMiddleOutOfMemoryTest
   = RssCheckSameDirectionEgoInTheMiddleTestBase<RssCheckOutOfMemoryTestBase>;
+#if !defined(AD_RSS_NO_EXCEPTIONS)
 TEST_P(RssCheckSameDirectionEgoInTheMiddleOutOfMemoryTest, outOfMemoryAnyTime)
 {
   performOutOfMemoryTest();
@@ -310,6 +315,7 @@ TEST_P(RssCheckSameDirectionEgoInTheMiddleOutOfMemoryTest, outOfMemoryAnyTime)
 INSTANTIATE_TEST_CASE_P(Range,
                         RssCheckSameDirectionEgoInTheMiddleOutOfMemoryTest,
                         ::testing::Range(uint64_t(0u), uint64_t(50u)));
+#endif
 
 } // namespace core
 } // namespace ad_rss
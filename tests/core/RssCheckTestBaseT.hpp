@@ -625,6 +625,10 @@ protected:
 
 using RssCheckTestBase = RssCheckTestBaseT<testing::Test>;
 
+/*
+ * Without exception support (AD_RSS_NO_EXCEPTIONS) a failing allocation within the library terminates the program.
+ * Therefore, the out of memory tests are only instantiated with exception support.
+ */
 class RssCheckOutOfMemoryTestBase : public RssCheckTestBaseT<testing::TestWithParam<uint64_t>>
 {
 protected:
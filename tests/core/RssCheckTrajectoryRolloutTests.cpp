@@ -0,0 +1,246 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssResponseResolving.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "core/RssSituationPrediction.hpp"
+#include "core/RssState.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckTrajectoryRolloutTests : public RssCheckTestBase
+{
+protected:
+  static RssTrajectoryRollout createRollout(double const egoAccelerationLon, std::size_t const numberOfSteps)
+  {
+    RssTrajectoryRollout rollout;
+    rollout.stepDuration = Duration(0.25);
+    RssRolloutStep step;
+    step.egoKinematics.accelerationLon = Acceleration(egoAccelerationLon);
+    rollout.steps.assign(numberOfSteps, step);
+    return rollout;
+  }
+};
+
+TEST_F(RssCheckTrajectoryRolloutTests, rollout_matches_sequential_processing)
+{
+  worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(10.);
+  RssTrajectoryRollout const rollout = createRollout(3., 20u);
+
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+  RssRolloutResult rolloutResult;
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, rollout, rolloutResult));
+  ASSERT_EQ(rolloutResult.stepResults.size(), rollout.steps.size());
+
+  // the same time steps processed one after the other
+  RssSituationChecking situationChecking;
+  RssResponseResolving responseResolving;
+  state::ResponseState properResponse;
+  ASSERT_TRUE(situationChecking.checkSituations(situationVector, responseStateVector));
+  ASSERT_TRUE(responseResolving.provideProperResponse(responseStateVector, properResponse));
+
+  situation::SituationVector predictedSituations;
+  ASSERT_TRUE(RssSituationPrediction::predictSituations(
+    situationVector, rollout, worldModel.timeIndex, predictedSituations));
+  ASSERT_EQ(predictedSituations.size(), rollout.steps.size() * situationVector.size());
+
+  bool isSafe = true;
+  for (std::size_t step = 0u; step < rollout.steps.size(); step++)
+  {
+    auto const begin = predictedSituations.begin() + static_cast<std::ptrdiff_t>(step * situationVector.size());
+    situation::SituationVector const stepSituations(begin,
+                                                    begin + static_cast<std::ptrdiff_t>(situationVector.size()));
+    ASSERT_TRUE(situationChecking.checkSituations(stepSituations, responseStateVector));
+    ASSERT_TRUE(responseResolving.provideProperResponse(responseStateVector, properResponse));
+
+    RssRolloutStepResult const &stepResult = rolloutResult.stepResults[step];
+    EXPECT_EQ(stepResult.timeIndex, worldModel.timeIndex + step + 1u);
+    EXPECT_EQ(stepResult.properResponse, properResponse) << "step " << step;
+    ASSERT_EQ(stepResult.safetyMargins.size(), situationVector.size());
+    for (std::size_t i = 0u; i < situationVector.size(); i++)
+    {
+      RssSituationSafetyMargins safetyMargins;
+      ASSERT_TRUE(RssSafetyMarginCalculation::calculateSafetyMargins(stepSituations[i], safetyMargins));
+      EXPECT_EQ(stepResult.safetyMargins[i].longitudinalMargin.margin, safetyMargins.longitudinalMargin.margin);
+    }
+
+    if (isSafe && isDangerous(properResponse))
+    {
+      isSafe = false;
+      EXPECT_EQ(rolloutResult.firstUnsafeStep, step);
+    }
+  }
+  EXPECT_EQ(rolloutResult.isSafe, isSafe);
+}
+
+TEST_F(RssCheckTrajectoryRolloutTests, first_unsafe_step)
+{
+  worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(10.);
+
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+  ASSERT_FALSE(isDangerous(responseStateVector[0]));
+
+  // braking keeps the ego vehicle safe
+  RssRolloutResult rolloutResult;
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, createRollout(-2., 20u), rolloutResult));
+  EXPECT_TRUE(rolloutResult.isSafe);
+
+  // accelerating towards the leading vehicle becomes dangerous
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, createRollout(4., 20u), rolloutResult));
+  ASSERT_FALSE(rolloutResult.isSafe);
+  ASSERT_LT(rolloutResult.firstUnsafeStep, rolloutResult.stepResults.size());
+  for (std::size_t step = 0u; step < rolloutResult.firstUnsafeStep; step++)
+  {
+    EXPECT_FALSE(isDangerous(rolloutResult.stepResults[step].properResponse));
+  }
+  EXPECT_TRUE(isDangerous(rolloutResult.stepResults[rolloutResult.firstUnsafeStep].properResponse));
+
+  // the margin shrinks while accelerating
+  for (std::size_t step = 1u; step < rolloutResult.stepResults.size(); step++)
+  {
+    ASSERT_TRUE(rolloutResult.stepResults[step].safetyMargins[0].hasLongitudinalMargin);
+    EXPECT_LT(rolloutResult.stepResults[step].safetyMargins[0].longitudinalMargin.margin,
+              rolloutResult.stepResults[step - 1u].safetyMargins[0].longitudinalMargin.margin);
+  }
+  EXPECT_LT(rolloutResult.stepResults[rolloutResult.firstUnsafeStep].safetyMargins[0].longitudinalMargin.margin,
+            Distance(Distance::cPrecisionValue));
+}
+
+TEST_F(RssCheckTrajectoryRolloutTests, object_kinematics)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+  RssTrajectoryRollout rollout = createRollout(0., 10u);
+  RssRolloutResult constantSpeedResult;
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, rollout, constantSpeedResult));
+
+  // the leading vehicle is braking
+  for (auto &step : rollout.steps)
+  {
+    RssRolloutKinematics objectKinematics;
+    objectKinematics.accelerationLon = Acceleration(-4.);
+    step.objectKinematics.assign(situationVector.size(), objectKinematics);
+  }
+  RssRolloutResult brakingResult;
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, rollout, brakingResult));
+  EXPECT_LT(brakingResult.stepResults.back().safetyMargins[0].longitudinalMargin.margin,
+            constantSpeedResult.stepResults.back().safetyMargins[0].longitudinalMargin.margin);
+}
+
+TEST_F(RssCheckTrajectoryRolloutTests, state_is_not_changed)
+{
+  RssCheck rssCheck;
+  RssCheck referenceRssCheck;
+  for (uint32_t i = 0u; i < 20u; i++)
+  {
+    worldModel.timeIndex++;
+    worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(5. * i);
+
+    world::AccelerationRestriction accelerationRestriction;
+    situation::SituationVector situationVector;
+    state::ResponseStateVector responseStateVector;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+      worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+    world::AccelerationRestriction referenceRestriction;
+    situation::SituationVector referenceSituationVector;
+    state::ResponseStateVector referenceResponseStateVector;
+    ASSERT_TRUE(referenceRssCheck.calculateAccelerationRestriction(
+      worldModel, referenceRestriction, referenceSituationVector, referenceResponseStateVector));
+
+    EXPECT_EQ(accelerationRestriction, referenceRestriction);
+    EXPECT_EQ(responseStateVector, referenceResponseStateVector);
+
+    RssRolloutResult rolloutResult;
+    ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, createRollout(2., 20u), rolloutResult));
+    RssRolloutResult repeatedRolloutResult;
+    ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situationVector, createRollout(2., 20u), repeatedRolloutResult));
+    EXPECT_EQ(rolloutResult.isSafe, repeatedRolloutResult.isSafe);
+    EXPECT_EQ(rolloutResult.firstUnsafeStep, repeatedRolloutResult.firstUnsafeStep);
+    ASSERT_EQ(rolloutResult.stepResults.size(), repeatedRolloutResult.stepResults.size());
+    for (std::size_t step = 0u; step < rolloutResult.stepResults.size(); step++)
+    {
+      EXPECT_EQ(rolloutResult.stepResults[step].properResponse, repeatedRolloutResult.stepResults[step].properResponse);
+    }
+  }
+}
+
+TEST_F(RssCheckTrajectoryRolloutTests, invalid_input)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, situationVector, responseStateVector));
+
+  RssRolloutResult rolloutResult;
+  RssTrajectoryRollout rollout = createRollout(0., 5u);
+  rollout.stepDuration = Duration(0.);
+  EXPECT_FALSE(rssCheck.checkTrajectoryRollout(situationVector, rollout, rolloutResult));
+  EXPECT_TRUE(rolloutResult.stepResults.empty());
+
+  rollout = createRollout(0., 5u);
+  rollout.steps[2].objectKinematics.resize(situationVector.size() + 1u);
+  EXPECT_FALSE(rssCheck.checkTrajectoryRollout(situationVector, rollout, rolloutResult));
+
+  // the ego vehicle exceeds the valid speed range
+  rollout = createRollout(50., 20u);
+  EXPECT_FALSE(rssCheck.checkTrajectoryRollout(situationVector, rollout, rolloutResult));
+  EXPECT_TRUE(rolloutResult.stepResults.empty());
+
+  // without situations all steps are safe
+  ASSERT_TRUE(rssCheck.checkTrajectoryRollout(situation::SituationVector(), createRollout(0., 5u), rolloutResult));
+  EXPECT_TRUE(rolloutResult.isSafe);
+  EXPECT_EQ(rolloutResult.stepResults.size(), 5u);
+}
+
+} // namespace core
+} // namespace ad_rss
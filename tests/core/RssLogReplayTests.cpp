@@ -0,0 +1,284 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdio>
+#include "RssCheckMixedScenesTestBase.hpp"
+#include "ad_rss/core/RssLogReplay.hpp"
+#include "ad_rss/core/RssLogWriter.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+
+namespace ad_rss {
+namespace core {
+
+/**
+ * @brief result handler storing the results of all ticks
+ */
+class RssLogReplayResults : public RssLogReplay::ResultHandler
+{
+public:
+  void handleResult(std::size_t const tickNumber,
+                    world::WorldModel const &worldModel,
+                    bool const result,
+                    world::AccelerationRestriction const &accelerationRestriction,
+                    situation::SituationVector const &situationVector,
+                    state::ResponseStateVector const &responseStateVector) override
+  {
+    EXPECT_EQ(tickNumbers.size(), tickNumber);
+    tickNumbers.push_back(tickNumber);
+    timeIndices.push_back(worldModel.timeIndex);
+    results.push_back(result);
+    accelerationRestrictions.push_back(accelerationRestriction);
+    situationVectors.push_back(situationVector);
+    responseStateVectors.push_back(responseStateVector);
+  }
+
+  std::vector<std::size_t> tickNumbers;
+  std::vector<physics::TimeIndex> timeIndices;
+  std::vector<bool> results;
+  std::vector<world::AccelerationRestriction> accelerationRestrictions;
+  std::vector<situation::SituationVector> situationVectors;
+  std::vector<state::ResponseStateVector> responseStateVectors;
+};
+
+class RssLogReplayTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  void TearDown() override
+  {
+    std::remove(cLogFileName);
+    RssCheckMixedScenesTestBase::TearDown();
+  }
+
+  /**
+   * @brief write a log of world models with the given number of ticks
+   *
+   * @param[in] numberOfTicks the number of ticks
+   * @param[in] failingTick the tick with a world model which is not checkable, none if larger than numberOfTicks
+   */
+  void writeLog(uint32_t const numberOfTicks, uint32_t const failingTick = std::numeric_limits<uint32_t>::max())
+  {
+    RssLogWriter writer;
+    ASSERT_TRUE(writer.open(cLogFileName));
+    for (uint32_t tick = 0u; tick < numberOfTicks; tick++)
+    {
+      worldModel.timeIndex++;
+      worldModel.egoVehicle.velocity.speedLon = Speed(5. + tick);
+      worldModel.scenes[tick % worldModel.scenes.size()].object.velocity.speedLon = Speed(25. - tick);
+
+      world::WorldModel tickWorldModel = worldModel;
+      if (tick == failingTick)
+      {
+        tickWorldModel.egoVehicle.occupiedRegions.clear();
+      }
+      ASSERT_TRUE(writer.write(tickWorldModel));
+      mWorldModels.push_back(tickWorldModel);
+    }
+    ASSERT_TRUE(writer.close());
+  }
+
+  /**
+   * @brief expect the replay results to match the step by step processing of the world models
+   */
+  void expectResults(RssLogReplayResults const &replayResults)
+  {
+    ASSERT_EQ(mWorldModels.size(), replayResults.results.size());
+    RssCheck rssCheck;
+    RssSituationChecking situationChecking;
+    for (std::size_t i = 0u; i < mWorldModels.size(); i++)
+    {
+      EXPECT_EQ(mWorldModels[i].timeIndex, replayResults.timeIndices[i]);
+
+      world::AccelerationRestriction accelerationRestriction;
+      bool const result = rssCheck.calculateAccelerationRestriction(mWorldModels[i], accelerationRestriction);
+      ASSERT_EQ(result, replayResults.results[i]);
+      if (!result)
+      {
+        EXPECT_TRUE(replayResults.situationVectors[i].empty());
+        EXPECT_TRUE(replayResults.responseStateVectors[i].empty());
+        continue;
+      }
+      EXPECT_EQ(accelerationRestriction, replayResults.accelerationRestrictions[i]);
+
+      situation::SituationVector situationVector;
+      state::ResponseStateVector responseStateVector;
+      ASSERT_TRUE(RssSituationExtraction::extractSituations(mWorldModels[i], situationVector));
+      ASSERT_TRUE(situationChecking.checkSituations(situationVector, responseStateVector));
+      EXPECT_EQ(situationVector, replayResults.situationVectors[i]);
+      EXPECT_EQ(responseStateVector, replayResults.responseStateVectors[i]);
+    }
+  }
+
+  static constexpr char const *cLogFileName = "RssLogReplayTests.rsslog";
+  std::vector<world::WorldModel> mWorldModels;
+};
+
+constexpr char const *RssLogReplayTests::cLogFileName;
+
+TEST_F(RssLogReplayTests, replayMatchesStepByStepProcessing)
+{
+  writeLog(20u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  for (uint32_t const numberOfReadAheadTicks : {0u, 1u, 3u, 8u, 32u})
+  {
+    RssLogReplayConfiguration configuration;
+    configuration.numberOfReadAheadTicks = numberOfReadAheadTicks;
+    RssLogReplay replay(configuration);
+    RssLogReplayResults replayResults;
+    RssLogReplayStatistics statistics;
+    ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+    expectResults(replayResults);
+
+    EXPECT_EQ(20u, statistics.numberOfTicks);
+    EXPECT_EQ(0u, statistics.numberOfFailedTicks);
+    EXPECT_GT(statistics.durationSeconds, 0.);
+    EXPECT_GT(statistics.ticksPerSecond, 0.);
+    EXPECT_LE(statistics.latencyP50Microseconds, statistics.latencyP90Microseconds);
+    EXPECT_LE(statistics.latencyP90Microseconds, statistics.latencyP99Microseconds);
+    EXPECT_LE(statistics.latencyP99Microseconds, statistics.latencyMaxMicroseconds);
+    EXPECT_LE(statistics.latencyMeanMicroseconds, statistics.latencyMaxMicroseconds);
+  }
+}
+
+TEST_F(RssLogReplayTests, replayWithCheckConfiguration)
+{
+  writeLog(20u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  RssLogReplayConfiguration configuration;
+  configuration.checkConfiguration.numberOfWorkerThreads = 2u;
+  configuration.checkConfiguration.enableIncrementalEvaluation = true;
+  configuration.checkConfiguration.enableBatchEvaluation = true;
+  RssLogReplay replay(configuration);
+  RssLogReplayResults replayResults;
+  RssLogReplayStatistics statistics;
+  ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+  expectResults(replayResults);
+
+  // a second replay starts with a new RssCheck and provides the same results
+  RssLogReplayResults secondReplayResults;
+  ASSERT_TRUE(replay.replay(reader, &secondReplayResults, statistics));
+  EXPECT_EQ(replayResults.accelerationRestrictions, secondReplayResults.accelerationRestrictions);
+  EXPECT_EQ(replayResults.responseStateVectors, secondReplayResults.responseStateVectors);
+}
+
+TEST_F(RssLogReplayTests, failingTicksAreReported)
+{
+  writeLog(10u, 4u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  RssLogReplay replay;
+  RssLogReplayResults replayResults;
+  RssLogReplayStatistics statistics;
+  ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+  expectResults(replayResults);
+  EXPECT_FALSE(replayResults.results[4]);
+  EXPECT_EQ(10u, statistics.numberOfTicks);
+  EXPECT_EQ(1u, statistics.numberOfFailedTicks);
+}
+
+TEST_F(RssLogReplayTests, temporalParallelReplayMatchesStepByStepProcessing)
+{
+  writeLog(25u, 17u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  for (uint32_t const numberOfWorkerThreads : {1u, 3u})
+  {
+    for (uint32_t const windowSize : {0u, 1u, 4u, 7u, 64u})
+    {
+      RssLogReplayConfiguration configuration;
+      configuration.numberOfTemporalWorkerThreads = numberOfWorkerThreads;
+      configuration.temporalWindowSize = windowSize;
+      RssLogReplay replay(configuration);
+      RssLogReplayResults replayResults;
+      RssLogReplayStatistics statistics;
+      ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+      expectResults(replayResults);
+      EXPECT_EQ(25u, statistics.numberOfTicks);
+      EXPECT_EQ(1u, statistics.numberOfFailedTicks);
+      EXPECT_LE(statistics.latencyP50Microseconds, statistics.latencyMaxMicroseconds);
+    }
+  }
+}
+
+TEST_F(RssLogReplayTests, temporalParallelReplayWithBatchEvaluation)
+{
+  writeLog(20u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  RssLogReplayConfiguration configuration;
+  configuration.checkConfiguration.numberOfWorkerThreads = 2u;
+  configuration.checkConfiguration.enableIncrementalEvaluation = true;
+  configuration.checkConfiguration.enableBatchEvaluation = true;
+  configuration.numberOfTemporalWorkerThreads = 2u;
+  configuration.temporalWindowSize = 6u;
+  RssLogReplay replay(configuration);
+  RssLogReplayResults replayResults;
+  RssLogReplayStatistics statistics;
+  ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+  expectResults(replayResults);
+  EXPECT_EQ(0u, statistics.numberOfFailedTicks);
+}
+
+TEST_F(RssLogReplayTests, replayWithoutResultHandler)
+{
+  writeLog(5u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  RssLogReplay replay;
+  RssLogReplayStatistics statistics;
+  ASSERT_TRUE(replay.replay(reader, nullptr, statistics));
+  EXPECT_EQ(5u, statistics.numberOfTicks);
+  EXPECT_EQ(0u, statistics.numberOfFailedTicks);
+}
+
+TEST_F(RssLogReplayTests, replayClosedLog)
+{
+  RssLogReader reader;
+  RssLogReplay replay;
+  RssLogReplayResults replayResults;
+  RssLogReplayStatistics statistics;
+  statistics.numberOfTicks = 1u;
+  ASSERT_TRUE(replay.replay(reader, &replayResults, statistics));
+  EXPECT_TRUE(replayResults.results.empty());
+  EXPECT_EQ(0u, statistics.numberOfTicks);
+  EXPECT_EQ(0., statistics.ticksPerSecond);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,287 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "RssCheckMixedScenesTestBase.hpp"
+#include "ad_rss/core/RssLogReader.hpp"
+#include "ad_rss/core/RssLogWriter.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "wrap_new.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssLogTests : public RssCheckMixedScenesTestBase
+{
+protected:
+  void TearDown() override
+  {
+    std::remove(cLogFileName);
+    RssCheckMixedScenesTestBase::TearDown();
+  }
+
+  /**
+   * @brief write a log with the given number of ticks, remembering the written data
+   */
+  void writeLog(uint32_t const numberOfTicks)
+  {
+    RssLogWriter writer;
+    ASSERT_TRUE(writer.open(cLogFileName));
+    RssSituationChecking situationChecking;
+    for (uint32_t tick = 0u; tick < numberOfTicks; tick++)
+    {
+      worldModel.timeIndex++;
+      worldModel.egoVehicle.velocity.speedLon = Speed(5. + tick);
+      worldModel.scenes[tick % worldModel.scenes.size()].object.velocity.speedLon = Speed(25. - tick);
+
+      situation::SituationVector situationVector;
+      state::ResponseStateVector responseStateVector;
+      ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+      ASSERT_TRUE(situationChecking.checkSituations(situationVector, responseStateVector));
+      ASSERT_TRUE(writer.write(worldModel, situationVector, responseStateVector));
+
+      mWorldModels.push_back(worldModel);
+      mSituationVectors.push_back(situationVector);
+      mResponseStateVectors.push_back(responseStateVector);
+    }
+    ASSERT_TRUE(writer.close());
+  }
+
+  void expectTick(RssLogTickView const &tick, std::size_t const tickNumber)
+  {
+    world::WorldModel decodedWorldModel;
+    tick.decode(decodedWorldModel);
+    EXPECT_EQ(mWorldModels[tickNumber], decodedWorldModel);
+    situation::SituationVector decodedSituationVector;
+    tick.decode(decodedSituationVector);
+    EXPECT_EQ(mSituationVectors[tickNumber], decodedSituationVector);
+    state::ResponseStateVector decodedResponseStateVector;
+    tick.decode(decodedResponseStateVector);
+    EXPECT_EQ(mResponseStateVectors[tickNumber], decodedResponseStateVector);
+  }
+
+  std::vector<uint8_t> readLogFile()
+  {
+    std::ifstream file(cLogFileName, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  static constexpr char const *cLogFileName = "RssLogTests.rsslog";
+  std::vector<world::WorldModel> mWorldModels;
+  std::vector<situation::SituationVector> mSituationVectors;
+  std::vector<state::ResponseStateVector> mResponseStateVectors;
+};
+
+constexpr char const *RssLogTests::cLogFileName;
+
+TEST_F(RssLogTests, writeAndReadTicks)
+{
+  writeLog(10u);
+
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+  ASSERT_EQ(10u, reader.getNumberOfTicks());
+  for (std::size_t i = 0u; i < reader.getNumberOfTicks(); i++)
+  {
+    RssLogTickView tick;
+    ASSERT_TRUE(reader.getTick(i, tick));
+    EXPECT_EQ(mWorldModels[i].timeIndex, tick.getTimeIndex());
+    expectTick(tick, i);
+  }
+  RssLogTickView tick;
+  EXPECT_FALSE(reader.getTick(10u, tick));
+}
+
+TEST_F(RssLogTests, readInPlace)
+{
+  writeLog(3u);
+
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+  RssLogTickView tick;
+  ASSERT_TRUE(reader.getTick(1u, tick));
+
+  world::WorldModel const &expectedWorldModel = mWorldModels[1];
+  EXPECT_EQ(expectedWorldModel.egoVehicle.objectId, tick.getEgoVehicle().getObjectId());
+  EXPECT_EQ(expectedWorldModel.egoVehicle.velocity, tick.getEgoVehicle().getVelocity());
+  ASSERT_EQ(expectedWorldModel.scenes.size(), tick.getScenes().size());
+  for (std::size_t i = 0u; i < expectedWorldModel.scenes.size(); i++)
+  {
+    world::Scene const &expectedScene = expectedWorldModel.scenes[i];
+    RssLogSceneView const scene = tick.getScenes()[i];
+    EXPECT_EQ(expectedScene.situationType, scene.getSituationType());
+    EXPECT_EQ(expectedScene.object.objectId, scene.getObject().getObjectId());
+    EXPECT_EQ(expectedScene.object.objectType, scene.getObject().getObjectType());
+    EXPECT_EQ(expectedScene.object.dynamics, scene.getObject().getDynamics());
+    EXPECT_EQ(expectedScene.object.responseTime, scene.getObject().getResponseTime());
+    ASSERT_EQ(expectedScene.object.occupiedRegions.size(), scene.getObject().getOccupiedRegions().size());
+    EXPECT_EQ(expectedScene.object.occupiedRegions[0], scene.getObject().getOccupiedRegions()[0]);
+    ASSERT_EQ(expectedScene.egoVehicleRoad.size(), scene.getEgoVehicleRoad().size());
+    ASSERT_EQ(expectedScene.intersectingRoad.size(), scene.getIntersectingRoad().size());
+    for (std::size_t j = 0u; j < expectedScene.egoVehicleRoad.size(); j++)
+    {
+      ASSERT_EQ(expectedScene.egoVehicleRoad[j].size(), scene.getEgoVehicleRoad()[j].size());
+      for (std::size_t k = 0u; k < expectedScene.egoVehicleRoad[j].size(); k++)
+      {
+        EXPECT_EQ(expectedScene.egoVehicleRoad[j][k], scene.getEgoVehicleRoad()[j][k]);
+      }
+    }
+  }
+  ASSERT_EQ(mSituationVectors[1].size(), tick.getSituations().size());
+  EXPECT_EQ(mSituationVectors[1].back(), tick.getSituations()[tick.getSituations().size() - 1u]);
+  ASSERT_EQ(mResponseStateVectors[1].size(), tick.getResponseStates().size());
+  EXPECT_EQ(mResponseStateVectors[1].front(), tick.getResponseStates()[0]);
+}
+
+TEST_F(RssLogTests, readFromMemory)
+{
+  writeLog(4u);
+  std::vector<uint8_t> const data = readLogFile();
+
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(data.data(), data.size()));
+  ASSERT_EQ(4u, reader.getNumberOfTicks());
+  RssLogTickView tick;
+  ASSERT_TRUE(reader.getTick(3u, tick));
+  expectTick(tick, 3u);
+}
+
+TEST_F(RssLogTests, findTick)
+{
+  writeLog(5u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  std::size_t tickNumber = 0u;
+  ASSERT_TRUE(reader.findTick(mWorldModels[3].timeIndex, tickNumber));
+  EXPECT_EQ(3u, tickNumber);
+  ASSERT_TRUE(reader.findTick(0u, tickNumber));
+  EXPECT_EQ(0u, tickNumber);
+  EXPECT_FALSE(reader.findTick(mWorldModels[4].timeIndex + 1u, tickNumber));
+
+  RssLogTickView tick;
+  ASSERT_TRUE(reader.findTick(mWorldModels[2].timeIndex, tickNumber));
+  ASSERT_TRUE(reader.getTick(tickNumber, tick));
+  expectTick(tick, 2u);
+}
+
+TEST_F(RssLogTests, decodeReusesMemory)
+{
+  writeLog(3u);
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+
+  world::WorldModel decodedWorldModel;
+  situation::SituationVector decodedSituationVector;
+  RssLogTickView tick;
+  ASSERT_TRUE(reader.getTick(0u, tick));
+  tick.decode(decodedWorldModel);
+  tick.decode(decodedSituationVector);
+
+  gNewCallCounter = 0u;
+  for (std::size_t i = 1u; i < reader.getNumberOfTicks(); i++)
+  {
+    ASSERT_TRUE(reader.getTick(i, tick));
+    tick.decode(decodedWorldModel);
+    tick.decode(decodedSituationVector);
+  }
+  EXPECT_EQ(0u, gNewCallCounter);
+  EXPECT_EQ(mWorldModels.back(), decodedWorldModel);
+}
+
+TEST_F(RssLogTests, writeWorldModelOnly)
+{
+  RssLogWriter writer;
+  ASSERT_TRUE(writer.open(cLogFileName));
+  worldModel.timeIndex = 5u;
+  ASSERT_TRUE(writer.write(worldModel));
+  // the time index has to increase
+  EXPECT_FALSE(writer.write(worldModel));
+  ASSERT_TRUE(writer.close());
+  EXPECT_FALSE(writer.close());
+
+  RssLogReader reader;
+  ASSERT_TRUE(reader.open(cLogFileName));
+  ASSERT_EQ(1u, reader.getNumberOfTicks());
+  RssLogTickView tick;
+  ASSERT_TRUE(reader.getTick(0u, tick));
+  world::WorldModel decodedWorldModel;
+  tick.decode(decodedWorldModel);
+  EXPECT_EQ(worldModel, decodedWorldModel);
+  EXPECT_TRUE(tick.getSituations().empty());
+  EXPECT_TRUE(tick.getResponseStates().empty());
+}
+
+TEST_F(RssLogTests, rejectInvalidLogs)
+{
+  RssLogReader reader;
+  EXPECT_FALSE(reader.open("NotExistingFile.rsslog"));
+  EXPECT_FALSE(reader.open(nullptr, 0u));
+
+  writeLog(2u);
+  std::vector<uint8_t> const data = readLogFile();
+  ASSERT_TRUE(reader.open(data.data(), data.size()));
+
+  // truncated log
+  EXPECT_FALSE(reader.open(data.data(), data.size() - 1u));
+  EXPECT_EQ(0u, reader.getNumberOfTicks());
+
+  // wrong magic
+  std::vector<uint8_t> corruptedData = data;
+  corruptedData[0] = 'X';
+  EXPECT_FALSE(reader.open(corruptedData.data(), corruptedData.size()));
+
+  // other version
+  corruptedData = data;
+  corruptedData[offsetof(RssLogFileHeader, version)]++;
+  EXPECT_FALSE(reader.open(corruptedData.data(), corruptedData.size()));
+
+  // tick index outside of the log
+  corruptedData = data;
+  corruptedData[corruptedData.size() - sizeof(RssLogFileFooter) + offsetof(RssLogFileFooter, tickCount)]++;
+  EXPECT_FALSE(reader.open(corruptedData.data(), corruptedData.size()));
+
+  // scenes array outside of the tick record
+  corruptedData = data;
+  std::size_t const scenesCountOffset
+    = sizeof(RssLogFileHeader) + offsetof(RssLogTickRecord, scenes) + offsetof(RssLogArrayRef, count);
+  corruptedData[scenesCountOffset + 1u] = 0xff;
+  ASSERT_TRUE(reader.open(corruptedData.data(), corruptedData.size()));
+  RssLogTickView tick;
+  EXPECT_FALSE(reader.getTick(0u, tick));
+  EXPECT_TRUE(reader.getTick(1u, tick));
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,164 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssSafetyLimits.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "core/RssState.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssSafetyLimitsTests : public RssCheckTestBase
+{
+protected:
+  /**
+   * @brief the world model is safe if none of the response states is dangerous
+   */
+  static bool isSafe(world::WorldModel const &currentWorldModel)
+  {
+    RssCheck rssCheck;
+    world::AccelerationRestriction accelerationRestriction;
+    situation::SituationVector situationVector;
+    state::ResponseStateVector responseStateVector;
+    EXPECT_TRUE(rssCheck.calculateAccelerationRestriction(
+      currentWorldModel, accelerationRestriction, situationVector, responseStateVector));
+    return std::none_of(responseStateVector.begin(), responseStateVector.end(), state::isDangerous);
+  }
+
+  /**
+   * @brief check that the world model is safe just below the limit and unsafe just above the limit
+   */
+  template <typename ValueType>
+  void expectLimit(ValueType &value, ValueType const &limit, double const minValue, double const maxValue)
+  {
+    ValueType const originalValue = value;
+    double const belowLimit = static_cast<double>(limit) - 0.01;
+    if ((minValue <= belowLimit) && (belowLimit <= maxValue))
+    {
+      value = ValueType(belowLimit);
+      EXPECT_TRUE(isSafe(worldModel)) << "limit " << static_cast<double>(limit);
+    }
+    double const aboveLimit = static_cast<double>(limit) + 0.01;
+    if ((minValue <= aboveLimit) && (aboveLimit <= maxValue))
+    {
+      value = ValueType(aboveLimit);
+      EXPECT_FALSE(isSafe(worldModel)) << "limit " << static_cast<double>(limit);
+    }
+    value = originalValue;
+  }
+};
+
+TEST_F(RssSafetyLimitsTests, replaces_iterative_search)
+{
+  for (auto speed : {0., 10., 30., 50., 70., 100.})
+  {
+    worldModel.egoVehicle.velocity.speedLon = kmhToMeterPerSec(speed);
+
+    RssSafetyLimits safetyLimits;
+    ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(worldModel, safetyLimits));
+
+    // the ego vehicle is following within the same lane, so only the longitudinal direction can become safe
+    if (isSafe(worldModel))
+    {
+      EXPECT_EQ(safetyLimits.maxAccelerationLat, std::numeric_limits<Acceleration>::max());
+    }
+    else
+    {
+      EXPECT_EQ(safetyLimits.maxAccelerationLat, std::numeric_limits<Acceleration>::lowest());
+    }
+    expectLimit(worldModel.egoVehicle.dynamics.alphaLon.accelMax, safetyLimits.maxAccelerationLon, 0., 100.);
+    expectLimit(worldModel.egoVehicle.velocity.speedLon, safetyLimits.maxSpeedLon, 0., 100.);
+  }
+}
+
+TEST_F(RssSafetyLimitsTests, tightest_limits_of_all_situations)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  RssSafetyLimits nearLimits;
+  ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(situationVector[0], nearLimits));
+
+  situation::Situation farSituation = situationVector[0];
+  farSituation.situationId = 1u;
+  farSituation.relativePosition.longitudinalDistance += Distance(20.);
+  RssSafetyLimits farLimits;
+  ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(farSituation, farLimits));
+  EXPECT_LT(nearLimits.maxAccelerationLon, farLimits.maxAccelerationLon);
+  EXPECT_LT(nearLimits.maxSpeedLon, farLimits.maxSpeedLon);
+
+  situation::Situation lateralSituation = situationVector[0];
+  lateralSituation.situationId = 2u;
+  lateralSituation.relativePosition.lateralPosition = situation::LateralRelativePosition::AtRight;
+  lateralSituation.relativePosition.lateralDistance = Distance(0.1);
+  lateralSituation.relativePosition.longitudinalDistance = Distance(1.);
+  RssSafetyLimits lateralLimits;
+  ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(lateralSituation, lateralLimits));
+  EXPECT_LT(lateralLimits.maxAccelerationLat, std::numeric_limits<Acceleration>::max());
+  EXPECT_GT(lateralLimits.minSpeedLat, std::numeric_limits<Speed>::lowest());
+
+  situationVector.push_back(farSituation);
+  situationVector.push_back(lateralSituation);
+  RssSafetyLimits safetyLimits;
+  ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(situationVector, safetyLimits));
+  EXPECT_EQ(safetyLimits.maxAccelerationLon,
+            std::min(nearLimits.maxAccelerationLon, lateralLimits.maxAccelerationLon));
+  EXPECT_EQ(safetyLimits.maxSpeedLon, std::min(nearLimits.maxSpeedLon, lateralLimits.maxSpeedLon));
+  EXPECT_EQ(safetyLimits.maxAccelerationLat, lateralLimits.maxAccelerationLat);
+  EXPECT_EQ(safetyLimits.minSpeedLat, lateralLimits.minSpeedLat);
+  EXPECT_EQ(safetyLimits.maxSpeedLat, std::numeric_limits<Speed>::max());
+}
+
+TEST_F(RssSafetyLimitsTests, ego_leading_is_not_limited)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  situation::Situation situation = situationVector[0];
+  situation.relativePosition.longitudinalPosition = situation::LongitudinalRelativePosition::InFront;
+  RssSafetyLimits safetyLimits;
+  ASSERT_TRUE(RssSafetyLimitsCalculation::calculateSafetyLimits(situation, safetyLimits));
+  EXPECT_EQ(safetyLimits.maxAccelerationLon, std::numeric_limits<Acceleration>::max());
+  EXPECT_EQ(safetyLimits.maxSpeedLon, std::numeric_limits<Speed>::max());
+}
+
+TEST_F(RssSafetyLimitsTests, invalid_world_model)
+{
+  worldModel.egoVehicle.responseTime = Duration(-1.);
+  RssSafetyLimits safetyLimits;
+  EXPECT_FALSE(RssSafetyLimitsCalculation::calculateSafetyLimits(worldModel, safetyLimits));
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,220 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssSafetyMargins.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssSafetyMarginsTests : public RssCheckTestBase
+{
+protected:
+  /**
+   * @brief the margin predicted by the constraint for the nominal accelerations of the planning horizon
+   */
+  static double nominalMargin(RssLinearConstraint const &constraint, RssPlanningHorizon const &planningHorizon)
+  {
+    auto const &accelerations = (constraint.axis == physics::CoordinateSystemAxis::Longitudinal)
+      ? planningHorizon.accelerationsLon
+      : planningHorizon.accelerationsLat;
+    double margin = constraint.upperBound + Distance::cPrecisionValue;
+    for (std::size_t j = 0u; j < accelerations.size(); j++)
+    {
+      margin -= constraint.coefficients[j] * static_cast<double>(accelerations[j]);
+    }
+    return margin;
+  }
+
+  static RssPlanningHorizon createPlanningHorizon(double const accelerationLon, double const accelerationLat)
+  {
+    RssPlanningHorizon planningHorizon;
+    planningHorizon.stepDuration = Duration(0.1);
+    planningHorizon.accelerationsLon.assign(10u, Acceleration(accelerationLon));
+    planningHorizon.accelerationsLat.assign(10u, Acceleration(accelerationLat));
+    return planningHorizon;
+  }
+};
+
+TEST_F(RssSafetyMarginsTests, margins_of_world_model)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  RssSituationSafetyMarginsVector safetyMarginsVector;
+  ASSERT_TRUE(RssSafetyMarginCalculation::calculateSafetyMargins(worldModel, safetyMarginsVector));
+  ASSERT_EQ(safetyMarginsVector.size(), 1u);
+
+  auto const &safetyMargins = safetyMarginsVector[0];
+  EXPECT_EQ(safetyMargins.situationId, situationVector[0].situationId);
+  ASSERT_TRUE(safetyMargins.hasLongitudinalMargin);
+  // the ego vehicle is following within the same lane
+  EXPECT_FALSE(safetyMargins.hasLateralMargin);
+
+  auto const &currentSituation = situationVector[0];
+  Distance const vehicleDistance = currentSituation.relativePosition.longitudinalDistance;
+  Distance safeDistance(0.);
+  bool isDistanceSafe = false;
+  ASSERT_TRUE(situation::checkSafeLongitudinalDistanceSameDirection(currentSituation.otherVehicleState,
+                                                                    currentSituation.egoVehicleState,
+                                                                    vehicleDistance,
+                                                                    safeDistance,
+                                                                    isDistanceSafe));
+  EXPECT_NEAR(static_cast<double>(safetyMargins.longitudinalMargin.margin),
+              static_cast<double>(vehicleDistance - safeDistance),
+              cDoubleNear);
+  // driving faster, accelerating more or responding later reduces the margin
+  EXPECT_LT(safetyMargins.longitudinalMargin.speedDerivative, Duration(0.));
+  EXPECT_LT(safetyMargins.longitudinalMargin.accelerationDerivative, physics::DurationSquared(0.));
+  EXPECT_LT(safetyMargins.longitudinalMargin.responseTimeDerivative, Speed(0.));
+}
+
+TEST_F(RssSafetyMarginsTests, lateral_margin)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  situation::Situation situation = situationVector[0];
+  situation.relativePosition.lateralPosition = situation::LateralRelativePosition::AtLeft;
+  situation.relativePosition.lateralDistance = Distance(1.);
+  situation.egoVehicleState.velocity.speedLat = Speed(0.5);
+
+  RssSituationSafetyMargins safetyMargins;
+  ASSERT_TRUE(RssSafetyMarginCalculation::calculateSafetyMargins(situation, safetyMargins));
+  EXPECT_TRUE(safetyMargins.hasLongitudinalMargin);
+  ASSERT_TRUE(safetyMargins.hasLateralMargin);
+  // moving towards the other vehicle reduces the margin
+  EXPECT_LT(safetyMargins.lateralMargin.speedDerivative, Duration(0.));
+  EXPECT_LT(safetyMargins.lateralMargin.accelerationDerivative, physics::DurationSquared(0.));
+}
+
+TEST_F(RssSafetyMarginsTests, intersection_margin)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  situation::Situation situation = situationVector[0];
+  situation.situationType = situation::SituationType::IntersectionObjectHasPriority;
+  situation.egoVehicleState.hasPriority = false;
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(40.);
+
+  RssSituationSafetyMargins safetyMargins;
+  ASSERT_TRUE(RssSafetyMarginCalculation::calculateSafetyMargins(situation, safetyMargins));
+  EXPECT_TRUE(safetyMargins.hasLongitudinalMargin);
+  EXPECT_FALSE(safetyMargins.hasLateralMargin);
+
+  situation.egoVehicleState.hasPriority = true;
+  ASSERT_TRUE(RssSafetyMarginCalculation::calculateSafetyMargins(situation, safetyMargins));
+  EXPECT_FALSE(safetyMargins.hasLongitudinalMargin);
+  EXPECT_FALSE(safetyMargins.hasLateralMargin);
+}
+
+TEST_F(RssSafetyMarginsTests, linear_constraints_over_planning_horizon)
+{
+  RssPlanningHorizon const planningHorizon = createPlanningHorizon(0., 0.);
+  RssLinearConstraintVector constraints;
+  ASSERT_TRUE(RssSafetyMarginCalculation::calculateLinearConstraints(worldModel, planningHorizon, constraints));
+  ASSERT_EQ(constraints.size(), planningHorizon.accelerationsLon.size());
+
+  for (auto const &constraint : constraints)
+  {
+    EXPECT_EQ(constraint.axis, physics::CoordinateSystemAxis::Longitudinal);
+    ASSERT_EQ(constraint.coefficients.size(), planningHorizon.accelerationsLon.size());
+    for (std::size_t j = 0u; j < constraint.coefficients.size(); j++)
+    {
+      if (j < constraint.step)
+      {
+        // accelerating reduces the margin of the following ego vehicle
+        EXPECT_GT(constraint.coefficients[j], 0.);
+      }
+      else
+      {
+        EXPECT_EQ(constraint.coefficients[j], 0.);
+      }
+    }
+  }
+
+  // the constraints predict the margins of slightly changed planned accelerations
+  for (auto acceleration : {-0.2, 0.2})
+  {
+    RssPlanningHorizon const changedPlanningHorizon = createPlanningHorizon(acceleration, 0.);
+    RssLinearConstraintVector changedConstraints;
+    ASSERT_TRUE(
+      RssSafetyMarginCalculation::calculateLinearConstraints(worldModel, changedPlanningHorizon, changedConstraints));
+    ASSERT_EQ(changedConstraints.size(), constraints.size());
+    for (std::size_t i = 0u; i < constraints.size(); i++)
+    {
+      EXPECT_NEAR(nominalMargin(constraints[i], changedPlanningHorizon),
+                  nominalMargin(changedConstraints[i], changedPlanningHorizon),
+                  cDoubleNear);
+    }
+  }
+}
+
+TEST_F(RssSafetyMarginsTests, linear_constraints_are_appended)
+{
+  situation::SituationVector situationVector;
+  ASSERT_TRUE(RssSituationExtraction::extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1u);
+
+  RssPlanningHorizon const planningHorizon = createPlanningHorizon(0., 0.);
+  RssLinearConstraintVector constraints;
+  ASSERT_TRUE(
+    RssSafetyMarginCalculation::calculateLinearConstraints(situationVector[0], planningHorizon, constraints));
+  ASSERT_TRUE(
+    RssSafetyMarginCalculation::calculateLinearConstraints(situationVector[0], planningHorizon, constraints));
+  EXPECT_EQ(constraints.size(), 2u * planningHorizon.accelerationsLon.size());
+}
+
+TEST_F(RssSafetyMarginsTests, invalid_input)
+{
+  RssPlanningHorizon planningHorizon = createPlanningHorizon(0., 0.);
+  RssLinearConstraintVector constraints;
+  planningHorizon.accelerationsLat.pop_back();
+  EXPECT_FALSE(RssSafetyMarginCalculation::calculateLinearConstraints(worldModel, planningHorizon, constraints));
+
+  planningHorizon = createPlanningHorizon(0., 0.);
+  planningHorizon.stepDuration = Duration(0.);
+  EXPECT_FALSE(RssSafetyMarginCalculation::calculateLinearConstraints(worldModel, planningHorizon, constraints));
+  EXPECT_TRUE(constraints.empty());
+
+  worldModel.egoVehicle.responseTime = Duration(-1.);
+  RssSituationSafetyMarginsVector safetyMarginsVector;
+  EXPECT_FALSE(RssSafetyMarginCalculation::calculateSafetyMargins(worldModel, safetyMarginsVector));
+}
+
+} // namespace core
+} // namespace ad_rss
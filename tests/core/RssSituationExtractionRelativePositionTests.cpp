@@ -30,7 +30,7 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "TestSupport.hpp"
-#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "core/RssSituationExtraction.hpp"
 
 namespace ad_rss {
 
@@ -40,16 +40,6 @@ namespace RssSituationExtraction {
 
 using physics::MetricRange;
 
-void calcluateRelativeLongitudinalPosition(MetricRange const &egoMetricRange,
-                                           MetricRange const &otherMetricRange,
-                                           situation::LongitudinalRelativePosition &longitudinalPosition,
-                                           Distance &longitudinalDistance);
-
-void calcluateRelativeLateralPosition(MetricRange const &egoMetricRange,
-                                      MetricRange const &otherMetricRange,
-                                      situation::LateralRelativePosition &lateralPosition,
-                                      Distance &lateralDistance);
-
 void performCalculateRelativePositionTest(Distance minA,
                                           Distance maxA,
                                           Distance minB,
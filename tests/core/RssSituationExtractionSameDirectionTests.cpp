@@ -203,6 +203,125 @@ TEST_F(RssSituationExtractionSameDirectionTests, longitudinalDifferenceEgoFollow
   ASSERT_EQ(situation, situationVector[0]);
 }
 
+TEST_F(RssSituationExtractionSameDirectionTests, multipleScenesWithSharedAndDistinctEgoVehicleRoads)
+{
+  world::WorldModel worldModel;
+  situation::SituationVector situationVector;
+
+  worldModel.egoVehicle = objectAsEgo(followingObject);
+  scene.object = leadingObject;
+
+  for (auto const laneLength : {10., 20., 10.})
+  {
+    ::ad_rss::world::RoadSegment roadSegment;
+    ::ad_rss::world::LaneSegment laneSegment;
+
+    laneSegment.id = 1;
+    laneSegment.length.minimum = Distance(laneLength);
+    laneSegment.length.maximum = Distance(laneLength);
+
+    laneSegment.width.minimum = Distance(5);
+    laneSegment.width.maximum = Distance(5);
+
+    roadSegment.push_back(laneSegment);
+
+    scene.egoVehicleRoad.clear();
+    scene.egoVehicleRoad.push_back(roadSegment);
+    scene.object.objectId = 10u + worldModel.scenes.size();
+    worldModel.scenes.push_back(scene);
+  }
+  worldModel.timeIndex = 1;
+
+  ASSERT_TRUE(extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 3);
+
+  ASSERT_EQ(situationVector[0].relativePosition.longitudinalDistance, Distance(6));
+  ASSERT_EQ(situationVector[1].relativePosition.longitudinalDistance, Distance(12));
+  ASSERT_EQ(situationVector[2].relativePosition.longitudinalDistance, Distance(6));
+
+  for (std::size_t i = 0u; i < worldModel.scenes.size(); i++)
+  {
+    situation::Situation situation;
+    ASSERT_TRUE(extractSituation(worldModel.timeIndex, worldModel.egoVehicle, worldModel.scenes[i], situation));
+    ASSERT_EQ(situation, situationVector[i]);
+  }
+}
+
+TEST_F(RssSituationExtractionSameDirectionTests, objectSpanningMultipleSegmentsInArbitraryOrder)
+{
+  world::WorldModel worldModel;
+  situation::SituationVector situationVector;
+
+  worldModel.egoVehicle = objectAsEgo(followingObject);
+  scene.object = leadingObject;
+  scene.object.occupiedRegions.clear();
+
+  for (auto const segmentId : {3u, 1u, 2u})
+  {
+    ::ad_rss::world::OccupiedRegion occupiedRegion;
+    occupiedRegion.segmentId = segmentId;
+    if (segmentId == 1u)
+    {
+      occupiedRegion.lonRange.minimum = ParametricValue(0.9);
+      occupiedRegion.lonRange.maximum = ParametricValue(1.0);
+      occupiedRegion.latRange.minimum = ParametricValue(0.5);
+      occupiedRegion.latRange.maximum = ParametricValue(0.6);
+    }
+    else if (segmentId == 2u)
+    {
+      occupiedRegion.lonRange.minimum = ParametricValue(0.8);
+      occupiedRegion.lonRange.maximum = ParametricValue(1.0);
+      occupiedRegion.latRange.minimum = ParametricValue(0.0);
+      occupiedRegion.latRange.maximum = ParametricValue(0.2);
+    }
+    else
+    {
+      occupiedRegion.lonRange.minimum = ParametricValue(0.0);
+      occupiedRegion.lonRange.maximum = ParametricValue(0.5);
+      occupiedRegion.latRange.minimum = ParametricValue(0.2);
+      occupiedRegion.latRange.maximum = ParametricValue(0.4);
+    }
+    scene.object.occupiedRegions.push_back(occupiedRegion);
+  }
+
+  ::ad_rss::world::LaneSegment laneSegment;
+  laneSegment.length.minimum = Distance(10);
+  laneSegment.length.maximum = Distance(10);
+  laneSegment.width.minimum = Distance(5);
+  laneSegment.width.maximum = Distance(5);
+
+  ::ad_rss::world::RoadSegment firstRoadSegment;
+  laneSegment.id = 1;
+  firstRoadSegment.push_back(laneSegment);
+  laneSegment.id = 2;
+  firstRoadSegment.push_back(laneSegment);
+  scene.egoVehicleRoad.push_back(firstRoadSegment);
+
+  ::ad_rss::world::RoadSegment secondRoadSegment;
+  laneSegment.id = 3;
+  secondRoadSegment.push_back(laneSegment);
+  scene.egoVehicleRoad.push_back(secondRoadSegment);
+
+  worldModel.scenes.push_back(scene);
+  worldModel.timeIndex = 1;
+
+  ASSERT_TRUE(extractSituations(worldModel, situationVector));
+  ASSERT_EQ(situationVector.size(), 1);
+
+  ASSERT_EQ(situationVector[0].relativePosition.longitudinalPosition,
+            ::ad_rss::situation::LongitudinalRelativePosition::AtBack);
+  ASSERT_EQ(situationVector[0].relativePosition.longitudinalDistance, Distance(6));
+  ASSERT_EQ(situationVector[0].relativePosition.lateralPosition, ::ad_rss::situation::LateralRelativePosition::Overlap);
+  ASSERT_EQ(situationVector[0].relativePosition.lateralDistance, Distance(0));
+
+  // an occupied region outside of the road area is an error
+  ::ad_rss::world::OccupiedRegion occupiedRegion = worldModel.scenes[0].object.occupiedRegions[0];
+  occupiedRegion.segmentId = 4u;
+  worldModel.scenes[0].object.occupiedRegions.push_back(occupiedRegion);
+  situationVector.clear();
+  ASSERT_FALSE(extractSituations(worldModel, situationVector));
+}
+
 } // namespace RssSituationExtraction
 } // namespace core
 } // namespace ad_rss
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/physics/Acceleration.hpp"
 
 TEST(AccelerationTests, defaultConstructionIsInvalid)
@@ -102,19 +103,19 @@ TEST(AccelerationTests, BelowMaxIsValid)
 TEST(AccelerationTests, ensureValidThrowsOnInvalid)
 {
   ::ad_rss::physics::Acceleration value;
-  EXPECT_THROW(value.ensureValid(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValid());
 }
 
 TEST(AccelerationTests, ensureValidNonZeroThrowsOnInvalid)
 {
   ::ad_rss::physics::Acceleration value;
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(AccelerationTests, ensureValidNonZeroThrowsOnZero)
 {
   ::ad_rss::physics::Acceleration value(0.);
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(AccelerationTestsStd, numericLimitsLowestIsMin)
@@ -232,23 +233,23 @@ TEST(AccelerationTests, comparisonOperatorsThrowOnInvalid)
   ::ad_rss::physics::Acceleration const value(::ad_rss::physics::Acceleration::cMinValue);
   ::ad_rss::physics::Acceleration const invalidValue;
 
-  EXPECT_THROW(invalidValue == value, std::out_of_range);
-  EXPECT_THROW(value == invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue == value);
+  EXPECT_RANGE_ERROR(value == invalidValue);
 
-  EXPECT_THROW(invalidValue != value, std::out_of_range);
-  EXPECT_THROW(value != invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue != value);
+  EXPECT_RANGE_ERROR(value != invalidValue);
 
-  EXPECT_THROW(invalidValue > value, std::out_of_range);
-  EXPECT_THROW(value > invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue > value);
+  EXPECT_RANGE_ERROR(value > invalidValue);
 
-  EXPECT_THROW(invalidValue < value, std::out_of_range);
-  EXPECT_THROW(value < invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue < value);
+  EXPECT_RANGE_ERROR(value < invalidValue);
 
-  EXPECT_THROW(invalidValue >= value, std::out_of_range);
-  EXPECT_THROW(value >= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue >= value);
+  EXPECT_RANGE_ERROR(value >= invalidValue);
 
-  EXPECT_THROW(invalidValue <= value, std::out_of_range);
-  EXPECT_THROW(value <= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue <= value);
+  EXPECT_RANGE_ERROR(value <= invalidValue);
 }
 
 TEST(AccelerationTests, arithmeticOperatorsThrowOnInvalid)
@@ -259,55 +260,55 @@ TEST(AccelerationTests, arithmeticOperatorsThrowOnInvalid)
   ::ad_rss::physics::Acceleration calculationValue;
 
   //  operator+(::ad_rss::physics::Acceleration)
-  EXPECT_THROW(invalidValue + maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue + maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue + invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue + maximalValue);
 
   //  operator+=(::ad_rss::physics::Acceleration)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += invalidValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
 
   //  operator-(::ad_rss::physics::Acceleration)
-  EXPECT_THROW(invalidValue - minimalValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - invalidValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue - minimalValue);
+  EXPECT_RANGE_ERROR(minimalValue - invalidValue);
+  EXPECT_RANGE_ERROR(minimalValue - maximalValue);
 
   //  operator-=(::ad_rss::physics::Acceleration)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue -= minimalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= minimalValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= invalidValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= maximalValue);
 
   //  operator*(double)
-  EXPECT_THROW(invalidValue * static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue * static_cast<double>(maximalValue), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue * static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue * static_cast<double>(maximalValue));
 
   //  operator/(double)
-  EXPECT_THROW(invalidValue / static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / static_cast<double>(invalidValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.0, std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.5, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue / static_cast<double>(invalidValue));
+  EXPECT_RANGE_ERROR(maximalValue / 0.0);
+  EXPECT_RANGE_ERROR(maximalValue / 0.5);
 
   //  operator/(::ad_rss::physics::Acceleration)
-  EXPECT_THROW(invalidValue / maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / ::ad_rss::physics::Acceleration(0.0), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue / invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue / ::ad_rss::physics::Acceleration(0.0));
 
   //  operator-()
-  EXPECT_THROW(-invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(-invalidValue);
   if (std::fabs(static_cast<double>(maximalValue)) > std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-maximalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-maximalValue);
   }
   else if (std::fabs(static_cast<double>(maximalValue)) < std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-minimalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-minimalValue);
   }
   else
   {
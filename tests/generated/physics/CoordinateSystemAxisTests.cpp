@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
 
 TEST(CoordinateSystemAxisTests, testFromString)
@@ -52,7 +53,7 @@ TEST(CoordinateSystemAxisTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::physics::CoordinateSystemAxis>("::ad_rss::physics::CoordinateSystemAxis::Lateral"),
             ::ad_rss::physics::CoordinateSystemAxis::Lateral);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::physics::CoordinateSystemAxis>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::physics::CoordinateSystemAxis>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(CoordinateSystemAxisTests, testToString)
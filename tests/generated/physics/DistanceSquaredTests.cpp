@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/physics/Distance.hpp"
 #include "ad_rss/physics/DistanceSquared.hpp"
 
@@ -105,19 +106,19 @@ TEST(DistanceSquaredTests, BelowMaxIsValid)
 TEST(DistanceSquaredTests, ensureValidThrowsOnInvalid)
 {
   ::ad_rss::physics::DistanceSquared value;
-  EXPECT_THROW(value.ensureValid(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValid());
 }
 
 TEST(DistanceSquaredTests, ensureValidNonZeroThrowsOnInvalid)
 {
   ::ad_rss::physics::DistanceSquared value;
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(DistanceSquaredTests, ensureValidNonZeroThrowsOnZero)
 {
   ::ad_rss::physics::DistanceSquared value(0.);
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(DistanceSquaredTestsStd, numericLimitsLowestIsMin)
@@ -235,23 +236,23 @@ TEST(DistanceSquaredTests, comparisonOperatorsThrowOnInvalid)
   ::ad_rss::physics::DistanceSquared const value(::ad_rss::physics::DistanceSquared::cMinValue);
   ::ad_rss::physics::DistanceSquared const invalidValue;
 
-  EXPECT_THROW(invalidValue == value, std::out_of_range);
-  EXPECT_THROW(value == invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue == value);
+  EXPECT_RANGE_ERROR(value == invalidValue);
 
-  EXPECT_THROW(invalidValue != value, std::out_of_range);
-  EXPECT_THROW(value != invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue != value);
+  EXPECT_RANGE_ERROR(value != invalidValue);
 
-  EXPECT_THROW(invalidValue > value, std::out_of_range);
-  EXPECT_THROW(value > invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue > value);
+  EXPECT_RANGE_ERROR(value > invalidValue);
 
-  EXPECT_THROW(invalidValue < value, std::out_of_range);
-  EXPECT_THROW(value < invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue < value);
+  EXPECT_RANGE_ERROR(value < invalidValue);
 
-  EXPECT_THROW(invalidValue >= value, std::out_of_range);
-  EXPECT_THROW(value >= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue >= value);
+  EXPECT_RANGE_ERROR(value >= invalidValue);
 
-  EXPECT_THROW(invalidValue <= value, std::out_of_range);
-  EXPECT_THROW(value <= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue <= value);
+  EXPECT_RANGE_ERROR(value <= invalidValue);
 }
 
 TEST(DistanceSquaredTests, arithmeticOperatorsThrowOnInvalid)
@@ -262,58 +263,58 @@ TEST(DistanceSquaredTests, arithmeticOperatorsThrowOnInvalid)
   ::ad_rss::physics::DistanceSquared calculationValue;
 
   //  operator+(::ad_rss::physics::DistanceSquared)
-  EXPECT_THROW(invalidValue + maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue + maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue + invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue + maximalValue);
 
   //  operator+=(::ad_rss::physics::DistanceSquared)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += invalidValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
 
   //  operator-(::ad_rss::physics::DistanceSquared)
-  EXPECT_THROW(invalidValue - minimalValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - invalidValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue - minimalValue);
+  EXPECT_RANGE_ERROR(minimalValue - invalidValue);
+  EXPECT_RANGE_ERROR(minimalValue - maximalValue);
 
   //  operator-=(::ad_rss::physics::DistanceSquared)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue -= minimalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= minimalValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= invalidValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= maximalValue);
 
   //  operator*(double)
-  EXPECT_THROW(invalidValue * static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue * static_cast<double>(maximalValue), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue * static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue * static_cast<double>(maximalValue));
 
   //  std::sqrt()
-  EXPECT_THROW(std::sqrt(invalidValue), std::out_of_range);
+  EXPECT_RANGE_ERROR(std::sqrt(invalidValue));
 
   //  operator/(double)
-  EXPECT_THROW(invalidValue / static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / static_cast<double>(invalidValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.0, std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.5, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue / static_cast<double>(invalidValue));
+  EXPECT_RANGE_ERROR(maximalValue / 0.0);
+  EXPECT_RANGE_ERROR(maximalValue / 0.5);
 
   //  operator/(::ad_rss::physics::DistanceSquared)
-  EXPECT_THROW(invalidValue / maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / ::ad_rss::physics::DistanceSquared(0.0), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue / invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue / ::ad_rss::physics::DistanceSquared(0.0));
 
   //  operator-()
-  EXPECT_THROW(-invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(-invalidValue);
   if (std::fabs(static_cast<double>(maximalValue)) > std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-maximalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-maximalValue);
   }
   else if (std::fabs(static_cast<double>(maximalValue)) < std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-minimalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-minimalValue);
   }
   else
   {
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/physics/Distance.hpp"
 #include "ad_rss/physics/DistanceSquared.hpp"
 
@@ -103,19 +104,19 @@ TEST(DistanceTests, BelowMaxIsValid)
 TEST(DistanceTests, ensureValidThrowsOnInvalid)
 {
   ::ad_rss::physics::Distance value;
-  EXPECT_THROW(value.ensureValid(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValid());
 }
 
 TEST(DistanceTests, ensureValidNonZeroThrowsOnInvalid)
 {
   ::ad_rss::physics::Distance value;
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(DistanceTests, ensureValidNonZeroThrowsOnZero)
 {
   ::ad_rss::physics::Distance value(0.);
-  EXPECT_THROW(value.ensureValidNonZero(), std::out_of_range);
+  EXPECT_RANGE_ERROR(value.ensureValidNonZero());
 }
 
 TEST(DistanceTestsStd, numericLimitsLowestIsMin)
@@ -227,23 +228,23 @@ TEST(DistanceTests, comparisonOperatorsThrowOnInvalid)
   ::ad_rss::physics::Distance const value(::ad_rss::physics::Distance::cMinValue);
   ::ad_rss::physics::Distance const invalidValue;
 
-  EXPECT_THROW(invalidValue == value, std::out_of_range);
-  EXPECT_THROW(value == invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue == value);
+  EXPECT_RANGE_ERROR(value == invalidValue);
 
-  EXPECT_THROW(invalidValue != value, std::out_of_range);
-  EXPECT_THROW(value != invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue != value);
+  EXPECT_RANGE_ERROR(value != invalidValue);
 
-  EXPECT_THROW(invalidValue > value, std::out_of_range);
-  EXPECT_THROW(value > invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue > value);
+  EXPECT_RANGE_ERROR(value > invalidValue);
 
-  EXPECT_THROW(invalidValue < value, std::out_of_range);
-  EXPECT_THROW(value < invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue < value);
+  EXPECT_RANGE_ERROR(value < invalidValue);
 
-  EXPECT_THROW(invalidValue >= value, std::out_of_range);
-  EXPECT_THROW(value >= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue >= value);
+  EXPECT_RANGE_ERROR(value >= invalidValue);
 
-  EXPECT_THROW(invalidValue <= value, std::out_of_range);
-  EXPECT_THROW(value <= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue <= value);
+  EXPECT_RANGE_ERROR(value <= invalidValue);
 }
 
 TEST(DistanceTests, arithmeticOperatorsThrowOnInvalid)
@@ -254,59 +255,59 @@ TEST(DistanceTests, arithmeticOperatorsThrowOnInvalid)
   ::ad_rss::physics::Distance calculationValue;
 
   //  operator+(::ad_rss::physics::Distance)
-  EXPECT_THROW(invalidValue + maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue + maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue + maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue + invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue + maximalValue);
 
   //  operator+=(::ad_rss::physics::Distance)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += invalidValue);
   calculationValue = maximalValue;
-  EXPECT_THROW(calculationValue += maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue += maximalValue);
 
   //  operator-(::ad_rss::physics::Distance)
-  EXPECT_THROW(invalidValue - minimalValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - invalidValue, std::out_of_range);
-  EXPECT_THROW(minimalValue - maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue - minimalValue);
+  EXPECT_RANGE_ERROR(minimalValue - invalidValue);
+  EXPECT_RANGE_ERROR(minimalValue - maximalValue);
 
   //  operator-=(::ad_rss::physics::Distance)
   calculationValue = invalidValue;
-  EXPECT_THROW(calculationValue -= minimalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= minimalValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= invalidValue);
   calculationValue = minimalValue;
-  EXPECT_THROW(calculationValue -= maximalValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(calculationValue -= maximalValue);
 
   //  operator*(double)
-  EXPECT_THROW(invalidValue * static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue * static_cast<double>(maximalValue), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue * static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue * static_cast<double>(maximalValue));
 
   //  operator*(::ad_rss::physics::Distance)
-  EXPECT_THROW(invalidValue * maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue * invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue * maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue * invalidValue);
 
   //  operator/(double)
-  EXPECT_THROW(invalidValue / static_cast<double>(maximalValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / static_cast<double>(invalidValue), std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.0, std::out_of_range);
-  EXPECT_THROW(maximalValue / 0.5, std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / static_cast<double>(maximalValue));
+  EXPECT_RANGE_ERROR(maximalValue / static_cast<double>(invalidValue));
+  EXPECT_RANGE_ERROR(maximalValue / 0.0);
+  EXPECT_RANGE_ERROR(maximalValue / 0.5);
 
   //  operator/(::ad_rss::physics::Distance)
-  EXPECT_THROW(invalidValue / maximalValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / invalidValue, std::out_of_range);
-  EXPECT_THROW(maximalValue / ::ad_rss::physics::Distance(0.0), std::out_of_range);
+  EXPECT_RANGE_ERROR(invalidValue / maximalValue);
+  EXPECT_RANGE_ERROR(maximalValue / invalidValue);
+  EXPECT_RANGE_ERROR(maximalValue / ::ad_rss::physics::Distance(0.0));
 
   //  operator-()
-  EXPECT_THROW(-invalidValue, std::out_of_range);
+  EXPECT_RANGE_ERROR(-invalidValue);
   if (std::fabs(static_cast<double>(maximalValue)) > std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-maximalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-maximalValue);
   }
   else if (std::fabs(static_cast<double>(maximalValue)) < std::fabs(static_cast<double>(minimalValue)))
   {
-    EXPECT_THROW(-minimalValue, std::out_of_range);
+    EXPECT_RANGE_ERROR(-minimalValue);
   }
   else
   {
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/situation/LateralRelativePosition.hpp"
 
 TEST(LateralRelativePositionTests, testFromString)
@@ -71,7 +72,7 @@ TEST(LateralRelativePositionTests, testFromString)
     fromString<::ad_rss::situation::LateralRelativePosition>("::ad_rss::situation::LateralRelativePosition::AtRight"),
     ::ad_rss::situation::LateralRelativePosition::AtRight);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::situation::LateralRelativePosition>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::situation::LateralRelativePosition>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LateralRelativePositionTests, testToString)
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/situation/LongitudinalRelativePosition.hpp"
 
 TEST(LongitudinalRelativePositionTests, testFromString)
@@ -71,7 +72,7 @@ TEST(LongitudinalRelativePositionTests, testFromString)
               "::ad_rss::situation::LongitudinalRelativePosition::AtBack"),
             ::ad_rss::situation::LongitudinalRelativePosition::AtBack);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::situation::LongitudinalRelativePosition>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::situation::LongitudinalRelativePosition>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LongitudinalRelativePositionTests, testToString)
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/situation/SituationType.hpp"
 
 TEST(SituationTypeTests, testFromString)
@@ -74,7 +75,7 @@ TEST(SituationTypeTests, testFromString)
     fromString<::ad_rss::situation::SituationType>("::ad_rss::situation::SituationType::IntersectionSamePriority"),
     ::ad_rss::situation::SituationType::IntersectionSamePriority);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::situation::SituationType>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::situation::SituationType>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(SituationTypeTests, testToString)
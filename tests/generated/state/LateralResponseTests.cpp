@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/state/LateralResponse.hpp"
 
 TEST(LateralResponseTests, testFromString)
@@ -49,7 +50,7 @@ TEST(LateralResponseTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::state::LateralResponse>("::ad_rss::state::LateralResponse::BrakeMin"),
             ::ad_rss::state::LateralResponse::BrakeMin);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::state::LateralResponse>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::state::LateralResponse>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LateralResponseTests, testToString)
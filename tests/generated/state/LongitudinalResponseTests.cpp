@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/state/LongitudinalResponse.hpp"
 
 TEST(LongitudinalResponseTests, testFromString)
@@ -55,7 +56,7 @@ TEST(LongitudinalResponseTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::state::LongitudinalResponse>("::ad_rss::state::LongitudinalResponse::BrakeMin"),
             ::ad_rss::state::LongitudinalResponse::BrakeMin);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::state::LongitudinalResponse>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::state::LongitudinalResponse>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LongitudinalResponseTests, testToString)
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/state/ResponseEvaluator.hpp"
 
 TEST(ResponseEvaluatorTests, testFromString)
@@ -103,7 +104,7 @@ TEST(ResponseEvaluatorTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::state::ResponseEvaluator>("::ad_rss::state::ResponseEvaluator::IntersectionOverlap"),
             ::ad_rss::state::ResponseEvaluator::IntersectionOverlap);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::state::ResponseEvaluator>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::state::ResponseEvaluator>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(ResponseEvaluatorTests, testToString)
@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/world/LaneDrivingDirection.hpp"
 
 TEST(LaneDrivingDirectionTests, testFromString)
@@ -56,7 +57,7 @@ TEST(LaneDrivingDirectionTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::world::LaneDrivingDirection>("::ad_rss::world::LaneDrivingDirection::Negative"),
             ::ad_rss::world::LaneDrivingDirection::Negative);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::world::LaneDrivingDirection>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::world::LaneDrivingDirection>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LaneDrivingDirectionTests, testToString)
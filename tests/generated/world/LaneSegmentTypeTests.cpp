@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/world/LaneSegmentType.hpp"
 
 TEST(LaneSegmentTypeTests, testFromString)
@@ -50,7 +51,7 @@ TEST(LaneSegmentTypeTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::world::LaneSegmentType>("::ad_rss::world::LaneSegmentType::Intersection"),
             ::ad_rss::world::LaneSegmentType::Intersection);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::world::LaneSegmentType>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::world::LaneSegmentType>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(LaneSegmentTypeTests, testToString)
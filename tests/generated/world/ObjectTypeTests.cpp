@@ -37,6 +37,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include "RangeErrorSupport.hpp"
 #include "ad_rss/world/ObjectType.hpp"
 
 TEST(ObjectTypeTests, testFromString)
@@ -53,7 +54,7 @@ TEST(ObjectTypeTests, testFromString)
   ASSERT_EQ(fromString<::ad_rss::world::ObjectType>("::ad_rss::world::ObjectType::ArtificialObject"),
             ::ad_rss::world::ObjectType::ArtificialObject);
 
-  EXPECT_ANY_THROW({ fromString<::ad_rss::world::ObjectType>("NOT A VALID ENUM LITERAL"); });
+  EXPECT_RANGE_ERROR({ fromString<::ad_rss::world::ObjectType>("NOT A VALID ENUM LITERAL"); });
 }
 
 TEST(ObjectTypeTests, testToString)
@@ -0,0 +1,343 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "TestSupport.hpp"
+#include "physics/Math.hpp"
+#include "physics/MathBatch.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace physics {
+
+// values covering the valid input range as well as invalid input values
+double const cNaN = std::numeric_limits<double>::quiet_NaN();
+std::vector<double> const cBatchSpeeds{-1e4, -100., -0.5, 0., 1e-310, 5e-4, 0.5, 10., 100., cNaN};
+std::vector<double> const cBatchAccelerations{-1e4, -100., -1., 0., 1e-310, 5e-5, 1e-3, 3.5, 100., cNaN};
+std::vector<double> const cBatchResponseTimes{-1., 0., 1e-310, 0.5, 2., 10., cNaN};
+std::vector<double> const cBatchDistances{-1., 0., 5e-4, 1., 100., 1e4, 1e7, cNaN};
+
+// odd batch size to cover the scalar processing of the batch tail
+std::size_t const cChunkSize = 7u;
+
+std::vector<MathBatchImplementation> getAvailableImplementations()
+{
+  std::vector<MathBatchImplementation> implementations;
+  for (auto implementation : {MathBatchImplementation::Auto,
+                              MathBatchImplementation::Scalar,
+                              MathBatchImplementation::SSE2,
+                              MathBatchImplementation::AVX2})
+  {
+    if (isMathBatchImplementationAvailable(implementation))
+    {
+      implementations.push_back(implementation);
+    }
+  }
+  return implementations;
+}
+
+bool isBitwiseEqual(double const left, double const right)
+{
+  uint64_t leftBits;
+  uint64_t rightBits;
+  std::memcpy(&leftBits, &left, sizeof(double));
+  std::memcpy(&rightBits, &right, sizeof(double));
+  return leftBits == rightBits;
+}
+
+template <typename Calculation> bool calculateScalar(Calculation calculation)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    result = calculation();
+  }
+  AD_RSS_CATCH_RANGE_ERROR
+  {
+    result = false;
+  }
+  return result;
+}
+
+/**
+ * Calculates the batch in chunks and compares the results with the expected results of the scalar calculation
+ */
+template <typename BatchCalculation>
+void expectEqualBatchResults(std::vector<bool> const &expectedSuccess,
+                             std::vector<double> const &expectedValues,
+                             BatchCalculation batchCalculation)
+{
+  for (auto implementation : getAvailableImplementations())
+  {
+    std::vector<double> values(expectedValues.size(), 0.);
+    for (std::size_t offset = 0u; offset < values.size(); offset += cChunkSize)
+    {
+      std::size_t const count = std::min(cChunkSize, values.size() - offset);
+      bool chunkSuccess = true;
+      for (std::size_t i = offset; i < offset + count; ++i)
+      {
+        chunkSuccess = chunkSuccess && expectedSuccess[i];
+      }
+      EXPECT_EQ(chunkSuccess, batchCalculation(offset, count, &values[offset], implementation))
+        << "implementation: " << static_cast<int32_t>(implementation) << " offset: " << offset;
+    }
+    for (std::size_t i = 0u; i < values.size(); ++i)
+    {
+      if (expectedSuccess[i])
+      {
+        EXPECT_TRUE(isBitwiseEqual(expectedValues[i], values[i]))
+          << "implementation: " << static_cast<int32_t>(implementation) << " index: " << i
+          << " expected: " << expectedValues[i] << " actual: " << values[i];
+      }
+    }
+  }
+}
+
+TEST(MathBatchTests, implementation_availability)
+{
+  EXPECT_TRUE(isMathBatchImplementationAvailable(MathBatchImplementation::Auto));
+  EXPECT_TRUE(isMathBatchImplementationAvailable(MathBatchImplementation::Scalar));
+  EXPECT_FALSE(isMathBatchImplementationAvailable(static_cast<MathBatchImplementation>(-1)));
+}
+
+TEST(MathBatchTests, invalid_arrays)
+{
+  double values[1] = {1.};
+  EXPECT_TRUE(calculateStoppingDistanceBatch(0u, nullptr, nullptr, nullptr));
+  EXPECT_FALSE(calculateStoppingDistanceBatch(1u, nullptr, values, values));
+  EXPECT_FALSE(calculateStoppingDistanceBatch(1u, values, values, nullptr));
+  EXPECT_FALSE(
+    calculateSpeedAfterResponseTimeBatch(CoordinateSystemAxis::Longitudinal, 1u, values, nullptr, values, values));
+  EXPECT_FALSE(
+    calculateDistanceOffsetAfterResponseTimeBatch(CoordinateSystemAxis::Lateral, 1u, values, values, nullptr, values));
+  EXPECT_FALSE(calculateTimeToCoverDistanceBatch(1u, values, values, values, values, nullptr, values));
+  EXPECT_FALSE(calculateDistanceOffsetAfterStatedBrakingPatternBatch(
+    CoordinateSystemAxis::Longitudinal, 1u, values, values, nullptr, values, values));
+  EXPECT_FALSE(calculateStoppingDistanceBatch(1u, values, values, values, static_cast<MathBatchImplementation>(-1)));
+}
+
+TEST(MathBatchTests, stopping_distance_equals_scalar)
+{
+  std::vector<double> speeds;
+  std::vector<double> decelerations;
+  std::vector<bool> expectedSuccess;
+  std::vector<double> expectedValues;
+  for (auto speed : cBatchSpeeds)
+  {
+    for (auto deceleration : cBatchAccelerations)
+    {
+      Distance stoppingDistance(0.);
+      speeds.push_back(speed);
+      decelerations.push_back(deceleration);
+      expectedSuccess.push_back(calculateScalar([&]() {
+        return calculateStoppingDistance(Speed(speed), Acceleration(deceleration), stoppingDistance);
+      }));
+      expectedValues.push_back(static_cast<double>(stoppingDistance));
+    }
+  }
+
+  expectEqualBatchResults(
+    expectedSuccess,
+    expectedValues,
+    [&](std::size_t offset, std::size_t count, double *values, MathBatchImplementation implementation) {
+      return calculateStoppingDistanceBatch(count, &speeds[offset], &decelerations[offset], values, implementation);
+    });
+}
+
+TEST(MathBatchTests, response_time_calculations_equal_scalar)
+{
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    std::vector<double> speeds;
+    std::vector<double> accelerations;
+    std::vector<double> responseTimes;
+    std::vector<bool> expectedSpeedSuccess;
+    std::vector<double> expectedSpeedValues;
+    std::vector<bool> expectedDistanceSuccess;
+    std::vector<double> expectedDistanceValues;
+    for (auto speed : cBatchSpeeds)
+    {
+      for (auto acceleration : cBatchAccelerations)
+      {
+        for (auto responseTime : cBatchResponseTimes)
+        {
+          speeds.push_back(speed);
+          accelerations.push_back(acceleration);
+          responseTimes.push_back(responseTime);
+          Speed resultingSpeed(0.);
+          expectedSpeedSuccess.push_back(calculateScalar([&]() {
+            return calculateSpeedAfterResponseTime(
+              axis, Speed(speed), Acceleration(acceleration), Duration(responseTime), resultingSpeed);
+          }));
+          expectedSpeedValues.push_back(static_cast<double>(resultingSpeed));
+          Distance distanceOffset(0.);
+          expectedDistanceSuccess.push_back(calculateScalar([&]() {
+            return calculateDistanceOffsetAfterResponseTime(
+              axis, Speed(speed), Acceleration(acceleration), Duration(responseTime), distanceOffset);
+          }));
+          expectedDistanceValues.push_back(static_cast<double>(distanceOffset));
+        }
+      }
+    }
+
+    expectEqualBatchResults(
+      expectedSpeedSuccess,
+      expectedSpeedValues,
+      [&](std::size_t offset, std::size_t count, double *values, MathBatchImplementation implementation) {
+        return calculateSpeedAfterResponseTimeBatch(
+          axis, count, &speeds[offset], &accelerations[offset], &responseTimes[offset], values, implementation);
+      });
+    expectEqualBatchResults(
+      expectedDistanceSuccess,
+      expectedDistanceValues,
+      [&](std::size_t offset, std::size_t count, double *values, MathBatchImplementation implementation) {
+        return calculateDistanceOffsetAfterResponseTimeBatch(
+          axis, count, &speeds[offset], &accelerations[offset], &responseTimes[offset], values, implementation);
+      });
+  }
+}
+
+TEST(MathBatchTests, time_to_cover_distance_equals_scalar)
+{
+  std::vector<double> speeds;
+  std::vector<double> responseTimes;
+  std::vector<double> accelerations;
+  std::vector<double> decelerations;
+  std::vector<double> distances;
+  std::vector<bool> expectedSuccess;
+  std::vector<double> expectedValues;
+  for (auto speed : cBatchSpeeds)
+  {
+    for (auto responseTime : cBatchResponseTimes)
+    {
+      for (auto acceleration : cBatchAccelerations)
+      {
+        for (auto deceleration : cBatchAccelerations)
+        {
+          for (auto distance : cBatchDistances)
+          {
+            speeds.push_back(speed);
+            responseTimes.push_back(responseTime);
+            accelerations.push_back(acceleration);
+            decelerations.push_back(deceleration);
+            distances.push_back(distance);
+            Duration requiredTime(0.);
+            expectedSuccess.push_back(calculateScalar([&]() {
+              return calculateTimeToCoverDistance(Speed(speed),
+                                                  Duration(responseTime),
+                                                  Acceleration(acceleration),
+                                                  Acceleration(deceleration),
+                                                  Distance(distance),
+                                                  requiredTime);
+            }));
+            expectedValues.push_back(static_cast<double>(requiredTime));
+          }
+        }
+      }
+    }
+  }
+
+  expectEqualBatchResults(
+    expectedSuccess,
+    expectedValues,
+    [&](std::size_t offset, std::size_t count, double *values, MathBatchImplementation implementation) {
+      return calculateTimeToCoverDistanceBatch(count,
+                                               &speeds[offset],
+                                               &responseTimes[offset],
+                                               &accelerations[offset],
+                                               &decelerations[offset],
+                                               &distances[offset],
+                                               values,
+                                               implementation);
+    });
+}
+
+TEST(MathBatchTests, stated_braking_pattern_equals_scalar)
+{
+  // values covering the valid input range of the vehicle state including its borders
+  std::vector<double> const speeds{-10., -0.5, 0., 0.5, 10., 100.};
+  std::vector<double> const responseTimes{1e-3, 0.5, 2., 10.};
+  std::vector<double> const accelerations{-100., -3.5, -1e-3, 0., 1e-3, 3.5, 100.};
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    std::vector<double> currentSpeeds;
+    std::vector<double> currentResponseTimes;
+    std::vector<double> currentAccelerations;
+    std::vector<double> decelerations;
+    std::vector<bool> expectedSuccess;
+    std::vector<double> expectedValues;
+    for (auto speed : speeds)
+    {
+      for (auto responseTime : responseTimes)
+      {
+        for (auto acceleration : accelerations)
+        {
+          for (auto deceleration : accelerations)
+          {
+            currentSpeeds.push_back(speed);
+            currentResponseTimes.push_back(responseTime);
+            currentAccelerations.push_back(acceleration);
+            decelerations.push_back(deceleration);
+            Distance distanceOffset(0.);
+            expectedSuccess.push_back(calculateScalar([&]() {
+              return situation::calculateDistanceOffsetAfterStatedBrakingPattern(axis,
+                                                                                 Speed(speed),
+                                                                                 Duration(responseTime),
+                                                                                 Acceleration(acceleration),
+                                                                                 Acceleration(deceleration),
+                                                                                 distanceOffset);
+            }));
+            expectedValues.push_back(static_cast<double>(distanceOffset));
+          }
+        }
+      }
+    }
+
+    expectEqualBatchResults(
+      expectedSuccess,
+      expectedValues,
+      [&](std::size_t offset, std::size_t count, double *values, MathBatchImplementation implementation) {
+        return calculateDistanceOffsetAfterStatedBrakingPatternBatch(axis,
+                                                                     count,
+                                                                     &currentSpeeds[offset],
+                                                                     &currentResponseTimes[offset],
+                                                                     &currentAccelerations[offset],
+                                                                     &decelerations[offset],
+                                                                     values,
+                                                                     implementation);
+      });
+  }
+}
+
+} // namespace physics
+} // namespace ad_rss
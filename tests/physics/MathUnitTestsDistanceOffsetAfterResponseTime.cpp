@@ -129,5 +129,47 @@ TEST(MathUnitTestsDistanceOffsetAfterResponseTime, checks_acceleration_time2s)
   }
 }
 
+TEST(MathUnitTestsDistanceOffsetAfterResponseTime, checks_speed_range)
+{
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    double const minimumSpeed = (axis == CoordinateSystemAxis::Longitudinal) ? 0. : -10.;
+    SpeedRange speedRange;
+    speedRange.minimum = Speed(minimumSpeed);
+    speedRange.maximum = Speed(10.);
+
+    for (auto acceleration : {-3., 0., 2.})
+    {
+      MetricRange distanceOffsetRange;
+      ASSERT_TRUE(calculateDistanceOffsetAfterResponseTime(
+        axis, speedRange, Acceleration(acceleration), Duration(2.), distanceOffsetRange));
+
+      for (double speed = minimumSpeed; speed <= 10.; speed += 0.25)
+      {
+        Distance distanceOffset(0.);
+        ASSERT_TRUE(calculateDistanceOffsetAfterResponseTime(
+          axis, Speed(speed), Acceleration(acceleration), Duration(2.), distanceOffset));
+        ASSERT_LE(distanceOffsetRange.minimum, distanceOffset);
+        ASSERT_GE(distanceOffsetRange.maximum, distanceOffset);
+      }
+    }
+  }
+}
+
+TEST(MathUnitTestsDistanceOffsetAfterResponseTime, negative_speed_range)
+{
+  SpeedRange speedRange;
+  speedRange.minimum = Speed(-1.);
+  speedRange.maximum = Speed(10.);
+
+  MetricRange distanceOffsetRange;
+  ASSERT_FALSE(calculateDistanceOffsetAfterResponseTime(
+    CoordinateSystemAxis::Longitudinal, speedRange, Acceleration(2.), Duration(1.), distanceOffsetRange));
+  ASSERT_TRUE(calculateDistanceOffsetAfterResponseTime(
+    CoordinateSystemAxis::Lateral, speedRange, Acceleration(2.), Duration(1.), distanceOffsetRange));
+  ASSERT_NEAR(static_cast<double>(distanceOffsetRange.minimum), 0., cDoubleNear);
+  ASSERT_NEAR(static_cast<double>(distanceOffsetRange.maximum), 11., cDoubleNear);
+}
+
 } // namespace physics
 } // namespace ad_rss
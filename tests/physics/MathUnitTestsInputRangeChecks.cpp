@@ -29,6 +29,7 @@
 //
 // ----------------- END LICENSE BLOCK -----------------------------------
 
+#include "RangeErrorSupport.hpp"
 #include "TestSupport.hpp"
 #include "physics/Math.hpp"
 
@@ -63,52 +64,47 @@ TEST(MathUnitTestsInputRangeChecks, speed_and_acceleration_zero)
 
 TEST(MathUnitTestsInputRangeChecks, calculateDistanceOffsetInAccerlatedMovementThrows)
 {
-  EXPECT_THROW(calculateDistanceOffsetInAccerlatedMovement(Speed(), Acceleration(0), Duration(0)), std::out_of_range);
-  EXPECT_THROW(calculateDistanceOffsetInAccerlatedMovement(Speed(0), Acceleration(), Duration(0)), std::out_of_range);
-  EXPECT_THROW(calculateDistanceOffsetInAccerlatedMovement(Speed(0), Acceleration(0), Duration()), std::out_of_range);
+  EXPECT_RANGE_ERROR(calculateDistanceOffsetInAccerlatedMovement(Speed(), Acceleration(0), Duration(0)));
+  EXPECT_RANGE_ERROR(calculateDistanceOffsetInAccerlatedMovement(Speed(0), Acceleration(), Duration(0)));
+  EXPECT_RANGE_ERROR(calculateDistanceOffsetInAccerlatedMovement(Speed(0), Acceleration(0), Duration()));
 }
 
 TEST(MathUnitTestsInputRangeChecks, calculateSpeedInAcceleratedMovementThrows)
 {
-  EXPECT_THROW(calculateSpeedInAcceleratedMovement(Speed(), Acceleration(0), Duration(0)), std::out_of_range);
-  EXPECT_THROW(calculateSpeedInAcceleratedMovement(Speed(0), Acceleration(), Duration(0)), std::out_of_range);
-  EXPECT_THROW(calculateSpeedInAcceleratedMovement(Speed(0), Acceleration(0), Duration()), std::out_of_range);
+  EXPECT_RANGE_ERROR(calculateSpeedInAcceleratedMovement(Speed(), Acceleration(0), Duration(0)));
+  EXPECT_RANGE_ERROR(calculateSpeedInAcceleratedMovement(Speed(0), Acceleration(), Duration(0)));
+  EXPECT_RANGE_ERROR(calculateSpeedInAcceleratedMovement(Speed(0), Acceleration(0), Duration()));
 }
 
 TEST(MathUnitTestsInputRangeChecks, calculateTimeToCoverDistanceThrows)
 {
   Duration requiredTime(0.);
-  EXPECT_THROW(calculateTimeToCoverDistance(Speed(),
-                                            Duration(0.),
-                                            Acceleration(0.),
-                                            std::numeric_limits<Acceleration>::epsilon(),
-                                            Distance(1.),
-                                            requiredTime),
-               std::out_of_range);
-  EXPECT_THROW(calculateTimeToCoverDistance(Speed(0.),
-                                            Duration(),
-                                            Acceleration(0.),
-                                            std::numeric_limits<Acceleration>::epsilon(),
-                                            Distance(1.),
-                                            requiredTime),
-               std::out_of_range);
-  EXPECT_THROW(calculateTimeToCoverDistance(Speed(0.),
-                                            Duration(0.),
-                                            Acceleration(),
-                                            std::numeric_limits<Acceleration>::epsilon(),
-                                            Distance(1.),
-                                            requiredTime),
-               std::out_of_range);
-  EXPECT_THROW(
-    calculateTimeToCoverDistance(Speed(0.), Duration(0.), Acceleration(0.), Acceleration(), Distance(1.), requiredTime),
-    std::out_of_range);
-  EXPECT_THROW(calculateTimeToCoverDistance(Speed(0.),
-                                            Duration(0.),
-                                            Acceleration(0.),
-                                            std::numeric_limits<Acceleration>::epsilon(),
-                                            Distance(),
-                                            requiredTime),
-               std::out_of_range);
+  EXPECT_RANGE_ERROR(calculateTimeToCoverDistance(Speed(),
+                                                  Duration(0.),
+                                                  Acceleration(0.),
+                                                  std::numeric_limits<Acceleration>::epsilon(),
+                                                  Distance(1.),
+                                                  requiredTime));
+  EXPECT_RANGE_ERROR(calculateTimeToCoverDistance(Speed(0.),
+                                                  Duration(),
+                                                  Acceleration(0.),
+                                                  std::numeric_limits<Acceleration>::epsilon(),
+                                                  Distance(1.),
+                                                  requiredTime));
+  EXPECT_RANGE_ERROR(calculateTimeToCoverDistance(Speed(0.),
+                                                  Duration(0.),
+                                                  Acceleration(),
+                                                  std::numeric_limits<Acceleration>::epsilon(),
+                                                  Distance(1.),
+                                                  requiredTime));
+  EXPECT_RANGE_ERROR(
+    calculateTimeToCoverDistance(Speed(0.), Duration(0.), Acceleration(0.), Acceleration(), Distance(1.), requiredTime));
+  EXPECT_RANGE_ERROR(calculateTimeToCoverDistance(Speed(0.),
+                                                  Duration(0.),
+                                                  Acceleration(0.),
+                                                  std::numeric_limits<Acceleration>::epsilon(),
+                                                  Distance(),
+                                                  requiredTime));
 }
 
 } // namespace physics
@@ -83,5 +83,39 @@ TEST(MathUnitTestsStoppingDistance, checks_value_range)
   }
 }
 
+TEST(MathUnitTestsStoppingDistance, checks_speed_range)
+{
+  Acceleration deceleration(2.);
+  SpeedRange speedRange;
+  speedRange.minimum = Speed(-30.);
+  speedRange.maximum = Speed(20.);
+
+  MetricRange stoppingDistanceRange;
+  ASSERT_TRUE(calculateStoppingDistance(speedRange, deceleration, stoppingDistanceRange));
+  ASSERT_NEAR(static_cast<double>(stoppingDistanceRange.minimum), -225., cDoubleNear);
+  ASSERT_NEAR(static_cast<double>(stoppingDistanceRange.maximum), 100., cDoubleNear);
+
+  for (double speed = -30.; speed <= 20.; speed += 0.5)
+  {
+    Distance stoppingDistance(0.);
+    ASSERT_TRUE(calculateStoppingDistance(Speed(speed), deceleration, stoppingDistance));
+    ASSERT_LE(stoppingDistanceRange.minimum, stoppingDistance);
+    ASSERT_GE(stoppingDistanceRange.maximum, stoppingDistance);
+  }
+}
+
+TEST(MathUnitTestsStoppingDistance, invalid_speed_range)
+{
+  SpeedRange speedRange;
+  speedRange.minimum = Speed(20.);
+  speedRange.maximum = Speed(10.);
+
+  MetricRange stoppingDistanceRange;
+  ASSERT_FALSE(calculateStoppingDistance(speedRange, Acceleration(2.), stoppingDistanceRange));
+
+  speedRange.minimum = Speed(0.);
+  ASSERT_FALSE(calculateStoppingDistance(speedRange, Acceleration(-2.), stoppingDistanceRange));
+}
+
 } // namespace physics
 } // namespace ad_rss
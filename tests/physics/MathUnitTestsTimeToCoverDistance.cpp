@@ -101,5 +101,98 @@ TEST(MathUnitTestsTimeToCoverDistance, brake_required_positive_deceleration)
   EXPECT_EQ(requiredTime, std::numeric_limits<Duration>::max());
 }
 
+namespace {
+
+bool calculateTimeToCoverDistanceCatched(Speed const &currentSpeed,
+                                         Duration const &responseTime,
+                                         Acceleration const &acceleration,
+                                         Acceleration const &deceleration,
+                                         Distance const &distanceToCover,
+                                         Duration &requiredTime)
+{
+  bool result = false;
+  AD_RSS_TRY
+  {
+    result = calculateTimeToCoverDistance(
+      currentSpeed, responseTime, acceleration, deceleration, distanceToCover, requiredTime);
+  }
+  AD_RSS_CATCH_ALL
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(MathUnitTestsTimeToCoverDistance, terms_provide_identical_results)
+{
+  std::vector<double> const speeds{0., 0.5, 10., 60., 100.};
+  std::vector<double> const responseTimes{0.1, 1., 10.};
+  std::vector<double> const accelerations{-10., -0.5, 0., 2., 100.};
+  std::vector<double> const decelerations{0., 0.5, 8., 100.};
+  std::vector<double> const distances{0., 0.1, 5., 80., 1000.};
+
+  for (auto const speed : speeds)
+  {
+    for (auto const responseTime : responseTimes)
+    {
+      for (auto const acceleration : accelerations)
+      {
+        for (auto const deceleration : decelerations)
+        {
+          TimeToCoverDistanceTerms terms;
+          calculateTimeToCoverDistanceTerms(
+            Speed(speed), Duration(responseTime), Acceleration(acceleration), Acceleration(deceleration), terms);
+          for (auto const distance : distances)
+          {
+            Duration expectedTime(0.);
+            bool const expectedResult = calculateTimeToCoverDistanceCatched(Speed(speed),
+                                                                            Duration(responseTime),
+                                                                            Acceleration(acceleration),
+                                                                            Acceleration(deceleration),
+                                                                            Distance(distance),
+                                                                            expectedTime);
+            Duration requiredTime(0.);
+            bool result = false;
+            AD_RSS_TRY
+            {
+              result = calculateTimeToCoverDistance(terms, Distance(distance), requiredTime);
+            }
+            AD_RSS_CATCH_ALL
+            {
+              result = false;
+            }
+            ASSERT_EQ(expectedResult, result);
+            if (expectedResult)
+            {
+              ASSERT_EQ(static_cast<double>(expectedTime), static_cast<double>(requiredTime));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(MathUnitTestsTimeToCoverDistance, terms_record_failing_calculations)
+{
+  TimeToCoverDistanceTerms terms;
+  // the speed after the response time exceeds the valid range
+  calculateTimeToCoverDistanceTerms(Speed(100.), Duration(10.), Acceleration(100.), Acceleration(1.), terms);
+  EXPECT_TRUE(terms.inputValid);
+  EXPECT_TRUE(terms.distanceAfterResponseTimeValid);
+  EXPECT_FALSE(terms.distanceToStopValid);
+
+  Duration requiredTime(0.);
+  EXPECT_FALSE(calculateTimeToCoverDistance(terms, Distance(7000.), requiredTime));
+  // the distance is covered within the response time, so the stopping phase is not required
+  EXPECT_TRUE(calculateTimeToCoverDistance(terms, Distance(1.), requiredTime));
+
+  calculateTimeToCoverDistanceTerms(Speed(1.), Duration(1.), Acceleration(0.), Acceleration(-1.), terms);
+  EXPECT_FALSE(terms.inputValid);
+  EXPECT_FALSE(calculateTimeToCoverDistance(terms, Distance(1.), requiredTime));
+}
+
 } // namespace physics
 } // namespace ad_rss
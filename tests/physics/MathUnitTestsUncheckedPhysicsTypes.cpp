@@ -0,0 +1,234 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RangeErrorSupport.hpp"
+#include "TestSupport.hpp"
+#include "physics/MathT.hpp"
+
+namespace ad_rss {
+namespace physics {
+
+typedef MathT<CheckedPhysicsTypes> CheckedMath;
+typedef MathT<UncheckedPhysicsTypes> UncheckedMath;
+
+struct CalculationResult
+{
+  bool exception{false};
+  bool result{false};
+  double value{0.};
+};
+
+void expectEqualCalculationResult(CalculationResult const &checked, CalculationResult const &unchecked)
+{
+  EXPECT_EQ(checked.exception, unchecked.exception);
+  EXPECT_EQ(checked.result, unchecked.result);
+  if (checked.result && !checked.exception)
+  {
+    EXPECT_DOUBLE_EQ(checked.value, unchecked.value);
+  }
+}
+
+// values covering the valid input range of the vehicle state including its borders
+std::vector<double> const cSpeeds{-100., -10., -0.5, 0., 0.5, 10., 100.};
+std::vector<double> const cAccelerations{-100., -10., -1e-3, 0., 1e-3, 10., 100.};
+std::vector<double> const cResponseTimes{0., 0.5, 2., 10.};
+std::vector<double> const cDistances{0., 1., 100., 1e4, 1e6};
+
+template <typename Calculation> CalculationResult calculate(Calculation calculation)
+{
+  CalculationResult calculationResult;
+  AD_RSS_TRY
+  {
+    calculationResult.result = calculation(calculationResult.value);
+  }
+  AD_RSS_CATCH_RANGE_ERROR
+  {
+    calculationResult.exception = true;
+  }
+  return calculationResult;
+}
+
+template <typename PhysicsTypes>
+bool stoppingDistance(double speed, double deceleration, double &stoppingDistanceValue)
+{
+  typename PhysicsTypes::Distance distance(0.);
+  bool const result = MathT<PhysicsTypes>::calculateStoppingDistance(
+    typename PhysicsTypes::Speed(speed), typename PhysicsTypes::Acceleration(deceleration), distance);
+  stoppingDistanceValue = static_cast<double>(distance);
+  return result;
+}
+
+template <typename PhysicsTypes>
+bool speedAfterResponseTime(
+  CoordinateSystemAxis axis, double speed, double acceleration, double responseTime, double &speedValue)
+{
+  typename PhysicsTypes::Speed resultingSpeed(0.);
+  bool const result
+    = MathT<PhysicsTypes>::calculateSpeedAfterResponseTime(axis,
+                                                            typename PhysicsTypes::Speed(speed),
+                                                            typename PhysicsTypes::Acceleration(acceleration),
+                                                            typename PhysicsTypes::Duration(responseTime),
+                                                            resultingSpeed);
+  speedValue = static_cast<double>(resultingSpeed);
+  return result;
+}
+
+template <typename PhysicsTypes>
+bool distanceOffsetAfterResponseTime(
+  CoordinateSystemAxis axis, double speed, double acceleration, double responseTime, double &distanceValue)
+{
+  typename PhysicsTypes::Distance distanceOffset(0.);
+  bool const result
+    = MathT<PhysicsTypes>::calculateDistanceOffsetAfterResponseTime(axis,
+                                                                     typename PhysicsTypes::Speed(speed),
+                                                                     typename PhysicsTypes::Acceleration(acceleration),
+                                                                     typename PhysicsTypes::Duration(responseTime),
+                                                                     distanceOffset);
+  distanceValue = static_cast<double>(distanceOffset);
+  return result;
+}
+
+template <typename PhysicsTypes>
+bool timeToCoverDistance(double speed,
+                         double responseTime,
+                         double acceleration,
+                         double deceleration,
+                         double distanceToCover,
+                         double &durationValue)
+{
+  typename PhysicsTypes::Duration requiredTime(0.);
+  bool const result
+    = MathT<PhysicsTypes>::calculateTimeToCoverDistance(typename PhysicsTypes::Speed(speed),
+                                                         typename PhysicsTypes::Duration(responseTime),
+                                                         typename PhysicsTypes::Acceleration(acceleration),
+                                                         typename PhysicsTypes::Acceleration(deceleration),
+                                                         typename PhysicsTypes::Distance(distanceToCover),
+                                                         requiredTime);
+  durationValue = static_cast<double>(requiredTime);
+  return result;
+}
+
+TEST(MathUnitTestsUncheckedPhysicsTypes, comparison_operators)
+{
+  EXPECT_TRUE(UncheckedSpeed(1.) == UncheckedSpeed(1. + Speed::cPrecisionValue * 0.5));
+  EXPECT_FALSE(UncheckedSpeed(1.) == UncheckedSpeed(1. + Speed::cPrecisionValue * 2.));
+  EXPECT_FALSE(UncheckedSpeed(1.) < UncheckedSpeed(1. + Speed::cPrecisionValue * 0.5));
+  EXPECT_TRUE(UncheckedSpeed(1.) <= UncheckedSpeed(1. + Speed::cPrecisionValue * 0.5));
+  EXPECT_TRUE(UncheckedSpeed(1.) < UncheckedSpeed(1. + Speed::cPrecisionValue * 2.));
+  EXPECT_TRUE(UncheckedAcceleration(0.) == UncheckedAcceleration(Acceleration::cPrecisionValue * 0.5));
+  EXPECT_FALSE(UncheckedAcceleration(0.) == UncheckedAcceleration(Acceleration::cPrecisionValue * 2.));
+}
+
+TEST(MathUnitTestsUncheckedPhysicsTypes, toChecked)
+{
+  EXPECT_EQ(Distance(10.), UncheckedDistance(10.).toChecked());
+  EXPECT_EQ(Speed(-5.), (UncheckedSpeed(10.) - UncheckedSpeed(15.)).toChecked());
+  EXPECT_RANGE_ERROR(UncheckedSpeed(Speed::getMax() * 2.).toChecked());
+  EXPECT_RANGE_ERROR(UncheckedDistance().toChecked());
+}
+
+TEST(MathUnitTestsUncheckedPhysicsTypes, stopping_distance_equals_checked)
+{
+  for (auto speed : cSpeeds)
+  {
+    for (auto deceleration : cAccelerations)
+    {
+      expectEqualCalculationResult(calculate([&](double &value) {
+                                     return stoppingDistance<CheckedPhysicsTypes>(speed, deceleration, value);
+                                   }),
+                                   calculate([&](double &value) {
+                                     return stoppingDistance<UncheckedPhysicsTypes>(speed, deceleration, value);
+                                   }));
+    }
+  }
+}
+
+TEST(MathUnitTestsUncheckedPhysicsTypes, response_time_calculations_equal_checked)
+{
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    for (auto speed : cSpeeds)
+    {
+      for (auto acceleration : cAccelerations)
+      {
+        for (auto responseTime : cResponseTimes)
+        {
+          expectEqualCalculationResult(
+            calculate([&](double &value) {
+              return speedAfterResponseTime<CheckedPhysicsTypes>(axis, speed, acceleration, responseTime, value);
+            }),
+            calculate([&](double &value) {
+              return speedAfterResponseTime<UncheckedPhysicsTypes>(axis, speed, acceleration, responseTime, value);
+            }));
+          expectEqualCalculationResult(
+            calculate([&](double &value) {
+              return distanceOffsetAfterResponseTime<CheckedPhysicsTypes>(
+                axis, speed, acceleration, responseTime, value);
+            }),
+            calculate([&](double &value) {
+              return distanceOffsetAfterResponseTime<UncheckedPhysicsTypes>(
+                axis, speed, acceleration, responseTime, value);
+            }));
+        }
+      }
+    }
+  }
+}
+
+TEST(MathUnitTestsUncheckedPhysicsTypes, time_to_cover_distance_equals_checked)
+{
+  for (auto speed : cSpeeds)
+  {
+    for (auto acceleration : cAccelerations)
+    {
+      for (auto deceleration : cAccelerations)
+      {
+        for (auto responseTime : cResponseTimes)
+        {
+          for (auto distance : cDistances)
+          {
+            expectEqualCalculationResult(calculate([&](double &value) {
+                                           return timeToCoverDistance<CheckedPhysicsTypes>(
+                                             speed, responseTime, acceleration, deceleration, distance, value);
+                                         }),
+                                         calculate([&](double &value) {
+                                           return timeToCoverDistance<UncheckedPhysicsTypes>(
+                                             speed, responseTime, acceleration, deceleration, distance, value);
+                                         }));
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace physics
+} // namespace ad_rss
@@ -126,5 +126,23 @@ TEST(MathUnitTestsSpeedAfterResponseTime, acceleration_accel_max_2m_s2_50kmh)
   }
 }
 
+TEST(MathUnitTestsSpeedAfterResponseTime, checks_speed_range)
+{
+  SpeedRange speedRange;
+  speedRange.minimum = Speed(2.);
+  speedRange.maximum = Speed(10.);
+
+  SpeedRange resultingSpeedRange;
+  ASSERT_TRUE(calculateSpeedAfterResponseTime(
+    CoordinateSystemAxis::Longitudinal, speedRange, Acceleration(-4.), Duration(1.), resultingSpeedRange));
+  ASSERT_NEAR(static_cast<double>(resultingSpeedRange.minimum), 0., cDoubleNear);
+  ASSERT_NEAR(static_cast<double>(resultingSpeedRange.maximum), 6., cDoubleNear);
+
+  ASSERT_TRUE(calculateSpeedAfterResponseTime(
+    CoordinateSystemAxis::Lateral, speedRange, Acceleration(-4.), Duration(1.), resultingSpeedRange));
+  ASSERT_NEAR(static_cast<double>(resultingSpeedRange.minimum), -2., cDoubleNear);
+  ASSERT_NEAR(static_cast<double>(resultingSpeedRange.maximum), 6., cDoubleNear);
+}
+
 } // namespace physics
 } // namespace ad_rss
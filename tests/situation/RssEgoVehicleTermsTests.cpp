@@ -0,0 +1,231 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/situation/SituationVector.hpp"
+#include "core/RssState.hpp"
+#include "situation/RssEgoVehicleTerms.hpp"
+#include "situation/RssIntersectionChecker.hpp"
+#include "situation/RssSituation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssEgoVehicleTermsTests : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    std::vector<double> const lonVelocities{0., 10., 50., 120.};
+    std::vector<double> const latVelocities{-8., -1., 0., 0.5, 6.};
+    std::vector<double> const responseTimes{0.5, 1., 2.};
+    std::vector<double> const lonDistances{0., 3., 25., 120., 1000.};
+    std::vector<double> const latDistances{0., 0.2, 1.5, 8.};
+
+    // cover the combinations of the relative positions and a variety of the vehicle states
+    for (uint32_t i = 0u; i < 500u; i++)
+    {
+      Situation situation;
+      situation.timeIndex = 1u;
+      situation.situationId = i;
+      situation.situationType = ((i % 2u) == 0u) ? SituationType::SameDirection : SituationType::OppositeDirection;
+      situation.egoVehicleState = createVehicleState(lonVelocities[i % lonVelocities.size()],
+                                                     latVelocities[(i / 3u) % latVelocities.size()]);
+      situation.egoVehicleState.responseTime = Duration(responseTimes[(i / 7u) % responseTimes.size()]);
+      situation.egoVehicleState.isInCorrectLane = ((i / 5u) % 2u) == 0u;
+      situation.otherVehicleState = createVehicleState(lonVelocities[(i / 11u) % lonVelocities.size()],
+                                                       latVelocities[(i / 2u) % latVelocities.size()]);
+      situation.relativePosition.longitudinalPosition = static_cast<LongitudinalRelativePosition>((i / 2u) % 5u);
+      situation.relativePosition.longitudinalDistance = Distance(lonDistances[(i / 13u) % lonDistances.size()]);
+      situation.relativePosition.lateralPosition = static_cast<LateralRelativePosition>((i / 10u) % 5u);
+      situation.relativePosition.lateralDistance = Distance(latDistances[(i / 17u) % latDistances.size()]);
+      situationVector.push_back(situation);
+    }
+  }
+
+  bool calculateRssState(Situation const &situation,
+                         RssEgoVehicleTerms const *terms,
+                         state::ResponseState &responseState)
+  {
+    responseState = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+    // the situation checking treats range errors as failures
+    bool result = false;
+    AD_RSS_TRY
+    {
+      if (situation.situationType == SituationType::SameDirection)
+      {
+        result = (terms != nullptr) ? calculateRssStateNonIntersectionSameDirection(situation, *terms, responseState)
+                                    : calculateRssStateNonIntersectionSameDirection(situation, responseState);
+      }
+      else
+      {
+        result = (terms != nullptr)
+          ? calculateRssStateNonIntersectionOppositeDirection(situation, *terms, responseState)
+          : calculateRssStateNonIntersectionOppositeDirection(situation, responseState);
+      }
+    }
+    AD_RSS_CATCH_ALL
+    {
+      result = false;
+    }
+    return result;
+  }
+
+  void expectIdenticalRssState(Situation const &situation, RssEgoVehicleTerms const &terms)
+  {
+    state::ResponseState expectedResponseState;
+    bool const expectedResult = calculateRssState(situation, nullptr, expectedResponseState);
+    state::ResponseState responseState;
+    ASSERT_EQ(expectedResult, calculateRssState(situation, &terms, responseState));
+    if (expectedResult)
+    {
+      EXPECT_EQ(expectedResponseState, responseState);
+      EXPECT_EQ(static_cast<double>(expectedResponseState.longitudinalState.responseInformation.safeDistance),
+                static_cast<double>(responseState.longitudinalState.responseInformation.safeDistance));
+      EXPECT_EQ(static_cast<double>(expectedResponseState.lateralStateLeft.responseInformation.safeDistance),
+                static_cast<double>(responseState.lateralStateLeft.responseInformation.safeDistance));
+      EXPECT_EQ(static_cast<double>(expectedResponseState.lateralStateRight.responseInformation.safeDistance),
+                static_cast<double>(responseState.lateralStateRight.responseInformation.safeDistance));
+    }
+  }
+
+  SituationVector situationVector;
+  RssEgoVehicleTerms egoVehicleTerms;
+};
+
+TEST_F(RssEgoVehicleTermsTests, identical_to_calculation_within_situation)
+{
+  for (auto const &situation : situationVector)
+  {
+    egoVehicleTerms.calculate(situation.egoVehicleState);
+    ASSERT_TRUE(egoVehicleTerms.isCalculatedFor(situation.egoVehicleState));
+    expectIdenticalRssState(situation, egoVehicleTerms);
+  }
+}
+
+TEST_F(RssEgoVehicleTermsTests, other_ego_vehicle_state_is_calculated_within_situation)
+{
+  VehicleState egoVehicleState = createVehicleState(30., 1.);
+  egoVehicleState.responseTime = Duration(0.7);
+  egoVehicleTerms.calculate(egoVehicleState);
+  for (auto const &situation : situationVector)
+  {
+    ASSERT_FALSE(egoVehicleTerms.isCalculatedFor(situation.egoVehicleState));
+    expectIdenticalRssState(situation, egoVehicleTerms);
+  }
+
+  egoVehicleTerms.calculate(situationVector.front().egoVehicleState);
+  egoVehicleTerms.reset();
+  EXPECT_FALSE(egoVehicleTerms.isCalculatedFor(situationVector.front().egoVehicleState));
+}
+
+TEST_F(RssEgoVehicleTermsTests, vehicle_states_have_to_be_bitwise_identical)
+{
+  VehicleState egoVehicleState = createVehicleState(30., 0.);
+  egoVehicleState.velocity.speedLat = Speed(0.);
+  egoVehicleTerms.calculate(egoVehicleState);
+  EXPECT_TRUE(egoVehicleTerms.isCalculatedFor(egoVehicleState));
+
+  // the sign of the lateral speed influences the lateral stated braking pattern
+  egoVehicleState.velocity.speedLat = Speed(-0.);
+  EXPECT_FALSE(egoVehicleTerms.isCalculatedFor(egoVehicleState));
+}
+
+TEST_F(RssEgoVehicleTermsTests, failing_ego_vehicle_terms)
+{
+  for (auto &situation : situationVector)
+  {
+    // the speed after the response time exceeds the valid range
+    situation.egoVehicleState.velocity.speedLon = Speed(100.);
+    situation.egoVehicleState.dynamics.alphaLon.accelMax = Acceleration(100.);
+    situation.egoVehicleState.responseTime = Duration(10.);
+    egoVehicleTerms.calculate(situation.egoVehicleState);
+    expectIdenticalRssState(situation, egoVehicleTerms);
+  }
+  physics::UncheckedDistance distance(0.);
+  EXPECT_FALSE(egoVehicleTerms.getDistanceTerm(VehicleDistanceTerm::LongitudinalStatedBrakingMin, distance));
+  EXPECT_TRUE(egoVehicleTerms.getDistanceTerm(VehicleDistanceTerm::LongitudinalStoppingMax, distance));
+  EXPECT_FALSE(egoVehicleTerms.getDistanceTerm(VehicleDistanceTerm::Count, distance));
+}
+
+TEST_F(RssEgoVehicleTermsTests, identical_intersection_results)
+{
+  std::vector<double> const enterDistances{0., 5., 40., 200.};
+  std::vector<double> const intersectionLengths{2., 10., 30.};
+
+  RssIntersectionChecker expectedIntersectionChecker;
+  RssIntersectionChecker intersectionChecker;
+  RssEgoVehicleTerms const notCalculatedEgoVehicleTerms;
+  for (uint32_t timeIndex = 1u; timeIndex < 50u; timeIndex++)
+  {
+    Situation const &templateSituation = situationVector[timeIndex * 7u];
+    egoVehicleTerms.calculate(templateSituation.egoVehicleState);
+    for (uint32_t i = 0u; i < 12u; i++)
+    {
+      Situation situation = templateSituation;
+      situation.timeIndex = timeIndex;
+      situation.situationId = i;
+      situation.situationType = static_cast<SituationType>(
+        static_cast<uint32_t>(SituationType::IntersectionEgoHasPriority) + (i % 3u));
+      situation.egoVehicleState.hasPriority = (situation.situationType == SituationType::IntersectionEgoHasPriority);
+      situation.otherVehicleState.hasPriority
+        = (situation.situationType == SituationType::IntersectionObjectHasPriority);
+      situation.egoVehicleState.distanceToEnterIntersection
+        = Distance(enterDistances[(timeIndex + i) % enterDistances.size()]);
+      situation.egoVehicleState.distanceToLeaveIntersection = situation.egoVehicleState.distanceToEnterIntersection
+        + Distance(intersectionLengths[i % intersectionLengths.size()]);
+      situation.otherVehicleState.distanceToEnterIntersection
+        = Distance(enterDistances[(timeIndex / 3u + i) % enterDistances.size()]);
+      situation.otherVehicleState.distanceToLeaveIntersection = situation.otherVehicleState.distanceToEnterIntersection
+        + Distance(intersectionLengths[(i / 2u) % intersectionLengths.size()]);
+      situation.relativePosition.longitudinalPosition
+        = ((i % 2u) == 0u) ? LongitudinalRelativePosition::InFront : LongitudinalRelativePosition::AtBack;
+
+      state::ResponseState expectedResponseState
+        = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+      bool const expectedResult = expectedIntersectionChecker.calculateRssStateIntersection(
+        situation, notCalculatedEgoVehicleTerms, expectedResponseState);
+      state::ResponseState responseState
+        = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+      ASSERT_EQ(expectedResult,
+                intersectionChecker.calculateRssStateIntersection(situation, egoVehicleTerms, responseState));
+      if (expectedResult)
+      {
+        EXPECT_EQ(expectedResponseState, responseState);
+        EXPECT_EQ(static_cast<double>(expectedResponseState.longitudinalState.responseInformation.safeDistance),
+                  static_cast<double>(responseState.longitudinalState.responseInformation.safeDistance));
+      }
+    }
+  }
+}
+
+} // namespace situation
+} // namespace ad_rss
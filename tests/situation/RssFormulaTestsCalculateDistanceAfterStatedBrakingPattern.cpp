@@ -116,5 +116,44 @@ TEST(RssFormulaTestsCalculateDistanceAfterStatedBrakingPatternEgoVehicle, leadin
   ASSERT_NEAR(static_cast<double>(distanceOffset), 71.77, cDoubleNear);
 }
 
+TEST(RssFormulaTestsCalculateDistanceAfterStatedBrakingPattern, checks_speed_range)
+{
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    double const minimumSpeed = (axis == CoordinateSystemAxis::Longitudinal) ? 0. : -3.;
+    double const maximumSpeed = (axis == CoordinateSystemAxis::Longitudinal) ? 30. : 3.;
+    physics::SpeedRange speedRange;
+    speedRange.minimum = Speed(minimumSpeed);
+    speedRange.maximum = Speed(maximumSpeed);
+
+    for (auto acceleration : {-2., 0., 3.5})
+    {
+      for (auto deceleration : {-4., 4.})
+      {
+        physics::MetricRange distanceOffsetRange;
+        ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(axis,
+                                                                     speedRange,
+                                                                     cResponseTimeOtherVehicles,
+                                                                     Acceleration(acceleration),
+                                                                     Acceleration(deceleration),
+                                                                     distanceOffsetRange));
+
+        for (double speed = minimumSpeed; speed <= maximumSpeed; speed += (maximumSpeed - minimumSpeed) / 100.)
+        {
+          Distance distanceOffset(0.);
+          ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(axis,
+                                                                       Speed(speed),
+                                                                       cResponseTimeOtherVehicles,
+                                                                       Acceleration(acceleration),
+                                                                       Acceleration(deceleration),
+                                                                       distanceOffset));
+          ASSERT_LE(distanceOffsetRange.minimum, distanceOffset);
+          ASSERT_GE(distanceOffsetRange.maximum, distanceOffset);
+        }
+      }
+    }
+  }
+}
+
 } // namespace situation
 } // namespace ad_rss
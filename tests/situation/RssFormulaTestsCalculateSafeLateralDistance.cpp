@@ -92,5 +92,38 @@ TEST(RssFormulaTestsCalculateSafeLateralDistance, one_zero_lateral_speed)
   }
 }
 
+TEST(RssFormulaTestsCalculateSafeLateralDistance, checks_speed_range)
+{
+  VehicleState leftVehicle = createVehicleStateForLateralMotion(0.);
+  VehicleState rightVehicle = createVehicleStateForLateralMotion(0.);
+  VehicleStateUncertainty leftUncertainty = createVehicleStateUncertainty(leftVehicle);
+  leftUncertainty.speedLat.minimum = Speed(-1.);
+  leftUncertainty.speedLat.maximum = Speed(1.5);
+  VehicleStateUncertainty rightUncertainty = createVehicleStateUncertainty(rightVehicle);
+  rightUncertainty.speedLat.minimum = Speed(-2.);
+  rightUncertainty.speedLat.maximum = Speed(0.5);
+
+  physics::MetricRange safeDistanceRange;
+  ASSERT_TRUE(
+    calculateSafeLateralDistanceRange(leftVehicle, leftUncertainty, rightVehicle, rightUncertainty, safeDistanceRange));
+
+  for (double leftSpeed = -1.; leftSpeed <= 1.5; leftSpeed += 0.125)
+  {
+    for (double rightSpeed = -2.; rightSpeed <= 0.5; rightSpeed += 0.125)
+    {
+      leftVehicle.velocity.speedLat = Speed(leftSpeed);
+      rightVehicle.velocity.speedLat = Speed(rightSpeed);
+      Distance safeDistance(0.);
+      ASSERT_TRUE(calculateSafeLateralDistance(leftVehicle, rightVehicle, safeDistance));
+      ASSERT_LE(safeDistanceRange.minimum, safeDistance);
+      ASSERT_GE(safeDistanceRange.maximum, safeDistance);
+      if ((leftSpeed >= 1.5) && (rightSpeed <= -2.))
+      {
+        ASSERT_NEAR(static_cast<double>(safeDistanceRange.maximum), static_cast<double>(safeDistance), cDoubleNear);
+      }
+    }
+  }
+}
+
 } // namespace situation
 } // namespace ad_rss
@@ -56,5 +56,57 @@ TEST(RssFormulaTestsCalculateSafeLongitudinalDistanceSameDirection, checks_leadi
   ASSERT_NEAR(static_cast<double>(safeDistance), 0, cDoubleNear);
 }
 
+TEST(RssFormulaTestsCalculateSafeLongitudinalDistanceSameDirection, checks_speed_range)
+{
+  VehicleState leadingVehicle = createVehicleStateForLongitudinalMotion(50);
+  VehicleState followingVehicle = createVehicleStateForLongitudinalMotion(70);
+  VehicleStateUncertainty leadingUncertainty = createVehicleStateUncertainty(leadingVehicle);
+  leadingUncertainty.speedLon.minimum = kmhToMeterPerSec(40);
+  leadingUncertainty.speedLon.maximum = kmhToMeterPerSec(60);
+  VehicleStateUncertainty followingUncertainty = createVehicleStateUncertainty(followingVehicle);
+  followingUncertainty.speedLon.minimum = kmhToMeterPerSec(65);
+  followingUncertainty.speedLon.maximum = kmhToMeterPerSec(75);
+
+  physics::MetricRange safeDistanceRange;
+  ASSERT_TRUE(calculateSafeLongitudinalDistanceRangeSameDirection(
+    leadingVehicle, leadingUncertainty, followingVehicle, followingUncertainty, safeDistanceRange));
+
+  Distance worstCaseSafeDistance(0.);
+  ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(createVehicleStateForLongitudinalMotion(40),
+                                                             createVehicleStateForLongitudinalMotion(75),
+                                                             worstCaseSafeDistance));
+  ASSERT_NEAR(static_cast<double>(safeDistanceRange.maximum), static_cast<double>(worstCaseSafeDistance), cDoubleNear);
+
+  for (double leadingSpeed = 40.; leadingSpeed <= 60.; leadingSpeed += 1.)
+  {
+    for (double followingSpeed = 65.; followingSpeed <= 75.; followingSpeed += 1.)
+    {
+      leadingVehicle = createVehicleStateForLongitudinalMotion(leadingSpeed);
+      followingVehicle = createVehicleStateForLongitudinalMotion(followingSpeed);
+      Distance safeDistance(0.);
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, safeDistance));
+      ASSERT_LE(safeDistanceRange.minimum, safeDistance);
+      ASSERT_GE(safeDistanceRange.maximum, safeDistance);
+    }
+  }
+}
+
+TEST(RssFormulaTestsCalculateSafeLongitudinalDistanceSameDirection, invalid_speed_range)
+{
+  VehicleState leadingVehicle = createVehicleStateForLongitudinalMotion(50);
+  VehicleState followingVehicle = createVehicleStateForLongitudinalMotion(50);
+  VehicleStateUncertainty leadingUncertainty = createVehicleStateUncertainty(leadingVehicle);
+  VehicleStateUncertainty followingUncertainty = createVehicleStateUncertainty(followingVehicle);
+
+  physics::MetricRange safeDistanceRange;
+  leadingUncertainty.speedLon.minimum = Speed(-1.);
+  ASSERT_FALSE(calculateSafeLongitudinalDistanceRangeSameDirection(
+    leadingVehicle, leadingUncertainty, followingVehicle, followingUncertainty, safeDistanceRange));
+
+  leadingUncertainty.speedLon.minimum = kmhToMeterPerSec(60);
+  ASSERT_FALSE(calculateSafeLongitudinalDistanceRangeSameDirection(
+    leadingVehicle, leadingUncertainty, followingVehicle, followingUncertainty, safeDistanceRange));
+}
+
 } // namespace situation
 } // namespace ad_rss
@@ -0,0 +1,349 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::CoordinateSystemAxis;
+
+class RssFormulaTestsCalculateSafetyLimits : public testing::Test
+{
+protected:
+  /**
+   * @brief check that the value is safe just below the limit and unsafe just above the limit
+   *
+   * Only values within the valid input range [minValue, maxValue] are probed.
+   */
+  template <typename ValueType, typename SafetyCheck>
+  static void expectLimit(ValueType &value,
+                          ValueType const &limit,
+                          double const minValue,
+                          double const maxValue,
+                          SafetyCheck const &isSafe)
+  {
+    ValueType const originalValue = value;
+    double const belowLimit = static_cast<double>(limit) - 0.01;
+    if ((minValue <= belowLimit) && (belowLimit <= maxValue))
+    {
+      value = ValueType(belowLimit);
+      EXPECT_TRUE(isSafe()) << "limit " << static_cast<double>(limit);
+    }
+    double const aboveLimit = static_cast<double>(limit) + 0.01;
+    if ((minValue <= aboveLimit) && (aboveLimit <= maxValue))
+    {
+      value = ValueType(aboveLimit);
+      EXPECT_FALSE(isSafe()) << "limit " << static_cast<double>(limit);
+    }
+    value = originalValue;
+  }
+
+  static bool isSafeSameDirection(VehicleState const &leadingVehicle,
+                                  VehicleState const &followingVehicle,
+                                  Distance const &vehicleDistance)
+  {
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    EXPECT_TRUE(checkSafeLongitudinalDistanceSameDirection(
+      leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+    return isDistanceSafe;
+  }
+
+  static bool isSafeOppositeDirection(VehicleState const &correctVehicle,
+                                      VehicleState const &oppositeVehicle,
+                                      Distance const &vehicleDistance)
+  {
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    EXPECT_TRUE(checkSafeLongitudinalDistanceOppositeDirection(
+      correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+    return isDistanceSafe;
+  }
+
+  static bool
+  isSafeLateral(VehicleState const &leftVehicle, VehicleState const &rightVehicle, Distance const &vehicleDistance)
+  {
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    EXPECT_TRUE(checkSafeLateralDistance(leftVehicle, rightVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+    return isDistanceSafe;
+  }
+
+  static bool isSafeStopInFrontIntersection(VehicleState const &vehicle)
+  {
+    Distance safeDistance(0.);
+    bool isDistanceSafe = false;
+    EXPECT_TRUE(checkStopInFrontIntersection(vehicle, safeDistance, isDistanceSafe));
+    return isDistanceSafe;
+  }
+
+  std::vector<double> const speeds{0., 10., 30., 50., 100., 150.};
+  std::vector<double> const distances{0.5, 5., 20., 50., 100., 200.};
+};
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, max_acceleration_for_distance_offset)
+{
+  Acceleration maxAcceleration(0.);
+  Distance distanceOffset(0.);
+
+  // accelerating during the response time
+  ASSERT_TRUE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), Acceleration(4.), Distance(32.), maxAcceleration));
+  ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), maxAcceleration, Acceleration(4.), distanceOffset));
+  EXPECT_NEAR(static_cast<double>(distanceOffset), 32., cDoubleNear);
+  EXPECT_NEAR(static_cast<double>(maxAcceleration), 2.832, cDoubleNear);
+
+  // stopping within the response time: s = v^2 / (2 * -a)
+  ASSERT_TRUE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), Acceleration(4.), Distance(2.), maxAcceleration));
+  EXPECT_NEAR(static_cast<double>(maxAcceleration), -25., cDoubleNear);
+  ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), maxAcceleration, Acceleration(4.), distanceOffset));
+  EXPECT_NEAR(static_cast<double>(distanceOffset), 2., cDoubleNear);
+
+  // not even an immediate stop is sufficient
+  ASSERT_TRUE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), Acceleration(4.), Distance(-1.), maxAcceleration));
+  EXPECT_EQ(maxAcceleration, std::numeric_limits<Acceleration>::lowest());
+
+  // lateral movement away from the other vehicle
+  ASSERT_TRUE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Lateral, Speed(-1.), Duration(1.), Acceleration(1.), Distance(-1.), maxAcceleration));
+  EXPECT_NEAR(static_cast<double>(maxAcceleration), 0., cDoubleNear);
+  ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Lateral, Speed(-1.), Duration(1.), maxAcceleration, Acceleration(1.), distanceOffset));
+  EXPECT_NEAR(static_cast<double>(distanceOffset), -1., cDoubleNear);
+
+  ASSERT_FALSE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(-1.), Duration(1.), Acceleration(4.), Distance(2.), maxAcceleration));
+  ASSERT_FALSE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(0.), Acceleration(4.), Distance(2.), maxAcceleration));
+  ASSERT_FALSE(calculateMaxAccelerationForDistanceOffset(
+    CoordinateSystemAxis::Longitudinal, Speed(10.), Duration(1.), Acceleration(0.), Distance(2.), maxAcceleration));
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, max_speed_for_distance_offset)
+{
+  Speed maxSpeed(0.);
+  Distance distanceOffset(0.);
+
+  ASSERT_TRUE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(2.), Duration(1.), Acceleration(4.), Distance(32.), maxSpeed));
+  ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, maxSpeed, Duration(1.), Acceleration(2.), Acceleration(4.), distanceOffset));
+  EXPECT_NEAR(static_cast<double>(distanceOffset), 32., cDoubleNear);
+
+  // the distance offset of the acceleration alone is too large
+  ASSERT_TRUE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(2.), Duration(1.), Acceleration(4.), Distance(1.), maxSpeed));
+  EXPECT_LT(maxSpeed, Speed(0.));
+
+  // lateral movement away from the other vehicle
+  ASSERT_TRUE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(1.), Duration(1.), Acceleration(1.), Distance(-2.), maxSpeed));
+  ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Lateral, maxSpeed, Duration(1.), Acceleration(1.), Acceleration(1.), distanceOffset));
+  EXPECT_NEAR(static_cast<double>(distanceOffset), -2., cDoubleNear);
+
+  ASSERT_FALSE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(-1.), Duration(1.), Acceleration(4.), Distance(32.), maxSpeed));
+  ASSERT_FALSE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(2.), Duration(0.), Acceleration(4.), Distance(32.), maxSpeed));
+  ASSERT_FALSE(
+    calculateMaxSpeedForDistanceOffset(Acceleration(2.), Duration(1.), Acceleration(0.), Distance(32.), maxSpeed));
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, same_direction)
+{
+  for (auto leadingSpeed : speeds)
+  {
+    for (auto followingSpeed : speeds)
+    {
+      for (auto distance : distances)
+      {
+        VehicleState const leadingVehicle = createVehicleStateForLongitudinalMotion(leadingSpeed);
+        VehicleState followingVehicle = createVehicleStateForLongitudinalMotion(followingSpeed);
+        Distance const vehicleDistance(distance);
+
+        Acceleration maxAcceleration(0.);
+        Speed maxSpeed(0.);
+        ASSERT_TRUE(calculateSafeLongitudinalLimitsSameDirection(
+          leadingVehicle, followingVehicle, vehicleDistance, maxAcceleration, maxSpeed));
+
+        auto const isSafe = [&]() { return isSafeSameDirection(leadingVehicle, followingVehicle, vehicleDistance); };
+        expectLimit(followingVehicle.dynamics.alphaLon.accelMax, maxAcceleration, 0., 100., isSafe);
+        expectLimit(followingVehicle.velocity.speedLon, maxSpeed, 0., 100., isSafe);
+      }
+    }
+  }
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, opposite_direction)
+{
+  for (auto isInCorrectLane : {true, false})
+  {
+    for (auto vehicleSpeed : speeds)
+    {
+      for (auto otherSpeed : speeds)
+      {
+        for (auto distance : distances)
+        {
+          VehicleState vehicle = createVehicleStateForLongitudinalMotion(vehicleSpeed);
+          vehicle.isInCorrectLane = isInCorrectLane;
+          VehicleState otherVehicle = createVehicleStateForLongitudinalMotion(otherSpeed);
+          otherVehicle.isInCorrectLane = !isInCorrectLane;
+          Distance const vehicleDistance(distance);
+
+          Acceleration maxAcceleration(0.);
+          Speed maxSpeed(0.);
+          ASSERT_TRUE(calculateSafeLongitudinalLimitsOppositeDirection(
+            vehicle, otherVehicle, vehicleDistance, maxAcceleration, maxSpeed));
+
+          auto const isSafe = [&]() {
+            if (isInCorrectLane)
+            {
+              return isSafeOppositeDirection(vehicle, otherVehicle, vehicleDistance);
+            }
+            return isSafeOppositeDirection(otherVehicle, vehicle, vehicleDistance);
+          };
+          expectLimit(vehicle.dynamics.alphaLon.accelMax, maxAcceleration, 0., 100., isSafe);
+          expectLimit(vehicle.velocity.speedLon, maxSpeed, 0., 100., isSafe);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, lateral)
+{
+  std::vector<double> const lateralSpeeds{-5., -1., 0., 1., 5.};
+  std::vector<double> const lateralDistances{0.01, 0.5, 1., 2., 5.};
+  for (auto vehicleSpeed : lateralSpeeds)
+  {
+    for (auto otherSpeed : lateralSpeeds)
+    {
+      for (auto distance : lateralDistances)
+      {
+        VehicleState vehicle = createVehicleStateForLateralMotion(vehicleSpeed);
+        VehicleState const otherVehicle = createVehicleStateForLateralMotion(otherSpeed);
+        Distance const vehicleDistance(distance);
+
+        Acceleration maxAcceleration(0.);
+        physics::SpeedRange speedRange;
+        ASSERT_TRUE(calculateSafeLateralLimits(
+          vehicle, otherVehicle, LateralRelativePosition::AtLeft, vehicleDistance, maxAcceleration, speedRange));
+        EXPECT_EQ(speedRange.minimum, std::numeric_limits<Speed>::lowest());
+
+        auto const isSafeAtLeft = [&]() { return isSafeLateral(vehicle, otherVehicle, vehicleDistance); };
+        expectLimit(vehicle.dynamics.alphaLat.accelMax, maxAcceleration, 0., 100., isSafeAtLeft);
+        expectLimit(vehicle.velocity.speedLat, speedRange.maximum, -10., 10., isSafeAtLeft);
+
+        ASSERT_TRUE(calculateSafeLateralLimits(
+          vehicle, otherVehicle, LateralRelativePosition::AtRight, vehicleDistance, maxAcceleration, speedRange));
+        EXPECT_EQ(speedRange.maximum, std::numeric_limits<Speed>::max());
+
+        auto const isSafeAtRight = [&]() { return isSafeLateral(otherVehicle, vehicle, vehicleDistance); };
+        expectLimit(vehicle.dynamics.alphaLat.accelMax, maxAcceleration, 0., 100., isSafeAtRight);
+        // the lower limit: safe above, unsafe below
+        auto const isUnsafeAtRight = [&]() { return !isSafeAtRight(); };
+        expectLimit(vehicle.velocity.speedLat, speedRange.minimum, -10., 10., isUnsafeAtRight);
+      }
+    }
+  }
+
+  Acceleration maxAcceleration(0.);
+  physics::SpeedRange speedRange;
+  EXPECT_FALSE(calculateSafeLateralLimits(createVehicleStateForLateralMotion(0.),
+                                          createVehicleStateForLateralMotion(0.),
+                                          LateralRelativePosition::Overlap,
+                                          Distance(1.),
+                                          maxAcceleration,
+                                          speedRange));
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, stop_in_front_intersection)
+{
+  for (auto speed : speeds)
+  {
+    for (auto distance : distances)
+    {
+      VehicleState vehicle = createVehicleStateForLongitudinalMotion(speed);
+      vehicle.distanceToEnterIntersection = Distance(distance);
+
+      Acceleration maxAcceleration(0.);
+      Speed maxSpeed(0.);
+      ASSERT_TRUE(calculateStopInFrontIntersectionLimits(vehicle, maxAcceleration, maxSpeed));
+
+      auto const isSafe = [&]() { return isSafeStopInFrontIntersection(vehicle); };
+      expectLimit(vehicle.dynamics.alphaLon.accelMax, maxAcceleration, 0., 100., isSafe);
+      expectLimit(vehicle.velocity.speedLon, maxSpeed, 0., 100., isSafe);
+    }
+  }
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, distance_never_safe)
+{
+  Acceleration maxAcceleration(0.);
+  Speed maxSpeed(0.);
+  ASSERT_TRUE(calculateSafeLongitudinalLimitsSameDirection(createVehicleStateForLongitudinalMotion(100.),
+                                                           createVehicleStateForLongitudinalMotion(0.),
+                                                           Distance(0.),
+                                                           maxAcceleration,
+                                                           maxSpeed));
+  EXPECT_EQ(maxAcceleration, std::numeric_limits<Acceleration>::lowest());
+  EXPECT_EQ(maxSpeed, std::numeric_limits<Speed>::lowest());
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyLimits, invalid_input)
+{
+  VehicleState invalidVehicle = createVehicleStateForLongitudinalMotion(50.);
+  invalidVehicle.responseTime = Duration(0.);
+  VehicleState const vehicle = createVehicleStateForLongitudinalMotion(50.);
+
+  Acceleration maxAcceleration(0.);
+  Speed maxSpeed(0.);
+  physics::SpeedRange speedRange;
+  EXPECT_FALSE(
+    calculateSafeLongitudinalLimitsSameDirection(vehicle, invalidVehicle, Distance(10.), maxAcceleration, maxSpeed));
+  EXPECT_FALSE(
+    calculateSafeLongitudinalLimitsSameDirection(vehicle, vehicle, Distance(-10.), maxAcceleration, maxSpeed));
+  EXPECT_FALSE(calculateSafeLongitudinalLimitsOppositeDirection(
+    invalidVehicle, vehicle, Distance(10.), maxAcceleration, maxSpeed));
+  EXPECT_FALSE(calculateSafeLateralLimits(
+    vehicle, invalidVehicle, LateralRelativePosition::AtLeft, Distance(1.), maxAcceleration, speedRange));
+  EXPECT_FALSE(calculateStopInFrontIntersectionLimits(invalidVehicle, maxAcceleration, maxSpeed));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,347 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::CoordinateSystemAxis;
+
+class RssFormulaTestsCalculateSafetyMargins : public testing::Test
+{
+protected:
+  /**
+   * @brief compare the derivative with the central difference quotient of the function
+   *
+   * Values at which the one-sided difference quotients differ are skipped, since the function is not differentiable
+   * there (e.g. the vehicle stops exactly at the end of the response time).
+   */
+  template <typename ValueType, typename Function>
+  void expectDerivative(ValueType &value, double const derivative, Function const &function)
+  {
+    double const h = 1e-4;
+    ValueType const originalValue = value;
+    double const center = function();
+    value = ValueType(static_cast<double>(originalValue) + h);
+    double const upper = function();
+    value = ValueType(static_cast<double>(originalValue) - h);
+    double const lower = function();
+    value = originalValue;
+
+    double const forwardQuotient = (upper - center) / h;
+    double const backwardQuotient = (center - lower) / h;
+    if (std::fabs(forwardQuotient - backwardQuotient) < 1e-3)
+    {
+      EXPECT_NEAR(derivative, (upper - lower) / (2. * h), 1e-3);
+      probeCount++;
+    }
+  }
+
+  /**
+   * @brief check the gradient of the margin with respect to the state of the vehicle
+   */
+  template <typename MarginFunction>
+  void expectMarginGradient(VehicleState &vehicle,
+                            CoordinateSystemAxis const &axis,
+                            DistanceGradient const &marginGradient,
+                            MarginFunction const &calculateMargin)
+  {
+    auto const marginValue = [&]() {
+      Distance margin(0.);
+      DistanceGradient gradient;
+      EXPECT_TRUE(calculateMargin(margin, gradient));
+      return static_cast<double>(margin);
+    };
+    if (axis == CoordinateSystemAxis::Longitudinal)
+    {
+      expectDerivative(vehicle.velocity.speedLon, static_cast<double>(marginGradient.speed), marginValue);
+      expectDerivative(
+        vehicle.dynamics.alphaLon.accelMax, static_cast<double>(marginGradient.acceleration), marginValue);
+    }
+    else
+    {
+      expectDerivative(vehicle.velocity.speedLat, static_cast<double>(marginGradient.speed), marginValue);
+      expectDerivative(
+        vehicle.dynamics.alphaLat.accelMax, static_cast<double>(marginGradient.acceleration), marginValue);
+    }
+    expectDerivative(vehicle.responseTime, static_cast<double>(marginGradient.responseTime), marginValue);
+  }
+
+  static void expectMarginSafety(Distance const &margin, bool const isDistanceSafe)
+  {
+    EXPECT_EQ(margin >= Distance(Distance::cPrecisionValue), isDistanceSafe) << static_cast<double>(margin);
+  }
+
+  std::vector<double> const speeds{0., 10., 30., 50., 100., 150.};
+  std::vector<double> const distances{0.5, 5., 20., 50., 100., 200.};
+  uint32_t probeCount{0u};
+};
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, distance_offset_gradient)
+{
+  for (auto axis : {CoordinateSystemAxis::Longitudinal, CoordinateSystemAxis::Lateral})
+  {
+    for (auto speed : {-5., -1., 0., 1., 5., 20.})
+    {
+      if ((axis == CoordinateSystemAxis::Longitudinal) && (speed < 0.))
+      {
+        continue;
+      }
+      for (auto acceleration : {-6., -2., 0.5, 3.})
+      {
+        Speed currentSpeed(speed);
+        Duration responseTime(1.);
+        Acceleration accel(acceleration);
+        Acceleration const deceleration(4.);
+
+        DistanceGradient gradient;
+        ASSERT_TRUE(calculateDistanceOffsetGradientAfterStatedBrakingPattern(
+          axis, currentSpeed, responseTime, accel, deceleration, gradient));
+
+        auto const distanceOffset = [&]() {
+          Distance offset(0.);
+          EXPECT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(
+            axis, currentSpeed, responseTime, accel, deceleration, offset));
+          return static_cast<double>(offset);
+        };
+        expectDerivative(currentSpeed, static_cast<double>(gradient.speed), distanceOffset);
+        expectDerivative(accel, static_cast<double>(gradient.acceleration), distanceOffset);
+        expectDerivative(responseTime, static_cast<double>(gradient.responseTime), distanceOffset);
+      }
+    }
+  }
+  EXPECT_GT(probeCount, 100u);
+
+  DistanceGradient gradient;
+  EXPECT_FALSE(calculateDistanceOffsetGradientAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, Speed(-1.), Duration(1.), Acceleration(1.), Acceleration(4.), gradient));
+  EXPECT_FALSE(calculateDistanceOffsetGradientAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, Speed(1.), Duration(-1.), Acceleration(1.), Acceleration(4.), gradient));
+  EXPECT_FALSE(calculateDistanceOffsetGradientAfterStatedBrakingPattern(
+    CoordinateSystemAxis::Longitudinal, Speed(1.), Duration(1.), Acceleration(1.), Acceleration(0.), gradient));
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, same_direction)
+{
+  for (auto isLeading : {true, false})
+  {
+    for (auto vehicleSpeed : speeds)
+    {
+      for (auto otherSpeed : speeds)
+      {
+        for (auto distance : distances)
+        {
+          VehicleState vehicle = createVehicleStateForLongitudinalMotion(vehicleSpeed);
+          VehicleState const otherVehicle = createVehicleStateForLongitudinalMotion(otherSpeed);
+          Distance const vehicleDistance(distance);
+          LongitudinalRelativePosition const position
+            = isLeading ? LongitudinalRelativePosition::InFront : LongitudinalRelativePosition::AtBack;
+
+          auto const calculateMargin = [&](Distance &margin, DistanceGradient &marginGradient) {
+            return calculateSafeLongitudinalMarginSameDirection(
+              vehicle, otherVehicle, position, vehicleDistance, margin, marginGradient);
+          };
+          Distance margin(0.);
+          DistanceGradient marginGradient;
+          ASSERT_TRUE(calculateMargin(margin, marginGradient));
+
+          Distance safeDistance(0.);
+          bool isDistanceSafe = false;
+          if (isLeading)
+          {
+            ASSERT_TRUE(checkSafeLongitudinalDistanceSameDirection(
+              vehicle, otherVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          else
+          {
+            ASSERT_TRUE(checkSafeLongitudinalDistanceSameDirection(
+              otherVehicle, vehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          EXPECT_NEAR(static_cast<double>(margin), static_cast<double>(vehicleDistance - safeDistance), cDoubleNear);
+          expectMarginSafety(margin, isDistanceSafe);
+          expectMarginGradient(vehicle, CoordinateSystemAxis::Longitudinal, marginGradient, calculateMargin);
+        }
+      }
+    }
+  }
+  EXPECT_GT(probeCount, 500u);
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, opposite_direction)
+{
+  for (auto isInCorrectLane : {true, false})
+  {
+    for (auto vehicleSpeed : speeds)
+    {
+      for (auto otherSpeed : speeds)
+      {
+        for (auto distance : distances)
+        {
+          VehicleState vehicle = createVehicleStateForLongitudinalMotion(vehicleSpeed);
+          vehicle.isInCorrectLane = isInCorrectLane;
+          VehicleState otherVehicle = createVehicleStateForLongitudinalMotion(otherSpeed);
+          otherVehicle.isInCorrectLane = !isInCorrectLane;
+          Distance const vehicleDistance(distance);
+
+          auto const calculateMargin = [&](Distance &margin, DistanceGradient &marginGradient) {
+            return calculateSafeLongitudinalMarginOppositeDirection(
+              vehicle, otherVehicle, vehicleDistance, margin, marginGradient);
+          };
+          Distance margin(0.);
+          DistanceGradient marginGradient;
+          ASSERT_TRUE(calculateMargin(margin, marginGradient));
+
+          Distance safeDistance(0.);
+          bool isDistanceSafe = false;
+          if (isInCorrectLane)
+          {
+            ASSERT_TRUE(checkSafeLongitudinalDistanceOppositeDirection(
+              vehicle, otherVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          else
+          {
+            ASSERT_TRUE(checkSafeLongitudinalDistanceOppositeDirection(
+              otherVehicle, vehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          EXPECT_NEAR(static_cast<double>(margin), static_cast<double>(vehicleDistance - safeDistance), cDoubleNear);
+          expectMarginSafety(margin, isDistanceSafe);
+          expectMarginGradient(vehicle, CoordinateSystemAxis::Longitudinal, marginGradient, calculateMargin);
+        }
+      }
+    }
+  }
+  EXPECT_GT(probeCount, 500u);
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, lateral)
+{
+  std::vector<double> const lateralSpeeds{-5., -1., 0., 1., 5.};
+  std::vector<double> const lateralDistances{0.01, 0.5, 1., 2., 5.};
+  for (auto position : {LateralRelativePosition::AtLeft, LateralRelativePosition::AtRight})
+  {
+    for (auto vehicleSpeed : lateralSpeeds)
+    {
+      for (auto otherSpeed : lateralSpeeds)
+      {
+        for (auto distance : lateralDistances)
+        {
+          VehicleState vehicle = createVehicleStateForLateralMotion(vehicleSpeed);
+          VehicleState const otherVehicle = createVehicleStateForLateralMotion(otherSpeed);
+          Distance const vehicleDistance(distance);
+
+          auto const calculateMargin = [&](Distance &margin, DistanceGradient &marginGradient) {
+            return calculateSafeLateralMargin(vehicle, otherVehicle, position, vehicleDistance, margin, marginGradient);
+          };
+          Distance margin(0.);
+          DistanceGradient marginGradient;
+          ASSERT_TRUE(calculateMargin(margin, marginGradient));
+
+          Distance safeDistance(0.);
+          bool isDistanceSafe = false;
+          if (position == LateralRelativePosition::AtLeft)
+          {
+            ASSERT_TRUE(checkSafeLateralDistance(vehicle, otherVehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          else
+          {
+            ASSERT_TRUE(checkSafeLateralDistance(otherVehicle, vehicle, vehicleDistance, safeDistance, isDistanceSafe));
+          }
+          EXPECT_NEAR(static_cast<double>(margin), static_cast<double>(vehicleDistance - safeDistance), cDoubleNear);
+          expectMarginSafety(margin, isDistanceSafe);
+          expectMarginGradient(vehicle, CoordinateSystemAxis::Lateral, marginGradient, calculateMargin);
+        }
+      }
+    }
+  }
+  EXPECT_GT(probeCount, 500u);
+
+  Distance margin(0.);
+  DistanceGradient marginGradient;
+  EXPECT_FALSE(calculateSafeLateralMargin(createVehicleStateForLateralMotion(0.),
+                                          createVehicleStateForLateralMotion(0.),
+                                          LateralRelativePosition::Overlap,
+                                          Distance(1.),
+                                          margin,
+                                          marginGradient));
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, stop_in_front_intersection)
+{
+  for (auto speed : speeds)
+  {
+    for (auto distance : distances)
+    {
+      VehicleState vehicle = createVehicleStateForLongitudinalMotion(speed);
+      vehicle.distanceToEnterIntersection = Distance(distance);
+
+      auto const calculateMargin = [&](Distance &margin, DistanceGradient &marginGradient) {
+        return calculateStopInFrontIntersectionMargin(vehicle, margin, marginGradient);
+      };
+      Distance margin(0.);
+      DistanceGradient marginGradient;
+      ASSERT_TRUE(calculateMargin(margin, marginGradient));
+
+      Distance safeDistance(0.);
+      bool isDistanceSafe = false;
+      ASSERT_TRUE(checkStopInFrontIntersection(vehicle, safeDistance, isDistanceSafe));
+      EXPECT_NEAR(static_cast<double>(margin),
+                  static_cast<double>(vehicle.distanceToEnterIntersection - safeDistance),
+                  cDoubleNear);
+      expectMarginSafety(margin, isDistanceSafe);
+      expectMarginGradient(vehicle, CoordinateSystemAxis::Longitudinal, marginGradient, calculateMargin);
+    }
+  }
+  EXPECT_GT(probeCount, 50u);
+}
+
+TEST_F(RssFormulaTestsCalculateSafetyMargins, invalid_input)
+{
+  VehicleState invalidVehicle = createVehicleStateForLongitudinalMotion(50.);
+  invalidVehicle.responseTime = Duration(0.);
+  VehicleState const vehicle = createVehicleStateForLongitudinalMotion(50.);
+
+  Distance margin(0.);
+  DistanceGradient marginGradient;
+  EXPECT_FALSE(calculateSafeLongitudinalMarginSameDirection(
+    vehicle, invalidVehicle, LongitudinalRelativePosition::AtBack, Distance(10.), margin, marginGradient));
+  EXPECT_FALSE(calculateSafeLongitudinalMarginSameDirection(
+    vehicle, vehicle, LongitudinalRelativePosition::AtBack, Distance(-10.), margin, marginGradient));
+  EXPECT_FALSE(
+    calculateSafeLongitudinalMarginOppositeDirection(invalidVehicle, vehicle, Distance(10.), margin, marginGradient));
+  EXPECT_FALSE(calculateSafeLateralMargin(
+    vehicle, invalidVehicle, LateralRelativePosition::AtLeft, Distance(1.), margin, marginGradient));
+  EXPECT_FALSE(calculateStopInFrontIntersectionMargin(invalidVehicle, margin, marginGradient));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,168 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "core/RssState.hpp"
+#include "situation/RssSituation.hpp"
+#include "situation/RssSituationBatchEvaluator.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssSituationBatchEvaluatorTests : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    std::vector<double> const lonVelocities{0., 10., 50., 120.};
+    std::vector<double> const latVelocities{-8., -1., 0., 0.5, 6.};
+    std::vector<double> const responseTimes{0.5, 1., 2.};
+    std::vector<double> const lonDistances{0., 3., 25., 120., 1000.};
+    std::vector<double> const latDistances{0., 0.2, 1.5, 8.};
+
+    // cover the combinations of the relative positions and a variety of the vehicle states
+    for (uint32_t i = 0u; i < 500u; i++)
+    {
+      Situation situation;
+      situation.timeIndex = 1u;
+      situation.situationId = i;
+      situation.situationType = ((i % 2u) == 0u) ? SituationType::SameDirection : SituationType::OppositeDirection;
+      situation.egoVehicleState = createVehicleState(lonVelocities[i % lonVelocities.size()],
+                                                     latVelocities[(i / 3u) % latVelocities.size()]);
+      situation.egoVehicleState.responseTime = Duration(responseTimes[(i / 7u) % responseTimes.size()]);
+      situation.egoVehicleState.isInCorrectLane = ((i / 5u) % 2u) == 0u;
+      situation.otherVehicleState = createVehicleState(lonVelocities[(i / 11u) % lonVelocities.size()],
+                                                       latVelocities[(i / 2u) % latVelocities.size()]);
+      situation.relativePosition.longitudinalPosition = static_cast<LongitudinalRelativePosition>((i / 2u) % 5u);
+      situation.relativePosition.longitudinalDistance = Distance(lonDistances[(i / 13u) % lonDistances.size()]);
+      situation.relativePosition.lateralPosition = static_cast<LateralRelativePosition>((i / 10u) % 5u);
+      situation.relativePosition.lateralDistance = Distance(latDistances[(i / 17u) % latDistances.size()]);
+      situationVector.push_back(situation);
+    }
+  }
+
+  bool calculateRssStates(std::vector<std::size_t> const &situationIndices,
+                          state::ResponseStateVector &responseStateVector)
+  {
+    responseStateVector.resize(situationVector.size());
+    for (auto const index : situationIndices)
+    {
+      responseStateVector[index] = state::createResponseState(
+        situationVector[index].timeIndex, situationVector[index].situationId, state::IsSafe::No);
+    }
+    return batchEvaluator.calculateRssStates(situationVector, situationIndices, responseStateVector);
+  }
+
+  bool calculateExpectedRssState(Situation const &situation, state::ResponseState &responseState)
+  {
+    responseState = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::No);
+    if (situation.situationType == SituationType::SameDirection)
+    {
+      return calculateRssStateNonIntersectionSameDirection(situation, responseState);
+    }
+    return calculateRssStateNonIntersectionOppositeDirection(situation, responseState);
+  }
+
+  void expectIdenticalSafeDistance(state::ResponseInformation const &expected,
+                                   state::ResponseInformation const &actual)
+  {
+    EXPECT_EQ(static_cast<double>(expected.safeDistance), static_cast<double>(actual.safeDistance));
+  }
+
+  SituationVector situationVector;
+  RssSituationBatchEvaluator batchEvaluator;
+};
+
+TEST_F(RssSituationBatchEvaluatorTests, identical_to_situation_wise_calculation)
+{
+  std::vector<std::size_t> situationIndices;
+  for (std::size_t i = 0u; i < situationVector.size(); i++)
+  {
+    situationIndices.push_back(i);
+  }
+
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(calculateRssStates(situationIndices, responseStateVector));
+
+  for (std::size_t i = 0u; i < situationVector.size(); i++)
+  {
+    state::ResponseState expectedResponseState;
+    ASSERT_TRUE(calculateExpectedRssState(situationVector[i], expectedResponseState));
+    EXPECT_EQ(expectedResponseState, responseStateVector[i]);
+    expectIdenticalSafeDistance(expectedResponseState.longitudinalState.responseInformation,
+                                responseStateVector[i].longitudinalState.responseInformation);
+    expectIdenticalSafeDistance(expectedResponseState.lateralStateLeft.responseInformation,
+                                responseStateVector[i].lateralStateLeft.responseInformation);
+    expectIdenticalSafeDistance(expectedResponseState.lateralStateRight.responseInformation,
+                                responseStateVector[i].lateralStateRight.responseInformation);
+  }
+}
+
+TEST_F(RssSituationBatchEvaluatorTests, only_given_situations_are_evaluated)
+{
+  std::vector<std::size_t> situationIndices{3u, 4u, 42u, 99u};
+  state::ResponseStateVector responseStateVector;
+  ASSERT_TRUE(calculateRssStates(situationIndices, responseStateVector));
+  for (auto const index : situationIndices)
+  {
+    state::ResponseState expectedResponseState;
+    ASSERT_TRUE(calculateExpectedRssState(situationVector[index], expectedResponseState));
+    EXPECT_EQ(expectedResponseState, responseStateVector[index]);
+  }
+  EXPECT_EQ(state::ResponseState(), responseStateVector[0u]);
+
+  // the evaluator can be reused
+  ASSERT_TRUE(calculateRssStates(std::vector<std::size_t>(), responseStateVector));
+  ASSERT_TRUE(calculateRssStates(situationIndices, responseStateVector));
+}
+
+TEST_F(RssSituationBatchEvaluatorTests, failing_situation)
+{
+  std::vector<std::size_t> situationIndices{0u, 1u, 2u};
+  state::ResponseStateVector responseStateVector;
+
+  situationVector[1u].relativePosition.longitudinalDistance = Distance(-1.);
+  state::ResponseState expectedResponseState;
+  ASSERT_FALSE(calculateExpectedRssState(situationVector[1u], expectedResponseState));
+  EXPECT_FALSE(calculateRssStates(situationIndices, responseStateVector));
+
+  situationVector[1u].relativePosition.longitudinalDistance = Distance(1.);
+  situationVector[2u].egoVehicleState.dynamics.alphaLon.brakeMin = Acceleration(0.);
+  situationVector[2u].otherVehicleState.dynamics.alphaLon.brakeMin = Acceleration(0.);
+  ASSERT_FALSE(calculateExpectedRssState(situationVector[2u], expectedResponseState));
+  EXPECT_FALSE(calculateRssStates(situationIndices, responseStateVector));
+
+  situationVector[2u].situationType = SituationType::IntersectionSamePriority;
+  EXPECT_FALSE(calculateRssStates(situationIndices, responseStateVector));
+}
+
+} // namespace situation
+} // namespace ad_rss
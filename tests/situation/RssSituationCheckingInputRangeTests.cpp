@@ -31,6 +31,7 @@
 
 #include "TestSupport.hpp"
 #include "ad_rss/core/RssSituationChecking.hpp"
+#include "core/RssState.hpp"
 
 namespace ad_rss {
 namespace core {
@@ -53,20 +54,30 @@ protected:
     situation.timeIndex = 1u;
   }
 
+  /**
+   * @brief check the situation by the public interface, which checks the input range of the situation
+   */
+  bool checkSituation()
+  {
+    situation::SituationVector situationVector;
+    situationVector.push_back(situation);
+    state::ResponseStateVector responseStateVector;
+    return situationChecking.checkSituations(situationVector, responseStateVector);
+  }
+
   virtual void performTestRun()
   {
-    EXPECT_FALSE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+    EXPECT_FALSE(checkSituation());
   }
   RssSituationChecking situationChecking;
   situation::VehicleState leadingVehicle;
   situation::VehicleState followingVehicle;
   situation::Situation situation;
-  state::ResponseState responseState;
 };
 
 TEST_F(RssSituationCheckingInputRangeTests, validateTestSetup)
 {
-  EXPECT_TRUE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  EXPECT_TRUE(checkSituation());
 }
 
 /**
@@ -304,7 +315,7 @@ TEST_F(RssSituationCheckingInputRangeTests, longitudinal_correct_deceleration_br
   situation.egoVehicleState.dynamics.alphaLon.brakeMax = Acceleration(4.);
   situation.egoVehicleState.dynamics.alphaLon.brakeMin = Acceleration(4.);
 
-  ASSERT_TRUE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  ASSERT_TRUE(checkSituation());
 }
 
 TEST_F(RssSituationCheckingInputRangeTests, longitudinal_correct_deceleration_brake_min_equals_brake_min_correct)
@@ -313,7 +324,7 @@ TEST_F(RssSituationCheckingInputRangeTests, longitudinal_correct_deceleration_br
   situation.egoVehicleState.dynamics.alphaLon.brakeMin = Acceleration(3.);
   situation.egoVehicleState.dynamics.alphaLon.brakeMinCorrect = Acceleration(3.);
 
-  ASSERT_TRUE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  ASSERT_TRUE(checkSituation());
 }
 
 TEST_F(RssSituationCheckingInputRangeTests,
@@ -323,7 +334,7 @@ TEST_F(RssSituationCheckingInputRangeTests,
   situation.egoVehicleState.dynamics.alphaLon.brakeMin = Acceleration(3.);
   situation.egoVehicleState.dynamics.alphaLon.brakeMinCorrect = Acceleration(3.);
 
-  ASSERT_TRUE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  ASSERT_TRUE(checkSituation());
 }
 
 TEST_F(RssSituationCheckingInputRangeTests, situationVectorSizeRange)
@@ -371,5 +382,23 @@ TEST_F(RssSituationCheckingInputRangeTests, nan_values)
   performTestRun();
 }
 
+TEST_F(RssSituationCheckingInputRangeTests, situationsOfReusedResponseStatesAreNotCheckedAgain)
+{
+  situation::SituationVector situationVector;
+  state::ResponseStateVector responseStateVector;
+  situationVector.push_back(situation);
+  situationVector.back().egoVehicleState.dynamics.alphaLon.brakeMin = Acceleration(0.);
+
+  // the situation is checked, if the response state is calculated
+  std::vector<uint8_t> reusedResponseStates(1u, 0u);
+  ASSERT_FALSE(situationChecking.checkSituations(situationVector, responseStateVector, reusedResponseStates, nullptr));
+
+  // the situation of a reused response state has been checked within the previous time step already
+  responseStateVector.resize(1u);
+  responseStateVector[0] = state::createResponseState(situation.timeIndex, situation.situationId, state::IsSafe::Yes);
+  reusedResponseStates[0] = 1u;
+  ASSERT_TRUE(situationChecking.checkSituations(situationVector, responseStateVector, reusedResponseStates, nullptr));
+}
+
 } // namespace core
 } // namespace ad_rss
@@ -216,7 +216,10 @@ TEST_F(RssSituationCheckingTestsOppositeDirection, incorrect_vehicle_state_ego)
   situation.relativePosition
     = createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(178.7));
 
-  ASSERT_FALSE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  situation::SituationVector situationVector;
+  situationVector.push_back(situation);
+  state::ResponseStateVector responseStateVector;
+  ASSERT_FALSE(situationChecking.checkSituations(situationVector, responseStateVector));
 }
 
 TEST_F(RssSituationCheckingTestsOppositeDirection, incorrect_vehicle_state_other)
@@ -232,7 +235,10 @@ TEST_F(RssSituationCheckingTestsOppositeDirection, incorrect_vehicle_state_other
   situation.relativePosition
     = createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(178.7));
 
-  ASSERT_FALSE(situationChecking.checkSituationInputRangeChecked(situation, true, responseState));
+  situation::SituationVector situationVector;
+  situationVector.push_back(situation);
+  state::ResponseStateVector responseStateVector;
+  ASSERT_FALSE(situationChecking.checkSituations(situationVector, responseStateVector));
 }
 
 TEST_F(RssSituationCheckingTestsOppositeDirection, 50kmh_brake_min_ego_opposite)
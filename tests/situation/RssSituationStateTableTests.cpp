@@ -0,0 +1,142 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "situation/RssSituationStateTable.hpp"
+#include "wrap_new.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+TEST(RssSituationStateTableTests, insertAndFind)
+{
+  RssSituationStateTable<uint32_t> table;
+
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 10u));
+  ASSERT_TRUE(table.insertCurrent(SituationId(2u), 20u));
+  ASSERT_EQ(nullptr, table.findPrevious(SituationId(1u)));
+  ASSERT_NE(nullptr, table.findCurrent(SituationId(1u)));
+  ASSERT_EQ(10u, *table.findCurrent(SituationId(1u)));
+  ASSERT_EQ(20u, *table.findCurrent(SituationId(2u)));
+  ASSERT_EQ(nullptr, table.findCurrent(SituationId(3u)));
+}
+
+TEST(RssSituationStateTableTests, duplicateInsertKeepsFirstState)
+{
+  RssSituationStateTable<uint32_t> table;
+
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 10u));
+  ASSERT_FALSE(table.insertCurrent(SituationId(1u), 11u));
+  ASSERT_EQ(10u, *table.findCurrent(SituationId(1u)));
+}
+
+TEST(RssSituationStateTableTests, generationsExpire)
+{
+  RssSituationStateTable<uint32_t> table;
+
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 10u));
+  table.nextGeneration();
+  ASSERT_EQ(nullptr, table.findCurrent(SituationId(1u)));
+  ASSERT_EQ(10u, *table.findPrevious(SituationId(1u)));
+
+  // same situation id in both generations
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 11u));
+  ASSERT_EQ(10u, *table.findPrevious(SituationId(1u)));
+  ASSERT_EQ(11u, *table.findCurrent(SituationId(1u)));
+
+  table.nextGeneration();
+  ASSERT_EQ(11u, *table.findPrevious(SituationId(1u)));
+  ASSERT_EQ(nullptr, table.findCurrent(SituationId(1u)));
+
+  table.nextGeneration();
+  ASSERT_EQ(nullptr, table.findPrevious(SituationId(1u)));
+}
+
+TEST(RssSituationStateTableTests, discardCurrentGeneration)
+{
+  RssSituationStateTable<uint32_t> table;
+
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 10u));
+  table.nextGeneration();
+  ASSERT_TRUE(table.insertCurrent(SituationId(1u), 11u));
+  ASSERT_TRUE(table.insertCurrent(SituationId(2u), 20u));
+  table.discardCurrentGeneration();
+  ASSERT_EQ(10u, *table.findPrevious(SituationId(1u)));
+  ASSERT_EQ(nullptr, table.findCurrent(SituationId(1u)));
+  ASSERT_EQ(nullptr, table.findCurrent(SituationId(2u)));
+  ASSERT_EQ(nullptr, table.findPrevious(SituationId(2u)));
+
+  table.clear();
+  ASSERT_EQ(nullptr, table.findPrevious(SituationId(1u)));
+}
+
+TEST(RssSituationStateTableTests, noAllocationsWithinPreallocatedSize)
+{
+  RssSituationStateTable<uint32_t> table(100u);
+
+  gNewCallCounter = 0u;
+  for (uint32_t step = 0u; step < 50u; ++step)
+  {
+    // partially changing situation ids over time
+    for (uint32_t situation = 0u; situation < 100u; ++situation)
+    {
+      SituationId const situationId = static_cast<SituationId>(step * 10u + situation);
+      ASSERT_TRUE(table.insertCurrent(situationId, step));
+      if (step > 0u && situation < 90u)
+      {
+        ASSERT_NE(nullptr, table.findPrevious(situationId));
+        ASSERT_EQ(step - 1u, *table.findPrevious(situationId));
+      }
+    }
+    table.nextGeneration();
+  }
+  ASSERT_EQ(0u, gNewCallCounter);
+}
+
+TEST(RssSituationStateTableTests, growsBeyondPreallocatedSize)
+{
+  RssSituationStateTable<uint32_t> table(2u);
+  std::size_t const initialCapacity = table.getCapacity();
+
+  for (uint32_t situation = 0u; situation < 1000u; ++situation)
+  {
+    ASSERT_TRUE(table.insertCurrent(SituationId(situation * 7u), situation));
+  }
+  table.nextGeneration();
+  ASSERT_LT(initialCapacity, table.getCapacity());
+  for (uint32_t situation = 0u; situation < 1000u; ++situation)
+  {
+    ASSERT_EQ(situation, *table.findPrevious(SituationId(situation * 7u)));
+  }
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,276 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "situation/RssFormulas.hpp"
+#include "situation/RssSituation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssSituationUncertaintyTests : public testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    situation.situationType = SituationType::SameDirection;
+    situation.timeIndex = 1u;
+    situation.egoVehicleState = createVehicleState(50., 1.);
+    situation.otherVehicleState = createVehicleState(40., -1.);
+    situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::InFront;
+    situation.relativePosition.longitudinalDistance = Distance(50.);
+    situation.relativePosition.lateralPosition = LateralRelativePosition::AtLeft;
+    situation.relativePosition.lateralDistance = Distance(1.);
+
+    uncertainty = createSituationUncertainty(situation);
+    uncertainty.egoVehicleState.speedLon.minimum = kmhToMeterPerSec(45.);
+    uncertainty.egoVehicleState.speedLon.maximum = kmhToMeterPerSec(55.);
+    uncertainty.egoVehicleState.speedLat.minimum = Speed(-0.5);
+    uncertainty.egoVehicleState.speedLat.maximum = Speed(0.8);
+    uncertainty.otherVehicleState.speedLon.minimum = kmhToMeterPerSec(30.);
+    uncertainty.otherVehicleState.speedLon.maximum = kmhToMeterPerSec(50.);
+    uncertainty.otherVehicleState.speedLat.minimum = Speed(-0.8);
+    uncertainty.otherVehicleState.speedLat.maximum = Speed(0.);
+    uncertainty.longitudinalDistance.minimum = Distance(40.);
+    uncertainty.longitudinalDistance.maximum = Distance(60.);
+    uncertainty.lateralDistance.minimum = Distance(0.5);
+    uncertainty.lateralDistance.maximum = Distance(1.5);
+  }
+
+  static bool calculateRssState(Situation const &currentSituation, state::ResponseState &responseState)
+  {
+    if (currentSituation.situationType == SituationType::SameDirection)
+    {
+      return calculateRssStateNonIntersectionSameDirection(currentSituation, responseState);
+    }
+    return calculateRssStateNonIntersectionOppositeDirection(currentSituation, responseState);
+  }
+
+  static bool calculateWorstCaseRssState(Situation const &currentSituation,
+                                         SituationUncertainty const &currentUncertainty,
+                                         state::ResponseState &responseState)
+  {
+    if (currentSituation.situationType == SituationType::SameDirection)
+    {
+      return calculateRssStateNonIntersectionSameDirection(currentSituation, currentUncertainty, responseState);
+    }
+    return calculateRssStateNonIntersectionOppositeDirection(currentSituation, currentUncertainty, responseState);
+  }
+
+  static double sampleValue(double const minimum, double const maximum, std::size_t const sample)
+  {
+    return minimum + (maximum - minimum) * static_cast<double>(sample) / static_cast<double>(cSamplesPerRange - 1u);
+  }
+
+  /**
+   * @brief evaluate the situation for the borders and the center of all ranges of the uncertainty
+   *
+   * The worst case has to be safe if and only if all samples are safe and has to report the maximal safe distance.
+   */
+  void expectWorstCaseOfSamples()
+  {
+    state::ResponseState worstCase;
+    ASSERT_TRUE(calculateWorstCaseRssState(situation, uncertainty, worstCase));
+
+    bool longitudinalSafe = true;
+    bool lateralLeftSafe = true;
+    bool lateralRightSafe = true;
+    std::size_t numberOfSamples = 1u;
+    for (std::size_t i = 0u; i < 6u; ++i)
+    {
+      numberOfSamples *= cSamplesPerRange;
+    }
+    for (std::size_t sampleIndex = 0u; sampleIndex < numberOfSamples; ++sampleIndex)
+    {
+      std::size_t remainingIndex = sampleIndex;
+      auto nextSample = [&remainingIndex](physics::SpeedRange const &range) {
+        std::size_t const sample = remainingIndex % cSamplesPerRange;
+        remainingIndex /= cSamplesPerRange;
+        return Speed(sampleValue(static_cast<double>(range.minimum), static_cast<double>(range.maximum), sample));
+      };
+      auto nextDistanceSample = [&remainingIndex](physics::MetricRange const &range) {
+        std::size_t const sample = remainingIndex % cSamplesPerRange;
+        remainingIndex /= cSamplesPerRange;
+        return Distance(sampleValue(static_cast<double>(range.minimum), static_cast<double>(range.maximum), sample));
+      };
+
+      Situation sample = situation;
+      sample.egoVehicleState.velocity.speedLon = nextSample(uncertainty.egoVehicleState.speedLon);
+      sample.egoVehicleState.velocity.speedLat = nextSample(uncertainty.egoVehicleState.speedLat);
+      sample.otherVehicleState.velocity.speedLon = nextSample(uncertainty.otherVehicleState.speedLon);
+      sample.otherVehicleState.velocity.speedLat = nextSample(uncertainty.otherVehicleState.speedLat);
+      sample.relativePosition.longitudinalDistance = nextDistanceSample(uncertainty.longitudinalDistance);
+      sample.relativePosition.lateralDistance = nextDistanceSample(uncertainty.lateralDistance);
+
+      state::ResponseState response;
+      ASSERT_TRUE(calculateRssState(sample, response));
+      longitudinalSafe = longitudinalSafe && response.longitudinalState.isSafe;
+      lateralLeftSafe = lateralLeftSafe && response.lateralStateLeft.isSafe;
+      lateralRightSafe = lateralRightSafe && response.lateralStateRight.isSafe;
+      ASSERT_LE(response.longitudinalState.responseInformation.safeDistance,
+                worstCase.longitudinalState.responseInformation.safeDistance);
+      ASSERT_LE(response.lateralStateLeft.responseInformation.safeDistance,
+                worstCase.lateralStateLeft.responseInformation.safeDistance);
+      ASSERT_LE(response.lateralStateRight.responseInformation.safeDistance,
+                worstCase.lateralStateRight.responseInformation.safeDistance);
+    }
+
+    EXPECT_EQ(worstCase.longitudinalState.isSafe, longitudinalSafe);
+    EXPECT_EQ(worstCase.lateralStateLeft.isSafe, lateralLeftSafe);
+    EXPECT_EQ(worstCase.lateralStateRight.isSafe, lateralRightSafe);
+  }
+
+  void expectWorstCaseOfSamplesForAllRelativePositions()
+  {
+    for (auto longitudinalPosition : {LongitudinalRelativePosition::InFront,
+                                      LongitudinalRelativePosition::OverlapFront,
+                                      LongitudinalRelativePosition::Overlap,
+                                      LongitudinalRelativePosition::OverlapBack,
+                                      LongitudinalRelativePosition::AtBack})
+    {
+      for (auto lateralPosition : {LateralRelativePosition::AtLeft,
+                                   LateralRelativePosition::OverlapLeft,
+                                   LateralRelativePosition::Overlap,
+                                   LateralRelativePosition::OverlapRight,
+                                   LateralRelativePosition::AtRight})
+      {
+        for (auto minimumDistance : {5., 40., 120.})
+        {
+          situation.relativePosition.longitudinalPosition = longitudinalPosition;
+          situation.relativePosition.lateralPosition = lateralPosition;
+          uncertainty.longitudinalDistance.minimum = Distance(minimumDistance);
+          uncertainty.longitudinalDistance.maximum = Distance(minimumDistance + 20.);
+          uncertainty.lateralDistance.minimum = Distance(minimumDistance / 40.);
+          uncertainty.lateralDistance.maximum = Distance(minimumDistance / 40. + 0.5);
+          expectWorstCaseOfSamples();
+        }
+      }
+    }
+  }
+
+  static const std::size_t cSamplesPerRange = 3u;
+  Situation situation;
+  SituationUncertainty uncertainty;
+};
+
+TEST_F(RssSituationUncertaintyTests, same_direction_worst_case_of_samples)
+{
+  expectWorstCaseOfSamplesForAllRelativePositions();
+}
+
+TEST_F(RssSituationUncertaintyTests, opposite_direction_worst_case_of_samples)
+{
+  situation.situationType = SituationType::OppositeDirection;
+  situation.otherVehicleState.isInCorrectLane = false;
+  expectWorstCaseOfSamplesForAllRelativePositions();
+
+  situation.egoVehicleState.isInCorrectLane = false;
+  situation.otherVehicleState.isInCorrectLane = true;
+  expectWorstCaseOfSamplesForAllRelativePositions();
+}
+
+TEST_F(RssSituationUncertaintyTests, without_uncertainty_equals_nominal_evaluation)
+{
+  for (auto situationType : {SituationType::SameDirection, SituationType::OppositeDirection})
+  {
+    situation.situationType = situationType;
+    state::ResponseState nominalResponse;
+    ASSERT_TRUE(calculateRssState(situation, nominalResponse));
+    state::ResponseState worstCaseResponse;
+    ASSERT_TRUE(calculateWorstCaseRssState(situation, createSituationUncertainty(situation), worstCaseResponse));
+    ASSERT_EQ(nominalResponse, worstCaseResponse);
+  }
+}
+
+TEST_F(RssSituationUncertaintyTests, unsafe_within_uncertainty)
+{
+  situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::AtBack;
+  situation.relativePosition.longitudinalDistance = Distance(90.);
+  uncertainty = createSituationUncertainty(situation);
+
+  state::ResponseState response;
+  ASSERT_TRUE(calculateWorstCaseRssState(situation, uncertainty, response));
+  ASSERT_TRUE(response.longitudinalState.isSafe);
+
+  uncertainty.longitudinalDistance.minimum = Distance(80.);
+  ASSERT_TRUE(calculateWorstCaseRssState(situation, uncertainty, response));
+  ASSERT_FALSE(response.longitudinalState.isSafe);
+  ASSERT_EQ(response.longitudinalState.responseInformation.currentDistance, Distance(80.));
+
+  uncertainty.longitudinalDistance.minimum = Distance(90.);
+  uncertainty.egoVehicleState.speedLon.maximum = kmhToMeterPerSec(60.);
+  ASSERT_TRUE(calculateWorstCaseRssState(situation, uncertainty, response));
+  ASSERT_FALSE(response.longitudinalState.isSafe);
+}
+
+TEST_F(RssSituationUncertaintyTests, invalid_uncertainty)
+{
+  state::ResponseState response;
+  SituationUncertainty invalidUncertainty = uncertainty;
+  invalidUncertainty.longitudinalDistance.minimum = Distance(70.);
+  ASSERT_FALSE(calculateWorstCaseRssState(situation, invalidUncertainty, response));
+
+  invalidUncertainty = uncertainty;
+  invalidUncertainty.egoVehicleState.speedLon.minimum = Speed(-1.);
+  ASSERT_FALSE(calculateWorstCaseRssState(situation, invalidUncertainty, response));
+
+  invalidUncertainty = uncertainty;
+  invalidUncertainty.otherVehicleState.speedLat.maximum = Speed(-1.);
+  ASSERT_FALSE(calculateWorstCaseRssState(situation, invalidUncertainty, response));
+
+  invalidUncertainty = uncertainty;
+  invalidUncertainty.lateralDistance.minimum = Distance(-1.);
+  ASSERT_FALSE(calculateWorstCaseRssState(situation, invalidUncertainty, response));
+}
+
+TEST_F(RssSituationUncertaintyTests, stop_in_front_intersection)
+{
+  VehicleState vehicle = createVehicleStateForLongitudinalMotion(50.);
+  vehicle.distanceToEnterIntersection = Distance(100.);
+  VehicleStateUncertainty vehicleUncertainty = createVehicleStateUncertainty(vehicle);
+
+  Distance safeDistance(0.);
+  bool isDistanceSafe = false;
+  ASSERT_TRUE(checkStopInFrontIntersection(vehicle, vehicleUncertainty, safeDistance, isDistanceSafe));
+  ASSERT_TRUE(isDistanceSafe);
+
+  vehicleUncertainty.speedLon.maximum = kmhToMeterPerSec(60.);
+  ASSERT_TRUE(checkStopInFrontIntersection(vehicle, vehicleUncertainty, safeDistance, isDistanceSafe));
+  ASSERT_FALSE(isDistanceSafe);
+
+  Distance maximumSpeedSafeDistance(0.);
+  ASSERT_TRUE(checkStopInFrontIntersection(
+    createVehicleStateForLongitudinalMotion(60.), maximumSpeedSafeDistance, isDistanceSafe));
+  ASSERT_NEAR(static_cast<double>(safeDistance), static_cast<double>(maximumSpeedSafeDistance), cDoubleNear);
+}
+
+} // namespace situation
+} // namespace ad_rss
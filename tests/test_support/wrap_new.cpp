@@ -36,9 +36,11 @@
 
 uint64_t gNewThrowCounter{0u};
 uint64_t gNewThrowSize{0u};
+uint64_t gNewCallCounter{0u};
 
 void *operator new(std::size_t count)
 {
+  gNewCallCounter++;
   if (gNewThrowCounter > 0u)
   {
     if ((gNewThrowSize == 0u) || (gNewThrowSize == count))
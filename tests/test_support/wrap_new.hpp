@@ -44,3 +44,10 @@ extern uint64_t gNewThrowCounter;
  * then an std::bad_alloc() exception is thrown.
  */
 extern uint64_t gNewThrowSize;
+
+/**
+ * @brief counts the number of calls to new()
+ *
+ * Can be reset by the test to count the number of heap allocations of a specific operation.
+ */
+extern uint64_t gNewCallCounter;
@@ -0,0 +1,352 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ *
+ * ad-rss-replay: replays a log written by RssLogWriter through RssCheck and reports throughput and latency.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include "ad_rss/core/RssLogReplay.hpp"
+#include "ad_rss/core/RssLogWriter.hpp"
+#include "core/RssState.hpp"
+
+namespace ad_rss {
+namespace replay {
+
+/**
+ * @brief the options of the replay tool
+ */
+struct ReplayOptions
+{
+  std::string logFileName;
+  std::string outputFileName;
+  std::string restrictionsFileName;
+  core::RssLogReplayConfiguration configuration;
+  uint32_t numberOfRepetitions{1u};
+  bool showHelp{false};
+};
+
+/**
+ * @brief result handler writing the results to the output files
+ */
+class ReplayOutput : public core::RssLogReplay::ResultHandler
+{
+public:
+  ~ReplayOutput()
+  {
+    close();
+  }
+
+  bool open(ReplayOptions const &options)
+  {
+    if (!options.outputFileName.empty())
+    {
+      mWriterOpen = mWriter.open(options.outputFileName);
+      if (!mWriterOpen)
+      {
+        std::cerr << "Failed to open output file: " << options.outputFileName << "\n";
+        return false;
+      }
+    }
+    if (!options.restrictionsFileName.empty())
+    {
+      mRestrictionsFile = std::fopen(options.restrictionsFileName.c_str(), "w");
+      if (mRestrictionsFile == nullptr)
+      {
+        std::cerr << "Failed to open restrictions file: " << options.restrictionsFileName << "\n";
+        return false;
+      }
+      std::fprintf(mRestrictionsFile,
+                   "tick,timeIndex,result,longitudinalMin,longitudinalMax,lateralLeftMin,lateralLeftMax,"
+                   "lateralRightMin,lateralRightMax,situations,dangerousSituations\n");
+    }
+    return true;
+  }
+
+  bool close()
+  {
+    bool result = mResult;
+    if (mWriterOpen)
+    {
+      result = mWriter.close() && result;
+      mWriterOpen = false;
+    }
+    if (mRestrictionsFile != nullptr)
+    {
+      result = (std::fclose(mRestrictionsFile) == 0) && result;
+      mRestrictionsFile = nullptr;
+    }
+    mResult = true;
+    return result;
+  }
+
+  void handleResult(std::size_t const tickNumber,
+                    world::WorldModel const &worldModel,
+                    bool const result,
+                    world::AccelerationRestriction const &accelerationRestriction,
+                    situation::SituationVector const &situationVector,
+                    state::ResponseStateVector const &responseStateVector) override
+  {
+    if (mWriterOpen)
+    {
+      mResult = mWriter.write(worldModel, situationVector, responseStateVector) && mResult;
+    }
+    if (mRestrictionsFile != nullptr)
+    {
+      std::size_t numberOfDangerousSituations = 0u;
+      for (auto const &responseState : responseStateVector)
+      {
+        if (state::isDangerous(responseState))
+        {
+          numberOfDangerousSituations++;
+        }
+      }
+      std::fprintf(mRestrictionsFile,
+                   "%zu,%llu,%d,%g,%g,%g,%g,%g,%g,%zu,%zu\n",
+                   tickNumber,
+                   static_cast<unsigned long long>(worldModel.timeIndex),
+                   result ? 1 : 0,
+                   static_cast<double>(accelerationRestriction.longitudinalRange.minimum),
+                   static_cast<double>(accelerationRestriction.longitudinalRange.maximum),
+                   static_cast<double>(accelerationRestriction.lateralLeftRange.minimum),
+                   static_cast<double>(accelerationRestriction.lateralLeftRange.maximum),
+                   static_cast<double>(accelerationRestriction.lateralRightRange.minimum),
+                   static_cast<double>(accelerationRestriction.lateralRightRange.maximum),
+                   situationVector.size(),
+                   numberOfDangerousSituations);
+    }
+  }
+
+  bool isActive() const
+  {
+    return mWriterOpen || (mRestrictionsFile != nullptr);
+  }
+
+private:
+  core::RssLogWriter mWriter;
+  bool mWriterOpen{false};
+  std::FILE *mRestrictionsFile{nullptr};
+  bool mResult{true};
+};
+
+bool parseValue(std::string const &text, uint32_t &value)
+{
+  char *end = nullptr;
+  unsigned long const parsedValue = std::strtoul(text.c_str(), &end, 10);
+  if (text.empty() || (*end != '\0') || (parsedValue > std::numeric_limits<uint32_t>::max()))
+  {
+    return false;
+  }
+  value = static_cast<uint32_t>(parsedValue);
+  return true;
+}
+
+void printUsage()
+{
+  std::cout << "Usage: ad-rss-replay [options] <log file>\n"
+            << "  --threads=<n>          number of worker threads used by RssCheck (default: 0)\n"
+            << "  --incremental          enable the incremental evaluation of unchanged scenes\n"
+            << "  --batch                enable the batch evaluation of non-intersection situations\n"
+            << "  --broad-phase          enable the broad-phase culling of far away scenes\n"
+            << "  --lazy                 enable the lazy re-evaluation of situations far from becoming unsafe\n"
+            << "  --read-ahead=<n>       number of ticks decoded ahead by the reader thread (default: 8)\n"
+            << "  --temporal-threads=<n> number of worker threads processing the ticks in parallel (default: 0)\n"
+            << "  --window=<n>           number of ticks per window of the temporal parallel replay (default: 64)\n"
+            << "  --repeat=<n>           number of replays of the log (default: 1)\n"
+            << "  --output=<file>        write the world models, situations and response states to a log\n"
+            << "  --restrictions=<file>  write the acceleration restrictions as CSV\n"
+            << "  --help                 print this message\n";
+}
+
+bool parseOptions(int argc, char *argv[], ReplayOptions &options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const argument(argv[i]);
+    std::size_t const separator = argument.find('=');
+    std::string const key = argument.substr(0u, separator);
+    std::string const value = (separator == std::string::npos) ? std::string() : argument.substr(separator + 1u);
+
+    bool valid = true;
+    if (key == "--threads")
+    {
+      valid = parseValue(value, options.configuration.checkConfiguration.numberOfWorkerThreads);
+    }
+    else if (key == "--incremental")
+    {
+      options.configuration.checkConfiguration.enableIncrementalEvaluation = true;
+    }
+    else if (key == "--batch")
+    {
+      options.configuration.checkConfiguration.enableBatchEvaluation = true;
+    }
+    else if (key == "--broad-phase")
+    {
+      options.configuration.checkConfiguration.enableBroadPhaseCulling = true;
+    }
+    else if (key == "--lazy")
+    {
+      options.configuration.checkConfiguration.enableLazyReevaluation = true;
+    }
+    else if (key == "--read-ahead")
+    {
+      valid = parseValue(value, options.configuration.numberOfReadAheadTicks);
+    }
+    else if (key == "--temporal-threads")
+    {
+      valid = parseValue(value, options.configuration.numberOfTemporalWorkerThreads);
+    }
+    else if (key == "--window")
+    {
+      valid = parseValue(value, options.configuration.temporalWindowSize)
+        && (options.configuration.temporalWindowSize > 0u);
+    }
+    else if (key == "--repeat")
+    {
+      valid = parseValue(value, options.numberOfRepetitions) && (options.numberOfRepetitions > 0u);
+    }
+    else if (key == "--output")
+    {
+      options.outputFileName = value;
+      valid = !value.empty();
+    }
+    else if (key == "--restrictions")
+    {
+      options.restrictionsFileName = value;
+      valid = !value.empty();
+    }
+    else if (key == "--help")
+    {
+      options.showHelp = true;
+    }
+    else if ((argument.compare(0u, 2u, "--") != 0) && options.logFileName.empty())
+    {
+      options.logFileName = argument;
+    }
+    else
+    {
+      valid = false;
+    }
+
+    if (!valid)
+    {
+      std::cerr << "Invalid argument: " << argument << "\n";
+      return false;
+    }
+  }
+  return options.showHelp || !options.logFileName.empty();
+}
+
+void printStatistics(uint32_t const repetition, core::RssLogReplayStatistics const &statistics)
+{
+  std::cout << std::setw(6) << repetition << std::setw(10) << statistics.numberOfTicks << std::setw(8)
+            << statistics.numberOfFailedTicks << std::fixed << std::setprecision(1) << std::setw(14)
+            << statistics.ticksPerSecond << std::setprecision(2) << std::setw(12)
+            << statistics.latencyMeanMicroseconds << std::setw(12) << statistics.latencyP50Microseconds
+            << std::setw(12) << statistics.latencyP90Microseconds << std::setw(12)
+            << statistics.latencyP99Microseconds << std::setw(12) << statistics.latencyMaxMicroseconds << std::endl;
+}
+
+int runReplay(ReplayOptions const &options)
+{
+  core::RssLogReader reader;
+  if (!reader.open(options.logFileName))
+  {
+    std::cerr << "Failed to open log file: " << options.logFileName << "\n";
+    return EXIT_FAILURE;
+  }
+
+  ReplayOutput output;
+  if (!output.open(options))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << std::setw(6) << "run" << std::setw(10) << "ticks" << std::setw(8) << "failed" << std::setw(14)
+            << "ticks/s" << std::setw(12) << "mean us" << std::setw(12) << "p50 us" << std::setw(12) << "p90 us"
+            << std::setw(12) << "p99 us" << std::setw(12) << "max us"
+            << "\n";
+
+  core::RssLogReplay replay(options.configuration);
+  int exitCode = EXIT_SUCCESS;
+  for (uint32_t repetition = 0u; repetition < options.numberOfRepetitions; ++repetition)
+  {
+    core::RssLogReplayStatistics statistics;
+    // the output files are only written by the first replay
+    core::RssLogReplay::ResultHandler *resultHandler = ((repetition == 0u) && output.isActive()) ? &output : nullptr;
+    if (!replay.replay(reader, resultHandler, statistics))
+    {
+      std::cerr << "Failed to replay log file: " << options.logFileName << "\n";
+      return EXIT_FAILURE;
+    }
+    if (repetition == 0u)
+    {
+      if (!output.close())
+      {
+        std::cerr << "Failed to write the output files\n";
+        exitCode = EXIT_FAILURE;
+      }
+    }
+    printStatistics(repetition, statistics);
+    if (statistics.numberOfFailedTicks > 0u)
+    {
+      exitCode = EXIT_FAILURE;
+    }
+  }
+
+  return exitCode;
+}
+
+} // namespace replay
+} // namespace ad_rss
+
+int main(int argc, char *argv[])
+{
+  ::ad_rss::replay::ReplayOptions options;
+  if (!::ad_rss::replay::parseOptions(argc, argv, options))
+  {
+    ::ad_rss::replay::printUsage();
+    return EXIT_FAILURE;
+  }
+  if (options.showHelp)
+  {
+    ::ad_rss::replay::printUsage();
+    return EXIT_SUCCESS;
+  }
+
+  return ::ad_rss::replay::runReplay(options);
+}